@@ -0,0 +1,167 @@
+/**
+  ************************************************************************************
+  * @file              Anim.h
+  * @author         None
+  * @version       V1.1.0
+  * @date            2026-10-17
+  * @brief           压缩动画存储模块头文件
+  *
+  * @details        本文件提供多通道亮度动画的压缩格式与编解码接口：
+  *                        1. 编码：Anim_Encode()，在主机上把逐帧的8位亮度数组编码成可放入Flash的数据
+  *                        2. 解码：Anim_Open() / Anim_Next() / Anim_Rewind()，
+  *                           在目标板上逐帧解码，只占用固定大小的Anim_Decoder，不需要整帧临时缓冲
+  *                        3. 每帧与上一帧按通道做差（模256），差值序列整体做游程编码，
+  *                           游程可以跨帧，长时间不变的画面只占几个字节；
+  *                           缓慢变化的通道差值很小，按半字节打包
+  *                        4. 基准测试：Anim_Benchmark()逐帧计时解码，目标板上由A命令报告
+  *                        命令行用法（定义ANIM_MAIN编译Anim.c得到anim程序）：
+  *                        - anim <逐帧亮度文件> <通道数> <帧间隔微秒> [输出.anim | 输出.c]
+  *                          输入为frames × channels字节的原始帧（如preview -o的输出），
+  *                          编码后先逐帧解码核对，输出.c时生成名为文件名的const数组
+  *
+  * @note            数据格式（小端）：
+  *                        - 0~3    魔数 "ANIM"
+  *                        - 4       版本号ANIM_VERSION
+  *                        - 5       保留，为0
+  *                        - 6~7    通道数
+  *                        - 8~11  帧数
+  *                        - 12~15 帧间隔，单位：微秒
+  *                        - 16~    差值序列的标记流：
+  *                                    0x00~0x3F  后跟 (c+1) 个差值字节（1~64）
+  *                                    0x40~0x7F  后跟 (c&0x3F)+1 字节，每字节两个 -8~7 的差值，先低后高（2~128）
+  *                                    0x80~0xBF  下一字节重复 (c&0x3F)+2 次（2~65）
+  *                                    0xC0~0xFF  连同下一字节组成14位长度n，(n+1) 个通道不变（1~16384）
+  *
+  * @attention     注意事项：
+  *                         1. Anim_Next()在调用者的帧缓冲上原地累加差值，两次调用之间不能改写帧缓冲
+  *                            （可直接用作Matrix_Render() / Ws2812_Show()等的输入）
+  *                         2. Anim_Encode()只在主机上调用，未被调用时Keil按函数分段去除，不占Flash
+  *                         3. 在Project目录下编译anim程序：gcc -DANIM_MAIN -O2 -IApp/Inc App/Src/Anim.c -o anim
+  *
+  *                         修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 增加Anim_Benchmark()和anim编码程序
+  *
+  ************************************************************************************
+  */
+
+#ifndef __ANIM_H
+#define __ANIM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#define ANIM_VERSION                          1U             /* 格式版本 */
+#define ANIM_HEADER_SIZE                    16U           /* 文件头长度，单位：字节 */
+
+/**
+  * @brief   Anim_Next()返回值
+  */
+#define ANIM_OK                                   0U             /* 已输出一帧 */
+#define ANIM_END                                 1U             /* 所有帧已输出，未输出新帧 */
+#define ANIM_ERROR                             2U             /* 数据损坏 */
+
+/**
+  * @brief   解码状态
+  */
+typedef struct
+{
+    const uint8_t *data;                            /* 动画数据起始地址 */
+    const uint8_t *pos;                              /* 当前读取位置 */
+    const uint8_t *end;                              /* 数据结束地址 */
+    uint32_t channels;                                /* 通道数 */
+    uint32_t frames;                                   /* 帧数 */
+    uint32_t frame_us;                                /* 帧间隔，单位：微秒 */
+    uint32_t frame;                                     /* 已输出的帧数 */
+    uint32_t run;                                        /* 当前标记剩余的通道数 */
+    uint8_t mode;                                       /* 当前标记类型 */
+    uint8_t value;                                       /* 重复标记的差值 */
+} Anim_Decoder;
+
+/**
+  * @brief   基准测试结果
+  */
+typedef struct
+{
+    uint32_t frames;                                   /* 每轮解码的帧数 */
+    uint32_t ticks;                                      /* 全部轮次解码的总耗时，单位：时钟计数 */
+    uint32_t frame_max;                              /* 单帧最长耗时，单位：时钟计数 */
+    uint32_t frame_ns;                                /* 平均每帧耗时，单位：纳秒 */
+    uint32_t sum;                                         /* 第一轮各帧全部通道亮度之和，与anim程序输出的值比较 */
+    uint8_t status;                                      /* ANIM_END=全部解码完成，ANIM_ERROR=数据损坏或帧缓冲不足 */
+} Anim_Bench;
+
+/**
+  * @brief           编码后数据的最大长度
+  * @param        channels 通道数
+  * @param        frames 帧数
+  * @retval          字节数（全部为字面量时的长度）
+  */
+uint32_t Anim_Bound(uint32_t channels, uint32_t frames);
+
+/**
+  * @brief           编码动画
+  * @param        levels 逐帧亮度，frames × channels字节，按帧存放
+  * @param        channels 通道数（1 ~ 65535）
+  * @param        frames 帧数
+  * @param        frame_us 帧间隔，单位：微秒
+  * @param        out 输出缓冲
+  * @param        size 输出缓冲大小（不小于Anim_Bound()时一定成功）
+  * @retval          编码后的字节数，0=参数非法或输出缓冲不足
+  */
+uint32_t Anim_Encode(const uint8_t *levels, uint32_t channels, uint32_t frames, uint32_t frame_us,
+                     uint8_t *out, uint32_t size);
+
+/**
+  * @brief           打开动画
+  * @param        dec 解码状态
+  * @param        data 动画数据（通常位于Flash）
+  * @param        size 数据长度，单位：字节
+  * @param        frame 帧缓冲，channels字节，被清零
+  * @retval          0=成功，1=文件头非法
+  */
+uint8_t Anim_Open(Anim_Decoder *dec, const uint8_t *data, uint32_t size, uint8_t *frame);
+
+/**
+  * @brief           回到第一帧之前
+  * @param        dec 解码状态
+  * @param        frame 帧缓冲，被清零
+  * @retval          None
+  * @note           循环播放时在Anim_Next()返回ANIM_END后调用
+  */
+void Anim_Rewind(Anim_Decoder *dec, uint8_t *frame);
+
+/**
+  * @brief           解码下一帧
+  * @param        dec 解码状态
+  * @param        frame 帧缓冲，保存着上一帧，原地更新为下一帧
+  * @retval          ANIM_OK / ANIM_END / ANIM_ERROR
+  * @note           不变的通道只移动指针，耗时与本帧变化的通道数成正比
+  */
+uint8_t Anim_Next(Anim_Decoder *dec, uint8_t *frame);
+
+/**
+  * @brief           逐帧计时解码整段动画
+  * @param        data 动画数据
+  * @param        size 数据长度，单位：字节
+  * @param        frame 帧缓冲
+  * @param        frame_size 帧缓冲大小，小于通道数时不解码，status为ANIM_ERROR
+  * @param        rounds 从第一帧解码到最后一帧的轮数
+  * @param        clock 时钟读取函数（如Delay_Mark，返回递增的计数值）
+  * @param        ticks_per_us 时钟每微秒的计数值（如SystemCoreClock / 1000000）
+  * @param        result 输出测试结果
+  * @retval          None
+  * @note           只计Anim_Next()的耗时（含一次clock()调用），回到第一帧和求和不计入；
+  *                        单次测量不能超过2^32个时钟计数
+  */
+void Anim_Benchmark(const uint8_t *data, uint32_t size, uint8_t *frame, uint32_t frame_size, uint32_t rounds,
+                    uint32_t (*clock)(void), uint32_t ticks_per_us, Anim_Bench *result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __ANIM_H */
@@ -0,0 +1,41 @@
+/**
+  ************************************************************************************
+  * @file              AnimDemo.h
+  * @author         None
+  * @version       V1.0.0
+  * @date            2026-10-17
+  * @brief           示例动画数据头文件
+  *
+  * @details        AnimDemo.c由anim程序从preview渲染的原始帧生成，供A命令测量目标板上的解码耗时：
+  *                        8 × 8通道，正弦缓动关键帧呼吸效果按列错开相位，50帧/秒，共100帧
+  *
+  * @note            在Project目录下重新生成：
+  *                        preview -n 64 -w 8 -f 100 -r 50 -k -o anim_demo.raw
+  *                        anim anim_demo.raw 64 20000 App/Src/AnimDemo.c
+  *                        anim程序输出的sum与A命令应答的sum字段应相同
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *
+  ************************************************************************************
+  */
+
+#ifndef __ANIMDEMO_H
+#define __ANIMDEMO_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#define ANIM_DEMO_CHANNELS               64U           /* 通道数，A命令的帧缓冲按此分配 */
+
+extern const uint8_t AnimDemo[];                /* 编码后的动画数据（位于Flash） */
+extern const uint32_t AnimDemo_Size;         /* 数据长度，单位：字节 */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __ANIMDEMO_H */
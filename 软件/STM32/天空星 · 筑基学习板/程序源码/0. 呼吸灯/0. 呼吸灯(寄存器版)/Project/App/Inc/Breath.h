@@ -0,0 +1,210 @@
+/**
+  ************************************************************************************
+  * @file              Breath.h
+  * @author         None
+  * @version       V1.2.0
+  * @date            2026-10-17
+  * @brief           呼吸灯参数评估与呼吸效果模块头文件
+  *
+  * @details        本文件提供呼吸灯三个调节参数的评估与批量扫描接口：
+  *                        1. 默认参数：BREATH_PWM_CYCLE 等，main.c直接使用
+  *                        2. 单组评估：Breath_Evaluate()，按main.c的主循环（相位累加器亮度 +
+  *                           Delay_Until截止时刻定时）计算各项指标
+  *                        3. 批量扫描：Breath_GridCount() / Breath_SweepRange()
+  *                        4. 帕累托比较：Breath_Dominates()
+  *                        5. 呼吸效果：Breath_Start() / Breath_SetPeriod() / Breath_Tick()，
+  *                           按毫秒周期和亮度范围运行，周期可在运行中修改
+  *
+  * @note            评估最多逐级计算brightness_max + 1个亮度，单组参数耗时为微秒级
+  *                        Breath_SweepRange()只读参数网格、无共享状态，
+  *                        主机上可把下标区间分给多个线程并行扫描
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 增加相位累加器呼吸效果接口
+  *                         - 2026-10-17 V1.2.0 评估改按相位累加器 + Delay_Until模型，调节参数改为PWM周期、亮度最大值和呼吸周期
+  *
+  ************************************************************************************
+  */
+
+#ifndef __BREATH_H
+#define __BREATH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#define BREATH_PWM_CYCLE                   500            /* PWM周期，单位：微秒 */
+#define BREATH_BRIGHTNESS_MAX        255            /* 亮度最大值 */
+#define BREATH_PERIOD_MS                   3825          /* 完整呼吸周期，单位：毫秒 */
+
+#define BREATH_LOOP_CYCLES               120            /* 每个PWM周期循环体的耗时，单位：CPU周期（估计值），
+                                                                                   由Delay_Until的截止时刻吸收，不改变载波周期；
+                                                                                   导通时间短于它时实际脉宽被拉长到它 */
+
+/**
+  * @brief   呼吸灯调节参数
+  */
+typedef struct
+{
+    uint32_t pwm_cycle;                           /* PWM周期，单位：微秒（也是Breath_Tick()的调用间隔） */
+    uint32_t brightness_max;                    /* 亮度最大值（1~65535） */
+    uint32_t period_ms;                            /* 完整呼吸周期，单位：毫秒 */
+} Breath_Params;
+
+/**
+  * @brief   评估指标
+  */
+typedef struct
+{
+    uint32_t period_ms;                            /* 实际完整呼吸周期（Breath_SetPeriod()限幅后），单位：毫秒 */
+    uint32_t carrier_hz;                            /* PWM载波频率，单位：Hz */
+    uint32_t levels;                                   /* 半个呼吸周期中实际出现的不同脉宽数（含熄灭） */
+    uint32_t lost_steps;                            /* 亮度变化但实际脉宽未变的次数 */
+    uint32_t min_step_cycles;                    /* 相邻两级之间最小的非零脉宽变化，单位：CPU周期 */
+    uint32_t overhead_ppm;                      /* 循环体耗时占PWM周期的比例，单位：百万分之一 */
+    uint8_t flicker_risk;                            /* 按IEEE 1789对100%调制深度的分级：0=无影响，1=低风险，2=有风险 */
+} Breath_Metrics;
+
+/**
+  * @brief   参数扫描网格，每个参数取 [min, max] 中间隔为inc的值
+  */
+typedef struct
+{
+    Breath_Params min;                              /* 各参数下限 */
+    Breath_Params max;                             /* 各参数上限 */
+    Breath_Params inc;                              /* 各参数步长（为0按1处理） */
+} Breath_Grid;
+
+/**
+  * @brief   呼吸效果事件（Breath_Tick()之后读取Breath_Effect.event）
+  */
+#define BREATH_EVT_NONE                      0U             /* 无事件 */
+#define BREATH_EVT_PEAK                       1U             /* 本次越过最亮点，开始变暗 */
+#define BREATH_EVT_TROUGH                  2U             /* 本次越过最暗点，开始变亮 */
+
+/**
+  * @brief   呼吸效果状态
+  * @note   相位为32位定点数，2^32对应一个完整呼吸周期；
+  *               每次调用Breath_Tick()相位增加 2^32 × tick_us ÷ period_us，
+  *               其整数部分为inc，小数部分以rem/den的余数形式累计，长期运行周期无偏差
+  */
+typedef struct
+{
+    uint32_t phase;                                   /* 当前相位 */
+    uint32_t inc;                                       /* 每次调用的相位增量（整数部分） */
+    uint32_t rem;                                      /* 小数部分的累计余数 */
+    uint32_t num;                                      /* 小数部分分子 */
+    uint32_t den;                                       /* 小数部分分母 = 周期（微秒） */
+    uint32_t tick_us;                                 /* 两次调用之间的时间，单位：微秒 */
+    uint16_t lo;                                         /* 亮度下限 */
+    uint16_t hi;                                         /* 亮度上限 */
+    uint8_t event;                                     /* 最近一次Breath_Tick()产生的事件 */
+} Breath_Effect;
+
+/**
+  * @brief   扫描回调
+  * @param   index 参数组在网格中的下标
+  */
+typedef void (*Breath_Visit)(uint32_t index, const Breath_Params *params,
+                             const Breath_Metrics *metrics, void *ctx);
+
+/**
+  * @brief           评估一组参数
+  * @param        params 调节参数
+  * @param        core_clock CPU主频，单位：Hz（通常为SystemCoreClock）
+  * @param        metrics 输出评估指标
+  * @retval          0=成功，1=参数非法（任一参数为0、brightness_max超过65535、主频低于1MHz，
+  *                       或brightness × 每PWM周期的CPU周期数超出32位，main.c中的乘法会溢出）
+  * @note           与main.c相同：亮度 = Breath_Tick()（tick_us = pwm_cycle），
+  *                       on_time = brightness × pwm_cycles ÷ brightness_max（CPU周期）；
+  *                       载波周期由Delay_Until截止时刻决定，精确等于pwm_cycle；
+  *                       非零导通时间短于BREATH_LOOP_CYCLES时按BREATH_LOOP_CYCLES计
+  */
+uint8_t Breath_Evaluate(const Breath_Params *params, uint32_t core_clock, Breath_Metrics *metrics);
+
+/**
+  * @brief           网格中的参数组数
+  * @param        grid 参数网格
+  * @retval          参数组数
+  */
+uint32_t Breath_GridCount(const Breath_Grid *grid);
+
+/**
+  * @brief           取网格中第index组参数
+  * @param        grid 参数网格
+  * @param        index 下标（0 ~ Breath_GridCount()-1）
+  * @param        params 输出调节参数
+  * @retval          None
+  */
+void Breath_GridAt(const Breath_Grid *grid, uint32_t index, Breath_Params *params);
+
+/**
+  * @brief           评估网格中连续的一段参数组
+  * @param        grid 参数网格
+  * @param        first 起始下标
+  * @param        count 组数
+  * @param        core_clock CPU主频，单位：Hz
+  * @param        visit 每组参数的回调（非法参数组跳过）
+  * @param        ctx 回调参数
+  * @retval          None
+  * @note           各段之间互不影响，可在多个线程中对不同区间并行调用
+  */
+void Breath_SweepRange(const Breath_Grid *grid, uint32_t first, uint32_t count,
+                       uint32_t core_clock, Breath_Visit visit, void *ctx);
+
+/**
+  * @brief           判断a是否帕累托支配b
+  * @param        a 指标a
+  * @param        b 指标b
+  * @retval          1=a在载波频率、级数、开销三项上都不差于b且至少一项更好
+  */
+uint8_t Breath_Dominates(const Breath_Metrics *a, const Breath_Metrics *b);
+
+/**
+  * @brief           启动呼吸效果
+  * @param        eff 效果状态
+  * @param        period_ms 完整呼吸周期，单位：毫秒
+  * @param        lo 亮度下限
+  * @param        hi 亮度上限
+  * @param        tick_us 两次调用Breath_Tick()之间的时间，单位：微秒（通常为PWM周期）
+  * @retval          None
+  * @note           从最暗点开始
+  */
+void Breath_Start(Breath_Effect *eff, uint32_t period_ms, uint16_t lo, uint16_t hi, uint32_t tick_us);
+
+/**
+  * @brief           运行中修改呼吸周期
+  * @param        eff 效果状态
+  * @param        period_ms 新的完整呼吸周期，单位：毫秒（为0时保持原值）
+  * @retval          None
+  * @note           只改变相位增量、保留当前相位，亮度不会跳变；
+  *                       周期短于2个tick时按2个tick处理（每tick在最暗点和最亮点之间切换）
+  */
+void Breath_SetPeriod(Breath_Effect *eff, uint32_t period_ms);
+
+/**
+  * @brief           运行中修改亮度范围
+  * @param        eff 效果状态
+  * @param        lo 亮度下限
+  * @param        hi 亮度上限
+  * @retval          None
+  */
+void Breath_SetRange(Breath_Effect *eff, uint16_t lo, uint16_t hi);
+
+/**
+  * @brief           推进一个tick并返回当前亮度
+  * @param        eff 效果状态
+  * @retval          当前亮度（lo ~ hi）
+  * @note           三角波：前半周期由lo升到hi，后半周期由hi降到lo；
+  *                        无除法运算，适合在PWM循环或定时器中断中调用
+  */
+uint16_t Breath_Tick(Breath_Effect *eff);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __BREATH_H */
@@ -0,0 +1,141 @@
+/**
+  ************************************************************************************
+  * @file              Cmd.h
+  * @author         None
+  * @version       V1.5.0
+  * @date            2026-10-17
+  * @brief           串口命令解析模块头文件
+  *
+  * @details        本文件提供串口控制命令的流式解析与排队接口：
+  *                        1. Cmd_Feed()的形式与Uart_Sink相同，直接在接收环形缓冲区上逐字节解析，
+  *                           不把一行拷贝到行缓冲区，命令跨两段交付也能正确拼接
+  *                        2. 解析出的命令以Cmd_Msg类型排入队列，由主循环在PWM周期边界取出执行
+  *                        3. Cmd_PutText() / Cmd_PutUint() / Cmd_PutField()拼接应答文本
+  *
+  * @note            命令格式（ASCII，以'\n'、'\r'、';'或空闲线结束，空格忽略）：
+  *                        - L<n>                   固定亮度n
+  *                        - E<ms>[,<lo>,<hi>]  呼吸效果：周期ms毫秒，亮度范围lo~hi（省略时为0~最大值）
+  *                        - S                        查询统计
+  *                        - B[<size>[,<depth>]]  内存池与malloc的基准测试（见Pool_Benchmark()）
+  *                        - A[<rounds>]           示例动画的解码基准测试（见Anim_Benchmark()）
+  *                        - D[<count>[,<rounds>]] DDS标量与SIMD实现的基准测试（见Dds_Benchmark()）
+  *                        无法识别或参数个数不对的命令排入CMD_BAD
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 增加Cmd_PutUint()
+  *                         - 2026-10-17 V1.2.0 增加B命令
+  *                         - 2026-10-17 V1.3.0 增加A命令
+  *                         - 2026-10-17 V1.4.0 增加D命令
+  *                         - 2026-10-17 V1.5.0 增加CMD_FIELD_MAX()，供编译期检查应答缓冲区大小
+  *
+  ************************************************************************************
+  */
+
+#ifndef __CMD_H
+#define __CMD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#define CMD_QUEUE_SIZE                     8U             /* 命令队列长度（2的幂） */
+#define CMD_MAX_ARGS                         3U             /* 每条命令最多的参数个数 */
+
+/* Cmd_PutField()写入的最大字节数，name为字符串常量，可用于常量表达式 */
+#define CMD_FIELD_MAX(name)                (sizeof(name) - 1U + 12U)
+
+/**
+  * @brief   命令类型
+  */
+#define CMD_NONE                                0U             /* 空行 */
+#define CMD_LEVEL                               1U             /* 固定亮度：arg[0]=亮度 */
+#define CMD_EFFECT                             2U             /* 呼吸效果：arg[0]=周期(ms)，arg[1]/arg[2]=亮度范围 */
+#define CMD_STATS                               3U             /* 查询统计 */
+#define CMD_BAD                                  4U             /* 无法解析 */
+#define CMD_BENCH                              5U             /* 内存池基准测试：arg[0]=块字节数，arg[1]=每轮块数（可省略） */
+#define CMD_ANIM                                6U             /* 动画解码基准测试：arg[0]=轮数（可省略） */
+#define CMD_DDS                                  7U             /* DDS基准测试：arg[0]=通道数，arg[1]=轮数（可省略） */
+
+/**
+  * @brief   一条已解析的命令
+  */
+typedef struct
+{
+    uint8_t type;                                       /* 命令类型 */
+    uint8_t argc;                                       /* 参数个数 */
+    uint32_t arg[CMD_MAX_ARGS];               /* 参数 */
+} Cmd_Msg;
+
+/**
+  * @brief   解析器状态与命令队列
+  */
+typedef struct
+{
+    Cmd_Msg cur;                                       /* 正在解析的命令 */
+    uint8_t digits;                                     /* 当前参数已读入的数字个数 */
+    uint8_t bad;                                         /* 当前命令已出错 */
+    Cmd_Msg queue[CMD_QUEUE_SIZE];        /* 命令队列 */
+    uint8_t head;                                       /* 写位置 */
+    uint8_t tail;                                         /* 读位置 */
+    uint32_t dropped;                                /* 队列满时丢弃的命令数 */
+} Cmd_Parser;
+
+/**
+  * @brief           初始化解析器
+  * @param        p 解析器
+  * @retval          None
+  */
+void Cmd_Init(Cmd_Parser *p);
+
+/**
+  * @brief           解析一段接收数据
+  * @param        ctx 解析器（Cmd_Parser *）
+  * @param        data 数据（只读，不保留指针）
+  * @param        len 字节数
+  * @param        idle 1=本段之后线路空闲，结束当前命令
+  * @retval          None
+  * @note           可直接作为Uart_Poll()的回调
+  */
+void Cmd_Feed(void *ctx, const uint8_t *data, uint32_t len, uint8_t idle);
+
+/**
+  * @brief           取出一条命令
+  * @param        p 解析器
+  * @param        msg 输出命令
+  * @retval          1=取到，0=队列为空
+  */
+uint8_t Cmd_Take(Cmd_Parser *p, Cmd_Msg *msg);
+
+/**
+  * @brief           追加一段文本
+  * @param        dst 写入位置
+  * @param        text 以'\0'结尾的文本
+  * @retval          写入的字节数（不含'\0'，不写'\0'）
+  */
+uint32_t Cmd_PutText(char *dst, const char *text);
+
+/**
+  * @brief           追加十进制数
+  * @param        dst 写入位置
+  * @param        value 数值
+  * @retval          写入的字节数（1~10，不写'\0'）
+  */
+uint32_t Cmd_PutUint(char *dst, uint32_t value);
+
+/**
+  * @brief           追加 "name=value "
+  * @param        dst 写入位置
+  * @param        name 字段名
+  * @param        value 十进制输出的数值
+  * @retval          写入的字节数（最多为 strlen(name) + 12）
+  */
+uint32_t Cmd_PutField(char *dst, const char *name, uint32_t value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __CMD_H */
@@ -0,0 +1,120 @@
+/**
+  ************************************************************************************
+  * @file              Dds.h
+  * @author         None
+  * @version       V1.1.1
+  * @date            2026-10-17
+  * @brief           多通道DDS波形发生模块头文件
+  *
+  * @details        本文件提供基于直接数字频率合成（DDS）的多通道亮度波形接口：
+  *                        1. 每通道一个32位相位累加器和32位频率字
+  *                        2. 相位高8位查表、其后15位做线性插值，输出Q15亮度（0-32767）
+  *                        3. Dds_Update()用双16位SIMD指令每次处理两个通道，
+  *                           Dds_UpdateScalar()为逐通道的参考实现，两者结果逐位一致
+  *                        4. Dds_Benchmark()测量两种实现每微秒处理的通道数，在板上经串口D命令运行（见Cmd.h）
+  *
+  * @note            通道状态按数组结构（SoA）存放：phase[] / freq[] / offset[] / out[]
+  *                        offset[]和out[]为int16_t数组，SIMD实现每次读写两个通道的打包字，
+  *                        须4字节对齐：静态数组用DDS_ALIGN4声明，动态分配时用Pool/Arena（均按4字节以上对齐）；
+  *                        Dds_Update()检测到未对齐时退回Dds_UpdateScalar()
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 增加DDS_ALIGN4，明确offset[]/out[]的对齐要求
+  *                         - 2026-10-17 V1.1.1 注明板上的D命令
+  *
+  ************************************************************************************
+  */
+
+#ifndef __DDS_H
+#define __DDS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#define DDS_TABLE_BITS                        8U             /* 查找表地址位数 */
+#define DDS_TABLE_SIZE                        (1U << DDS_TABLE_BITS)
+#define DDS_FRAC_BITS                         15U           /* 插值系数位数 */
+
+/* 4字节对齐声明，用于offset[]/out[]静态数组，如：static DDS_ALIGN4 int16_t out[64]; */
+#if defined(__CC_ARM)
+#define DDS_ALIGN4                               __align(4)
+#else
+#define DDS_ALIGN4                               __attribute__((aligned(4)))
+#endif
+
+/**
+  * @brief   默认波形表：升余弦 (1 - cos) / 2，Q15，共DDS_TABLE_SIZE + 1项（末项等于首项）
+  */
+extern const int16_t Dds_RaisedCosine[DDS_TABLE_SIZE + 1];
+
+/**
+  * @brief   通道组（各数组由调用者分配，长度均为count）
+  */
+typedef struct
+{
+    uint32_t *phase;                                 /* 相位累加器 */
+    uint32_t *freq;                                   /* 频率字：每次更新的相位增量 */
+    int16_t *offset;                                 /* 输出偏移（叠加在插值结果上，不饱和），4字节对齐 */
+    int16_t *out;                                      /* 输出亮度，4字节对齐 */
+    const int16_t *table;                          /* 波形表（DDS_TABLE_SIZE + 1项，取值0-32767） */
+    uint32_t count;                                   /* 通道数 */
+} Dds_Bank;
+
+/**
+  * @brief   基准测试结果
+  */
+typedef struct
+{
+    uint32_t scalar_ticks;                          /* 标量实现耗时，单位：时钟计数 */
+    uint32_t simd_ticks;                             /* SIMD实现耗时，单位：时钟计数 */
+    uint32_t scalar_ch_per_us;                   /* 标量实现每微秒处理的通道数（×1000） */
+    uint32_t simd_ch_per_us;                      /* SIMD实现每微秒处理的通道数（×1000） */
+    uint8_t match;                                     /* 两种实现输出是否逐位一致 */
+} Dds_Bench;
+
+/**
+  * @brief           由频率计算频率字
+  * @param        freq_mhz 输出频率，单位：毫赫兹（mHz）
+  * @param        update_hz 调用Dds_Update()的频率，单位：Hz
+  * @retval          频率字 = freq × 2^32 ÷ update_hz
+  */
+uint32_t Dds_FreqWord(uint32_t freq_mhz, uint32_t update_hz);
+
+/**
+  * @brief           更新全部通道（SIMD实现）
+  * @param        bank 通道组
+  * @retval          None
+  * @note           每次循环处理两个通道；通道数为奇数时最后一个通道按标量处理；
+  *                       offset或out未4字节对齐时整组按标量处理
+  */
+void Dds_Update(const Dds_Bank *bank);
+
+/**
+  * @brief           更新全部通道（标量参考实现）
+  * @param        bank 通道组
+  * @retval          None
+  */
+void Dds_UpdateScalar(const Dds_Bank *bank);
+
+/**
+  * @brief           比较两种实现的速度并校验结果
+  * @param        bank 通道组（相位会被修改）
+  * @param        rounds 每种实现的更新轮数
+  * @param        clock 时钟读取函数（如Delay_Mark，返回递增的计数值）
+  * @param        ticks_per_us 时钟每微秒的计数值（如SystemCoreClock / 1000000）
+  * @param        result 输出测试结果
+  * @retval          None
+  * @note           校验时临时占用out[]，结束后out[]为SIMD实现的最后一轮输出
+  */
+void Dds_Benchmark(const Dds_Bank *bank, uint32_t rounds, uint32_t (*clock)(void),
+                   uint32_t ticks_per_us, Dds_Bench *result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __DDS_H */
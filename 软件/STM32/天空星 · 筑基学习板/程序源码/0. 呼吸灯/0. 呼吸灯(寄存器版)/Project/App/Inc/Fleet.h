@@ -0,0 +1,209 @@
+/**
+  ************************************************************************************
+  * @file              Fleet.h
+  * @author         None
+  * @version       V2.1.0
+  * @date            2026-10-17
+  * @brief           多板晶振偏差仿真模块头文件
+  *
+  * @details        本文件提供多块虚拟板同时运行呼吸固件的仿真接口：
+  *                        1. 每块板有独立的RegSim上下文（寄存器、DWT和虚拟时钟），
+  *                           板上运行与main.c相同的软件PWM主循环（LED_Init、Breath_Tick、Delay_Until）
+  *                        2. 板的CPU时钟 = 实际HSE频率 × FLEET_PLL_MUL，HSE频率误差（ppb）由种子生成，
+  *                           固件仍按标称SystemCoreClock计算PWM周期，频率误差因此表现为相位漂移
+  *                        3. 按参考时间推进全部或一段板，统计相位离散度和总tick数
+  *                        4. Fleet_Run()：工作窃取线程池，按轮推进，统计吞吐量（板tick数 ÷ 墙钟秒）
+  *                        5. 同步仿真：0号板为主板，其余板运行PhaseLock，每轮结束时处理主板的同步脉冲
+  *
+  * @note            主机端模块，须与RegSim、LED、Delay、Breath、PhaseLock一起编译（-DREG_SIM -pthread）
+  *                        各板之间无共享状态，结果与线程数和窃取顺序无关
+  *
+  * @attention     注意事项：
+  *                         1. 主机端模块，不加入Keil工程
+  *                         2. 每块板的Delay_Until按FLEET_POLL_CYCLES一次轮询CYCCNT，
+  *                            仿真开销约为 PWM周期的CPU周期数 ÷ FLEET_POLL_CYCLES 次寄存器访问/tick
+  *
+  *                         修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 增加主从相位同步仿真
+  *                         - 2026-10-17 V2.0.0 每块板改为独立RegSim上下文运行固件主循环，CPU时钟由HSE频率决定；
+  *                                                        增加工作窃取线程池和吞吐量统计
+  *                         - 2026-10-17 V2.1.0 增加Fleet_SetPhase()
+  *
+  ************************************************************************************
+  */
+
+#ifndef __FLEET_H
+#define __FLEET_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "Breath.h"
+#include "PhaseLock.h"
+#include "RegSim.h"
+
+#define FLEET_HSE_NOMINAL                  8000000U     /* 晶振标称频率，单位：Hz（与HSE_VALUE一致） */
+#define FLEET_PLL_MUL                         21U             /* SYSCLK = HSE ÷ 8 × 336 ÷ 2 = HSE × 21（168MHz） */
+#define FLEET_PPB                                 1000000000U /* 十亿分之一的分母 */
+#define FLEET_POLL_CYCLES                   6U             /* Delay_Until轮询一次CYCCNT的周期数（LDR + SUB + CMP + 跳转） */
+#define FLEET_THREADS_MAX                   64U           /* Fleet_Run()最多线程数 */
+
+/**
+  * @brief   虚拟板
+  */
+typedef struct
+{
+    RegSim_Context *sim;                            /* 本板的寄存器和虚拟时钟 */
+    Breath_Effect eff;                                /* 呼吸效果 */
+    int32_t ppb;                                        /* 晶振频率误差，单位：十亿分之一 */
+    uint64_t hse_millihz;                          /* 实际晶振频率，单位：毫赫（1ppb = 8mHz，无舍入） */
+    uint64_t acc;                                       /* 参考时间换算为本板周期的余数，单位：周期 × 10^9 */
+    uint64_t cycles;                                   /* 已经过的参考时间对应的本板CPU周期数 */
+    uint64_t due;                                       /* 下一个PWM周期结束的本板时刻（CPU周期） */
+    uint32_t mark;                                     /* 主循环的Delay_Until截止时刻（CYCCNT） */
+    uint32_t ticks;                                     /* 已执行的Breath_Tick()次数 */
+    uint16_t level;                                     /* 当前亮度 */
+} Fleet_Board;
+
+/**
+  * @brief   板组
+  */
+typedef struct
+{
+    Fleet_Board *boards;                            /* 板数组（由调用者分配） */
+    PhaseLock *locks;                                 /* 各板的锁相环（同步仿真时有效，否则为NULL） */
+    uint32_t count;                                     /* 板数 */
+    uint32_t tick_us;                                  /* 各板Breath_Tick()的标称间隔，单位：微秒 */
+    uint32_t period_ms;                              /* 标称呼吸周期，单位：毫秒 */
+    uint32_t pwm_cycles;                            /* 固件按标称主频算出的PWM周期，单位：CPU周期 */
+} Fleet;
+
+/**
+  * @brief   离散度统计
+  */
+typedef struct
+{
+    uint32_t spread_us;                              /* 最超前与最滞后两块板的相位差，单位：微秒 */
+    int32_t lead;                                        /* 最超前的板号 */
+    int32_t lag;                                          /* 最滞后的板号 */
+    uint64_t ticks;                                      /* 全部板的tick总数 */
+} Fleet_Stats;
+
+/**
+  * @brief   线程池运行统计
+  */
+typedef struct
+{
+    uint64_t ticks;                                      /* 本次运行全部板执行的tick数 */
+    uint64_t steals;                                     /* 窃取次数 */
+    uint32_t threads;                                   /* 实际线程数 */
+    double seconds;                                    /* 墙钟耗时，单位：秒 */
+    double ticks_per_sec;                            /* 吞吐量：板tick数 ÷ 墙钟秒 */
+} Fleet_RunStats;
+
+/**
+  * @brief           初始化板组
+  * @param        fleet 板组
+  * @param        boards 板数组
+  * @param        count 板数
+  * @param        seed 随机种子
+  * @param        spread_ppb 频率误差范围，各板在 [-spread_ppb, +spread_ppb] 内均匀分布
+  * @param        period_ms 呼吸周期，单位：毫秒
+  * @param        tick_us Breath_Tick()间隔，单位：微秒
+  * @retval          0=成功，1=内存不足（已创建的上下文已释放）
+  * @note           各板的频率误差只由seed和板号决定，与初始化顺序无关；
+  *                        每块板新建一个RegSim上下文并执行固件初始化（LED_Init、Delay_Mark）
+  */
+uint8_t Fleet_Init(Fleet *fleet, Fleet_Board *boards, uint32_t count, uint32_t seed,
+                   uint32_t spread_ppb, uint32_t period_ms, uint32_t tick_us);
+
+/**
+  * @brief           释放各板的RegSim上下文
+  * @param        fleet 板组
+  * @retval          None
+  */
+void Fleet_Free(Fleet *fleet);
+
+/**
+  * @brief           设置单块板的频率误差
+  * @param        fleet 板组
+  * @param        index 板号
+  * @param        ppb 频率误差，单位：十亿分之一
+  * @retval          None
+  * @note           只影响之后推进的时间
+  */
+void Fleet_SetPpb(Fleet *fleet, uint32_t index, int32_t ppb);
+
+/**
+  * @brief           设置单块板的呼吸相位
+  * @param        fleet 板组
+  * @param        index 板号
+  * @param        phase 相位，2^32对应一个呼吸周期
+  * @retval          None
+  * @note           Fleet_Init()后各板都从相位0开始，同步仿真用它模拟各板上电时刻不同
+  */
+void Fleet_SetPhase(Fleet *fleet, uint32_t index, uint32_t phase);
+
+/**
+  * @brief           把一段板推进一段参考时间
+  * @param        fleet 板组
+  * @param        first 起始板号
+  * @param        count 板数
+  * @param        step_us 参考时间，单位：微秒
+  * @retval          None
+  * @note           只修改这段板自身的状态，可在多个线程中对不同区间并行调用；
+  *                        调用线程的RegSim上下文选择在返回时恢复
+  */
+void Fleet_StepRange(Fleet *fleet, uint32_t first, uint32_t count, uint32_t step_us);
+
+/**
+  * @brief           把全部板推进一段参考时间
+  * @param        fleet 板组
+  * @param        step_us 参考时间，单位：微秒
+  * @retval          None
+  */
+void Fleet_Step(Fleet *fleet, uint32_t step_us);
+
+/**
+  * @brief           带相位同步地推进全部板
+  * @param        fleet 板组
+  * @param        locks 各板的锁相环（0号板的不使用），须已调用PhaseLock_Init()
+  * @param        step_us 参考时间，单位：微秒（小于半个呼吸周期，通常为tick_us）
+  * @retval          None
+  * @note           0号板在本步内经过最暗点时，其余板在步末捕获相位，
+  *                        从板在之后每个tick的主循环中调用PhaseLock_Update()；捕获时刻的误差不超过一步
+  */
+void Fleet_StepLocked(Fleet *fleet, PhaseLock *locks, uint32_t step_us);
+
+/**
+  * @brief           用工作窃取线程池推进全部板
+  * @param        fleet 板组
+  * @param        locks 锁相环数组（同Fleet_StepLocked()），为NULL时各板自由运行
+  * @param        threads 线程数（1 ~ FLEET_THREADS_MAX，调用线程算作其中一个）
+  * @param        epochs 轮数
+  * @param        epoch_us 每轮的参考时间，单位：微秒（同步仿真时小于半个呼吸周期）
+  * @param        stats 输出统计（可为NULL）
+  * @retval          0=成功，1=参数非法或线程创建失败
+  * @note           每轮开始时板号按线程均分，线程做完自己的区间后从其他线程的区间尾部窃取一半；
+  *                        轮与轮之间处理同步脉冲。结果与Fleet_StepLocked()/Fleet_Step()逐轮调用相同
+  */
+uint8_t Fleet_Run(Fleet *fleet, PhaseLock *locks, uint32_t threads, uint32_t epochs, uint32_t epoch_us,
+                  Fleet_RunStats *stats);
+
+/**
+  * @brief           统计相位离散度
+  * @param        fleet 板组
+  * @param        stats 输出统计
+  * @retval          None
+  * @note           以0号板为基准比较相位，离散度须小于半个呼吸周期
+  */
+void Fleet_Measure(const Fleet *fleet, Fleet_Stats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __FLEET_H */
@@ -0,0 +1,154 @@
+/**
+  ************************************************************************************
+  * @file              Flicker.h
+  * @author         None
+  * @version       V1.1.1
+  * @date            2026-10-17
+  * @brief           闪烁与平滑度指标分析模块头文件
+  *
+  * @details        本文件提供对单通道引脚边沿序列的流式分析接口：
+  *                        1. 百分比闪烁与闪烁指数（按分析窗口统计）
+  *                        2. 载波抖动（相邻上升沿间隔的均方根与峰峰值）
+  *                        3. 占空比误差（相对Flicker_SetTarget()给出的目标亮度）
+  *                        4. 亮度阶跃可见性（gamma模型下相邻周期感知亮度的变化）
+  *                        边沿可来自Trace模块，也可来自逻辑分析仪导出的CSV
+  *
+  * @note            分析状态为固定大小的结构体，内存占用与跟踪长度无关
+  *                        时间单位由调用者决定（如CPU周期或纳秒），配置中给出每秒的单位数
+  *                        主机端分析模块（用到libm），不加入Keil工程
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 CSV时间支持负数和指数形式，输出改为有符号数
+  *                         - 2026-10-17 V1.1.1 零长度周期并入当前周期；由hostcheck flicker检查
+  *
+  ************************************************************************************
+  */
+
+#ifndef __FLICKER_H
+#define __FLICKER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/**
+  * @brief   分析配置
+  */
+typedef struct
+{
+    uint64_t units_per_sec;                     /* 每秒的时间单位数，如168000000（CPU周期） */
+    uint64_t window;                                /* 闪烁统计窗口长度，单位同时间，0表示1秒 */
+    float gamma;                                      /* 感知亮度 = 占空比^(1/gamma)，0表示2.2 */
+    float visible_step;                            /* 可见阶跃阈值（感知亮度，0-1），0表示0.01 */
+} Flicker_Config;
+
+/**
+  * @brief   分析状态（调用者分配，内容视为私有）
+  */
+typedef struct
+{
+    Flicker_Config cfg;
+    uint8_t level;                                     /* 当前电平 */
+    uint8_t started;                                  /* 是否已收到上升沿 */
+    uint64_t last_rise;                              /* 最近上升沿时间 */
+    uint64_t high_in_period;                     /* 当前周期内点亮时间 */
+    uint64_t last_edge;                             /* 最近边沿时间 */
+    uint32_t target_ppm;                           /* 目标占空比 */
+    /* 窗口统计 */
+    uint64_t win_start;
+    uint64_t win_high;
+    uint8_t win_levels;                             /* bit0=出现过熄灭，bit1=出现过点亮 */
+    uint32_t windows;
+    float fi_sum;
+    float fi_max;
+    float pf_sum;
+    /* 周期统计（Welford在线均值/方差） */
+    uint32_t periods;
+    double period_mean;
+    double period_m2;
+    uint64_t period_min;
+    uint64_t period_max;
+    double duty_err_sum;
+    uint32_t duty_err_max;
+    float last_perceived;
+    float step_max;
+    uint32_t visible_steps;
+} Flicker_State;
+
+/**
+  * @brief   分析结果
+  */
+typedef struct
+{
+    float percent_flicker;                         /* 各窗口百分比闪烁的平均值，单位：% */
+    float flicker_index;                            /* 各窗口闪烁指数的平均值（0-1） */
+    float flicker_index_max;                   /* 闪烁指数最大值 */
+    float carrier_hz;                                /* 平均载波频率 */
+    float jitter_rms;                                 /* 载波周期均方根抖动，单位同时间 */
+    uint64_t jitter_pp;                              /* 载波周期峰峰值抖动，单位同时间 */
+    uint32_t duty_err_mean_ppm;           /* 平均占空比误差，单位：百万分之一 */
+    uint32_t duty_err_max_ppm;             /* 最大占空比误差，单位：百万分之一 */
+    float step_max;                                  /* 相邻周期感知亮度的最大变化 */
+    uint32_t visible_steps;                       /* 超过可见阈值的阶跃次数 */
+    uint32_t periods;                                 /* 完整PWM周期数 */
+} Flicker_Metrics;
+
+/**
+  * @brief           初始化分析状态
+  * @param        st 分析状态
+  * @param        cfg 分析配置
+  * @retval          None
+  */
+void Flicker_Init(Flicker_State *st, const Flicker_Config *cfg);
+
+/**
+  * @brief           设置当前的目标亮度
+  * @param        st 分析状态
+  * @param        duty_ppm 目标占空比，单位：百万分之一
+  * @retval          None
+  * @note           之后完成的周期都与该值比较
+  */
+void Flicker_SetTarget(Flicker_State *st, uint32_t duty_ppm);
+
+/**
+  * @brief           输入一个边沿
+  * @param        st 分析状态
+  * @param        time 边沿时间（单调不减）
+  * @param        level 1=点亮，0=熄灭
+  * @retval          None
+  * @note           与当前电平相同的边沿被忽略；与上一个上升沿同一时刻的上升沿（其间的熄灭为零宽）不结束周期
+  */
+void Flicker_Edge(Flicker_State *st, uint64_t time, uint8_t level);
+
+/**
+  * @brief           取得当前的分析结果
+  * @param        st 分析状态
+  * @param        m 输出分析结果
+  * @retval          None
+  * @note           只统计已结束的窗口和周期，可在分析过程中随时调用
+  */
+void Flicker_Result(const Flicker_State *st, Flicker_Metrics *m);
+
+/**
+  * @brief           解析逻辑分析仪导出的一行CSV
+  * @param        line 一行文本，格式为"时间(秒),电平[,...]"，如"0.000125,1"
+  * @param        units_per_sec 每秒的时间单位数
+  * @param        time 输出时间，单位同units_per_sec，四舍五入到整数
+  * @param        level 输出电平
+  * @retval          1=解析成功，0=表头或格式错误
+  * @note           时间格式：[+|-]数字[.数字][e|E[+|-]数字]，如"0.000125"、"-2.5e-6"、"1E3"，
+  *                       前后可有空格；超过18位的有效数字被舍去，换算后绝对值超过约9.2e18时返回0
+  *                       逻辑分析仪以触发点为0，触发前的边沿时间为负；
+  *                       Flicker_Edge()的时间为无符号数，调用者应减去第一行的时间后再输入
+  *                       只取第一列数据通道，不依赖标准库
+  */
+uint8_t Flicker_ParseCsv(const char *line, uint64_t units_per_sec, int64_t *time, uint8_t *level);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __FLICKER_H */
@@ -0,0 +1,87 @@
+/**
+  ************************************************************************************
+  * @file              HostCheck.h
+  * @author         None
+  * @version       V1.11.0
+  * @date            2026-10-17
+  * @brief           主机端驱动检查程序头文件
+  *
+  * @details        本文件提供在RegSim + SimPeriph上运行驱动代码的检查项：
+  *                        1. 每个检查项独立复位仿真层并挂接所需的外设模型，结果与期望不符时返回1
+  *                        2. 检查项按名称选择，all依次运行全部检查项
+  *                        3. 检查项说明见HostCheck.c文件头，hostcheck list列出名称和参数
+  *                        命令行用法（定义HOSTCHECK_MAIN编译本文件得到hostcheck程序）：
+  *                        - hostcheck list                 列出检查项
+  *                        - hostcheck <名称> [参数...]   运行一个检查项
+  *                        - hostcheck all                   运行全部检查项（使用默认参数）
+  *
+  * @note            在Project目录下编译（-no-pie使静态缓冲区地址在32位范围内，DMA模型可直接访问）：
+  *                        gcc -DREG_SIM -DSTM32F40_41xxx -DHOSTCHECK_MAIN -DTRACE_ENABLE -no-pie -O2
+  *                            -IApp/Inc -IDriver/Inc -IFirmware/StartUp
+  *                            App/Src/HostCheck.c Driver/Src/RegSim.c Driver/Src/SimPeriph.c
+  *                            Driver/Src/LED.c Driver/Src/Delay.c Driver/Src/Device.c Driver/Src/SyncPin.c
+  *                            Driver/Src/Indicator.c Driver/Src/Ws2812.c Driver/Src/Matrix.c
+  *                            Driver/Src/Charlie.c Driver/Src/Shift595.c Driver/Src/Uart.c App/Src/Cmd.c
+  *                            App/Src/Fleet.c
+  *                            App/Src/Breath.c App/Src/PhaseLock.c Driver/Src/Trace.c App/Src/Flicker.c
+  *                            App/Src/PwmStagger.c App/Src/Anim.c App/Src/AnimDemo.c Driver/Src/Pool.c
+  *                            Driver/Src/Arena.c App/Src/MapSize.c -DARENA_POISON=1
+  *                            -pthread -lm -o hostcheck
+  *                        trace检查项读取HostData/下的黄金跟踪，mapsize检查项读取HostData/MapSize/下的夹具，
+  *                        须在Project目录下运行
+  *                        按全部型号宏编译并运行：sh HostMatrix.sh（见HostMatrix.sh）
+  *
+  * @attention     注意事项：
+  *                         1. 主机端程序，不加入Keil工程
+  *                         2. 期望值按F407（SystemCoreClock = 168MHz，APB1 ÷ 4，APB2 ÷ 2）给出
+  *
+  *                         修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 编译命令加入Fleet、Breath、PhaseLock和-pthread（fleet检查项）
+  *                         - 2026-10-17 V1.2.0 编译命令加入Shift595（shift595检查项）
+  *                         - 2026-10-17 V1.3.0 编译命令加入Cmd（uart检查项）
+  *                         - 2026-10-17 V1.4.0 增加device检查项和型号编译矩阵HostMatrix.sh
+  *                         - 2026-10-17 V1.5.0 编译命令加入Trace和-DTRACE_ENABLE（trace检查项）
+  *                         - 2026-10-17 V1.6.0 编译命令加入Flicker和-lm（flicker检查项）
+  *                         - 2026-10-17 V1.7.0 编译命令加入PwmStagger（pwmstagger检查项）
+  *                         - 2026-10-17 V1.8.0 编译命令加入Anim和AnimDemo（anim检查项）
+  *                         - 2026-10-17 V1.9.0 编译命令加入Pool（pool检查项）
+  *                         - 2026-10-17 V1.10.0 编译命令加入Arena和-DARENA_POISON=1（arena检查项）
+  *                         - 2026-10-17 V1.11.0 编译命令加入MapSize（mapsize检查项）
+  *
+  ************************************************************************************
+  */
+
+#ifndef __HOSTCHECK_H
+#define __HOSTCHECK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/**
+  * @brief   检查项
+  * @note   run返回0=通过，1=失败，2=参数错误
+  */
+typedef struct
+{
+    const char *name;                                               /* 名称 */
+    int (*run)(int argc, char **argv);                          /* 入口，argv[0]为检查项名称 */
+    const char *help;                                                 /* 说明 */
+} HostCheck_Item;
+
+/**
+  * @brief           按名称运行检查项
+  * @param        argc 参数个数
+  * @param        argv 参数，argv[1]为检查项名称
+  * @retval          0=全部通过，1=有检查项失败，2=参数错误
+  */
+int HostCheck_Main(int argc, char **argv);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __HOSTCHECK_H */
@@ -0,0 +1,170 @@
+/**
+  ************************************************************************************
+  * @file              Key.h
+  * @author         None
+  * @version       V1.2.0
+  * @date            2026-10-17
+  * @brief           关键帧动画引擎头文件
+  *
+  * @details        本文件提供多通道关键帧插值接口：
+  *                        1. 每个通道引用一张 (时刻, 亮度, 缓动曲线) 关键帧表，可循环播放
+  *                        2. 缓动曲线为Q16定点函数：线性、二次、三次、正弦（查Dds_RaisedCosine表）
+  *                        3. 每段的进度增量du在关键帧表中预先算好（Key_Prepare()或KEY_DU()），
+  *                           进入一段时只复制起点亮度、变化量和du，
+  *                           之后每tick只做一次加法、一次曲线计算和一次乘法，不做除法
+  *                        4. Key_Engine只遍历仍在播放的通道，播放结束的通道从活动表中移除
+  *
+  * @note            时刻单位为tick（两次Key_Tick()/Key_EngineTick()之间的时间，通常为PWM周期）
+  *                        除法只出现在Key_Prepare()（生成关键帧表时）和Key_Seek()（循环取模）中，
+  *                        段边界上没有除法
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 增加Key_BreathFrames()，固件与主机预览共用
+  *                         - 2026-10-17 V1.2.0 每段的进度增量存入Key_Frame.du，进入一段时不再做除法；增加Key_Prepare()和KEY_DU()
+  *
+  ************************************************************************************
+  */
+
+#ifndef __KEY_H
+#define __KEY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/**
+  * @brief   缓动曲线（作用于从该关键帧到下一关键帧的一段）
+  */
+#define KEY_EASE_LINEAR                     0U             /* 线性 */
+#define KEY_EASE_QUAD                        1U             /* 二次，两端缓入缓出 */
+#define KEY_EASE_CUBIC                       2U             /* 三次，两端缓入缓出 */
+#define KEY_EASE_SINE                         3U             /* 正弦 (1 - cos(πx)) / 2 */
+#define KEY_EASE_STEP                         4U             /* 保持起点亮度，段末跳变 */
+
+/**
+  * @brief   关键帧
+  */
+typedef struct
+{
+    uint32_t time;                                     /* 时刻，单位：tick，自通道开始计（非递减） */
+    uint16_t level;                                     /* 亮度 */
+    uint8_t ease;                                       /* 到下一关键帧的缓动曲线 */
+    uint32_t du;                                        /* 到下一关键帧每tick的进度增量，Q32（Key_Prepare()或KEY_DU()填写） */
+} Key_Frame;
+
+/**
+  * @brief   长度为dur个tick的一段的进度增量，用于const关键帧表的初始化
+  * @note   如：{ 0, 0, KEY_EASE_SINE, KEY_DU(400) }, { 400, 255, KEY_EASE_LINEAR, 0 }
+  */
+#define KEY_DU(dur)                             (((dur) > 0U) ? 0xFFFFFFFFU / (uint32_t)(dur) : 0U)
+
+/**
+  * @brief   通道状态
+  */
+typedef struct
+{
+    const Key_Frame *keys;                       /* 关键帧表 */
+    uint16_t count;                                   /* 关键帧数 */
+    uint16_t seg;                                       /* 当前段的起点关键帧下标 */
+    uint32_t t;                                           /* 当前段内已走过的tick数 */
+    uint32_t dur;                                       /* 当前段长度，单位：tick */
+    uint32_t u;                                          /* 当前段进度，Q32 */
+    uint32_t du;                                        /* 每tick的进度增量，Q32 */
+    int32_t span;                                       /* 当前段亮度变化量 */
+    uint16_t from;                                     /* 当前段起点亮度 */
+    uint16_t level;                                     /* 当前亮度 */
+    uint8_t ease;                                       /* 当前段缓动曲线 */
+    uint8_t loop;                                       /* 1=最后一个关键帧后回到第一个 */
+    uint8_t done;                                       /* 1=已播放结束，亮度停在最后一个关键帧 */
+} Key_Channel;
+
+/**
+  * @brief   多通道引擎
+  */
+typedef struct
+{
+    Key_Channel *ch;                                  /* 通道数组 */
+    uint16_t *active;                                 /* 活动通道下标表，容量不小于通道数 */
+    uint16_t count;                                    /* 通道数 */
+    uint16_t n_active;                               /* 活动通道数 */
+} Key_Engine;
+
+/**
+  * @brief           Q16缓动曲线
+  * @param        ease 曲线类型
+  * @param        x 进度（0 ~ 65535）
+  * @retval          曲线值（0 ~ 65536）
+  */
+uint32_t Key_Ease(uint8_t ease, uint32_t x);
+
+/**
+  * @brief           按相邻关键帧的时刻填写各段的进度增量du
+  * @param        keys 关键帧表
+  * @param        count 关键帧数
+  * @retval          None
+  * @note           修改关键帧的时刻后、Key_Bind()之前调用；最后一个关键帧的du为0
+  */
+void Key_Prepare(Key_Frame *keys, uint16_t count);
+
+/**
+  * @brief           绑定关键帧表并从时刻0开始
+  * @param        ch 通道状态
+  * @param        keys 关键帧表（由调用者保持有效，du须已由Key_Prepare()或KEY_DU()填写）
+  * @param        count 关键帧数（为0时通道直接结束，亮度为0）
+  * @param        loop 1=循环播放（循环周期 = 最后一个关键帧的时刻）
+  * @retval          None
+  */
+void Key_Bind(Key_Channel *ch, const Key_Frame *keys, uint16_t count, uint8_t loop);
+
+/**
+  * @brief           跳到指定时刻
+  * @param        ch 通道状态（须已绑定）
+  * @param        time 时刻，单位：tick；循环通道按周期取模
+  * @retval          None
+  */
+void Key_Seek(Key_Channel *ch, uint32_t time);
+
+/**
+  * @brief           推进一个tick
+  * @param        ch 通道状态
+  * @retval          当前亮度
+  */
+uint16_t Key_Tick(Key_Channel *ch);
+
+/**
+  * @brief           生成一个呼吸周期的关键帧：最暗 → 最亮 → 最暗
+  * @param        keys 输出关键帧表，3项
+  * @param        lo 最暗亮度
+  * @param        hi 最亮亮度
+  * @param        ticks 呼吸周期，单位：tick
+  * @retval          None
+  * @note           前后两段都用正弦缓动（最后一个关键帧只标记周期终点），循环播放；du已填写
+  */
+void Key_BreathFrames(Key_Frame *keys, uint16_t lo, uint16_t hi, uint32_t ticks);
+
+/**
+  * @brief           初始化引擎
+  * @param        eng 引擎
+  * @param        ch 通道数组（须已逐个调用Key_Bind()）
+  * @param        active 活动通道下标表，count项
+  * @param        count 通道数
+  * @retval          None
+  */
+void Key_EngineInit(Key_Engine *eng, Key_Channel *ch, uint16_t *active, uint16_t count);
+
+/**
+  * @brief           所有活动通道推进一个tick
+  * @param        eng 引擎
+  * @retval          仍在播放的通道数
+  * @note           结果在ch[i].level中；已结束的通道不再访问
+  */
+uint16_t Key_EngineTick(Key_Engine *eng);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __KEY_H */
@@ -0,0 +1,171 @@
+/**
+  ************************************************************************************
+  * @file              MapSize.h
+  * @author         None
+  * @version       V1.0.1
+  * @date            2026-10-17
+  * @brief           映像大小分析工具头文件
+  *
+  * @details        本文件提供主机端的Flash/RAM占用分析接口：
+  *                        1. 读取：MapSize_Load()，自动识别Keil（armlink）的.map、GCC（ld）的.map和ELF文件
+  *                        2. 报告：MapSize_Report()按模块和符号列出Flash/RAM占用（从大到小）
+  *                        3. 标记：MapSize_Flag()列出被链接进来的CMSIS-DSP表（arm_common_tables等）
+  *                        4. 预算：MapSize_Check()按预算文件检查总量、模块、符号和禁止出现的符号
+  *                        5. 比较：MapSize_Diff()列出两次构建之间变化最大的模块和符号
+  *
+  * @note            Flash = 代码 + 只读数据 + 已初始化数据的初值，RAM = 已初始化数据 + 零初始化数据
+  *                        Keil的.map在Listings目录下，Clean.bat会删除*.map，需在清理前分析
+  *                        命令行用法（定义MAPSIZE_MAIN编译本文件得到mapsize程序）：
+  *                        - mapsize report <map|elf> [N]          前N个模块和符号（默认20）
+  *                        - mapsize check <map|elf> <预算文件>   超出预算时返回1
+  *                        - mapsize diff <旧map|elf> <新map|elf> [N]
+  *
+  * @attention     注意事项：
+  *                         1. 主机端工具，不加入Keil工程
+  *                         2. 预算文件格式见SizeBudget.txt；ELF只含本地符号的所属文件，全局符号的模块记为"?"
+  *                         3. 三种格式的夹具在HostData/MapSize/下，由hostcheck的mapsize检查项使用
+  *
+  *                         修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.0.1 注明夹具和对应的检查项
+  *
+  ************************************************************************************
+  */
+
+#ifndef __MAPSIZE_H
+#define __MAPSIZE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdio.h>
+
+#define MAPSIZE_NAME_MAX                    64U           /* 符号名最大长度（含结束符，超长截断） */
+#define MAPSIZE_MODULE_MAX                 48U           /* 模块名最大长度（含结束符，超长截断） */
+
+/**
+  * @brief   文件格式（MapSize_Load()返回值）
+  */
+#define MAPSIZE_FMT_NONE                     0U             /* 无法识别 */
+#define MAPSIZE_FMT_KEIL                      1U             /* armlink .map */
+#define MAPSIZE_FMT_GCC                       2U             /* ld .map */
+#define MAPSIZE_FMT_ELF                        3U             /* ELF32 */
+
+/**
+  * @brief   符号所在的存储器（可组合：已初始化数据同时占用Flash和RAM）
+  */
+#define MAPSIZE_IN_FLASH                       0x01U
+#define MAPSIZE_IN_RAM                          0x02U
+
+/**
+  * @brief   符号
+  */
+typedef struct
+{
+    char name[MAPSIZE_NAME_MAX];          /* 符号名 */
+    char module[MAPSIZE_MODULE_MAX];   /* 所属模块（目标文件名） */
+    uint32_t addr;                                    /* 地址 */
+    uint32_t size;                                     /* 大小，单位：字节 */
+    uint8_t where;                                   /* MAPSIZE_IN_FLASH | MAPSIZE_IN_RAM */
+} MapSize_Symbol;
+
+/**
+  * @brief   模块
+  */
+typedef struct
+{
+    char name[MAPSIZE_MODULE_MAX];      /* 模块名（目标文件名） */
+    uint32_t flash;                                    /* Flash占用，单位：字节 */
+    uint32_t ram;                                      /* RAM占用，单位：字节 */
+} MapSize_Module;
+
+/**
+  * @brief   映像
+  */
+typedef struct
+{
+    MapSize_Symbol *sym;                         /* 符号表，按大小从大到小排列 */
+    uint32_t sym_count;                              /* 符号数 */
+    uint32_t sym_cap;                                /* 符号表容量 */
+    MapSize_Module *mod;                          /* 模块表，按Flash + RAM从大到小排列 */
+    uint32_t mod_count;                             /* 模块数 */
+    uint32_t mod_cap;                               /* 模块表容量 */
+    uint32_t flash;                                    /* Flash总量，单位：字节 */
+    uint32_t ram;                                      /* RAM总量，单位：字节 */
+    uint32_t dropped;                               /* 超出容量未记录的符号和模块数 */
+    uint8_t format;                                   /* MAPSIZE_FMT_xxx */
+} MapSize_Image;
+
+/**
+  * @brief           初始化映像
+  * @param        img 映像
+  * @param        sym 符号表存储
+  * @param        sym_cap 符号表容量
+  * @param        mod 模块表存储
+  * @param        mod_cap 模块表容量
+  * @retval          None
+  */
+void MapSize_Init(MapSize_Image *img, MapSize_Symbol *sym, uint32_t sym_cap,
+                  MapSize_Module *mod, uint32_t mod_cap);
+
+/**
+  * @brief           解析.map或ELF文件内容
+  * @param        img 映像（须已初始化）
+  * @param        data 文件内容
+  * @param        len 文件长度，单位：字节
+  * @retval          MAPSIZE_FMT_xxx，MAPSIZE_FMT_NONE表示无法识别
+  */
+uint8_t MapSize_Load(MapSize_Image *img, const uint8_t *data, uint32_t len);
+
+/**
+  * @brief           输出占用报告
+  * @param        img 映像
+  * @param        top 模块和符号各列出的项数
+  * @param        out 输出文件
+  * @retval          None
+  */
+void MapSize_Report(const MapSize_Image *img, uint32_t top, FILE *out);
+
+/**
+  * @brief           列出被链接进来的CMSIS-DSP表和函数
+  * @param        img 映像
+  * @param        out 输出文件
+  * @retval          匹配的符号和模块数
+  */
+uint32_t MapSize_Flag(const MapSize_Image *img, FILE *out);
+
+/**
+  * @brief           按预算检查
+  * @param        img 映像
+  * @param        budget 预算文件内容
+  * @param        len 预算文件长度，单位：字节
+  * @param        out 输出文件
+  * @retval          超出预算的项数
+  */
+uint32_t MapSize_Check(const MapSize_Image *img, const char *budget, uint32_t len, FILE *out);
+
+/**
+  * @brief           比较两次构建
+  * @param        old_img 旧映像
+  * @param        new_img 新映像
+  * @param        top 模块和符号各列出的项数
+  * @param        out 输出文件
+  * @retval          None
+  */
+void MapSize_Diff(const MapSize_Image *old_img, const MapSize_Image *new_img, uint32_t top, FILE *out);
+
+/**
+  * @brief           命令行入口
+  * @param        argc 参数个数
+  * @param        argv 参数
+  * @retval          0=成功，1=超出预算，2=参数或文件错误
+  */
+int MapSize_Main(int argc, char **argv);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __MAPSIZE_H */
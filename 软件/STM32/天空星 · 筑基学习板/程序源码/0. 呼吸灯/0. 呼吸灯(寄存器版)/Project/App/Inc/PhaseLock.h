@@ -0,0 +1,90 @@
+/**
+  ************************************************************************************
+  * @file              PhaseLock.h
+  * @author         None
+  * @version       V1.0.1
+  * @date            2026-10-17
+  * @brief           呼吸相位同步（锁相环）模块头文件
+  *
+  * @details        本文件提供多板呼吸相位同步接口：
+  *                        1. 主板在每个最暗点输出一个同步脉冲
+  *                        2. 从板在脉冲到来时记录自己的呼吸相位：PhaseLock_Capture()，可在中断中调用
+  *                        3. 主循环中PhaseLock_Update()按相位误差修正相位（比例项），
+  *                           并累计修正相位增量（积分项），从而同时消除相位差和晶振频率差；
+  *                           积分项只在误差进入锁定窗口后累计，任意初始相位都不会使积分饱和
+  *
+  * @note            理想情况下从板在脉冲时刻的相位为0，误差 = -捕获相位（按有符号数解释）
+  *                        修正量均用移位实现，无乘除法
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.0.1 锁定窗口外不累计积分项
+  *
+  ************************************************************************************
+  */
+
+#ifndef __PHASELOCK_H
+#define __PHASELOCK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "Breath.h"
+
+#define PHASELOCK_KP_SHIFT                1U             /* 比例项：每个脉冲修正 误差 ÷ 2 */
+#define PHASELOCK_KI_SHIFT                 15U           /* 积分项：每个脉冲相位增量修正 误差 ÷ 2^15 */
+#define PHASELOCK_LOCK_WINDOW        0x00400000U /* 锁定判据：|误差| 小于呼吸周期的 1/1024 */
+#define PHASELOCK_LOCK_COUNT           4U             /* 连续多少个脉冲满足判据视为锁定 */
+
+/**
+  * @brief   锁相环状态
+  */
+typedef struct
+{
+    uint32_t base_inc;                                /* 未修正的相位增量（取自Breath_Effect.inc） */
+    int32_t integ;                                      /* 积分项：相位增量修正值 */
+    int32_t err;                                         /* 最近一次的相位误差 */
+    volatile uint32_t captured;                   /* 脉冲时刻捕获的相位 */
+    volatile uint8_t pending;                      /* 是否有未处理的捕获 */
+    uint8_t kp_shift;                                  /* 比例项移位数 */
+    uint8_t ki_shift;                                   /* 积分项移位数 */
+    uint8_t locked;                                     /* 1=已锁定 */
+    uint8_t good;                                       /* 连续满足锁定判据的脉冲数 */
+} PhaseLock;
+
+/**
+  * @brief           初始化锁相环
+  * @param        pl 锁相环状态
+  * @param        eff 被同步的呼吸效果（须已调用Breath_Start()）
+  * @param        kp_shift 比例项移位数（通常为PHASELOCK_KP_SHIFT）
+  * @param        ki_shift 积分项移位数（通常为PHASELOCK_KI_SHIFT）
+  * @retval          None
+  * @note           调用Breath_SetPeriod()修改周期后须重新初始化
+  */
+void PhaseLock_Init(PhaseLock *pl, const Breath_Effect *eff, uint8_t kp_shift, uint8_t ki_shift);
+
+/**
+  * @brief           记录同步脉冲时刻的相位
+  * @param        pl 锁相环状态
+  * @param        phase 脉冲时刻的Breath_Effect.phase
+  * @retval          None
+  * @note           可在外部中断中调用；未处理的捕获会被新的捕获覆盖
+  */
+void PhaseLock_Capture(PhaseLock *pl, uint32_t phase);
+
+/**
+  * @brief           处理捕获并修正呼吸效果
+  * @param        pl 锁相环状态
+  * @param        eff 被同步的呼吸效果
+  * @retval          1=本次处理了一个捕获，0=无捕获
+  * @note           在主循环中调用
+  */
+uint8_t PhaseLock_Update(PhaseLock *pl, Breath_Effect *eff);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __PHASELOCK_H */
@@ -0,0 +1,180 @@
+/**
+  ************************************************************************************
+  * @file              Preview.h
+  * @author         None
+  * @version       V2.0.0
+  * @date            2026-10-17
+  * @brief           大规模灯阵效果预览模块头文件
+  *
+  * @details        本文件提供在主机上预览上千通道固件效果的接口：
+  *                        1. 效果与固件LED2相同：PREVIEW_MODE_BREATH为Breath_Tick()的三角波，
+  *                           PREVIEW_MODE_KEY为Key_BreathFrames()的正弦缓动关键帧（每个最暗点重新对齐）
+  *                        2. 各通道只有相位偏移不同（数组结构offset[]），周期、亮度范围和相位余数共用一个
+  *                           Breath_Effect，逐通道结果与各自运行一个Breath_Effect逐位一致
+  *                        3. 三角波模式每帧只推进共用效果，再用SIMD_V4_xxx每次计算4个通道的亮度；
+  *                           关键帧模式逐tick逐通道调用Key_Tick()，与固件的开销相同
+  *                        4. 输出按width排列的8位灰度帧，经回调交给调用者写入文件
+  *                           （原始视频：ffmpeg -f rawvideo -pix_fmt gray -s WxH；
+  *                            图像序列：每帧前加Preview_PgmHeader()生成的PGM文件头）
+  *                        命令行用法（定义PREVIEW_MAIN编译Preview.c得到preview程序）：
+  *                        - preview [-n 通道数] [-w 宽度] [-f 帧数] [-r 帧率] [-t tick微秒] [-p 周期毫秒]
+  *                                  [-l 波长] [-k] [-o 原始视频文件 | -s PGM文件名前缀]
+  *
+  * @note            在Project目录下编译：
+  *                        gcc -DPREVIEW_MAIN -O2 -IApp/Inc -IDriver/Inc App/Src/Preview.c App/Src/Breath.c
+  *                            App/Src/Key.c App/Src/Dds.c App/Src/Cmd.c -o preview
+  *
+  * @attention     注意事项：
+  *                         1. 主机端模块，不加入Keil工程
+  *                         2. 亮度上限不超过255，亮度值直接作为灰度
+  *
+  *                         修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V2.0.0 改为渲染固件的呼吸/关键帧效果，主机端SSE2向量化，增加帧文件输出程序
+  *
+  ************************************************************************************
+  */
+
+#ifndef __PREVIEW_H
+#define __PREVIEW_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "Breath.h"
+#include "Key.h"
+
+#define PREVIEW_PGM_HEADER_MAX          32U            /* PGM文件头最大长度 */
+
+/**
+  * @brief   效果模式
+  */
+#define PREVIEW_MODE_BREATH               0U             /* 三角波（LED2_KEYFRAMES = 0） */
+#define PREVIEW_MODE_KEY                     1U             /* 正弦缓动关键帧（LED2_KEYFRAMES = 1） */
+
+/**
+  * @brief   帧输出回调
+  * @param   frame 帧序号（从0开始）
+  * @param   pixels 灰度像素，width × height字节，按行存放
+  */
+typedef void (*Preview_Sink)(void *ctx, uint32_t frame, const uint8_t *pixels,
+                             uint32_t width, uint32_t height);
+
+/**
+  * @brief   预览状态
+  */
+typedef struct
+{
+    Breath_Effect ref;                                /* 相位偏移为0的通道，所有通道共用其增量与余数 */
+    Key_Frame keys[3];                              /* 关键帧表（PREVIEW_MODE_KEY） */
+    uint32_t *offset;                                 /* 各通道相位偏移，count项 */
+    Key_Channel *key;                                /* 各通道关键帧状态，count项（PREVIEW_MODE_KEY） */
+    uint8_t *pixels;                                   /* 帧缓冲，width × height字节 */
+    const uint8_t *gamma;                         /* 256项亮度映射表，为NULL时线性映射 */
+    uint32_t count;                                    /* 通道数 */
+    uint32_t width;                                     /* 每行像素数 */
+    uint32_t height;                                    /* 行数 = 通道数 ÷ width（向上取整） */
+    uint32_t steps;                                     /* 每帧的整数tick数 */
+    uint32_t rem;                                        /* 每帧tick数的小数部分分子 */
+    uint32_t den;                                        /* 每帧tick数的小数部分分母 */
+    uint32_t acc;                                         /* 小数部分累计值 */
+    uint32_t frame_hz;                                /* 帧率，单位：Hz */
+    uint32_t frame;                                     /* 已输出的帧数 */
+    uint64_t ticks;                                      /* 已推进的tick数 */
+    uint8_t mode;                                       /* PREVIEW_MODE_xxx */
+} Preview_State;
+
+/**
+  * @brief   运行统计
+  */
+typedef struct
+{
+    uint32_t frames;                                   /* 输出帧数 */
+    uint32_t ticks;                                      /* 总耗时，单位：时钟计数 */
+    uint32_t realtime_x1000;                      /* 仿真时长 ÷ 实际耗时（×1000），≥1000为实时 */
+} Preview_Stats;
+
+/**
+  * @brief           初始化预览
+  * @param        st 预览状态
+  * @param        mode PREVIEW_MODE_xxx
+  * @param        count 通道数
+  * @param        offset 相位偏移数组，count项（内容由Preview_Ripple()设置）
+  * @param        key 关键帧状态数组，count项（PREVIEW_MODE_BREATH时可为NULL）
+  * @param        pixels 帧缓冲，至少 width × Preview_Height() 字节
+  * @param        width 每行像素数
+  * @param        tick_us 固件调用Breath_Tick()的间隔，单位：微秒（即PWM周期）
+  * @param        period_ms 呼吸周期，单位：毫秒
+  * @param        hi 最亮亮度（1~255），最暗为0
+  * @param        frame_hz 预览帧率，单位：Hz（帧间隔不短于一个tick）
+  * @retval          0=成功，1=参数非法
+  * @note           初始化后各通道同相，调用Preview_Ripple()设置相位差
+  */
+uint8_t Preview_Init(Preview_State *st, uint8_t mode, uint32_t count, uint32_t *offset, Key_Channel *key,
+                     uint8_t *pixels, uint32_t width, uint32_t tick_us, uint32_t period_ms,
+                     uint16_t hi, uint32_t frame_hz);
+
+/**
+  * @brief           帧的行数
+  * @param        count 通道数
+  * @param        width 每行像素数
+  * @retval          行数
+  */
+uint32_t Preview_Height(uint32_t count, uint32_t width);
+
+/**
+  * @brief           设置亮度映射表
+  * @param        st 预览状态
+  * @param        gamma 256项映射表，下标为亮度；为NULL时线性映射
+  * @retval          None
+  */
+void Preview_SetGamma(Preview_State *st, const uint8_t *gamma);
+
+/**
+  * @brief           设置沿通道方向传播的波纹
+  * @param        st 预览状态
+  * @param        wavelength 一个完整呼吸周期跨越的通道数（为0时各通道同相）
+  * @retval          None
+  * @note           关键帧模式下各通道跳到自身相位对应的时刻，与固件Led2_BuildKeys()相同
+  */
+void Preview_Ripple(Preview_State *st, uint32_t wavelength);
+
+/**
+  * @brief           推进一帧并输出
+  * @param        st 预览状态
+  * @param        sink 帧输出回调（可为NULL）
+  * @param        ctx 回调参数
+  * @retval          None
+  */
+void Preview_Frame(Preview_State *st, Preview_Sink sink, void *ctx);
+
+/**
+  * @brief           连续输出多帧并统计速度
+  * @param        st 预览状态
+  * @param        frames 帧数
+  * @param        clock 时钟读取函数（返回递增的计数值）
+  * @param        ticks_per_us 时钟每微秒的计数值
+  * @param        sink 帧输出回调（可为NULL，只测计算速度）
+  * @param        ctx 回调参数
+  * @param        stats 输出统计
+  * @retval          None
+  */
+void Preview_Run(Preview_State *st, uint32_t frames, uint32_t (*clock)(void), uint32_t ticks_per_us,
+                 Preview_Sink sink, void *ctx, Preview_Stats *stats);
+
+/**
+  * @brief           生成PGM（P5）文件头
+  * @param        buf 输出缓冲，至少PREVIEW_PGM_HEADER_MAX字节
+  * @param        width 图像宽度
+  * @param        height 图像高度
+  * @retval          文件头长度（不含结尾的'\0'）
+  */
+uint32_t Preview_PgmHeader(char *buf, uint32_t width, uint32_t height);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __PREVIEW_H */
@@ -0,0 +1,107 @@
+/**
+  ************************************************************************************
+  * @file              PwmStagger.h
+  * @author         None
+  * @version       V1.0.0
+  * @date            2026-10-17
+  * @brief           多通道PWM相位错开模块头文件
+  *
+  * @details        本文件提供多通道软件PWM的相位分配、负载统计和输出时序表：
+  *                        1. PwmStagger_Distribute()：按占空比依次首尾相接排列各通道的导通区间，
+  *                           同时导通的通道数峰值降到下限 ⌈Σduty ÷ period⌉
+  *                        2. PwmStagger_Measure()：统计一个周期内同时导通通道数的峰值、均值和均方根
+  *                        3. PwmStagger_Build()：把各通道的开关边沿合并为按时间排序的BSRR写入表
+  *
+  * @note            时间单位由调用者决定（如CPU周期或微秒），period为一个PWM周期的长度
+  *                        各通道占空比不变，只改变导通区间在周期内的起点
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *
+  ************************************************************************************
+  */
+
+#ifndef __PWMSTAGGER_H
+#define __PWMSTAGGER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/**
+  * @brief   开关边沿（排序用的临时数据，由调用者提供2 × n项）
+  */
+typedef struct
+{
+    uint32_t time;                                     /* 周期内的时刻 */
+    uint16_t ch;                                        /* 通道号 */
+    uint8_t level;                                      /* 1=导通，0=关断 */
+} PwmStagger_Edge;
+
+/**
+  * @brief   BSRR写入表的一项
+  */
+typedef struct
+{
+    uint32_t time;                                     /* 周期内的时刻 */
+    uint32_t bsrr;                                     /* 该时刻写入BSRR的值（低16位置位，高16位复位） */
+} PwmStagger_Slot;
+
+/**
+  * @brief   同时导通通道数统计
+  */
+typedef struct
+{
+    uint32_t peak;                                     /* 峰值 */
+    uint32_t mean_x1000;                          /* 时间平均值（×1000） */
+    uint32_t rms_x1000;                            /* 均方根（×1000） */
+} PwmStagger_Load;
+
+/**
+  * @brief           分配各通道的相位偏移
+  * @param        duty 各通道导通时间（0 ~ period）
+  * @param        offset 输出各通道导通起点（0 ~ period-1）
+  * @param        n 通道数
+  * @param        period PWM周期
+  * @retval          None
+  */
+void PwmStagger_Distribute(const uint32_t *duty, uint32_t *offset, uint32_t n, uint32_t period);
+
+/**
+  * @brief           统计同时导通的通道数
+  * @param        duty 各通道导通时间
+  * @param        offset 各通道导通起点（全为0即传统的对齐PWM）
+  * @param        n 通道数
+  * @param        period PWM周期
+  * @param        scratch 临时数据，至少2 × n项
+  * @param        load 输出统计
+  * @retval          None
+  * @note           同一时刻的关断先于导通处理
+  */
+void PwmStagger_Measure(const uint32_t *duty, const uint32_t *offset, uint32_t n, uint32_t period,
+                        PwmStagger_Edge *scratch, PwmStagger_Load *load);
+
+/**
+  * @brief           生成BSRR写入表
+  * @param        duty 各通道导通时间
+  * @param        offset 各通道导通起点
+  * @param        pin 各通道在同一GPIO端口上的引脚号（0-15），高电平导通
+  * @param        n 通道数（不超过16）
+  * @param        period PWM周期
+  * @param        scratch 临时数据，至少2 × n项
+  * @param        slots 输出写入表，至少2 × n + 1项
+  * @retval          写入表项数
+  * @note           第0项的时刻为0，写入周期起点各通道应有的电平；
+  *                        之后按时间顺序，同一时刻的边沿合并为一项。
+  *                        驱动循环：依次等待到slots[i].time后写GPIOx->BSRR，到period后从头开始
+  */
+uint32_t PwmStagger_Build(const uint32_t *duty, const uint32_t *offset, const uint8_t *pin,
+                          uint32_t n, uint32_t period, PwmStagger_Edge *scratch, PwmStagger_Slot *slots);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __PWMSTAGGER_H */
@@ -0,0 +1,92 @@
+/**
+  ************************************************************************************
+  * @file              Sweep.h
+  * @author         None
+  * @version       V1.0.1
+  * @date            2026-10-17
+  * @brief           呼吸灯参数扫描工具头文件
+  *
+  * @details        本文件提供主机端多线程扫描Breath_Params网格的接口：
+  *                        1. 扫描：Sweep_Run()把网格下标按块分给多个线程，线程从共享计数器取块，
+  *                           每块调用一次Breath_SweepRange()
+  *                        2. 结果：每组参数的指标按下标写入结果数组，输出顺序与线程数无关
+  *                        3. 帕累托前沿：每个线程维护自己的非支配集，结束后合并（Breath_Dominates()）
+  *                        命令行用法（定义SWEEP_MAIN编译本文件得到sweep程序）：
+  *                        - sweep [-j 线程数] [-c CSV文件] [-p 前沿CSV文件] [-k 主频Hz] [参数=下限:上限:步长 ...]
+  *                          参数名见Sweep.c中的sweep_axis表，未给出的参数取Breath.h中的默认值
+  *
+  * @note            在Project目录下编译：
+  *                        gcc -DSWEEP_MAIN -O2 -pthread -IApp/Inc App/Src/Sweep.c App/Src/Breath.c -o sweep
+  *
+  * @attention     注意事项：
+  *                         1. 主机端工具，用到pthread和malloc，不加入Keil工程
+  *
+  *                         修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.0.1 明确输出文件失败时的返回值
+  *
+  ************************************************************************************
+  */
+
+#ifndef __SWEEP_H
+#define __SWEEP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "Breath.h"
+
+#define SWEEP_THREADS_MAX                   64U           /* 最多线程数 */
+#define SWEEP_CHUNK                              256U          /* 每次从计数器取的参数组数 */
+
+/**
+  * @brief   一组参数的扫描结果
+  */
+typedef struct
+{
+    Breath_Metrics metrics;                        /* 指标 */
+    uint8_t valid;                                       /* 1=参数合法，已评估 */
+    uint8_t pareto;                                     /* 1=在帕累托前沿上 */
+} Sweep_Result;
+
+/**
+  * @brief   扫描统计
+  */
+typedef struct
+{
+    uint32_t total;                                      /* 网格参数组数 */
+    uint32_t valid;                                      /* 合法的参数组数 */
+    uint32_t front;                                      /* 前沿上的参数组数 */
+    uint32_t threads;                                   /* 实际线程数 */
+    double seconds;                                    /* 扫描耗时（墙钟），单位：秒 */
+} Sweep_Stats;
+
+/**
+  * @brief           多线程扫描一个网格
+  * @param        grid 参数网格
+  * @param        core_clock CPU主频，单位：Hz
+  * @param        threads 线程数（1 ~ SWEEP_THREADS_MAX）
+  * @param        results 输出结果，Breath_GridCount(grid)项
+  * @param        stats 输出统计
+  * @retval          0=成功，1=参数非法或线程创建失败
+  * @note           结果与线程数无关：同一网格用1个和N个线程得到的results逐项相同
+  */
+uint8_t Sweep_Run(const Breath_Grid *grid, uint32_t core_clock, uint32_t threads,
+                  Sweep_Result *results, Sweep_Stats *stats);
+
+/**
+  * @brief           命令行入口
+  * @param        argc 参数个数
+  * @param        argv 参数
+  * @retval          0=成功，1=失败（内存不足、扫描失败、输出文件打不开或写入失败），2=参数错误
+  * @note           输出文件失败时在stderr给出文件名和原因，其余输出照常完成
+  */
+int Sweep_Main(int argc, char **argv);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __SWEEP_H */
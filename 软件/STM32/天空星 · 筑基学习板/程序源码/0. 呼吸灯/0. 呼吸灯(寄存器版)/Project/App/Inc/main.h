@@ -2,7 +2,7 @@
   ************************************************************************************
   * @file               main.h
   * @author          None
-  * @version        V1.0.0
+  * @version        V1.11.0
   * @date             2026-01-18
   * @brief            主头文件
   *
@@ -17,6 +17,17 @@
   *
   * @attention     修改日志：
   *                         - 2026-01-18 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 增加多板同步角色配置SYNC_ROLE
+  *                         - 2026-10-17 V1.2.0 增加LED1硬件指示配置LED1_INDICATOR_HW
+  *                         - 2026-10-17 V1.3.0 增加串口控制配置UART_CONTROL
+  *                         - 2026-10-17 V1.4.0 增加LED2关键帧缓动配置LED2_KEYFRAMES
+  *                         - 2026-10-17 V1.5.0 增加器件能力表，无TIM3/TIM4的型号默认软件指示LED1
+  *                         - 2026-10-17 V1.6.0 包含C启动代码头文件
+  *                         - 2026-10-17 V1.7.0 增加固定块内存池
+  *                         - 2026-10-17 V1.8.0 增加B命令（内存池基准测试）的默认参数
+  *                         - 2026-10-17 V1.9.0 增加A命令（动画解码基准测试）的示例动画和轮数
+  *                         - 2026-10-17 V1.10.0 增加D命令（DDS基准测试）的通道数和轮数
+  *                         - 2026-10-17 V1.11.0 包含帧分配区头文件
   *
   ************************************************************************************
   */
@@ -41,6 +52,37 @@ extern "C" {
   */
 #include "stm32f4xx.h"
 
+/**
+  * @brief   器件能力表头文件
+  * @note   按型号宏提供定时器、GPIO端口、CCM等差异和实际总线时钟，
+  *                驱动据此在各型号上按实际时钟计算参数
+  *
+  * @attention 注意事项：
+  *                1. 更换型号时同时修改工程中的型号宏和启动文件
+  */
+#include "Device.h"
+
+/**
+  * @brief   C语言启动代码头文件
+  * @note   提供复位到进入main()的CPU周期数Startup_Cycles和NOINIT变量修饰STARTUP_NOINIT
+  */
+#include "Startup.h"
+
+/**
+  * @brief   固定块内存池头文件
+  * @note   C启动代码没有堆，动态内存从POOL_TABLE配置的固定块池中分配，中断中也可分配和释放
+  */
+#include "Pool.h"
+
+/**
+  * @brief   帧内临时内存头文件
+  * @note   每个PWM周期内的临时缓冲区从Arena_Frame分配，主循环在周期末调用Arena_Reset()整体回收
+  *
+  * @attention 注意事项：
+  *                1. 本周期内分配的指针不能保存到下一个周期
+  */
+#include "Arena.h"
+
 /**
   * @brief   LED控制模块头文件
   * @note   提供LED初始化、开关等函数接口
@@ -63,6 +105,117 @@ extern "C" {
   */
 #include "Delay.h"
 
+/**
+  * @brief   呼吸灯参数评估模块头文件
+  * @note   提供呼吸灯调节参数的默认值和评估、扫描函数
+  *
+  * @attention 注意事项：
+  *                1. 修改默认参数前可先用Breath_Evaluate()检查载波频率和级数
+  */
+#include "Breath.h"
+
+/**
+  * @brief   多板相位同步模块头文件
+  * @note   主板经PA1输出同步脉冲，从板捕获脉冲并用锁相环修正呼吸相位
+  *
+  * @attention 注意事项：
+  *                1. 每块板按实际角色设置SYNC_ROLE，同一条同步线上只能有一块主板
+  */
+#include "SyncPin.h"
+#include "PhaseLock.h"
+
+#define SYNC_ROLE_NONE                      0               /* 不同步，单板运行 */
+#define SYNC_ROLE_LEADER                   1               /* 主板：在最暗点输出同步脉冲 */
+#define SYNC_ROLE_FOLLOWER              2               /* 从板：跟随同步脉冲 */
+
+#ifndef SYNC_ROLE
+#define SYNC_ROLE                               SYNC_ROLE_NONE
+#endif
+
+/**
+  * @brief   LED1硬件指示驱动头文件
+  * @note   TIM3→TIM4级联直接在PB8上产生LED1指示，主循环以TIM3溢出为PWM节拍
+  *
+  * @attention 注意事项：
+  *                1. 从板的锁相环会修正呼吸相位，硬件指示无法跟随，从板默认使用软件指示
+  *                2. 没有TIM3/TIM4的型号（F410）默认使用软件指示
+  */
+#include "Indicator.h"
+
+#ifndef LED1_INDICATOR_HW
+#if SYNC_ROLE == SYNC_ROLE_FOLLOWER || !(DEVICE_HAS_TIM(3) && DEVICE_HAS_TIM(4))
+#define LED1_INDICATOR_HW                0               /* 0=软件翻转LED1 */
+#else
+#define LED1_INDICATOR_HW                1               /* 1=定时器级联产生LED1 */
+#endif
+#endif
+
+#if LED1_INDICATOR_HW && !(DEVICE_HAS_TIM(3) && DEVICE_HAS_TIM(4))
+#error "LED1_INDICATOR_HW requires TIM3 and TIM4"
+#endif
+
+/**
+  * @brief   串口控制模块头文件
+  * @note   USART1经DMA收发，空闲线分帧；命令在接收缓冲区上原地解析后排队，
+  *                由主循环在PWM周期边界执行，应答经DMA发回
+  *
+  * @attention 注意事项：
+  *                1. 使用PA9/PA10，与其他驱动的引脚不冲突
+  */
+#include "Uart.h"
+#include "Cmd.h"
+
+#ifndef UART_CONTROL
+#define UART_CONTROL                         1               /* 1=启用串口控制，0=只运行默认呼吸效果 */
+#endif
+
+#define BENCH_SIZE                              48U            /* B命令默认块字节数（落在64字节池） */
+#define BENCH_DEPTH                            8U              /* B命令默认每轮块数（64字节池共8块，malloc含块头也在512字节堆内） */
+#define BENCH_ROUNDS                         100U           /* B命令轮数（168MHz下约1毫秒，期间LED暂停刷新） */
+
+/**
+  * @brief   压缩动画模块头文件
+  * @note   A命令在目标板上逐帧解码Flash中的示例动画AnimDemo，报告每帧耗时
+  *
+  * @attention 注意事项：
+  *                1. 示例动画由主机端anim程序生成，重新生成的方法见AnimDemo.h
+  */
+#include "Anim.h"
+#include "AnimDemo.h"
+
+#define ANIM_BENCH_ROUNDS                 2U              /* A命令默认轮数（每轮解码全部100帧） */
+#define ANIM_BENCH_ROUNDS_MAX          100U           /* A命令最多轮数，解码期间LED暂停刷新 */
+
+/**
+  * @brief   多通道DDS波形发生模块头文件
+  * @note   D命令在目标板上比较Dds_UpdateScalar()与双16位SIMD实现Dds_Update()的耗时
+  *
+  * @attention 注意事项：
+  *                1. 通道数组从帧分配区Arena_Frame分配，通道数不超过DDS_BENCH_CHANNELS_MAX
+  */
+#include "Dds.h"
+
+#define DDS_BENCH_CHANNELS_MAX         64U            /* D命令最多通道数（从Arena_Frame分配12 × 64字节） */
+#define DDS_BENCH_ROUNDS                  100U           /* D命令默认轮数（64通道时168MHz下约1毫秒） */
+#define DDS_BENCH_ROUNDS_MAX           10000U         /* D命令最多轮数，测试期间LED暂停刷新 */
+
+/**
+  * @brief   关键帧动画引擎头文件
+  * @note   LED2亮度由关键帧表按缓动曲线插值，呼吸效果只提供周期、亮度范围和最亮/最暗事件
+  *
+  * @attention 注意事项：
+  *                1. 从板的锁相环直接修正呼吸相位，关键帧只在最暗点对齐，从板默认使用三角波
+  */
+#include "Key.h"
+
+#ifndef LED2_KEYFRAMES
+#if SYNC_ROLE == SYNC_ROLE_FOLLOWER
+#define LED2_KEYFRAMES                      0               /* 0=LED2使用呼吸效果的三角波 */
+#else
+#define LED2_KEYFRAMES                      1               /* 1=LED2使用正弦缓动的关键帧 */
+#endif
+#endif
+
 #ifdef __cplusplus
 }
 #endif
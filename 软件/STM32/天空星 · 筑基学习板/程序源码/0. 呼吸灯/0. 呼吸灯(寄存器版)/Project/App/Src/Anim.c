@@ -0,0 +1,594 @@
+/**
+  ************************************************************************************
+  * @file              Anim.c
+  * @author         None
+  * @version       V1.1.0
+  * @date            2026-10-17
+  * @brief           压缩动画存储模块源文件
+  *
+  * @details        本文件实现了差值 + 游程编码：
+  *                        1. 编码器按需计算第k个差值 = levels[k] - levels[k - channels]，不分配差值数组
+  *                        2. 贪心选择标记：相同差值连续出现达到门限时用重复/跳过标记；
+  *                           字面量已打开时门限为3（要多付一个新字面量的长度字节），否则为2
+  *                        3. 其余位置若至少4个差值都在 -8~7 之间，用半字节标记每字节存两个差值，
+  *                           遇到能用重复/跳过标记的位置提前结束；否则并入字面量
+  *                        4. 解码器每帧按剩余通道数消耗标记，标记跨帧时把剩余长度留给下一帧，
+  *                           半字节标记按剩余个数的奇偶判断取低半字节还是高半字节
+  *                        5. ANIM_MAIN：主机端编码程序，读原始帧、编码、逐帧解码核对后输出数据文件或C数组
+  *
+  * @note            任何标记都不比对应的字面量长，编码结果不超过Anim_Bound()
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 增加Anim_Benchmark()和anim编码程序
+  *
+  ************************************************************************************
+  */
+
+#include "Anim.h"
+
+#define ANIM_LIT_MAX                           64U           /* 字面量最长字节数 */
+#define ANIM_NIB_MAX                           128U          /* 半字节标记最多差值个数 */
+#define ANIM_REP_MAX                           65U           /* 重复标记最长次数 */
+#define ANIM_SKIP_MAX                          16384U      /* 跳过标记最长通道数 */
+
+#define ANIM_MODE_LIT                         0U             /* 字面量 */
+#define ANIM_MODE_REP                         1U             /* 重复 */
+#define ANIM_MODE_SKIP                        2U             /* 跳过 */
+#define ANIM_MODE_NIB                          3U             /* 半字节 */
+
+/** 差值d（按有符号数）在 -8~7 之间 */
+#define ANIM_IS_SMALL(d)                       ((uint8_t)((d) + 8U) < 16U)
+
+/**
+  * @brief           第k个差值
+  * @param        levels 逐帧亮度
+  * @param        channels 通道数
+  * @param        k 下标（帧号 × 通道数 + 通道号）
+  * @retval          与上一帧同一通道的差（模256），第一帧与0比较
+  */
+static uint8_t Anim_Delta(const uint8_t *levels, uint32_t channels, uint32_t k)
+{
+    return (uint8_t)(levels[k] - ((k >= channels) ? levels[k - channels] : 0U));
+}
+
+/**
+  * @brief           从k开始相同差值的个数
+  * @param        levels 逐帧亮度
+  * @param        channels 通道数
+  * @param        k 起始下标
+  * @param        n 差值总数
+  * @param        max 最多统计的个数
+  * @retval          个数（1 ~ max）
+  */
+static uint32_t Anim_RunLength(const uint8_t *levels, uint32_t channels, uint32_t k, uint32_t n, uint32_t max)
+{
+    uint8_t d = Anim_Delta(levels, channels, k);
+    uint32_t r = 1;
+
+    while(k + r < n && r < max && Anim_Delta(levels, channels, k + r) == d) r++;
+    return r;
+}
+
+/**
+  * @brief           读16位小端数
+  * @param        p 数据地址（不要求对齐）
+  * @retval          数值
+  */
+static uint32_t Anim_Get16(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8);
+}
+
+/**
+  * @brief           读32位小端数
+  * @param        p 数据地址（不要求对齐）
+  * @retval          数值
+  */
+static uint32_t Anim_Get32(const uint8_t *p)
+{
+    return Anim_Get16(p) | (Anim_Get16(p + 2) << 16);
+}
+
+/**
+  * @brief           写32位小端数
+  * @param        p 写入地址（不要求对齐）
+  * @param        v 数值
+  * @retval          None
+  */
+static void Anim_Put32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+/**
+  * @brief           编码后数据的最大长度
+  * @param        channels 通道数
+  * @param        frames 帧数
+  * @retval          字节数
+  */
+uint32_t Anim_Bound(uint32_t channels, uint32_t frames)
+{
+    uint32_t n = channels * frames;
+
+    return ANIM_HEADER_SIZE + n + (n + ANIM_LIT_MAX - 1U) / ANIM_LIT_MAX;
+}
+
+/**
+  * @brief           编码动画
+  * @param        levels 逐帧亮度
+  * @param        channels 通道数
+  * @param        frames 帧数
+  * @param        frame_us 帧间隔，单位：微秒
+  * @param        out 输出缓冲
+  * @param        size 输出缓冲大小
+  * @retval          编码后的字节数，0=失败
+  */
+uint32_t Anim_Encode(const uint8_t *levels, uint32_t channels, uint32_t frames, uint32_t frame_us,
+                     uint8_t *out, uint32_t size)
+{
+    uint32_t n = channels * frames;
+    uint32_t pos = ANIM_HEADER_SIZE;
+    uint32_t lit = 0;                                   /* 当前字面量的长度字节位置，0=未打开 */
+    uint32_t lit_len = 0;
+    uint32_t i = 0;
+    uint32_t r;
+    uint32_t k;
+    uint8_t d;
+
+    if(channels == 0 || channels > 0xFFFFU || size < ANIM_HEADER_SIZE) return 0;
+
+    out[0] = 'A';
+    out[1] = 'N';
+    out[2] = 'I';
+    out[3] = 'M';
+    out[4] = ANIM_VERSION;
+    out[5] = 0;
+    out[6] = (uint8_t)channels;
+    out[7] = (uint8_t)(channels >> 8);
+    Anim_Put32(&out[8], frames);
+    Anim_Put32(&out[12], frame_us);
+
+    while(i < n) {
+        /* 从i开始相同差值的个数 */
+        d = Anim_Delta(levels, channels, i);
+        r = Anim_RunLength(levels, channels, i, n, (d == 0) ? ANIM_SKIP_MAX : ANIM_REP_MAX);
+
+        if(r >= (lit_len ? 3U : 2U)) {
+            /* 关闭字面量，输出重复或跳过标记 */
+            if(lit_len) {
+                out[lit] = (uint8_t)(lit_len - 1U);
+                lit_len = 0;
+            }
+            if(pos + 2U > size) return 0;
+            if(d == 0) {
+                out[pos++] = (uint8_t)(0xC0U | ((r - 1U) >> 8));
+                out[pos++] = (uint8_t)(r - 1U);
+            } else {
+                out[pos++] = (uint8_t)(0x80U | (r - 2U));
+                out[pos++] = d;
+            }
+            i += r;
+            continue;
+        }
+
+        /* 连续的小差值个数，遇到可用重复/跳过标记的位置结束 */
+        k = 0;
+        while(i + k < n && k < ANIM_NIB_MAX && ANIM_IS_SMALL(Anim_Delta(levels, channels, i + k))
+              && (k == 0 || Anim_RunLength(levels, channels, i + k, n, 3U) < 3U)) k++;
+        k &= ~1U;
+
+        if(k >= 4U) {
+            /* 关闭字面量，输出半字节标记：先低半字节后高半字节 */
+            if(lit_len) {
+                out[lit] = (uint8_t)(lit_len - 1U);
+                lit_len = 0;
+            }
+            if(pos + 1U + k / 2U > size) return 0;
+            out[pos++] = (uint8_t)(0x40U | (k / 2U - 1U));
+            for(r = 0; r < k; r += 2U) {
+                out[pos++] = (uint8_t)((Anim_Delta(levels, channels, i + r) & 0x0FU)
+                                       | (Anim_Delta(levels, channels, i + r + 1U) << 4));
+            }
+            i += k;
+        } else {
+            /* 并入字面量 */
+            if(lit_len == 0) {
+                if(pos >= size) return 0;
+                lit = pos++;
+            }
+            if(pos >= size) return 0;
+            out[pos++] = d;
+            i++;
+            if(++lit_len == ANIM_LIT_MAX) {
+                out[lit] = (uint8_t)(lit_len - 1U);
+                lit_len = 0;
+            }
+        }
+    }
+    if(lit_len) {
+        out[lit] = (uint8_t)(lit_len - 1U);
+    }
+    return pos;
+}
+
+/**
+  * @brief           打开动画
+  * @param        dec 解码状态
+  * @param        data 动画数据
+  * @param        size 数据长度
+  * @param        frame 帧缓冲
+  * @retval          0=成功，1=文件头非法
+  */
+uint8_t Anim_Open(Anim_Decoder *dec, const uint8_t *data, uint32_t size, uint8_t *frame)
+{
+    if(size < ANIM_HEADER_SIZE || data[0] != 'A' || data[1] != 'N' || data[2] != 'I' || data[3] != 'M'
+       || data[4] != ANIM_VERSION || Anim_Get16(&data[6]) == 0) return 1;
+
+    dec->data = data;
+    dec->end = data + size;
+    dec->channels = Anim_Get16(&data[6]);
+    dec->frames = Anim_Get32(&data[8]);
+    dec->frame_us = Anim_Get32(&data[12]);
+    Anim_Rewind(dec, frame);
+    return 0;
+}
+
+/**
+  * @brief           回到第一帧之前
+  * @param        dec 解码状态
+  * @param        frame 帧缓冲
+  * @retval          None
+  */
+void Anim_Rewind(Anim_Decoder *dec, uint8_t *frame)
+{
+    uint32_t i;
+
+    dec->pos = dec->data + ANIM_HEADER_SIZE;
+    dec->frame = 0;
+    dec->run = 0;
+    dec->mode = ANIM_MODE_LIT;
+    dec->value = 0;
+    for(i = 0; i < dec->channels; i++) {
+        frame[i] = 0;
+    }
+}
+
+/**
+  * @brief           解码下一帧
+  * @param        dec 解码状态
+  * @param        frame 帧缓冲
+  * @retval          ANIM_OK / ANIM_END / ANIM_ERROR
+  */
+uint8_t Anim_Next(Anim_Decoder *dec, uint8_t *frame)
+{
+    const uint8_t *p = dec->pos;
+    uint32_t left = dec->channels;
+    uint32_t run = dec->run;
+    uint32_t n;
+    uint8_t c;
+    uint8_t v;
+
+    if(dec->frame >= dec->frames) return ANIM_END;
+
+    while(left > 0) {
+        /* 取下一个标记 */
+        if(run == 0) {
+            if(p >= dec->end) return ANIM_ERROR;
+            c = *p++;
+            if(c < 0x40U) {
+                run = (uint32_t)c + 1U;
+                if((uint32_t)(dec->end - p) < run) return ANIM_ERROR;
+                dec->mode = ANIM_MODE_LIT;
+            } else if(c < 0x80U) {
+                run = ((uint32_t)(c & 0x3FU) + 1U) * 2U;
+                if((uint32_t)(dec->end - p) < run / 2U) return ANIM_ERROR;
+                dec->mode = ANIM_MODE_NIB;
+            } else {
+                if(p >= dec->end) return ANIM_ERROR;
+                if(c < 0xC0U) {
+                    run = (uint32_t)(c & 0x3FU) + 2U;
+                    dec->value = *p++;
+                    dec->mode = ANIM_MODE_REP;
+                } else {
+                    run = (((uint32_t)(c & 0x3FU) << 8) | *p++) + 1U;
+                    dec->mode = ANIM_MODE_SKIP;
+                }
+            }
+        }
+
+        n = (run < left) ? run : left;
+        left -= n;
+        if(dec->mode == ANIM_MODE_NIB) {
+            /* 剩余个数为偶数时取低半字节，奇数时取高半字节并移到下一字节 */
+            while(n--) {
+                if(run & 1U) {
+                    v = (uint8_t)(*p++ >> 4);
+                } else {
+                    v = (uint8_t)(*p & 0x0FU);
+                }
+                *frame++ += (uint8_t)(v - ((v & 0x08U) << 1));
+                run--;
+            }
+            continue;
+        }
+        run -= n;
+        if(dec->mode == ANIM_MODE_LIT) {
+            while(n--) *frame++ += *p++;
+        } else if(dec->mode == ANIM_MODE_REP) {
+            v = dec->value;
+            while(n--) *frame++ += v;
+        } else {
+            frame += n;
+        }
+    }
+
+    dec->pos = p;
+    dec->run = run;
+    dec->frame++;
+    return ANIM_OK;
+}
+
+/**
+  * @brief           逐帧计时解码整段动画
+  * @param        data 动画数据
+  * @param        size 数据长度
+  * @param        frame 帧缓冲
+  * @param        frame_size 帧缓冲大小
+  * @param        rounds 轮数
+  * @param        clock 时钟读取函数
+  * @param        ticks_per_us 时钟每微秒的计数值
+  * @param        result 输出测试结果
+  * @retval          None
+  */
+void Anim_Benchmark(const uint8_t *data, uint32_t size, uint8_t *frame, uint32_t frame_size, uint32_t rounds,
+                    uint32_t (*clock)(void), uint32_t ticks_per_us, Anim_Bench *result)
+{
+    Anim_Decoder dec;
+    uint64_t den;                                             /* 帧数 × 轮数 × 每微秒时钟计数 */
+    uint32_t start;
+    uint32_t t;
+    uint32_t i;
+    uint32_t k;
+    uint8_t r = ANIM_END;
+
+    result->frames = 0;
+    result->ticks = 0;
+    result->frame_max = 0;
+    result->frame_ns = 0;
+    result->sum = 0;
+    result->status = ANIM_ERROR;
+
+    /* 先检查通道数，Anim_Open()会清零整个帧缓冲 */
+    if(size < ANIM_HEADER_SIZE || Anim_Get16(&data[6]) > frame_size) return;
+    if(Anim_Open(&dec, data, size, frame) != 0) return;
+
+    for(i = 0; i < rounds && r != ANIM_ERROR; i++) {
+        Anim_Rewind(&dec, frame);
+        while(1) {
+            start = clock();
+            r = Anim_Next(&dec, frame);
+            t = clock() - start;
+            if(r != ANIM_OK) break;
+
+            result->ticks += t;
+            if(t > result->frame_max) result->frame_max = t;
+            if(i == 0) {
+                result->frames++;
+                for(k = 0; k < dec.channels; k++) result->sum += frame[k];
+            }
+        }
+    }
+    result->status = r;
+
+    den = (uint64_t)result->frames * rounds * ticks_per_us;
+    result->frame_ns = den ? (uint32_t)((uint64_t)result->ticks * 1000U / den) : 0;
+}
+
+#ifdef ANIM_MAIN
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define ANIM_MAIN_ROUNDS                    100U           /* 主机端基准测试轮数 */
+#define ANIM_MAIN_NAME_MAX                  64U            /* C数组名最长字符数 */
+
+/**
+  * @brief           主机时钟：单调时间的低32位，单位：纳秒
+  * @param        None
+  * @retval          当前时刻
+  */
+static uint32_t Anim_HostClock(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec);
+}
+
+/**
+  * @brief           逐帧解码并与原始帧比较
+  * @param        data 编码结果
+  * @param        size 编码结果长度
+  * @param        levels 原始帧
+  * @param        channels 通道数
+  * @param        frames 帧数
+  * @retval          0=一致，1=不一致
+  */
+static int Anim_Verify(const uint8_t *data, uint32_t size, const uint8_t *levels, uint32_t channels, uint32_t frames)
+{
+    Anim_Decoder dec;
+    uint8_t *frame = (uint8_t *)malloc(channels);
+    uint32_t f;
+    int bad = (frame == NULL || Anim_Open(&dec, data, size, frame) != 0);
+
+    for(f = 0; !bad && f < frames; f++) {
+        bad = (Anim_Next(&dec, frame) != ANIM_OK || memcmp(frame, &levels[(size_t)f * channels], channels) != 0);
+    }
+    if(!bad) bad = (Anim_Next(&dec, frame) != ANIM_END || dec.pos != dec.end);
+    free(frame);
+    return bad;
+}
+
+/**
+  * @brief           以C数组形式写出编码结果
+  * @param        f 输出文件
+  * @param        path 输出文件名，去掉目录和扩展名后作为数组名
+  * @param        data 编码结果
+  * @param        size 编码结果长度
+  * @param        channels 通道数
+  * @param        frames 帧数
+  * @param        frame_us 帧间隔
+  * @param        sum 各帧全部通道亮度之和
+  * @retval          0=成功，1=写文件失败
+  */
+static int Anim_WriteArray(FILE *f, const char *path, const uint8_t *data, uint32_t size, uint32_t channels,
+                           uint32_t frames, uint32_t frame_us, uint32_t sum)
+{
+    const char *base = strrchr(path, '/');
+    char name[ANIM_MAIN_NAME_MAX + 1U];
+    uint32_t n = 0;
+    uint32_t i;
+
+    base = (base != NULL) ? base + 1 : path;
+    while(base[n] != '\0' && base[n] != '.' && n < ANIM_MAIN_NAME_MAX) {
+        name[n] = (base[n] == '-' || base[n] == ' ') ? '_' : base[n];
+        n++;
+    }
+    name[n] = '\0';
+
+    fprintf(f, "/**\n"
+               "  ************************************************************************************\n"
+               "  * @file              %s.c\n"
+               "  * @brief           动画数据（由anim程序生成，不要手工修改）\n"
+               "  *\n"
+               "  * @details        %lu通道，%lu帧，帧间隔%lu微秒，%lu字节（原始帧%lu字节）\n"
+               "  *                        各帧全部通道亮度之和：%lu（与A命令应答的sum字段比较）\n"
+               "  *\n"
+               "  ************************************************************************************\n"
+               "  */\n\n"
+               "#include <stdint.h>\n\n"
+               "const uint8_t %s[%lu] =\n{",
+            name, (unsigned long)channels, (unsigned long)frames, (unsigned long)frame_us, (unsigned long)size,
+            (unsigned long)channels * frames, (unsigned long)sum, name, (unsigned long)size);
+    for(i = 0; i < size; i++) {
+        fprintf(f, "%s0x%02X", (i == 0) ? "\n    " : (i % 16U == 0) ? ",\n    " : ", ", data[i]);
+    }
+    fprintf(f, "\n};\n\nconst uint32_t %s_Size = sizeof(%s);\n", name, name);
+    return ferror(f) ? 1 : 0;
+}
+
+/**
+  * @brief           读入整个文件
+  * @param        path 文件名
+  * @param        len 输出文件长度
+  * @retval          文件内容（malloc分配），NULL=读取失败或文件为空
+  */
+static uint8_t *Anim_Load(const char *path, uint32_t *len)
+{
+    FILE *f = fopen(path, "rb");
+    uint8_t *buf = NULL;
+    long n = 0;
+
+    if(f != NULL && fseek(f, 0, SEEK_END) == 0 && (n = ftell(f)) > 0 && fseek(f, 0, SEEK_SET) == 0) {
+        buf = (uint8_t *)malloc((size_t)n);
+        if(buf != NULL && fread(buf, 1, (size_t)n, f) != (size_t)n) {
+            free(buf);
+            buf = NULL;
+        }
+    }
+    if(f != NULL) fclose(f);
+    *len = (uint32_t)n;
+    return buf;
+}
+
+/**
+  * @brief           写出编码结果
+  * @param        path 输出文件名，扩展名为.c时写C数组，否则写二进制数据
+  * @param        data 编码结果
+  * @param        size 编码结果长度
+  * @param        channels 通道数
+  * @param        frames 帧数
+  * @param        frame_us 帧间隔
+  * @param        sum 各帧全部通道亮度之和
+  * @retval          0=成功，1=写文件失败
+  */
+static int Anim_Save(const char *path, const uint8_t *data, uint32_t size, uint32_t channels, uint32_t frames,
+                     uint32_t frame_us, uint32_t sum)
+{
+    const char *ext = strrchr(path, '.');
+    uint8_t array = (ext != NULL && strcmp(ext, ".c") == 0);
+    FILE *f = fopen(path, array ? "w" : "wb");
+    int r;
+
+    if(f == NULL) return 1;
+    r = array ? Anim_WriteArray(f, path, data, size, channels, frames, frame_us, sum)
+              : (fwrite(data, 1, size, f) != size);
+    if(fclose(f) != 0) r = 1;
+    return r;
+}
+
+/**
+  * @brief           主机端编码程序入口
+  * @param        argc 参数个数
+  * @param        argv 参数：<逐帧亮度文件> <通道数> <帧间隔微秒> [输出文件]
+  * @retval          0=成功，1=失败，2=参数错误
+  */
+int main(int argc, char **argv)
+{
+    uint32_t channels = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 0) : 0;
+    uint32_t frame_us = (argc > 3) ? (uint32_t)strtoul(argv[3], NULL, 0) : 0;
+    uint8_t *levels;
+    uint8_t *out;
+    uint8_t *frame;
+    uint32_t len;
+    uint32_t frames;
+    uint32_t bound;
+    uint32_t size = 0;
+    Anim_Bench b;
+    int r = 1;
+
+    if(argc < 4 || argc > 5 || channels == 0 || channels > 0xFFFFU) {
+        fprintf(stderr, "usage: anim <levels.raw> <channels> <frame_us> [out.anim | out.c]\n");
+        return 2;
+    }
+    levels = Anim_Load(argv[1], &len);
+    if(levels == NULL) {
+        fprintf(stderr, "%s: cannot read\n", argv[1]);
+        return 1;
+    }
+    if(len % channels != 0) {
+        fprintf(stderr, "%s: %lu bytes is not a multiple of %lu channels\n", argv[1], (unsigned long)len,
+                (unsigned long)channels);
+        free(levels);
+        return 2;
+    }
+    frames = len / channels;
+    bound = Anim_Bound(channels, frames);
+    out = (uint8_t *)malloc(bound);
+    frame = (uint8_t *)malloc(channels);
+
+    /* 编码，逐帧解码核对 */
+    if(out != NULL && frame != NULL) size = Anim_Encode(levels, channels, frames, frame_us, out, bound);
+    if(size == 0 || Anim_Verify(out, size, levels, channels, frames) != 0) {
+        fprintf(stderr, "round trip FAIL\n");
+    } else {
+        Anim_Benchmark(out, size, frame, channels, ANIM_MAIN_ROUNDS, Anim_HostClock, 1000U, &b);
+        printf("%lu channels x %lu frames, %lu -> %lu bytes (%lu%%, bound %lu)\n", (unsigned long)channels,
+               (unsigned long)frames, (unsigned long)len, (unsigned long)size,
+               (unsigned long)((uint64_t)size * 100U / len), (unsigned long)bound);
+        printf("  decode  %8lu ns/frame  max %lu ns  sum %lu\n", (unsigned long)b.frame_ns,
+               (unsigned long)b.frame_max, (unsigned long)b.sum);
+        r = (argc == 5) ? Anim_Save(argv[4], out, size, channels, frames, frame_us, b.sum) : 0;
+        if(r) fprintf(stderr, "%s: cannot write\n", argv[4]);
+    }
+    free(levels);
+    free(out);
+    free(frame);
+    return r;
+}
+#endif  /* ANIM_MAIN */
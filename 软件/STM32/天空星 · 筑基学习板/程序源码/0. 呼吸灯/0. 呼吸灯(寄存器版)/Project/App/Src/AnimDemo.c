@@ -0,0 +1,225 @@
+/**
+  ************************************************************************************
+  * @file              AnimDemo.c
+  * @brief           动画数据（由anim程序生成，不要手工修改）
+  *
+  * @details        64通道，100帧，帧间隔20000微秒，3300字节（原始帧6400字节）
+  *                        各帧全部通道亮度之和：816120（与A命令应答的sum字段比较）
+  *
+  ************************************************************************************
+  */
+
+#include <stdint.h>
+
+const uint8_t AnimDemo[3300] =
+{
+    0x41, 0x4E, 0x49, 0x4D, 0x01, 0x00, 0x40, 0x00, 0x64, 0x00, 0x00, 0x00, 0x20, 0x4E, 0x00, 0x00,
+    0x3F, 0x00, 0x23, 0x7B, 0xD7, 0xFF, 0xDC, 0x84, 0x28, 0x00, 0x23, 0x7B, 0xD7, 0xFF, 0xDC, 0x84,
+    0x28, 0x00, 0x23, 0x7B, 0xD7, 0xFF, 0xDC, 0x84, 0x28, 0x00, 0x23, 0x7B, 0xD7, 0xFF, 0xDC, 0x84,
+    0x28, 0x00, 0x23, 0x7B, 0xD7, 0xFF, 0xDC, 0x84, 0x28, 0x00, 0x23, 0x7B, 0xD7, 0xFF, 0xDC, 0x84,
+    0x28, 0x00, 0x23, 0x7B, 0xD7, 0xFF, 0xDC, 0x84, 0x28, 0x00, 0x23, 0x7B, 0xD7, 0xFF, 0xDC, 0x84,
+    0x28, 0x7F, 0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC,
+    0x30, 0x34, 0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC,
+    0x30, 0x34, 0xD1, 0xCC, 0x3F, 0x44, 0xD1, 0xCC, 0x3F, 0x44, 0xD1, 0xCC, 0x3F, 0x44, 0xD1, 0xCC,
+    0x3F, 0x44, 0xD1, 0xCC, 0x3F, 0x44, 0xD1, 0xCC, 0x3F, 0x44, 0xD1, 0xCC, 0x3F, 0x44, 0xD1, 0xCC,
+    0x3F, 0x44, 0x7F, 0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC, 0x30, 0x34, 0xD0,
+    0xDC, 0x30, 0x34, 0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC, 0x30, 0x34, 0xD0,
+    0xDC, 0x30, 0x34, 0xE1, 0xDC, 0x2F, 0x34, 0xE1, 0xDC, 0x2F, 0x34, 0xE1, 0xDC, 0x2F, 0x34, 0xE1,
+    0xDC, 0x2F, 0x34, 0xE1, 0xDC, 0x2F, 0x34, 0xE1, 0xDC, 0x2F, 0x34, 0xE1, 0xDC, 0x2F, 0x34, 0xE1,
+    0xDC, 0x2F, 0x34, 0x7F, 0xD0, 0xCC, 0x30, 0x44, 0xD0, 0xCC, 0x30, 0x44, 0xD0, 0xCC, 0x30, 0x44,
+    0xD0, 0xCC, 0x30, 0x44, 0xD0, 0xCC, 0x30, 0x44, 0xD0, 0xCC, 0x30, 0x44, 0xD0, 0xCC, 0x30, 0x44,
+    0xD0, 0xCC, 0x30, 0x44, 0xE1, 0xDC, 0x2F, 0x34, 0xE1, 0xDC, 0x2F, 0x34, 0xE1, 0xDC, 0x2F, 0x34,
+    0xE1, 0xDC, 0x2F, 0x34, 0xE1, 0xDC, 0x2F, 0x34, 0xE1, 0xDC, 0x2F, 0x34, 0xE1, 0xDC, 0x2F, 0x34,
+    0xE1, 0xDC, 0x2F, 0x34, 0x7F, 0xE1, 0xCB, 0x2F, 0x45, 0xE1, 0xCB, 0x2F, 0x45, 0xE1, 0xCB, 0x2F,
+    0x45, 0xE1, 0xCB, 0x2F, 0x45, 0xE1, 0xCB, 0x2F, 0x45, 0xE1, 0xCB, 0x2F, 0x45, 0xE1, 0xCB, 0x2F,
+    0x45, 0xE1, 0xCB, 0x2F, 0x45, 0xE2, 0xDC, 0x2E, 0x34, 0xE2, 0xDC, 0x2E, 0x34, 0xE2, 0xDC, 0x2E,
+    0x34, 0xE2, 0xDC, 0x2E, 0x34, 0xE2, 0xDC, 0x2E, 0x34, 0xE2, 0xDC, 0x2E, 0x34, 0xE2, 0xDC, 0x2E,
+    0x34, 0xE2, 0xDC, 0x2E, 0x34, 0x7F, 0xE1, 0xCC, 0x2F, 0x44, 0xE1, 0xCC, 0x2F, 0x44, 0xE1, 0xCC,
+    0x2F, 0x44, 0xE1, 0xCC, 0x2F, 0x44, 0xE1, 0xCC, 0x2F, 0x44, 0xE1, 0xCC, 0x2F, 0x44, 0xE1, 0xCC,
+    0x2F, 0x44, 0xE1, 0xCC, 0x2F, 0x44, 0xE1, 0xCC, 0x2F, 0x44, 0xE1, 0xCC, 0x2F, 0x44, 0xE1, 0xCC,
+    0x2F, 0x44, 0xE1, 0xCC, 0x2F, 0x44, 0xE1, 0xCC, 0x2F, 0x44, 0xE1, 0xCC, 0x2F, 0x44, 0xE1, 0xCC,
+    0x2F, 0x44, 0xE1, 0xCC, 0x2F, 0x44, 0x7F, 0xF2, 0xCD, 0x1E, 0x43, 0xF2, 0xCD, 0x1E, 0x43, 0xF2,
+    0xCD, 0x1E, 0x43, 0xF2, 0xCD, 0x1E, 0x43, 0xF2, 0xCD, 0x1E, 0x43, 0xF2, 0xCD, 0x1E, 0x43, 0xF2,
+    0xCD, 0x1E, 0x43, 0xF2, 0xCD, 0x1E, 0x43, 0xE1, 0xCC, 0x2F, 0x44, 0xE1, 0xCC, 0x2F, 0x44, 0xE1,
+    0xCC, 0x2F, 0x44, 0xE1, 0xCC, 0x2F, 0x44, 0xE1, 0xCC, 0x2F, 0x44, 0xE1, 0xCC, 0x2F, 0x44, 0xE1,
+    0xCC, 0x2F, 0x44, 0xE1, 0xCC, 0x2F, 0x44, 0x7F, 0xF2, 0xCC, 0x1E, 0x44, 0xF2, 0xCC, 0x1E, 0x44,
+    0xF2, 0xCC, 0x1E, 0x44, 0xF2, 0xCC, 0x1E, 0x44, 0xF2, 0xCC, 0x1E, 0x44, 0xF2, 0xCC, 0x1E, 0x44,
+    0xF2, 0xCC, 0x1E, 0x44, 0xF2, 0xCC, 0x1E, 0x44, 0xE2, 0xCC, 0x2E, 0x44, 0xE2, 0xCC, 0x2E, 0x44,
+    0xE2, 0xCC, 0x2E, 0x44, 0xE2, 0xCC, 0x2E, 0x44, 0xE2, 0xCC, 0x2E, 0x44, 0xE2, 0xCC, 0x2E, 0x44,
+    0xE2, 0xCC, 0x2E, 0x44, 0xE2, 0xCC, 0x2E, 0x44, 0x7F, 0xF2, 0xCD, 0x1E, 0x43, 0xF2, 0xCD, 0x1E,
+    0x43, 0xF2, 0xCD, 0x1E, 0x43, 0xF2, 0xCD, 0x1E, 0x43, 0xF2, 0xCD, 0x1E, 0x43, 0xF2, 0xCD, 0x1E,
+    0x43, 0xF2, 0xCD, 0x1E, 0x43, 0xF2, 0xCD, 0x1E, 0x43, 0xF2, 0xCC, 0x1E, 0x44, 0xF2, 0xCC, 0x1E,
+    0x44, 0xF2, 0xCC, 0x1E, 0x44, 0xF2, 0xCC, 0x1E, 0x44, 0xF2, 0xCC, 0x1E, 0x44, 0xF2, 0xCC, 0x1E,
+    0x44, 0xF2, 0xCC, 0x1E, 0x44, 0xF2, 0xCC, 0x1E, 0x44, 0x7F, 0xF3, 0xCC, 0x1D, 0x44, 0xF3, 0xCC,
+    0x1D, 0x44, 0xF3, 0xCC, 0x1D, 0x44, 0xF3, 0xCC, 0x1D, 0x44, 0xF3, 0xCC, 0x1D, 0x44, 0xF3, 0xCC,
+    0x1D, 0x44, 0xF3, 0xCC, 0x1D, 0x44, 0xF3, 0xCC, 0x1D, 0x44, 0x02, 0xCD, 0x0E, 0x43, 0x02, 0xCD,
+    0x0E, 0x43, 0x02, 0xCD, 0x0E, 0x43, 0x02, 0xCD, 0x0E, 0x43, 0x02, 0xCD, 0x0E, 0x43, 0x02, 0xCD,
+    0x0E, 0x43, 0x02, 0xCD, 0x0E, 0x43, 0x02, 0xCD, 0x0E, 0x43, 0x7F, 0xF3, 0xCD, 0x1D, 0x43, 0xF3,
+    0xCD, 0x1D, 0x43, 0xF3, 0xCD, 0x1D, 0x43, 0xF3, 0xCD, 0x1D, 0x43, 0xF3, 0xCD, 0x1D, 0x43, 0xF3,
+    0xCD, 0x1D, 0x43, 0xF3, 0xCD, 0x1D, 0x43, 0xF3, 0xCD, 0x1D, 0x43, 0x02, 0xCC, 0x0E, 0x44, 0x02,
+    0xCC, 0x0E, 0x44, 0x02, 0xCC, 0x0E, 0x44, 0x02, 0xCC, 0x0E, 0x44, 0x02, 0xCC, 0x0E, 0x44, 0x02,
+    0xCC, 0x0E, 0x44, 0x02, 0xCC, 0x0E, 0x44, 0x02, 0xCC, 0x0E, 0x44, 0x7F, 0xF3, 0xCD, 0x1D, 0x43,
+    0xF3, 0xCD, 0x1D, 0x43, 0xF3, 0xCD, 0x1D, 0x43, 0xF3, 0xCD, 0x1D, 0x43, 0xF3, 0xCD, 0x1D, 0x43,
+    0xF3, 0xCD, 0x1D, 0x43, 0xF3, 0xCD, 0x1D, 0x43, 0xF3, 0xCD, 0x1D, 0x43, 0x03, 0xBD, 0x0D, 0x53,
+    0x03, 0xBD, 0x0D, 0x53, 0x03, 0xBD, 0x0D, 0x53, 0x03, 0xBD, 0x0D, 0x53, 0x03, 0xBD, 0x0D, 0x53,
+    0x03, 0xBD, 0x0D, 0x53, 0x03, 0xBD, 0x0D, 0x53, 0x03, 0xBD, 0x0D, 0x53, 0x7F, 0x03, 0xCD, 0x0D,
+    0x43, 0x03, 0xCD, 0x0D, 0x43, 0x03, 0xCD, 0x0D, 0x43, 0x03, 0xCD, 0x0D, 0x43, 0x03, 0xCD, 0x0D,
+    0x43, 0x03, 0xCD, 0x0D, 0x43, 0x03, 0xCD, 0x0D, 0x43, 0x03, 0xCD, 0x0D, 0x43, 0x03, 0xCD, 0x0D,
+    0x43, 0x03, 0xCD, 0x0D, 0x43, 0x03, 0xCD, 0x0D, 0x43, 0x03, 0xCD, 0x0D, 0x43, 0x03, 0xCD, 0x0D,
+    0x43, 0x03, 0xCD, 0x0D, 0x43, 0x03, 0xCD, 0x0D, 0x43, 0x03, 0xCD, 0x0D, 0x43, 0x7F, 0x03, 0xCD,
+    0x0D, 0x43, 0x03, 0xCD, 0x0D, 0x43, 0x03, 0xCD, 0x0D, 0x43, 0x03, 0xCD, 0x0D, 0x43, 0x03, 0xCD,
+    0x0D, 0x43, 0x03, 0xCD, 0x0D, 0x43, 0x03, 0xCD, 0x0D, 0x43, 0x03, 0xCD, 0x0D, 0x43, 0x13, 0xCE,
+    0xFD, 0x42, 0x13, 0xCE, 0xFD, 0x42, 0x13, 0xCE, 0xFD, 0x42, 0x13, 0xCE, 0xFD, 0x42, 0x13, 0xCE,
+    0xFD, 0x42, 0x13, 0xCE, 0xFD, 0x42, 0x13, 0xCE, 0xFD, 0x42, 0x13, 0xCE, 0xFD, 0x42, 0x7F, 0x03,
+    0xBD, 0x0D, 0x53, 0x03, 0xBD, 0x0D, 0x53, 0x03, 0xBD, 0x0D, 0x53, 0x03, 0xBD, 0x0D, 0x53, 0x03,
+    0xBD, 0x0D, 0x53, 0x03, 0xBD, 0x0D, 0x53, 0x03, 0xBD, 0x0D, 0x53, 0x03, 0xBD, 0x0D, 0x53, 0x14,
+    0xCE, 0xFC, 0x42, 0x14, 0xCE, 0xFC, 0x42, 0x14, 0xCE, 0xFC, 0x42, 0x14, 0xCE, 0xFC, 0x42, 0x14,
+    0xCE, 0xFC, 0x42, 0x14, 0xCE, 0xFC, 0x42, 0x14, 0xCE, 0xFC, 0x42, 0x14, 0xCE, 0xFC, 0x42, 0x7F,
+    0x13, 0xCD, 0xFD, 0x43, 0x13, 0xCD, 0xFD, 0x43, 0x13, 0xCD, 0xFD, 0x43, 0x13, 0xCD, 0xFD, 0x43,
+    0x13, 0xCD, 0xFD, 0x43, 0x13, 0xCD, 0xFD, 0x43, 0x13, 0xCD, 0xFD, 0x43, 0x13, 0xCD, 0xFD, 0x43,
+    0x04, 0xCE, 0x0C, 0x42, 0x04, 0xCE, 0x0C, 0x42, 0x04, 0xCE, 0x0C, 0x42, 0x04, 0xCE, 0x0C, 0x42,
+    0x04, 0xCE, 0x0C, 0x42, 0x04, 0xCE, 0x0C, 0x42, 0x04, 0xCE, 0x0C, 0x42, 0x04, 0xCE, 0x0C, 0x42,
+    0x7F, 0x13, 0xCE, 0xFD, 0x42, 0x13, 0xCE, 0xFD, 0x42, 0x13, 0xCE, 0xFD, 0x42, 0x13, 0xCE, 0xFD,
+    0x42, 0x13, 0xCE, 0xFD, 0x42, 0x13, 0xCE, 0xFD, 0x42, 0x13, 0xCE, 0xFD, 0x42, 0x13, 0xCE, 0xFD,
+    0x42, 0x24, 0xCE, 0xEC, 0x42, 0x24, 0xCE, 0xEC, 0x42, 0x24, 0xCE, 0xEC, 0x42, 0x24, 0xCE, 0xEC,
+    0x42, 0x24, 0xCE, 0xEC, 0x42, 0x24, 0xCE, 0xEC, 0x42, 0x24, 0xCE, 0xEC, 0x42, 0x24, 0xCE, 0xEC,
+    0x42, 0x7F, 0x14, 0xCE, 0xFC, 0x42, 0x14, 0xCE, 0xFC, 0x42, 0x14, 0xCE, 0xFC, 0x42, 0x14, 0xCE,
+    0xFC, 0x42, 0x14, 0xCE, 0xFC, 0x42, 0x14, 0xCE, 0xFC, 0x42, 0x14, 0xCE, 0xFC, 0x42, 0x14, 0xCE,
+    0xFC, 0x42, 0x13, 0xCE, 0xFD, 0x42, 0x13, 0xCE, 0xFD, 0x42, 0x13, 0xCE, 0xFD, 0x42, 0x13, 0xCE,
+    0xFD, 0x42, 0x13, 0xCE, 0xFD, 0x42, 0x13, 0xCE, 0xFD, 0x42, 0x13, 0xCE, 0xFD, 0x42, 0x13, 0xCE,
+    0xFD, 0x42, 0x7F, 0x24, 0xCF, 0xEC, 0x41, 0x24, 0xCF, 0xEC, 0x41, 0x24, 0xCF, 0xEC, 0x41, 0x24,
+    0xCF, 0xEC, 0x41, 0x24, 0xCF, 0xEC, 0x41, 0x24, 0xCF, 0xEC, 0x41, 0x24, 0xCF, 0xEC, 0x41, 0x24,
+    0xCF, 0xEC, 0x41, 0x24, 0xCE, 0xEC, 0x42, 0x24, 0xCE, 0xEC, 0x42, 0x24, 0xCE, 0xEC, 0x42, 0x24,
+    0xCE, 0xEC, 0x42, 0x24, 0xCE, 0xEC, 0x42, 0x24, 0xCE, 0xEC, 0x42, 0x24, 0xCE, 0xEC, 0x42, 0x24,
+    0xCE, 0xEC, 0x42, 0x7F, 0x14, 0xDF, 0xFC, 0x31, 0x14, 0xDF, 0xFC, 0x31, 0x14, 0xDF, 0xFC, 0x31,
+    0x14, 0xDF, 0xFC, 0x31, 0x14, 0xDF, 0xFC, 0x31, 0x14, 0xDF, 0xFC, 0x31, 0x14, 0xDF, 0xFC, 0x31,
+    0x14, 0xDF, 0xFC, 0x31, 0x24, 0xCE, 0xEC, 0x42, 0x24, 0xCE, 0xEC, 0x42, 0x24, 0xCE, 0xEC, 0x42,
+    0x24, 0xCE, 0xEC, 0x42, 0x24, 0xCE, 0xEC, 0x42, 0x24, 0xCE, 0xEC, 0x42, 0x24, 0xCE, 0xEC, 0x42,
+    0x24, 0xCE, 0xEC, 0x42, 0x7F, 0x24, 0xCF, 0xEC, 0x41, 0x24, 0xCF, 0xEC, 0x41, 0x24, 0xCF, 0xEC,
+    0x41, 0x24, 0xCF, 0xEC, 0x41, 0x24, 0xCF, 0xEC, 0x41, 0x24, 0xCF, 0xEC, 0x41, 0x24, 0xCF, 0xEC,
+    0x41, 0x24, 0xCF, 0xEC, 0x41, 0x34, 0xDF, 0xDC, 0x31, 0x34, 0xDF, 0xDC, 0x31, 0x34, 0xDF, 0xDC,
+    0x31, 0x34, 0xDF, 0xDC, 0x31, 0x34, 0xDF, 0xDC, 0x31, 0x34, 0xDF, 0xDC, 0x31, 0x34, 0xDF, 0xDC,
+    0x31, 0x34, 0xDF, 0xDC, 0x31, 0x7F, 0x24, 0xCF, 0xEC, 0x41, 0x24, 0xCF, 0xEC, 0x41, 0x24, 0xCF,
+    0xEC, 0x41, 0x24, 0xCF, 0xEC, 0x41, 0x24, 0xCF, 0xEC, 0x41, 0x24, 0xCF, 0xEC, 0x41, 0x24, 0xCF,
+    0xEC, 0x41, 0x24, 0xCF, 0xEC, 0x41, 0x24, 0xD0, 0xEC, 0x30, 0x24, 0xD0, 0xEC, 0x30, 0x24, 0xD0,
+    0xEC, 0x30, 0x24, 0xD0, 0xEC, 0x30, 0x24, 0xD0, 0xEC, 0x30, 0x24, 0xD0, 0xEC, 0x30, 0x24, 0xD0,
+    0xEC, 0x30, 0x24, 0xD0, 0xEC, 0x30, 0x7F, 0x35, 0xCF, 0xDB, 0x41, 0x35, 0xCF, 0xDB, 0x41, 0x35,
+    0xCF, 0xDB, 0x41, 0x35, 0xCF, 0xDB, 0x41, 0x35, 0xCF, 0xDB, 0x41, 0x35, 0xCF, 0xDB, 0x41, 0x35,
+    0xCF, 0xDB, 0x41, 0x35, 0xCF, 0xDB, 0x41, 0x24, 0xD0, 0xEC, 0x30, 0x24, 0xD0, 0xEC, 0x30, 0x24,
+    0xD0, 0xEC, 0x30, 0x24, 0xD0, 0xEC, 0x30, 0x24, 0xD0, 0xEC, 0x30, 0x24, 0xD0, 0xEC, 0x30, 0x24,
+    0xD0, 0xEC, 0x30, 0x24, 0xD0, 0xEC, 0x30, 0x7F, 0x34, 0xDF, 0xDC, 0x31, 0x34, 0xDF, 0xDC, 0x31,
+    0x34, 0xDF, 0xDC, 0x31, 0x34, 0xDF, 0xDC, 0x31, 0x34, 0xDF, 0xDC, 0x31, 0x34, 0xDF, 0xDC, 0x31,
+    0x34, 0xDF, 0xDC, 0x31, 0x34, 0xDF, 0xDC, 0x31, 0x34, 0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC, 0x30,
+    0x34, 0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC, 0x30,
+    0x34, 0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC, 0x30, 0x7F, 0x34, 0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC,
+    0x30, 0x34, 0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC,
+    0x30, 0x34, 0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC,
+    0x30, 0x34, 0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC,
+    0x30, 0x34, 0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC, 0x30, 0x7F, 0x35, 0xD0, 0xDB, 0x30, 0x35, 0xD0,
+    0xDB, 0x30, 0x35, 0xD0, 0xDB, 0x30, 0x35, 0xD0, 0xDB, 0x30, 0x35, 0xD0, 0xDB, 0x30, 0x35, 0xD0,
+    0xDB, 0x30, 0x35, 0xD0, 0xDB, 0x30, 0x35, 0xD0, 0xDB, 0x30, 0x34, 0xD1, 0xDC, 0x3F, 0x34, 0xD1,
+    0xDC, 0x3F, 0x34, 0xD1, 0xDC, 0x3F, 0x34, 0xD1, 0xDC, 0x3F, 0x34, 0xD1, 0xDC, 0x3F, 0x34, 0xD1,
+    0xDC, 0x3F, 0x34, 0xD1, 0xDC, 0x3F, 0x34, 0xD1, 0xDC, 0x3F, 0x80, 0x04, 0x7F, 0xE0, 0xDC, 0x20,
+    0x44, 0xE0, 0xDC, 0x20, 0x44, 0xE0, 0xDC, 0x20, 0x44, 0xE0, 0xDC, 0x20, 0x44, 0xE0, 0xDC, 0x20,
+    0x44, 0xE0, 0xDC, 0x20, 0x44, 0xE0, 0xDC, 0x20, 0x44, 0xE0, 0xDC, 0x20, 0x34, 0xD1, 0xCC, 0x3F,
+    0x34, 0xD1, 0xCC, 0x3F, 0x34, 0xD1, 0xCC, 0x3F, 0x34, 0xD1, 0xCC, 0x3F, 0x34, 0xD1, 0xCC, 0x3F,
+    0x34, 0xD1, 0xCC, 0x3F, 0x34, 0xD1, 0xCC, 0x3F, 0x34, 0xD1, 0xCC, 0x3F, 0x34, 0x7F, 0xE1, 0xDC,
+    0x2F, 0x34, 0xE1, 0xDC, 0x2F, 0x34, 0xE1, 0xDC, 0x2F, 0x34, 0xE1, 0xDC, 0x2F, 0x34, 0xE1, 0xDC,
+    0x2F, 0x34, 0xE1, 0xDC, 0x2F, 0x34, 0xE1, 0xDC, 0x2F, 0x34, 0xE1, 0xDC, 0x2F, 0x44, 0xE1, 0xCC,
+    0x2F, 0x44, 0xE1, 0xCC, 0x2F, 0x44, 0xE1, 0xCC, 0x2F, 0x44, 0xE1, 0xCC, 0x2F, 0x44, 0xE1, 0xCC,
+    0x2F, 0x44, 0xE1, 0xCC, 0x2F, 0x44, 0xE1, 0xCC, 0x2F, 0x44, 0xE1, 0xCC, 0x2F, 0x44, 0x7F, 0xE1,
+    0xDC, 0x2F, 0x44, 0xE1, 0xDC, 0x2F, 0x44, 0xE1, 0xDC, 0x2F, 0x44, 0xE1, 0xDC, 0x2F, 0x44, 0xE1,
+    0xDC, 0x2F, 0x44, 0xE1, 0xDC, 0x2F, 0x44, 0xE1, 0xDC, 0x2F, 0x44, 0xE1, 0xDC, 0x2F, 0x34, 0xE1,
+    0xCC, 0x2F, 0x34, 0xE1, 0xCC, 0x2F, 0x34, 0xE1, 0xCC, 0x2F, 0x34, 0xE1, 0xCC, 0x2F, 0x34, 0xE1,
+    0xCC, 0x2F, 0x34, 0xE1, 0xCC, 0x2F, 0x34, 0xE1, 0xCC, 0x2F, 0x34, 0xE1, 0xCC, 0x2F, 0x44, 0x7F,
+    0xE1, 0xCC, 0x2F, 0x44, 0xE1, 0xCC, 0x2F, 0x44, 0xE1, 0xCC, 0x2F, 0x44, 0xE1, 0xCC, 0x2F, 0x44,
+    0xE1, 0xCC, 0x2F, 0x44, 0xE1, 0xCC, 0x2F, 0x44, 0xE1, 0xCC, 0x2F, 0x44, 0xE1, 0xCC, 0x2F, 0x44,
+    0xE2, 0xCC, 0x2F, 0x44, 0xE2, 0xCC, 0x2F, 0x44, 0xE2, 0xCC, 0x2F, 0x44, 0xE2, 0xCC, 0x2F, 0x44,
+    0xE2, 0xCC, 0x2F, 0x44, 0xE2, 0xCC, 0x2F, 0x44, 0xE2, 0xCC, 0x2F, 0x44, 0xE2, 0xCC, 0x2F, 0x44,
+    0x7F, 0xE1, 0xCC, 0x2E, 0x44, 0xE1, 0xCC, 0x2E, 0x44, 0xE1, 0xCC, 0x2E, 0x44, 0xE1, 0xCC, 0x2E,
+    0x44, 0xE1, 0xCC, 0x2E, 0x44, 0xE1, 0xCC, 0x2E, 0x44, 0xE1, 0xCC, 0x2E, 0x44, 0xE1, 0xCC, 0x2E,
+    0x44, 0xF2, 0xDC, 0x1E, 0x44, 0xF2, 0xDC, 0x1E, 0x44, 0xF2, 0xDC, 0x1E, 0x44, 0xF2, 0xDC, 0x1E,
+    0x44, 0xF2, 0xDC, 0x1E, 0x44, 0xF2, 0xDC, 0x1E, 0x44, 0xF2, 0xDC, 0x1E, 0x44, 0xF2, 0xDC, 0x1E,
+    0x34, 0x7F, 0xE2, 0xCC, 0x2E, 0x34, 0xE2, 0xCC, 0x2E, 0x34, 0xE2, 0xCC, 0x2E, 0x34, 0xE2, 0xCC,
+    0x2E, 0x34, 0xE2, 0xCC, 0x2E, 0x34, 0xE2, 0xCC, 0x2E, 0x34, 0xE2, 0xCC, 0x2E, 0x34, 0xE2, 0xCC,
+    0x2E, 0x43, 0xF2, 0xCD, 0x1E, 0x43, 0xF2, 0xCD, 0x1E, 0x43, 0xF2, 0xCD, 0x1E, 0x43, 0xF2, 0xCD,
+    0x1E, 0x43, 0xF2, 0xCD, 0x1E, 0x43, 0xF2, 0xCD, 0x1E, 0x43, 0xF2, 0xCD, 0x1E, 0x43, 0xF2, 0xCD,
+    0x1E, 0x54, 0x7F, 0xF2, 0xCC, 0x1E, 0x54, 0xF2, 0xCC, 0x1E, 0x54, 0xF2, 0xCC, 0x1E, 0x54, 0xF2,
+    0xCC, 0x1E, 0x54, 0xF2, 0xCC, 0x1E, 0x54, 0xF2, 0xCC, 0x1E, 0x54, 0xF2, 0xCC, 0x1E, 0x54, 0xF2,
+    0xCC, 0x1E, 0x44, 0xF2, 0xBC, 0x1E, 0x44, 0xF2, 0xBC, 0x1E, 0x44, 0xF2, 0xBC, 0x1E, 0x44, 0xF2,
+    0xBC, 0x1E, 0x44, 0xF2, 0xBC, 0x1E, 0x44, 0xF2, 0xBC, 0x1E, 0x44, 0xF2, 0xBC, 0x1E, 0x44, 0xF2,
+    0xBC, 0x1E, 0x43, 0x7F, 0xF2, 0xCD, 0x1E, 0x43, 0xF2, 0xCD, 0x1E, 0x43, 0xF2, 0xCD, 0x1E, 0x43,
+    0xF2, 0xCD, 0x1E, 0x43, 0xF2, 0xCD, 0x1E, 0x43, 0xF2, 0xCD, 0x1E, 0x43, 0xF2, 0xCD, 0x1E, 0x43,
+    0xF2, 0xCD, 0x1E, 0x44, 0x03, 0xCC, 0x0E, 0x44, 0x03, 0xCC, 0x0E, 0x44, 0x03, 0xCC, 0x0E, 0x44,
+    0x03, 0xCC, 0x0E, 0x44, 0x03, 0xCC, 0x0E, 0x44, 0x03, 0xCC, 0x0E, 0x44, 0x03, 0xCC, 0x0E, 0x44,
+    0x03, 0xCC, 0x0E, 0x43, 0x7F, 0xF2, 0xCD, 0x1D, 0x43, 0xF2, 0xCD, 0x1D, 0x43, 0xF2, 0xCD, 0x1D,
+    0x43, 0xF2, 0xCD, 0x1D, 0x43, 0xF2, 0xCD, 0x1D, 0x43, 0xF2, 0xCD, 0x1D, 0x43, 0xF2, 0xCD, 0x1D,
+    0x43, 0xF2, 0xCD, 0x1D, 0x43, 0x03, 0xCD, 0x0D, 0x43, 0x03, 0xCD, 0x0D, 0x43, 0x03, 0xCD, 0x0D,
+    0x43, 0x03, 0xCD, 0x0D, 0x43, 0x03, 0xCD, 0x0D, 0x43, 0x03, 0xCD, 0x0D, 0x43, 0x03, 0xCD, 0x0D,
+    0x43, 0x03, 0xCD, 0x0D, 0x43, 0x7F, 0xF2, 0xCD, 0x1E, 0x43, 0xF2, 0xCD, 0x1E, 0x43, 0xF2, 0xCD,
+    0x1E, 0x43, 0xF2, 0xCD, 0x1E, 0x43, 0xF2, 0xCD, 0x1E, 0x43, 0xF2, 0xCD, 0x1E, 0x43, 0xF2, 0xCD,
+    0x1E, 0x43, 0xF2, 0xCD, 0x1E, 0x53, 0x03, 0xCD, 0x0D, 0x53, 0x03, 0xCD, 0x0D, 0x53, 0x03, 0xCD,
+    0x0D, 0x53, 0x03, 0xCD, 0x0D, 0x53, 0x03, 0xCD, 0x0D, 0x53, 0x03, 0xCD, 0x0D, 0x53, 0x03, 0xCD,
+    0x0D, 0x53, 0x03, 0xCD, 0x0D, 0x43, 0x7F, 0x03, 0xBD, 0x0D, 0x43, 0x03, 0xBD, 0x0D, 0x43, 0x03,
+    0xBD, 0x0D, 0x43, 0x03, 0xBD, 0x0D, 0x43, 0x03, 0xBD, 0x0D, 0x43, 0x03, 0xBD, 0x0D, 0x43, 0x03,
+    0xBD, 0x0D, 0x43, 0x03, 0xBD, 0x0D, 0x43, 0x03, 0xCD, 0x0D, 0x43, 0x03, 0xCD, 0x0D, 0x43, 0x03,
+    0xCD, 0x0D, 0x43, 0x03, 0xCD, 0x0D, 0x43, 0x03, 0xCD, 0x0D, 0x43, 0x03, 0xCD, 0x0D, 0x43, 0x03,
+    0xCD, 0x0D, 0x43, 0x03, 0xCD, 0x0D, 0x43, 0x7F, 0x03, 0xCD, 0x0D, 0x43, 0x03, 0xCD, 0x0D, 0x43,
+    0x03, 0xCD, 0x0D, 0x43, 0x03, 0xCD, 0x0D, 0x43, 0x03, 0xCD, 0x0D, 0x43, 0x03, 0xCD, 0x0D, 0x43,
+    0x03, 0xCD, 0x0D, 0x43, 0x03, 0xCD, 0x0D, 0x43, 0x14, 0xCD, 0xFC, 0x43, 0x14, 0xCD, 0xFC, 0x43,
+    0x14, 0xCD, 0xFC, 0x43, 0x14, 0xCD, 0xFC, 0x43, 0x14, 0xCD, 0xFC, 0x43, 0x14, 0xCD, 0xFC, 0x43,
+    0x14, 0xCD, 0xFC, 0x43, 0x14, 0xCD, 0xFC, 0x42, 0x7F, 0x03, 0xCE, 0x0D, 0x42, 0x03, 0xCE, 0x0D,
+    0x42, 0x03, 0xCE, 0x0D, 0x42, 0x03, 0xCE, 0x0D, 0x42, 0x03, 0xCE, 0x0D, 0x42, 0x03, 0xCE, 0x0D,
+    0x42, 0x03, 0xCE, 0x0D, 0x42, 0x03, 0xCE, 0x0D, 0x53, 0x13, 0xCD, 0xFD, 0x53, 0x13, 0xCD, 0xFD,
+    0x53, 0x13, 0xCD, 0xFD, 0x53, 0x13, 0xCD, 0xFD, 0x53, 0x13, 0xCD, 0xFD, 0x53, 0x13, 0xCD, 0xFD,
+    0x53, 0x13, 0xCD, 0xFD, 0x53, 0x13, 0xCD, 0xFD, 0x42, 0x7F, 0x14, 0xBE, 0xFC, 0x42, 0x14, 0xBE,
+    0xFC, 0x42, 0x14, 0xBE, 0xFC, 0x42, 0x14, 0xBE, 0xFC, 0x42, 0x14, 0xBE, 0xFC, 0x42, 0x14, 0xBE,
+    0xFC, 0x42, 0x14, 0xBE, 0xFC, 0x42, 0x14, 0xBE, 0xFC, 0x42, 0x13, 0xCE, 0xFD, 0x42, 0x13, 0xCE,
+    0xFD, 0x42, 0x13, 0xCE, 0xFD, 0x42, 0x13, 0xCE, 0xFD, 0x42, 0x13, 0xCE, 0xFD, 0x42, 0x13, 0xCE,
+    0xFD, 0x42, 0x13, 0xCE, 0xFD, 0x42, 0x13, 0xCE, 0xFD, 0x43, 0x7F, 0x14, 0xCD, 0xFC, 0x43, 0x14,
+    0xCD, 0xFC, 0x43, 0x14, 0xCD, 0xFC, 0x43, 0x14, 0xCD, 0xFC, 0x43, 0x14, 0xCD, 0xFC, 0x43, 0x14,
+    0xCD, 0xFC, 0x43, 0x14, 0xCD, 0xFC, 0x43, 0x14, 0xCD, 0xFC, 0x42, 0x14, 0xCE, 0xFC, 0x42, 0x14,
+    0xCE, 0xFC, 0x42, 0x14, 0xCE, 0xFC, 0x42, 0x14, 0xCE, 0xFC, 0x42, 0x14, 0xCE, 0xFC, 0x42, 0x14,
+    0xCE, 0xFC, 0x42, 0x14, 0xCE, 0xFC, 0x42, 0x14, 0xCE, 0xFC, 0x41, 0x7F, 0x13, 0xCF, 0xFD, 0x41,
+    0x13, 0xCF, 0xFD, 0x41, 0x13, 0xCF, 0xFD, 0x41, 0x13, 0xCF, 0xFD, 0x41, 0x13, 0xCF, 0xFD, 0x41,
+    0x13, 0xCF, 0xFD, 0x41, 0x13, 0xCF, 0xFD, 0x41, 0x13, 0xCF, 0xFD, 0x42, 0x24, 0xCE, 0xEC, 0x42,
+    0x24, 0xCE, 0xEC, 0x42, 0x24, 0xCE, 0xEC, 0x42, 0x24, 0xCE, 0xEC, 0x42, 0x24, 0xCE, 0xEC, 0x42,
+    0x24, 0xCE, 0xEC, 0x42, 0x24, 0xCE, 0xEC, 0x42, 0x24, 0xCE, 0xEC, 0x42, 0x7F, 0x14, 0xDE, 0xFC,
+    0x42, 0x14, 0xDE, 0xFC, 0x42, 0x14, 0xDE, 0xFC, 0x42, 0x14, 0xDE, 0xFC, 0x42, 0x14, 0xDE, 0xFC,
+    0x42, 0x14, 0xDE, 0xFC, 0x42, 0x14, 0xDE, 0xFC, 0x42, 0x14, 0xDE, 0xFC, 0x31, 0x24, 0xCF, 0xEC,
+    0x31, 0x24, 0xCF, 0xEC, 0x31, 0x24, 0xCF, 0xEC, 0x31, 0x24, 0xCF, 0xEC, 0x31, 0x24, 0xCF, 0xEC,
+    0x31, 0x24, 0xCF, 0xEC, 0x31, 0x24, 0xCF, 0xEC, 0x31, 0x24, 0xCF, 0xEC, 0x42, 0x7F, 0x24, 0xCE,
+    0xEC, 0x42, 0x24, 0xCE, 0xEC, 0x42, 0x24, 0xCE, 0xEC, 0x42, 0x24, 0xCE, 0xEC, 0x42, 0x24, 0xCE,
+    0xEC, 0x42, 0x24, 0xCE, 0xEC, 0x42, 0x24, 0xCE, 0xEC, 0x42, 0x24, 0xCE, 0xEC, 0x41, 0x24, 0xCF,
+    0xEC, 0x41, 0x24, 0xCF, 0xEC, 0x41, 0x24, 0xCF, 0xEC, 0x41, 0x24, 0xCF, 0xEC, 0x41, 0x24, 0xCF,
+    0xEC, 0x41, 0x24, 0xCF, 0xEC, 0x41, 0x24, 0xCF, 0xEC, 0x41, 0x24, 0xCF, 0xEC, 0x31, 0x7F, 0x24,
+    0xDF, 0xEC, 0x31, 0x24, 0xDF, 0xEC, 0x31, 0x24, 0xDF, 0xEC, 0x31, 0x24, 0xDF, 0xEC, 0x31, 0x24,
+    0xDF, 0xEC, 0x31, 0x24, 0xDF, 0xEC, 0x31, 0x24, 0xDF, 0xEC, 0x31, 0x24, 0xDF, 0xEC, 0x41, 0x24,
+    0xCF, 0xEC, 0x41, 0x24, 0xCF, 0xEC, 0x41, 0x24, 0xCF, 0xEC, 0x41, 0x24, 0xCF, 0xEC, 0x41, 0x24,
+    0xCF, 0xEC, 0x41, 0x24, 0xCF, 0xEC, 0x41, 0x24, 0xCF, 0xEC, 0x41, 0x24, 0xCF, 0xEC, 0x41, 0x7F,
+    0x24, 0xDF, 0xEC, 0x41, 0x24, 0xDF, 0xEC, 0x41, 0x24, 0xDF, 0xEC, 0x41, 0x24, 0xDF, 0xEC, 0x41,
+    0x24, 0xDF, 0xEC, 0x41, 0x24, 0xDF, 0xEC, 0x41, 0x24, 0xDF, 0xEC, 0x41, 0x24, 0xDF, 0xEC, 0x31,
+    0x34, 0xCF, 0xDC, 0x31, 0x34, 0xCF, 0xDC, 0x31, 0x34, 0xCF, 0xDC, 0x31, 0x34, 0xCF, 0xDC, 0x31,
+    0x34, 0xCF, 0xDC, 0x31, 0x34, 0xCF, 0xDC, 0x31, 0x34, 0xCF, 0xDC, 0x31, 0x34, 0xCF, 0xDC, 0x30,
+    0x7F, 0x24, 0xD0, 0xEC, 0x30, 0x24, 0xD0, 0xEC, 0x30, 0x24, 0xD0, 0xEC, 0x30, 0x24, 0xD0, 0xEC,
+    0x30, 0x24, 0xD0, 0xEC, 0x30, 0x24, 0xD0, 0xEC, 0x30, 0x24, 0xD0, 0xEC, 0x30, 0x24, 0xD0, 0xEC,
+    0x41, 0x35, 0xDF, 0xDC, 0x41, 0x35, 0xDF, 0xDC, 0x41, 0x35, 0xDF, 0xDC, 0x41, 0x35, 0xDF, 0xDC,
+    0x41, 0x35, 0xDF, 0xDC, 0x41, 0x35, 0xDF, 0xDC, 0x41, 0x35, 0xDF, 0xDC, 0x41, 0x35, 0xDF, 0xDC,
+    0x30, 0x7F, 0x34, 0xC0, 0xDB, 0x30, 0x34, 0xC0, 0xDB, 0x30, 0x34, 0xC0, 0xDB, 0x30, 0x34, 0xC0,
+    0xDB, 0x30, 0x34, 0xC0, 0xDB, 0x30, 0x34, 0xC0, 0xDB, 0x30, 0x34, 0xC0, 0xDB, 0x30, 0x34, 0xC0,
+    0xDB, 0x30, 0x34, 0xD0, 0xEC, 0x30, 0x34, 0xD0, 0xEC, 0x30, 0x34, 0xD0, 0xEC, 0x30, 0x34, 0xD0,
+    0xEC, 0x30, 0x34, 0xD0, 0xEC, 0x30, 0x34, 0xD0, 0xEC, 0x30, 0x34, 0xD0, 0xEC, 0x30, 0x34, 0xD0,
+    0xEC, 0x30, 0x7F, 0x34, 0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC, 0x30, 0x34,
+    0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC, 0x30, 0x34,
+    0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC, 0x30, 0x34,
+    0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC, 0x30, 0x34,
+    0xD0, 0xDC, 0x20, 0x7F, 0x34, 0xE0, 0xCC, 0x20, 0x34, 0xE0, 0xCC, 0x20, 0x34, 0xE0, 0xCC, 0x20,
+    0x34, 0xE0, 0xCC, 0x20, 0x34, 0xE0, 0xCC, 0x20, 0x34, 0xE0, 0xCC, 0x20, 0x34, 0xE0, 0xCC, 0x20,
+    0x34, 0xE0, 0xCC, 0x3F, 0x35, 0xD1, 0xDB, 0x3F, 0x35, 0xD1, 0xDB, 0x3F, 0x35, 0xD1, 0xDB, 0x3F,
+    0x35, 0xD1, 0xDB, 0x3F, 0x35, 0xD1, 0xDB, 0x3F, 0x35, 0xD1, 0xDB, 0x3F, 0x35, 0xD1, 0xDB, 0x3F,
+    0x35, 0xD1, 0xDB, 0x30, 0x5E, 0x34, 0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC,
+    0x30, 0x34, 0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC, 0x30, 0x34, 0xD0, 0xDC,
+    0x30, 0x34, 0xD0, 0xDC
+};
+
+const uint32_t AnimDemo_Size = sizeof(AnimDemo);
@@ -0,0 +1,306 @@
+/**
+  ************************************************************************************
+  * @file              Breath.c
+  * @author         None
+  * @version       V1.2.0
+  * @date            2026-10-17
+  * @brief           呼吸灯参数评估与呼吸效果模块源文件
+  *
+  * @details        本文件实现了呼吸灯参数的评估与网格扫描：
+  *                        1. 按main.c的相位累加器亮度逐级计算脉宽，统计级数与丢失步数；
+  *                           每tick亮度变化超过1时用Breath_Tick()逐tick走完上升段
+  *                        2. 载波和呼吸周期由Delay_Until截止时刻和相位累加器决定，都是精确值；
+  *                           循环体耗时只影响CPU占用和最短脉宽
+  *                        3. 按IEEE 1789对100%调制深度给出闪烁风险分级
+  *                        4. 呼吸效果用32位相位累加器，增量的小数部分按余数累计，
+  *                           任意毫秒周期都能精确达到
+  *
+  * @note            最多逐级计算brightness_max + 1个亮度，不逐PWM周期仿真
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 增加相位累加器呼吸效果
+  *                         - 2026-10-17 V1.2.0 评估改按相位累加器 + Delay_Until模型；周期下限改为两个tick
+  *
+  ************************************************************************************
+  */
+
+#include "Breath.h"
+
+#define BREATH_FLICKER_NOEFFECT_HZ   3000U       /* 100%调制深度下无可观测影响的最低频率 */
+#define BREATH_FLICKER_LOWRISK_HZ    1250U       /* 100%调制深度下低风险的最低频率 */
+
+/**
+  * @brief           统计一个亮度值对应的脉宽
+  * @param        metrics 评估指标
+  * @param        brightness 亮度
+  * @param        bmax 亮度最大值
+  * @param        pwm_cycles 每个PWM周期的CPU周期数
+  * @param        last 上一个亮度的脉宽，首次调用为UINT32_MAX
+  * @retval          本亮度的实际脉宽，单位：CPU周期
+  */
+static uint32_t Breath_CountLevel(Breath_Metrics *metrics, uint32_t brightness, uint32_t bmax,
+                                  uint32_t pwm_cycles, uint32_t last)
+{
+    uint32_t on = brightness * pwm_cycles / bmax;
+
+    /* 熄灭段之前的点亮与Delay_Until调用本身要占用一段时间，短脉冲被拉长 */
+    if(on != 0 && on < BREATH_LOOP_CYCLES) on = BREATH_LOOP_CYCLES;
+    if(last == UINT32_MAX) {
+        metrics->levels = 1;
+    } else if(on == last) {
+        metrics->lost_steps++;
+    } else {
+        metrics->levels++;
+        if(metrics->min_step_cycles == 0 || on - last < metrics->min_step_cycles) {
+            metrics->min_step_cycles = on - last;
+        }
+    }
+    return on;
+}
+
+/**
+  * @brief           评估一组参数
+  * @param        params 调节参数
+  * @param        core_clock CPU主频，单位：Hz
+  * @param        metrics 输出评估指标
+  * @retval          0=成功，1=参数非法
+  */
+uint8_t Breath_Evaluate(const Breath_Params *params, uint32_t core_clock, Breath_Metrics *metrics)
+{
+    Breath_Effect eff;
+    uint64_t pwm_cycles;
+    uint32_t half_ticks;
+    uint32_t last = UINT32_MAX;
+    uint32_t b, prev, i;
+
+    if(params->pwm_cycle == 0 || params->brightness_max == 0 || params->brightness_max > 0xFFFFU
+       || params->period_ms == 0 || core_clock < 1000000U) {
+        return 1;
+    }
+    pwm_cycles = (uint64_t)(core_clock / 1000000U) * params->pwm_cycle;
+    if(pwm_cycles * params->brightness_max > 0xFFFFFFFFU) return 1;
+
+    /* 周期按Breath_SetPeriod()的限幅取值 */
+    Breath_Start(&eff, params->period_ms, 0, (uint16_t)params->brightness_max, params->pwm_cycle);
+    half_ticks = eff.den / (2U * eff.tick_us);
+
+    metrics->lost_steps = 0;
+    metrics->min_step_cycles = 0;
+    if(half_ticks >= params->brightness_max) {
+        /* 每tick亮度变化不超过1，上升段经过每一个亮度值 */
+        for(b = 0; b <= params->brightness_max; b++) {
+            last = Breath_CountLevel(metrics, b, params->brightness_max, (uint32_t)pwm_cycles, last);
+        }
+    } else {
+        /* 亮度跳级：按Breath_Tick()逐tick走完上升段 */
+        prev = 0;
+        last = Breath_CountLevel(metrics, 0, params->brightness_max, (uint32_t)pwm_cycles, last);
+        for(i = 0; i < half_ticks; i++) {
+            b = Breath_Tick(&eff);
+            if(b != prev) last = Breath_CountLevel(metrics, b, params->brightness_max, (uint32_t)pwm_cycles, last);
+            if(eff.event == BREATH_EVT_PEAK) break;
+            prev = b;
+        }
+    }
+
+    /* 载波周期由截止时刻决定，与循环体耗时无关 */
+    metrics->period_ms = (eff.den + 500U) / 1000U;
+    metrics->carrier_hz = (uint32_t)((1000000U + params->pwm_cycle / 2U) / params->pwm_cycle);
+    metrics->overhead_ppm = (uint32_t)((uint64_t)BREATH_LOOP_CYCLES * 1000000U / pwm_cycles);
+
+    if(metrics->carrier_hz >= BREATH_FLICKER_NOEFFECT_HZ) {
+        metrics->flicker_risk = 0;
+    } else if(metrics->carrier_hz >= BREATH_FLICKER_LOWRISK_HZ) {
+        metrics->flicker_risk = 1;
+    } else {
+        metrics->flicker_risk = 2;
+    }
+    return 0;
+}
+
+/**
+  * @brief           单个参数在网格中的取值个数
+  * @param        min 下限
+  * @param        max 上限
+  * @param        inc 步长
+  * @retval          取值个数
+  */
+static uint32_t Breath_AxisCount(uint32_t min, uint32_t max, uint32_t inc)
+{
+    if(max < min) return 0;
+    return (max - min) / (inc ? inc : 1U) + 1U;
+}
+
+/**
+  * @brief           网格中的参数组数
+  * @param        grid 参数网格
+  * @retval          参数组数
+  */
+uint32_t Breath_GridCount(const Breath_Grid *grid)
+{
+    return Breath_AxisCount(grid->min.pwm_cycle, grid->max.pwm_cycle, grid->inc.pwm_cycle)
+         * Breath_AxisCount(grid->min.brightness_max, grid->max.brightness_max, grid->inc.brightness_max)
+         * Breath_AxisCount(grid->min.period_ms, grid->max.period_ms, grid->inc.period_ms);
+}
+
+/**
+  * @brief           取网格中第index组参数
+  * @param        grid 参数网格
+  * @param        index 下标
+  * @param        params 输出调节参数
+  * @retval          None
+  * @note           下标按period_ms、brightness_max、pwm_cycle的顺序由低到高展开
+  */
+void Breath_GridAt(const Breath_Grid *grid, uint32_t index, Breath_Params *params)
+{
+    uint32_t n;
+
+    n = Breath_AxisCount(grid->min.period_ms, grid->max.period_ms, grid->inc.period_ms);
+    params->period_ms = grid->min.period_ms + (index % n) * (grid->inc.period_ms ? grid->inc.period_ms : 1U);
+    index /= n;
+
+    n = Breath_AxisCount(grid->min.brightness_max, grid->max.brightness_max, grid->inc.brightness_max);
+    params->brightness_max = grid->min.brightness_max + (index % n) * (grid->inc.brightness_max ? grid->inc.brightness_max : 1U);
+    index /= n;
+
+    params->pwm_cycle = grid->min.pwm_cycle + index * (grid->inc.pwm_cycle ? grid->inc.pwm_cycle : 1U);
+}
+
+/**
+  * @brief           评估网格中连续的一段参数组
+  * @param        grid 参数网格
+  * @param        first 起始下标
+  * @param        count 组数
+  * @param        core_clock CPU主频，单位：Hz
+  * @param        visit 回调
+  * @param        ctx 回调参数
+  * @retval          None
+  */
+void Breath_SweepRange(const Breath_Grid *grid, uint32_t first, uint32_t count,
+                       uint32_t core_clock, Breath_Visit visit, void *ctx)
+{
+    uint32_t total = Breath_GridCount(grid);
+    uint32_t i;
+    Breath_Params params;
+    Breath_Metrics metrics;
+
+    for(i = first; i < total && i - first < count; i++) {
+        Breath_GridAt(grid, i, &params);
+        if(Breath_Evaluate(&params, core_clock, &metrics) == 0) {
+            visit(i, &params, &metrics, ctx);
+        }
+    }
+}
+
+/**
+  * @brief           判断a是否帕累托支配b
+  * @param        a 指标a
+  * @param        b 指标b
+  * @retval          1=支配，0=不支配
+  */
+uint8_t Breath_Dominates(const Breath_Metrics *a, const Breath_Metrics *b)
+{
+    if(a->carrier_hz < b->carrier_hz || a->levels < b->levels || a->overhead_ppm > b->overhead_ppm) {
+        return 0;
+    }
+    return (a->carrier_hz > b->carrier_hz || a->levels > b->levels || a->overhead_ppm < b->overhead_ppm);
+}
+
+/**
+  * @brief           启动呼吸效果
+  * @param        eff 效果状态
+  * @param        period_ms 完整呼吸周期，单位：毫秒
+  * @param        lo 亮度下限
+  * @param        hi 亮度上限
+  * @param        tick_us 调用间隔，单位：微秒
+  * @retval          None
+  */
+void Breath_Start(Breath_Effect *eff, uint32_t period_ms, uint16_t lo, uint16_t hi, uint32_t tick_us)
+{
+    eff->phase = 0;
+    eff->rem = 0;
+    eff->tick_us = tick_us ? tick_us : 1U;
+    eff->event = BREATH_EVT_NONE;
+    eff->den = 0;
+    Breath_SetRange(eff, lo, hi);
+    Breath_SetPeriod(eff, period_ms ? period_ms : BREATH_PERIOD_MS);
+}
+
+/**
+  * @brief           运行中修改呼吸周期
+  * @param        eff 效果状态
+  * @param        period_ms 新的完整呼吸周期，单位：毫秒
+  * @retval          None
+  */
+void Breath_SetPeriod(Breath_Effect *eff, uint32_t period_ms)
+{
+    uint64_t period_us = (uint64_t)period_ms * 1000U;
+    uint64_t total;
+
+    if(period_ms == 0) return;
+    /* 周期不足两个tick时按两个tick处理（增量为2^31，每tick交替越过最亮点和最暗点；
+       只有一个tick时增量为2^32，相位不动，效果冻结）；分母限制在31位内，rem + num不会溢出（最长约35分钟） */
+    if(period_us < 2U * (uint64_t)eff->tick_us) period_us = 2U * (uint64_t)eff->tick_us;
+    if(period_us > 0x7FFFFFFFU) period_us = 0x7FFFFFFFU;
+
+    /* 每tick相位增量 = 2^32 × tick_us ÷ period_us = inc + num/den */
+    total = ((uint64_t)eff->tick_us << 32);
+    eff->inc = (uint32_t)(total / period_us);
+    eff->num = (uint32_t)(total % period_us);
+    /* 余数按新分母等比例换算，保持小数相位连续 */
+    if(eff->den != 0) {
+        eff->rem = (uint32_t)((uint64_t)eff->rem * period_us / eff->den);
+    }
+    eff->den = (uint32_t)period_us;
+}
+
+/**
+  * @brief           运行中修改亮度范围
+  * @param        eff 效果状态
+  * @param        lo 亮度下限
+  * @param        hi 亮度上限
+  * @retval          None
+  */
+void Breath_SetRange(Breath_Effect *eff, uint16_t lo, uint16_t hi)
+{
+    if(hi < lo) {
+        uint16_t t = lo;
+        lo = hi;
+        hi = t;
+    }
+    eff->lo = lo;
+    eff->hi = hi;
+}
+
+/**
+  * @brief           推进一个tick并返回当前亮度
+  * @param        eff 效果状态
+  * @retval          当前亮度
+  */
+uint16_t Breath_Tick(Breath_Effect *eff)
+{
+    uint32_t old = eff->phase;
+    uint32_t tri;
+
+    /* 相位推进：整数部分直接相加，小数部分按余数进位 */
+    eff->phase += eff->inc;
+    eff->rem += eff->num;
+    if(eff->rem >= eff->den) {
+        eff->rem -= eff->den;
+        eff->phase++;
+    }
+
+    /* 越过半周期为最亮点，相位回绕为最暗点 */
+    if(eff->phase < old) {
+        eff->event = BREATH_EVT_TROUGH;
+    } else if((old ^ eff->phase) & 0x80000000U) {
+        eff->event = BREATH_EVT_PEAK;
+    } else {
+        eff->event = BREATH_EVT_NONE;
+    }
+
+    /* 三角波：tri的高16位为0~65535的线性亮度比例 */
+    tri = (eff->phase & 0x80000000U) ? ~(eff->phase << 1) : (eff->phase << 1);
+    return (uint16_t)(eff->lo + (((uint32_t)(eff->hi - eff->lo) * (tri >> 16) + 0x8000U) >> 16));
+}
@@ -0,0 +1,202 @@
+/**
+  ************************************************************************************
+  * @file              Cmd.c
+  * @author         None
+  * @version       V1.4.0
+  * @date            2026-10-17
+  * @brief           串口命令解析模块源文件
+  *
+  * @details        本文件实现了逐字节的命令状态机：
+  *                        1. 命令字母开始一条命令，数字累加到当前参数，','开始下一个参数
+  *                        2. 结束符或空闲线时检查参数个数，合法则按类型入队，否则入队CMD_BAD
+  *                        3. 队列为单生产者单消费者环形队列，生产者和消费者都在主循环中
+  *
+  * @note            参数超过9位数字视为出错，不做溢出运算
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 数字转换拆为Cmd_PutUint()，供Preview等模块共用
+  *                         - 2026-10-17 V1.2.0 增加B命令（内存池基准测试）
+  *                         - 2026-10-17 V1.3.0 增加A命令（动画解码基准测试）
+  *                         - 2026-10-17 V1.4.0 增加D命令（DDS基准测试）
+  *
+  ************************************************************************************
+  */
+
+#include "Cmd.h"
+
+#define CMD_MAX_DIGITS                       9U             /* 每个参数最多的数字个数，保证不溢出32位 */
+
+/**
+  * @brief           结束当前命令并入队
+  * @param        p 解析器
+  * @retval          None
+  */
+static void Cmd_End(Cmd_Parser *p)
+{
+    Cmd_Msg *m = &p->cur;
+    uint8_t ok;
+
+    if(m->type == CMD_NONE && !p->bad) return;
+
+    /* 最后一个参数在结束时计数 */
+    if(p->digits > 0) m->argc++;
+
+    switch(m->type) {
+        case CMD_LEVEL:  ok = (m->argc == 1U); break;
+        case CMD_EFFECT: ok = (m->argc == 1U || m->argc == 3U); break;
+        case CMD_STATS:  ok = (m->argc == 0U); break;
+        case CMD_BENCH:  ok = (m->argc <= 2U); break;
+        case CMD_ANIM:   ok = (m->argc <= 1U); break;
+        case CMD_DDS:    ok = (m->argc <= 2U); break;
+        default:         ok = 0; break;
+    }
+    if(p->bad || !ok) m->type = CMD_BAD;
+
+    if((uint8_t)(p->head - p->tail) >= CMD_QUEUE_SIZE) {
+        p->dropped++;
+    } else {
+        p->queue[p->head & (CMD_QUEUE_SIZE - 1U)] = *m;
+        p->head++;
+    }
+
+    m->type = CMD_NONE;
+    m->argc = 0;
+    p->digits = 0;
+    p->bad = 0;
+}
+
+/**
+  * @brief           初始化解析器
+  * @param        p 解析器
+  * @retval          None
+  */
+void Cmd_Init(Cmd_Parser *p)
+{
+    p->cur.type = CMD_NONE;
+    p->cur.argc = 0;
+    p->digits = 0;
+    p->bad = 0;
+    p->head = 0;
+    p->tail = 0;
+    p->dropped = 0;
+}
+
+/**
+  * @brief           解析一段接收数据
+  * @param        ctx 解析器
+  * @param        data 数据
+  * @param        len 字节数
+  * @param        idle 1=本段之后线路空闲
+  * @retval          None
+  */
+void Cmd_Feed(void *ctx, const uint8_t *data, uint32_t len, uint8_t idle)
+{
+    Cmd_Parser *p = (Cmd_Parser *)ctx;
+    Cmd_Msg *m = &p->cur;
+    uint8_t c;
+
+    while(len--) {
+        c = *data++;
+        if(c >= '0' && c <= '9') {
+            if(m->type == CMD_NONE || m->argc >= CMD_MAX_ARGS || p->digits >= CMD_MAX_DIGITS) {
+                p->bad = 1;
+                continue;
+            }
+            if(p->digits == 0) m->arg[m->argc] = 0;
+            m->arg[m->argc] = m->arg[m->argc] * 10U + (uint32_t)(c - '0');
+            p->digits++;
+        } else if(c == ',') {
+            if(p->digits == 0 || m->argc + 1U >= CMD_MAX_ARGS) p->bad = 1;
+            else m->argc++;
+            p->digits = 0;
+        } else if(c == '\n' || c == '\r' || c == ';') {
+            Cmd_End(p);
+        } else if(c == ' ') {
+            /* 忽略空格 */
+        } else if(m->type == CMD_NONE && !p->bad) {
+            switch(c | 0x20U) {
+                case 'l': m->type = CMD_LEVEL; break;
+                case 'e': m->type = CMD_EFFECT; break;
+                case 's': m->type = CMD_STATS; break;
+                case 'b': m->type = CMD_BENCH; break;
+                case 'a': m->type = CMD_ANIM; break;
+                case 'd': m->type = CMD_DDS; break;
+                default:  p->bad = 1; break;
+            }
+        } else {
+            p->bad = 1;
+        }
+    }
+    if(idle) Cmd_End(p);
+}
+
+/**
+  * @brief           取出一条命令
+  * @param        p 解析器
+  * @param        msg 输出命令
+  * @retval          1=取到，0=队列为空
+  */
+uint8_t Cmd_Take(Cmd_Parser *p, Cmd_Msg *msg)
+{
+    if(p->head == p->tail) return 0;
+    *msg = p->queue[p->tail & (CMD_QUEUE_SIZE - 1U)];
+    p->tail++;
+    return 1;
+}
+
+/**
+  * @brief           追加一段文本
+  * @param        dst 写入位置
+  * @param        text 文本
+  * @retval          写入的字节数
+  */
+uint32_t Cmd_PutText(char *dst, const char *text)
+{
+    uint32_t n = 0;
+
+    while(text[n] != '\0') {
+        dst[n] = text[n];
+        n++;
+    }
+    return n;
+}
+
+/**
+  * @brief           追加十进制数
+  * @param        dst 写入位置
+  * @param        value 数值
+  * @retval          写入的字节数
+  */
+uint32_t Cmd_PutUint(char *dst, uint32_t value)
+{
+    char tmp[10];
+    uint32_t n = 0;
+    uint32_t k = 0;
+
+    do {
+        tmp[k++] = (char)('0' + value % 10U);
+        value /= 10U;
+    } while(value > 0);
+    while(k > 0) {
+        dst[n++] = tmp[--k];
+    }
+    return n;
+}
+
+/**
+  * @brief           追加 "name=value "
+  * @param        dst 写入位置
+  * @param        name 字段名
+  * @param        value 数值
+  * @retval          写入的字节数
+  */
+uint32_t Cmd_PutField(char *dst, const char *name, uint32_t value)
+{
+    uint32_t n = Cmd_PutText(dst, name);
+
+    dst[n++] = '=';
+    n += Cmd_PutUint(&dst[n], value);
+    dst[n++] = ' ';
+    return n;
+}
@@ -0,0 +1,259 @@
+/**
+  ************************************************************************************
+  * @file              Dds.c
+  * @author         None
+  * @version       V1.1.0
+  * @date            2026-10-17
+  * @brief           多通道DDS波形发生模块源文件
+  *
+  * @details        本文件实现了DDS相位累加、查表插值和基准测试：
+  *                        1. 插值公式：y = (a × (0x8000 - f) + b × f) >> 15，
+  *                           SIMD实现写成 SMLAD({a,b}, {0x7FFF-f, f}, a)，与标量实现逐位一致
+  *                        2. 两个通道的插值系数用一次SSUB16求补，结果用PKHBT打包、
+  *                           SADD16叠加偏移后一次写出
+  *
+  * @note            相位累加为32位加法，两个通道分别计算；SIMD只用于插值和输出
+  *                        定义DDS_MAIN在主机上编译得到基准测试程序（Simd.h使用C语言实现）：
+  *                        gcc -DDDS_MAIN -O2 -IApp/Inc -IDriver/Inc App/Src/Dds.c -o dds
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 offset[]/out[]未4字节对齐时退回标量实现；增加主机端基准测试入口
+  *
+  ************************************************************************************
+  */
+
+#include "Dds.h"
+#include "Simd.h"
+
+#define DDS_INDEX_SHIFT                      (32U - DDS_TABLE_BITS)
+#define DDS_FRAC_SHIFT                        (DDS_INDEX_SHIFT - DDS_FRAC_BITS)
+#define DDS_FRAC_MASK                         ((1U << DDS_FRAC_BITS) - 1U)
+
+const int16_t Dds_RaisedCosine[DDS_TABLE_SIZE + 1] = {
+        0,     5,    20,    44,    79,   123,   177,   241,   315,   398,   491,   593,
+      705,   827,   958,  1098,  1247,  1406,  1573,  1749,  1935,  2128,  2331,  2542,
+     2761,  2989,  3224,  3468,  3719,  3978,  4244,  4518,  4799,  5086,  5381,  5682,
+     5990,  6304,  6624,  6950,  7281,  7618,  7961,  8308,  8660,  9017,  9379,  9744,
+    10114, 10487, 10864, 11244, 11628, 12014, 12403, 12794, 13187, 13583, 13980, 14378,
+    14778, 15178, 15580, 15981, 16383, 16786, 17187, 17589, 17989, 18389, 18787, 19184,
+    19580, 19973, 20364, 20753, 21139, 21523, 21903, 22280, 22653, 23023, 23388, 23750,
+    24107, 24459, 24806, 25149, 25486, 25817, 26143, 26463, 26777, 27085, 27386, 27681,
+    27968, 28249, 28523, 28789, 29048, 29299, 29543, 29778, 30006, 30225, 30436, 30639,
+    30832, 31018, 31194, 31361, 31520, 31669, 31809, 31940, 32062, 32174, 32276, 32369,
+    32452, 32526, 32590, 32644, 32688, 32723, 32747, 32762, 32767, 32762, 32747, 32723,
+    32688, 32644, 32590, 32526, 32452, 32369, 32276, 32174, 32062, 31940, 31809, 31669,
+    31520, 31361, 31194, 31018, 30832, 30639, 30436, 30225, 30006, 29778, 29543, 29299,
+    29048, 28789, 28523, 28249, 27968, 27681, 27386, 27085, 26777, 26463, 26143, 25817,
+    25486, 25149, 24806, 24459, 24107, 23750, 23388, 23023, 22653, 22280, 21903, 21523,
+    21139, 20753, 20364, 19973, 19580, 19184, 18787, 18389, 17989, 17589, 17187, 16786,
+    16384, 15981, 15580, 15178, 14778, 14378, 13980, 13583, 13187, 12794, 12403, 12014,
+    11628, 11244, 10864, 10487, 10114,  9744,  9379,  9017,  8660,  8308,  7961,  7618,
+     7281,  6950,  6624,  6304,  5990,  5682,  5381,  5086,  4799,  4518,  4244,  3978,
+     3719,  3468,  3224,  2989,  2761,  2542,  2331,  2128,  1935,  1749,  1573,  1406,
+     1247,  1098,   958,   827,   705,   593,   491,   398,   315,   241,   177,   123,
+       79,    44,    20,     5,     0
+};
+
+/**
+  * @brief           单通道查表插值（标量）
+  * @param        table 波形表
+  * @param        phase 相位
+  * @retval          插值结果（Q15）
+  */
+static __inline int32_t Dds_Interp(const int16_t *table, uint32_t phase)
+{
+    uint32_t idx = phase >> DDS_INDEX_SHIFT;
+    int32_t f = (int32_t)((phase >> DDS_FRAC_SHIFT) & DDS_FRAC_MASK);
+    int32_t a = table[idx];
+    int32_t b = table[idx + 1U];
+
+    return (a * (0x8000 - f) + b * f) >> DDS_FRAC_BITS;
+}
+
+/**
+  * @brief           由频率计算频率字
+  * @param        freq_mhz 输出频率，单位：毫赫兹
+  * @param        update_hz 更新频率，单位：Hz
+  * @retval          频率字
+  */
+uint32_t Dds_FreqWord(uint32_t freq_mhz, uint32_t update_hz)
+{
+    if(update_hz == 0) return 0;
+    return (uint32_t)((((uint64_t)freq_mhz << 32) / 1000U) / update_hz);
+}
+
+/**
+  * @brief           更新全部通道（SIMD实现）
+  * @param        bank 通道组
+  * @retval          None
+  */
+void Dds_Update(const Dds_Bank *bank)
+{
+    const int16_t *table = bank->table;
+    uint32_t *phase = bank->phase;
+    const uint32_t *freq = bank->freq;
+    const int16_t *offset = bank->offset;
+    int16_t *out = bank->out;
+    uint32_t pairs = bank->count >> 1;
+    uint32_t p0, p1, i0, i1, fw, comp, y0, y1;
+
+    /* 打包读写要求offset[]、out[]4字节对齐（M4上LDR/STR可非对齐，但LDRD/STRD和部分编译优化不行），
+       不满足时退回标量实现，结果相同 */
+    if((((uint32_t)(uintptr_t)offset) | ((uint32_t)(uintptr_t)out)) & 3U) {
+        Dds_UpdateScalar(bank);
+        return;
+    }
+
+    while(pairs--) {
+        /* 相位累加 */
+        p0 = phase[0] + freq[0];
+        p1 = phase[1] + freq[1];
+        phase[0] = p0;
+        phase[1] = p1;
+
+        i0 = p0 >> DDS_INDEX_SHIFT;
+        i1 = p1 >> DDS_INDEX_SHIFT;
+
+        /* 两个通道的插值系数 {f0, f1} 及其补数 {0x7FFF-f0, 0x7FFF-f1} */
+        fw = SIMD_PKHBT((p0 >> DDS_FRAC_SHIFT) & DDS_FRAC_MASK, (p1 >> DDS_FRAC_SHIFT) & DDS_FRAC_MASK, 16);
+        comp = SIMD_SSUB16(0x7FFF7FFFU, fw);
+
+        /* y = a + a × (0x7FFF - f) + b × f */
+        y0 = SIMD_SMLAD(SIMD_PKHBT((uint16_t)table[i0], (uint16_t)table[i0 + 1U], 16),
+                        SIMD_PKHBT(comp, fw, 16), (uint32_t)table[i0]);
+        y1 = SIMD_SMLAD(SIMD_PKHBT((uint16_t)table[i1], (uint16_t)table[i1 + 1U], 16),
+                        SIMD_PKHTB(fw, comp, 16), (uint32_t)table[i1]);
+
+        /* 打包两个结果，叠加偏移后一次写出 */
+        SIMD_STORE32(out, SIMD_SADD16(SIMD_PKHBT(y0 >> DDS_FRAC_BITS, y1 >> DDS_FRAC_BITS, 16),
+                                      SIMD_LOAD32(offset)));
+
+        phase += 2;
+        freq += 2;
+        offset += 2;
+        out += 2;
+    }
+
+    if(bank->count & 1U) {
+        phase[0] += freq[0];
+        out[0] = (int16_t)(Dds_Interp(table, phase[0]) + offset[0]);
+    }
+}
+
+/**
+  * @brief           更新全部通道（标量参考实现）
+  * @param        bank 通道组
+  * @retval          None
+  */
+void Dds_UpdateScalar(const Dds_Bank *bank)
+{
+    uint32_t i;
+
+    for(i = 0; i < bank->count; i++) {
+        bank->phase[i] += bank->freq[i];
+        bank->out[i] = (int16_t)(Dds_Interp(bank->table, bank->phase[i]) + bank->offset[i]);
+    }
+}
+
+/**
+  * @brief           比较两种实现的速度并校验结果
+  * @param        bank 通道组
+  * @param        rounds 更新轮数
+  * @param        clock 时钟读取函数
+  * @param        ticks_per_us 时钟每微秒的计数值
+  * @param        result 输出测试结果
+  * @retval          None
+  */
+void Dds_Benchmark(const Dds_Bank *bank, uint32_t rounds, uint32_t (*clock)(void),
+                   uint32_t ticks_per_us, Dds_Bench *result)
+{
+    uint32_t start;
+    uint32_t i;
+    uint64_t work = (uint64_t)bank->count * rounds * ticks_per_us * 1000U;
+
+    start = clock();
+    for(i = 0; i < rounds; i++) Dds_UpdateScalar(bank);
+    result->scalar_ticks = clock() - start;
+
+    start = clock();
+    for(i = 0; i < rounds; i++) Dds_Update(bank);
+    result->simd_ticks = clock() - start;
+
+    result->scalar_ch_per_us = result->scalar_ticks ? (uint32_t)(work / result->scalar_ticks) : 0;
+    result->simd_ch_per_us = result->simd_ticks ? (uint32_t)(work / result->simd_ticks) : 0;
+
+    /* 以更新后的相位重新按标量公式计算，校验SIMD输出 */
+    result->match = 1;
+    for(i = 0; i < bank->count; i++) {
+        if(bank->out[i] != (int16_t)(Dds_Interp(bank->table, bank->phase[i]) + bank->offset[i])) {
+            result->match = 0;
+            break;
+        }
+    }
+}
+
+#ifdef DDS_MAIN
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/**
+  * @brief           主机时钟：单调时间的低32位，单位：纳秒
+  * @param        None
+  * @retval          当前时刻
+  */
+static uint32_t Dds_HostClock(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec);
+}
+
+/**
+  * @brief           主机端基准测试入口
+  * @param        argc 参数个数
+  * @param        argv 参数：[通道数 [轮数]]
+  * @retval          0=SIMD与标量输出一致，1=不一致或内存不足
+  * @note           单次测量不能超过2^32纳秒（约4.3秒），通道数 × 轮数过大时减小轮数
+  */
+int main(int argc, char **argv)
+{
+    uint32_t count = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : 1024U;
+    uint32_t rounds = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 0) : 10000U;
+    uint32_t *phase = (uint32_t *)malloc(count * sizeof(uint32_t));
+    uint32_t *freq = (uint32_t *)malloc(count * sizeof(uint32_t));
+    int16_t *offset = (int16_t *)malloc(count * sizeof(int16_t));
+    int16_t *out = (int16_t *)malloc(count * sizeof(int16_t));
+    Dds_Bank bank;
+    Dds_Bench b;
+    uint32_t i;
+
+    if(phase == NULL || freq == NULL || offset == NULL || out == NULL) return 1;
+    for(i = 0; i < count; i++) {
+        phase[i] = i * 0x9E3779B9U;
+        freq[i] = Dds_FreqWord(250U + i * 7U, 2000U);
+        offset[i] = (int16_t)(i & 0xFFU);
+    }
+    bank.phase = phase;
+    bank.freq = freq;
+    bank.offset = offset;
+    bank.out = out;
+    bank.table = Dds_RaisedCosine;
+    bank.count = count;
+
+    Dds_Benchmark(&bank, rounds, Dds_HostClock, 1000U, &b);
+    printf("%lu channels x %lu rounds, SIMD_NATIVE=%d\n", (unsigned long)count, (unsigned long)rounds, SIMD_NATIVE);
+    printf("  scalar  %10lu ns  %8lu.%03lu ch/us\n", (unsigned long)b.scalar_ticks,
+           (unsigned long)(b.scalar_ch_per_us / 1000U), (unsigned long)(b.scalar_ch_per_us % 1000U));
+    printf("  simd    %10lu ns  %8lu.%03lu ch/us\n", (unsigned long)b.simd_ticks,
+           (unsigned long)(b.simd_ch_per_us / 1000U), (unsigned long)(b.simd_ch_per_us % 1000U));
+    printf("  match   %u\n", (unsigned)b.match);
+    free(phase);
+    free(freq);
+    free(offset);
+    free(out);
+    return b.match ? 0 : 1;
+}
+#endif  /* DDS_MAIN */
@@ -0,0 +1,553 @@
+/**
+  ************************************************************************************
+  * @file              Fleet.c
+  * @author         None
+  * @version       V2.1.0
+  * @date            2026-10-17
+  * @brief           多板晶振偏差仿真模块源文件
+  *
+  * @details        本文件实现了多块虚拟板的推进、线程池与统计：
+  *                        1. 参考时间每过1微秒，板的CPU走过 hse_millihz × 21 ÷ 10^9 个周期，
+  *                           以 周期 × 10^9 为单位整数累计，没有舍入误差
+  *                        2. 板上的主循环与main.c（软件PWM、LED1按最亮/最暗点切换）相同，
+  *                           下一个PWM周期的截止时刻不晚于已经过的本板周期数时执行一个周期
+  *                        3. 板号经散列后作为随机数种子，频率误差与推进顺序无关
+  *                        4. 同步仿真中主板的同步脉冲对从板相当于外部中断，直接调用PhaseLock_Capture()
+  *                        5. 线程池：每个线程一个板号区间（互斥锁保护），从区间头部逐块取板；
+  *                           区间为空时依次查看其他线程，取走对方剩余区间的后一半
+  *
+  * @note            仅在定义REG_SIM时编译，用到pthread和malloc
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 增加主从相位同步仿真
+  *                         - 2026-10-17 V2.0.0 每块板独立RegSim上下文运行固件主循环，增加工作窃取线程池
+  *                         - 2026-10-17 V2.1.0 增加Fleet_SetPhase()，同步仿真可从任意初始相位开始
+  *
+  ************************************************************************************
+  */
+
+#ifdef REG_SIM
+
+#include "Fleet.h"
+#include <pthread.h>
+#include <time.h>
+#include "stm32f4xx.h"
+#include "Delay.h"
+#include "LED.h"
+
+/**
+  * @brief   线程的板号区间
+  */
+typedef struct
+{
+    pthread_mutex_t lock;                          /* 保护lo/hi */
+    uint32_t lo;                                         /* 下一块要推进的板号 */
+    uint32_t hi;                                         /* 区间末尾（不含） */
+    uint64_t steals;                                    /* 本线程的窃取次数 */
+} Fleet_Queue;
+
+/**
+  * @brief   线程池共享状态
+  */
+typedef struct
+{
+    Fleet *fleet;                                        /* 板组 */
+    Fleet_Queue queue[FLEET_THREADS_MAX];   /* 各线程的区间 */
+    uint32_t threads;                                  /* 线程数 */
+    uint32_t epoch_us;                               /* 每轮的参考时间 */
+    uint8_t go;                                          /* 1=全部线程已创建，可以进入栅栏 */
+    uint8_t quit;                                        /* 1=线程退出 */
+    pthread_mutex_t gate_lock;                    /* 保护go */
+    pthread_cond_t gate;                              /* go置位时广播 */
+    pthread_barrier_t start;                        /* 一轮开始 */
+    pthread_barrier_t done;                         /* 一轮结束 */
+} Fleet_Pool;
+
+/**
+  * @brief   工作线程参数
+  */
+typedef struct
+{
+    Fleet_Pool *pool;                                 /* 线程池 */
+    uint32_t id;                                         /* 线程号 */
+} Fleet_Worker;
+
+/**
+  * @brief           由种子和板号生成随机数（splitmix32）
+  * @param        seed 随机种子
+  * @param        index 板号
+  * @retval          32位随机数
+  */
+static uint32_t Fleet_Hash(uint32_t seed, uint32_t index)
+{
+    uint32_t x = seed + index * 0x9E3779B9U;
+
+    x ^= x >> 16;
+    x *= 0x85EBCA6BU;
+    x ^= x >> 13;
+    x *= 0xC2B2AE35U;
+    x ^= x >> 16;
+    return x;
+}
+
+/**
+  * @brief           板上主循环的一个PWM周期（同main.c，软件PWM）
+  * @param        fleet 板组
+  * @param        index 板号
+  * @retval          None
+  * @note           调用前须已选择该板的RegSim上下文
+  */
+static void Fleet_Loop(Fleet *fleet, uint32_t index)
+{
+    Fleet_Board *b = &fleet->boards[index];
+    uint32_t on_time;
+    uint32_t off_time;
+
+    b->level = Breath_Tick(&b->eff);
+    on_time = b->level * fleet->pwm_cycles / BREATH_BRIGHTNESS_MAX;
+    off_time = fleet->pwm_cycles - on_time;
+
+    if(on_time > 0) {
+        LED_On_2();
+        Delay_Until(&b->mark, on_time);
+    }
+    if(off_time > 0) {
+        LED_Off_2();
+        Delay_Until(&b->mark, off_time);
+    }
+    if(b->eff.event == BREATH_EVT_PEAK) {
+        LED_On_1();
+    } else if(b->eff.event == BREATH_EVT_TROUGH) {
+        LED_Off_1();
+    }
+    if(fleet->locks != 0 && index != 0) PhaseLock_Update(&fleet->locks[index], &b->eff);
+    b->ticks++;
+}
+
+/**
+  * @brief           把一块板推进一段参考时间
+  * @param        fleet 板组
+  * @param        index 板号
+  * @param        step_us 参考时间，单位：微秒
+  * @retval          None
+  */
+static void Fleet_StepBoard(Fleet *fleet, uint32_t index, uint32_t step_us)
+{
+    Fleet_Board *b = &fleet->boards[index];
+
+    b->acc += (uint64_t)step_us * b->hse_millihz * FLEET_PLL_MUL;
+    b->cycles += b->acc / FLEET_PPB;
+    b->acc %= FLEET_PPB;
+
+    RegSim_Select(b->sim);
+    while(b->due <= b->cycles) {
+        Fleet_Loop(fleet, index);
+        b->due += fleet->pwm_cycles;
+    }
+}
+
+/**
+  * @brief           主板经过最暗点时各从板捕获相位
+  * @param        fleet 板组
+  * @retval          None
+  */
+static void Fleet_Pulse(Fleet *fleet)
+{
+    uint32_t i;
+
+    for(i = 1; i < fleet->count; i++) {
+        PhaseLock_Capture(&fleet->locks[i], fleet->boards[i].eff.phase);
+    }
+}
+
+/**
+  * @brief           全部板的tick总数
+  * @param        fleet 板组
+  * @retval          tick总数
+  */
+static uint64_t Fleet_Ticks(const Fleet *fleet)
+{
+    uint64_t ticks = 0;
+    uint32_t i;
+
+    for(i = 0; i < fleet->count; i++) ticks += fleet->boards[i].ticks;
+    return ticks;
+}
+
+/* ---------------------------------- 线程池 ---------------------------------- */
+
+/**
+  * @brief           取下一块要推进的板
+  * @param        pool 线程池
+  * @param        id 线程号
+  * @param        index 输出板号
+  * @retval          1=取到，0=所有区间都已取完
+  * @note           自己的区间为空时从其他线程窃取后一半，对方保留前一半
+  */
+static uint8_t Fleet_Take(Fleet_Pool *pool, uint32_t id, uint32_t *index)
+{
+    Fleet_Queue *own = &pool->queue[id];
+    Fleet_Queue *victim;
+    uint32_t lo = 0;
+    uint32_t hi = 0;
+    uint32_t k;
+
+    pthread_mutex_lock(&own->lock);
+    if(own->lo < own->hi) {
+        *index = own->lo++;
+        pthread_mutex_unlock(&own->lock);
+        return 1;
+    }
+    pthread_mutex_unlock(&own->lock);
+
+    for(k = 1; k < pool->threads; k++) {
+        victim = &pool->queue[(id + k) % pool->threads];
+        pthread_mutex_lock(&victim->lock);
+        if(victim->lo < victim->hi) {
+            lo = victim->lo + (victim->hi - victim->lo) / 2U;
+            hi = victim->hi;
+            victim->hi = lo;
+        }
+        pthread_mutex_unlock(&victim->lock);
+        if(lo < hi) break;
+    }
+    if(lo >= hi) return 0;
+
+    pthread_mutex_lock(&own->lock);
+    own->lo = lo + 1U;
+    own->hi = hi;
+    own->steals++;
+    pthread_mutex_unlock(&own->lock);
+    *index = lo;
+    return 1;
+}
+
+/**
+  * @brief           推进本轮取到的全部板
+  * @param        pool 线程池
+  * @param        id 线程号
+  * @retval          None
+  */
+static void Fleet_Work(Fleet_Pool *pool, uint32_t id)
+{
+    RegSim_Context *prev = RegSim_Select(0);
+    uint32_t index;
+
+    while(Fleet_Take(pool, id, &index)) Fleet_StepBoard(pool->fleet, index, pool->epoch_us);
+    RegSim_Select(prev);
+}
+
+/**
+  * @brief           工作线程（1号及以后）
+  * @param        arg Fleet_Worker
+  * @retval          NULL
+  */
+static void *Fleet_Thread(void *arg)
+{
+    Fleet_Worker *w = (Fleet_Worker *)arg;
+
+    /* 栅栏人数在全部线程创建成功后才确定 */
+    pthread_mutex_lock(&w->pool->gate_lock);
+    while(!w->pool->go) pthread_cond_wait(&w->pool->gate, &w->pool->gate_lock);
+    pthread_mutex_unlock(&w->pool->gate_lock);
+    if(w->pool->quit) return 0;
+
+    for(;;) {
+        pthread_barrier_wait(&w->pool->start);
+        if(w->pool->quit) break;
+        Fleet_Work(w->pool, w->id);
+        pthread_barrier_wait(&w->pool->done);
+    }
+    return 0;
+}
+
+/* ---------------------------------- 接口函数 ---------------------------------- */
+
+/**
+  * @brief           初始化板组
+  * @param        fleet 板组
+  * @param        boards 板数组
+  * @param        count 板数
+  * @param        seed 随机种子
+  * @param        spread_ppb 频率误差范围
+  * @param        period_ms 呼吸周期，单位：毫秒
+  * @param        tick_us Breath_Tick()间隔，单位：微秒
+  * @retval          0=成功，1=内存不足
+  */
+uint8_t Fleet_Init(Fleet *fleet, Fleet_Board *boards, uint32_t count, uint32_t seed,
+                   uint32_t spread_ppb, uint32_t period_ms, uint32_t tick_us)
+{
+    RegSim_Context *prev;
+    Fleet_Board *b;
+    uint32_t i;
+    int32_t ppb;
+
+    fleet->boards = boards;
+    fleet->locks = 0;
+    fleet->count = count;
+    fleet->tick_us = tick_us ? tick_us : 1U;
+    fleet->period_ms = period_ms;
+    fleet->pwm_cycles = SystemCoreClock / 1000000U * fleet->tick_us;
+
+    prev = RegSim_Select(0);
+    for(i = 0; i < count; i++) {
+        b = &boards[i];
+        b->sim = RegSim_Create();
+        if(b->sim == 0) {
+            fleet->count = i;
+            Fleet_Free(fleet);
+            RegSim_Select(prev);
+            return 1;
+        }
+
+        /* 随机数映射到 [-spread_ppb, +spread_ppb] */
+        ppb = (int32_t)((uint64_t)Fleet_Hash(seed, i) * (2U * (uint64_t)spread_ppb + 1U) >> 32) - (int32_t)spread_ppb;
+        Fleet_SetPpb(fleet, i, ppb);
+        b->acc = 0;
+        b->cycles = 0;
+        b->ticks = 0;
+        b->level = 0;
+
+        /* 固件初始化：上电时刻与参考时间0对齐 */
+        RegSim_Select(b->sim);
+        RegSim_SetAccessCost(FLEET_POLL_CYCLES);
+        LED_Init();
+        Breath_Start(&b->eff, period_ms, 0, BREATH_BRIGHTNESS_MAX, fleet->tick_us);
+        b->mark = Delay_Mark();
+        b->due = RegSim_Now() + fleet->pwm_cycles;
+    }
+    RegSim_Select(prev);
+    return 0;
+}
+
+/**
+  * @brief           释放各板的RegSim上下文
+  * @param        fleet 板组
+  * @retval          None
+  */
+void Fleet_Free(Fleet *fleet)
+{
+    uint32_t i;
+
+    for(i = 0; i < fleet->count; i++) {
+        RegSim_Destroy(fleet->boards[i].sim);
+        fleet->boards[i].sim = 0;
+    }
+    fleet->count = 0;
+}
+
+/**
+  * @brief           设置单块板的频率误差
+  * @param        fleet 板组
+  * @param        index 板号
+  * @param        ppb 频率误差，单位：十亿分之一
+  * @retval          None
+  */
+void Fleet_SetPpb(Fleet *fleet, uint32_t index, int32_t ppb)
+{
+    Fleet_Board *b = &fleet->boards[index];
+
+    b->ppb = ppb;
+    /* 毫赫 = HSE × 1000 × (1 + ppb/10^9)，标称8MHz时 1ppb = 8mHz */
+    b->hse_millihz = (uint64_t)((int64_t)FLEET_HSE_NOMINAL * 1000 + (int64_t)FLEET_HSE_NOMINAL * ppb / 1000000);
+}
+
+/**
+  * @brief           设置单块板的呼吸相位
+  * @param        fleet 板组
+  * @param        index 板号
+  * @param        phase 相位，2^32对应一个呼吸周期
+  * @retval          None
+  */
+void Fleet_SetPhase(Fleet *fleet, uint32_t index, uint32_t phase)
+{
+    fleet->boards[index].eff.phase = phase;
+}
+
+/**
+  * @brief           把一段板推进一段参考时间
+  * @param        fleet 板组
+  * @param        first 起始板号
+  * @param        count 板数
+  * @param        step_us 参考时间，单位：微秒
+  * @retval          None
+  */
+void Fleet_StepRange(Fleet *fleet, uint32_t first, uint32_t count, uint32_t step_us)
+{
+    RegSim_Context *prev = RegSim_Select(0);
+    uint32_t end = first + count;
+    uint32_t i;
+
+    if(end > fleet->count || end < first) end = fleet->count;
+    for(i = first; i < end; i++) Fleet_StepBoard(fleet, i, step_us);
+    RegSim_Select(prev);
+}
+
+/**
+  * @brief           把全部板推进一段参考时间
+  * @param        fleet 板组
+  * @param        step_us 参考时间，单位：微秒
+  * @retval          None
+  */
+void Fleet_Step(Fleet *fleet, uint32_t step_us)
+{
+    Fleet_StepRange(fleet, 0, fleet->count, step_us);
+}
+
+/**
+  * @brief           带相位同步地推进全部板
+  * @param        fleet 板组
+  * @param        locks 各板的锁相环
+  * @param        step_us 参考时间，单位：微秒
+  * @retval          None
+  */
+void Fleet_StepLocked(Fleet *fleet, PhaseLock *locks, uint32_t step_us)
+{
+    uint32_t old;
+
+    if(fleet->count == 0) return;
+
+    fleet->locks = locks;
+    old = fleet->boards[0].eff.phase;
+    Fleet_StepRange(fleet, 0, fleet->count, step_us);
+
+    /* 主板相位回绕即经过最暗点，输出同步脉冲 */
+    if(fleet->boards[0].eff.phase < old) Fleet_Pulse(fleet);
+}
+
+/**
+  * @brief           用工作窃取线程池推进全部板
+  * @param        fleet 板组
+  * @param        locks 锁相环数组，为NULL时各板自由运行
+  * @param        threads 线程数
+  * @param        epochs 轮数
+  * @param        epoch_us 每轮的参考时间，单位：微秒
+  * @param        stats 输出统计（可为NULL）
+  * @retval          0=成功，1=参数非法或线程创建失败
+  */
+uint8_t Fleet_Run(Fleet *fleet, PhaseLock *locks, uint32_t threads, uint32_t epochs, uint32_t epoch_us,
+                  Fleet_RunStats *stats)
+{
+    Fleet_Pool pool;
+    pthread_t tid[FLEET_THREADS_MAX];
+    Fleet_Worker worker[FLEET_THREADS_MAX];
+    struct timespec t0;
+    struct timespec t1;
+    uint64_t ticks0;
+    uint32_t started = 1;
+    uint32_t old;
+    uint32_t e;
+    uint32_t i;
+
+    if(threads == 0 || threads > FLEET_THREADS_MAX) return 1;
+
+    fleet->locks = locks;
+    pool.fleet = fleet;
+    pool.threads = threads;
+    pool.epoch_us = epoch_us;
+    pool.go = 0;
+    pool.quit = 0;
+    pthread_mutex_init(&pool.gate_lock, 0);
+    pthread_cond_init(&pool.gate, 0);
+    for(i = 0; i < threads; i++) {
+        pthread_mutex_init(&pool.queue[i].lock, 0);
+        pool.queue[i].lo = 0;
+        pool.queue[i].hi = 0;
+        pool.queue[i].steals = 0;
+    }
+
+    ticks0 = Fleet_Ticks(fleet);
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for(i = 1; i < threads; i++) {
+        worker[i].pool = &pool;
+        worker[i].id = i;
+        if(pthread_create(&tid[i], 0, Fleet_Thread, &worker[i]) != 0) break;
+        started++;
+    }
+    pthread_barrier_init(&pool.start, 0, threads);
+    pthread_barrier_init(&pool.done, 0, threads);
+    pthread_mutex_lock(&pool.gate_lock);
+    pool.quit = (started < threads);
+    pool.go = 1;
+    pthread_cond_broadcast(&pool.gate);
+    pthread_mutex_unlock(&pool.gate_lock);
+
+    for(e = 0; e < epochs && !pool.quit; e++) {
+        /* 板号按线程均分 */
+        for(i = 0; i < threads; i++) {
+            pool.queue[i].lo = (uint32_t)((uint64_t)fleet->count * i / threads);
+            pool.queue[i].hi = (uint32_t)((uint64_t)fleet->count * (i + 1U) / threads);
+        }
+        old = (fleet->count > 0) ? fleet->boards[0].eff.phase : 0;
+
+        pthread_barrier_wait(&pool.start);
+        Fleet_Work(&pool, 0);
+        pthread_barrier_wait(&pool.done);
+
+        /* 主板相位回绕即经过最暗点，输出同步脉冲 */
+        if(locks != 0 && fleet->count > 0 && fleet->boards[0].eff.phase < old) Fleet_Pulse(fleet);
+    }
+    if(!pool.quit) {
+        pool.quit = 1;
+        pthread_barrier_wait(&pool.start);
+    }
+    for(i = 1; i < started; i++) pthread_join(tid[i], 0);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+
+    if(stats != 0) {
+        stats->ticks = Fleet_Ticks(fleet) - ticks0;
+        stats->steals = 0;
+        for(i = 0; i < threads; i++) stats->steals += pool.queue[i].steals;
+        stats->threads = threads;
+        stats->seconds = (double)(t1.tv_sec - t0.tv_sec) + (double)(t1.tv_nsec - t0.tv_nsec) * 1e-9;
+        stats->ticks_per_sec = (stats->seconds > 0.0) ? (double)stats->ticks / stats->seconds : 0.0;
+    }
+    pthread_barrier_destroy(&pool.start);
+    pthread_barrier_destroy(&pool.done);
+    pthread_cond_destroy(&pool.gate);
+    pthread_mutex_destroy(&pool.gate_lock);
+    for(i = 0; i < threads; i++) pthread_mutex_destroy(&pool.queue[i].lock);
+    return (started < threads) ? 1U : 0U;
+}
+
+/**
+  * @brief           统计相位离散度
+  * @param        fleet 板组
+  * @param        stats 输出统计
+  * @retval          None
+  */
+void Fleet_Measure(const Fleet *fleet, Fleet_Stats *stats)
+{
+    uint32_t ref;
+    int32_t d;
+    int32_t dmin = 0;
+    int32_t dmax = 0;
+    uint32_t i;
+
+    stats->spread_us = 0;
+    stats->lead = 0;
+    stats->lag = 0;
+    stats->ticks = 0;
+    if(fleet->count == 0) return;
+
+    ref = fleet->boards[0].eff.phase;
+    for(i = 0; i < fleet->count; i++) {
+        /* 相位差按有符号数解释，回绕不影响比较 */
+        d = (int32_t)(fleet->boards[i].eff.phase - ref);
+        if(d > dmax) {
+            dmax = d;
+            stats->lead = (int32_t)i;
+        }
+        if(d < dmin) {
+            dmin = d;
+            stats->lag = (int32_t)i;
+        }
+        stats->ticks += fleet->boards[i].ticks;
+    }
+
+    /* 相位差换算为时间：2^32对应一个呼吸周期 */
+    stats->spread_us = (uint32_t)(((uint64_t)(uint32_t)(dmax - dmin) * fleet->period_ms * 1000U) >> 32);
+}
+
+#endif  /* REG_SIM */
@@ -0,0 +1,290 @@
+/**
+  ************************************************************************************
+  * @file              Flicker.c
+  * @author         None
+  * @version       V1.1.1
+  * @date            2026-10-17
+  * @brief           闪烁与平滑度指标分析模块源文件
+  *
+  * @details        本文件实现了单通道边沿序列的流式分析：
+  *                        1. 按窗口累计点亮时间；二值光输出下闪烁指数 = 1 - 窗口平均亮度，
+  *                           窗口内同时出现亮灭时百分比闪烁为100%
+  *                        2. 每个上升沿结束一个PWM周期，在线更新周期均值/方差、
+  *                           占空比误差和gamma模型下的感知亮度阶跃；
+  *                           与上一个上升沿时刻相同的上升沿（重复的CSV行、零宽毛刺）不结束周期
+  *
+  * @note            所有统计量都是累加值，不保存历史边沿
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 CSV时间支持负数和指数形式
+  *                         - 2026-10-17 V1.1.1 与上一个上升沿同一时刻的上升沿（零长度周期）并入当前周期，不再除以0
+  *
+  ************************************************************************************
+  */
+
+#include "Flicker.h"
+#include <math.h>
+
+#define FLICKER_DEFAULT_GAMMA          2.2f
+#define FLICKER_DEFAULT_STEP             0.01f
+
+/**
+  * @brief           初始化分析状态
+  * @param        st 分析状态
+  * @param        cfg 分析配置
+  * @retval          None
+  */
+void Flicker_Init(Flicker_State *st, const Flicker_Config *cfg)
+{
+    Flicker_State zero = {0};
+
+    *st = zero;
+    st->cfg = *cfg;
+    if(st->cfg.window == 0) st->cfg.window = st->cfg.units_per_sec;
+    if(st->cfg.gamma <= 0.0f) st->cfg.gamma = FLICKER_DEFAULT_GAMMA;
+    if(st->cfg.visible_step <= 0.0f) st->cfg.visible_step = FLICKER_DEFAULT_STEP;
+    st->last_perceived = -1.0f;
+}
+
+/**
+  * @brief           设置当前的目标亮度
+  * @param        st 分析状态
+  * @param        duty_ppm 目标占空比，单位：百万分之一
+  * @retval          None
+  */
+void Flicker_SetTarget(Flicker_State *st, uint32_t duty_ppm)
+{
+    st->target_ppm = duty_ppm;
+}
+
+/**
+  * @brief           结束一个统计窗口
+  * @param        st 分析状态
+  * @retval          None
+  */
+static void Flicker_CloseWindow(Flicker_State *st)
+{
+    float mean = (float)st->win_high / (float)st->cfg.window;
+    uint8_t both = (st->win_levels == 0x03U);
+    float fi = both ? 1.0f - mean : 0.0f;
+
+    st->fi_sum += fi;
+    if(fi > st->fi_max) st->fi_max = fi;
+    st->pf_sum += both ? 100.0f : 0.0f;
+    st->windows++;
+
+    st->win_start += st->cfg.window;
+    st->win_high = 0;
+    st->win_levels = 0;
+}
+
+/**
+  * @brief           把上一边沿到time之间的电平计入窗口统计
+  * @param        st 分析状态
+  * @param        time 当前时间
+  * @retval          None
+  */
+static void Flicker_Account(Flicker_State *st, uint64_t time)
+{
+    uint64_t end;
+
+    while(time >= st->win_start + st->cfg.window) {
+        end = st->win_start + st->cfg.window;
+        if(end > st->last_edge) {
+            if(st->level) st->win_high += end - st->last_edge;
+            st->win_levels |= (uint8_t)(1U << st->level);
+            st->last_edge = end;
+        }
+        Flicker_CloseWindow(st);
+    }
+    if(time > st->last_edge) {
+        if(st->level) st->win_high += time - st->last_edge;
+        st->win_levels |= (uint8_t)(1U << st->level);
+        st->last_edge = time;
+    }
+}
+
+/**
+  * @brief           结束一个PWM周期
+  * @param        st 分析状态
+  * @param        period 周期长度（大于0）
+  * @retval          None
+  */
+static void Flicker_ClosePeriod(Flicker_State *st, uint64_t period)
+{
+    double delta;
+    uint32_t duty_ppm;
+    uint32_t err;
+    float perceived;
+    float step;
+
+    if(period == 0) return;
+    duty_ppm = (uint32_t)(st->high_in_period * 1000000U / period);
+    err = duty_ppm > st->target_ppm ? duty_ppm - st->target_ppm : st->target_ppm - duty_ppm;
+    perceived = powf((float)duty_ppm / 1000000.0f, 1.0f / st->cfg.gamma);
+
+    /* 周期均值与方差 */
+    st->periods++;
+    delta = (double)period - st->period_mean;
+    st->period_mean += delta / st->periods;
+    st->period_m2 += delta * ((double)period - st->period_mean);
+    if(st->periods == 1 || period < st->period_min) st->period_min = period;
+    if(period > st->period_max) st->period_max = period;
+
+    /* 占空比误差 */
+    st->duty_err_sum += err;
+    if(err > st->duty_err_max) st->duty_err_max = err;
+
+    /* 感知亮度阶跃 */
+    if(st->last_perceived >= 0.0f) {
+        step = fabsf(perceived - st->last_perceived);
+        if(step > st->step_max) st->step_max = step;
+        if(step > st->cfg.visible_step) st->visible_steps++;
+    }
+    st->last_perceived = perceived;
+}
+
+/**
+  * @brief           输入一个边沿
+  * @param        st 分析状态
+  * @param        time 边沿时间
+  * @param        level 1=点亮，0=熄灭
+  * @retval          None
+  */
+void Flicker_Edge(Flicker_State *st, uint64_t time, uint8_t level)
+{
+    level = level ? 1U : 0U;
+    if(st->started && level == st->level) return;
+
+    if(!st->started) {
+        /* 第一个上升沿之前的数据不计入统计 */
+        if(!level) return;
+        st->started = 1;
+        st->win_start = time;
+        st->last_edge = time;
+        st->last_rise = time;
+        st->level = 1;
+        return;
+    }
+
+    Flicker_Account(st, time);
+    if(level) {
+        /* 零长度周期：熄灭和再次点亮都在上一个上升沿的时刻，视为没有熄灭过 */
+        if(time != st->last_rise) {
+            Flicker_ClosePeriod(st, time - st->last_rise);
+            st->last_rise = time;
+            st->high_in_period = 0;
+        }
+    } else {
+        st->high_in_period = time - st->last_rise;
+    }
+    st->level = level;
+}
+
+/**
+  * @brief           取得当前的分析结果
+  * @param        st 分析状态
+  * @param        m 输出分析结果
+  * @retval          None
+  */
+void Flicker_Result(const Flicker_State *st, Flicker_Metrics *m)
+{
+    Flicker_Metrics zero = {0};
+
+    *m = zero;
+    if(st->windows > 0) {
+        m->percent_flicker = st->pf_sum / (float)st->windows;
+        m->flicker_index = st->fi_sum / (float)st->windows;
+        m->flicker_index_max = st->fi_max;
+    }
+    if(st->periods > 0) {
+        m->carrier_hz = (float)((double)st->cfg.units_per_sec / st->period_mean);
+        m->jitter_rms = (float)sqrt(st->period_m2 / st->periods);
+        m->jitter_pp = st->period_max - st->period_min;
+        m->duty_err_mean_ppm = (uint32_t)(st->duty_err_sum / st->periods);
+        m->duty_err_max_ppm = st->duty_err_max;
+    }
+    m->step_max = st->step_max;
+    m->visible_steps = st->visible_steps;
+    m->periods = st->periods;
+}
+
+/**
+  * @brief           跳过空格和制表符
+  * @param        p 文本
+  * @retval          第一个非空白字符
+  */
+static const char *Flicker_SkipSpace(const char *p)
+{
+    while(*p == ' ' || *p == '\t') p++;
+    return p;
+}
+
+/**
+  * @brief           解析逻辑分析仪导出的一行CSV
+  * @param        line 一行文本
+  * @param        units_per_sec 每秒的时间单位数
+  * @param        time 输出时间（可为负）
+  * @param        level 输出电平
+  * @retval          1=解析成功，0=表头或格式错误
+  */
+uint8_t Flicker_ParseCsv(const char *line, uint64_t units_per_sec, int64_t *time, uint8_t *level)
+{
+    uint64_t mant = 0;
+    int32_t exp10 = 0;
+    int32_t e = 0;
+    uint8_t digits = 0;
+    uint8_t neg = 0;
+    uint8_t eneg = 0;
+    double t;
+
+    line = Flicker_SkipSpace(line);
+    if(*line == '-' || *line == '+') neg = (*line++ == '-');
+
+    /* 尾数：超过18位有效数字的部分只计入指数 */
+    while(*line >= '0' && *line <= '9') {
+        if(mant < 100000000000000000ULL) mant = mant * 10U + (uint64_t)(*line - '0');
+        else exp10++;
+        line++;
+        digits++;
+    }
+    if(*line == '.') {
+        line++;
+        while(*line >= '0' && *line <= '9') {
+            if(mant < 100000000000000000ULL) {
+                mant = mant * 10U + (uint64_t)(*line - '0');
+                exp10--;
+            }
+            line++;
+            digits++;
+        }
+    }
+    if(digits == 0) return 0;
+
+    /* 指数 */
+    if(*line == 'e' || *line == 'E') {
+        line++;
+        if(*line == '-' || *line == '+') eneg = (*line++ == '-');
+        if(*line < '0' || *line > '9') return 0;
+        while(*line >= '0' && *line <= '9') {
+            if(e < 1000) e = e * 10 + (*line - '0');
+            line++;
+        }
+        exp10 += eneg ? -e : e;
+    }
+
+    line = Flicker_SkipSpace(line);
+    if(*line++ != ',') return 0;
+    line = Flicker_SkipSpace(line);
+    if(*line != '0' && *line != '1') return 0;
+
+    t = (double)mant * (double)units_per_sec;
+    for(; exp10 > 0; exp10--) t *= 10.0;
+    for(; exp10 < 0; exp10++) t /= 10.0;
+    if(t > 9.2e18) return 0;
+
+    *time = neg ? -(int64_t)(t + 0.5) : (int64_t)(t + 0.5);
+    *level = (uint8_t)(*line - '0');
+    return 1;
+}
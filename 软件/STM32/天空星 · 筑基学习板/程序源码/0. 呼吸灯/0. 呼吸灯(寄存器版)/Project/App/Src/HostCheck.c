@@ -0,0 +1,3095 @@
+/**
+  ************************************************************************************
+  * @file              HostCheck.c
+  * @author         None
+  * @version       V1.15.0
+  * @date            2026-10-17
+  * @brief           主机端驱动检查程序源文件
+  *
+  * @details        本文件实现了以下检查项：
+  *                        1. bus：各初始化路径的总线访问次数，每个寄存器最多一次读-改-写或一次写
+  *                        2. soak：Delay_Until跨多次CYCCNT回绕的累计误差，单次延时的超调
+  *                        3. fleet：多块虚拟板各自的RegSim上下文、HSE频率误差、线程池结果与吞吐量、相位同步
+  *                        4. ws2812：TIM2 + DMA1模型上发送1000像素，逐位比对CCR1波形，统计帧耗时和帧率
+  *                        5. shift595：TIM5 + SPI2 + DMA1模型驱动74HC595级联模型，逐帧核对各LED点亮时间，
+  *                           检查换帧无半帧、不丢帧，统计刷新率与级联长度的关系
+  *                        6. matrix：TIM7 + GPIO模型上按引脚电平累计各像素点亮时间，核对亮度、单行选通、消隐，
+  *                           统计刷新率、占空比和中断开销
+  *                        7. charlie：TIM6 + GPIO模型上按引脚三态累计各LED点亮时间，核对亮度、检查鬼影，统计时隙开销
+  *                        8. uart：USART1 + DMA2模型上按主循环节拍运行Uart_Poll()和Cmd解析，最高波特率下核对交付内容、
+  *                           统计接收吞吐量，测量命令到应答的延迟
+  *                        9. device：能力表与编译期宏一致；按能力表的主频和总线上限核对Flash等待周期、APB分频和超限检测
+  *                        10. trace：RegSim上运行LED主循环，以虚拟CYCCNT记录边沿，与黄金跟踪HostData/breath.trace比对；
+  *                             record/diff/dump子命令生成、比对和打印跟踪文件
+  *                        11. flicker：已知PWM波形（稳定、周期抖动、占空比阶跃、零宽毛刺、逻辑分析仪CSV）输入Flicker，
+  *                             核对抖动、占空比误差、闪烁指数和可见阶跃
+  *                        12. pwmstagger：对齐与错开相位时同时导通通道数的峰值、均方根，与逐点统计的参考值比对；
+  *                             错开后的BSRR写入表在GPIO模型上回放，核对各通道占空比
+  *                        13. anim：各种内容的动画编码后逐帧解码核对，任意截断的数据须报错，
+  *                             Anim_Benchmark()解码示例动画AnimDemo的帧数和亮度之和
+  *                        14. pool：各池分配到用完、占用/最高占用/失败统计、按大小回退，
+  *                             Pool_Free()拒绝池外和非块起始地址
+  *                        15. arena：不对齐的存储区上各种对齐要求的分配、空间不足、水位统计，
+  *                             ARENA_POISON为1时发现回收后经旧指针的写入
+  *                        16. mapsize：HostData/MapSize/下同一程序的Keil .map、GCC .map和ELF夹具，
+  *                             核对解析出的总量和符号，报告、按预算检查和两次构建的比较
+  *
+  * @note            主机端程序，用到stdio（输出结果，trace读写跟踪文件）、malloc和pthread（fleet）、libm（flicker）
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 增加soak检查项
+  *                         - 2026-10-17 V1.2.0 增加fleet检查项
+  *                         - 2026-10-17 V1.3.0 增加ws2812检查项
+  *                         - 2026-10-17 V1.4.0 增加shift595检查项
+  *                         - 2026-10-17 V1.5.0 增加matrix检查项
+  *                         - 2026-10-17 V1.6.0 增加charlie检查项
+  *                         - 2026-10-17 V1.7.0 增加uart检查项
+  *                         - 2026-10-17 V1.8.0 增加device检查项，bus检查项增加Device_TuneBus
+  *                         - 2026-10-17 V1.9.0 增加trace检查项
+  *                         - 2026-10-17 V1.10.0 增加flicker检查项
+  *                         - 2026-10-17 V1.10.1 ws2812按32位比对CCR1（半字DMA写入会复制到高半字）
+  *                         - 2026-10-17 V1.11.0 增加pwmstagger检查项
+  *                         - 2026-10-17 V1.11.1 fleet离散度改用±5000ppm运行1秒检查（预期20个tick），±100ppm的结果只输出
+  *                         - 2026-10-17 V1.11.2 fleet同步仿真从随机相位开始，检查锁定所需周期数和残余误差
+  *                         - 2026-10-17 V1.12.0 增加anim检查项
+  *                         - 2026-10-17 V1.13.0 增加pool检查项
+  *                         - 2026-10-17 V1.14.0 增加arena检查项
+  *                         - 2026-10-17 V1.15.0 增加mapsize检查项
+  *
+  ************************************************************************************
+  */
+
+#include "HostCheck.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <math.h>
+#include "stm32f4xx.h"
+#include "Reg.h"
+#include "RegSim.h"
+#include "SimPeriph.h"
+#include "Device.h"
+#include "Delay.h"
+#include "LED.h"
+#include "SyncPin.h"
+#include "Indicator.h"
+#include "Ws2812.h"
+#include "Shift595.h"
+#include "Matrix.h"
+#include "Charlie.h"
+#include "Uart.h"
+#include "Cmd.h"
+#include "Breath.h"
+#include "Fleet.h"
+#include "PhaseLock.h"
+#include "Trace.h"
+#include "Flicker.h"
+#include "PwmStagger.h"
+#include "Anim.h"
+#include "AnimDemo.h"
+#include "Pool.h"
+#include "Arena.h"
+#include "MapSize.h"
+
+/* ---------------------------------- 公共部分 ---------------------------------- */
+
+/**
+  * @brief           复位仿真层并设置F407的时钟配置
+  * @param        None
+  * @retval          None
+  * @note           APB1 ÷ 4、APB2 ÷ 2，设置产生的访问不计入统计
+  */
+static void HostCheck_Reset(void)
+{
+    RegSim_Stats st;
+
+    RegSim_Init();
+    SystemCoreClock = SIMPERIPH_CORE_CLOCK;
+    REG_WRITE(RCC->CFGR, RCC_CFGR_PPRE1_DIV4 | RCC_CFGR_PPRE2_DIV2);
+    RegSim_TakeStats(&st);
+}
+
+/**
+  * @brief           比较并输出一项结果
+  * @param        what 项目名称
+  * @param        got 实际值
+  * @param        want 期望值
+  * @retval          0=相等，1=不相等
+  */
+static int HostCheck_Expect(const char *what, uint32_t got, uint32_t want)
+{
+    printf("  %-28s %10lu  (expect %lu)%s\n", what, (unsigned long)got, (unsigned long)want,
+           got == want ? "" : "  FAIL");
+    return got != want;
+}
+
+/**
+  * @brief           检查并输出一项不超过上限的结果
+  * @param        what 项目名称
+  * @param        got 实际值
+  * @param        max 上限
+  * @retval          0=不超过上限，1=超过上限
+  */
+static int HostCheck_ExpectMax(const char *what, uint64_t got, uint64_t max)
+{
+    printf("  %-28s %10llu  (max %llu)%s\n", what, (unsigned long long)got, (unsigned long long)max,
+           got <= max ? "" : "  FAIL");
+    return got > max;
+}
+
+/**
+  * @brief           确定性伪随机数（线性同余）
+  * @param        state 状态
+  * @retval          31位随机数
+  */
+static uint32_t HostCheck_Rand(uint32_t *state)
+{
+    *state = *state * 1103515245U + 12345U;
+    return (*state >> 1) & 0x7FFFFFFFU;
+}
+
+#define HOSTCHECK_IRQ_CYCLES               24U              /* Cortex-M4异常进入12周期 + 返回12周期（无尾链、零等待） */
+
+/* ---------------------------------- bus ---------------------------------- */
+
+#if DEVICE_HAS_TIM(7)
+/* 8 × 8点阵：行PC0~PC7（低电平有效），列PD0~PD7 */
+static const uint8_t hc_row_pin[8] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+static const uint8_t hc_col_pin[8] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+static const Matrix_Config hc_matrix = { GPIOC, GPIOD, hc_row_pin, hc_col_pin, 8, 8, 1, 0, MATRIX_MIN_UNIT };
+static Matrix_Slot hc_mx_a[MATRIX_BITS * 8];
+static Matrix_Slot hc_mx_b[MATRIX_BITS * 8];
+#endif
+
+#if DEVICE_HAS_TIM(6)
+/* 6引脚查理复用：PE0~PE5 */
+static const uint8_t hc_charlie_pin[6] = { 0, 1, 2, 3, 4, 5 };
+static Charlie_Slot hc_ch_a[CHARLIE_BITS * 6];
+static Charlie_Slot hc_ch_b[CHARLIE_BITS * 6];
+#endif
+
+static void Bus_Led(void)          { LED_Init(); }
+static void Bus_Delay(void)        { (void)Delay_Mark(); }
+static void Bus_DelayWarm(void)    { RegSim_Stats st; (void)Delay_Mark(); RegSim_TakeStats(&st); (void)Delay_Mark(); }
+static void Bus_Flash(void)        { (void)Device_TuneFlash(); }
+static void Bus_ApbTune(void)      { (void)Device_TuneBus(); }
+static void Bus_SyncLeader(void)   { SyncPin_InitLeader(); }
+static void Bus_SyncFollower(void) { SyncPin_InitFollower(0); }
+#if DEVICE_HAS_TIM(3) && DEVICE_HAS_TIM(4)
+static void Bus_Indicator(void)    { Indicator_Init(BREATH_PWM_CYCLE, BREATH_PERIOD_MS * 1000U / BREATH_PWM_CYCLE); }
+#endif
+#if DEVICE_HAS_TIM(2)
+static void Bus_Ws2812(void)       { Ws2812_Init(); }
+#endif
+#if DEVICE_HAS_TIM(7)
+static void Bus_Matrix(void)       { Matrix_Init(&hc_matrix, hc_mx_a, hc_mx_b); }
+#endif
+#if DEVICE_HAS_TIM(6)
+static void Bus_Charlie(void)      { Charlie_Init(GPIOE, hc_charlie_pin, 6, CHARLIE_MIN_UNIT, hc_ch_a, hc_ch_b); }
+#endif
+static void Bus_Uart(void)         { Uart_Init(UART_BAUD); }
+
+/**
+  * @brief   初始化路径及期望的访问次数
+  * @note   期望值按源码逐条数出：读次数 = 读-改-写次数 + 直接读次数，写次数 = 读-改-写次数 + 直接写次数
+  */
+typedef struct
+{
+    const char *name;
+    void (*init)(void);
+    uint32_t reads;
+    uint32_t writes;
+} Bus_Path;
+
+static const Bus_Path bus_path[] =
+{
+    /* AHB1ENR/MODER/OTYPER/PUPDR/OSPEEDR各一次读-改-写 + BSRR */
+    { "LED_Init",              Bus_Led,          5,  6 },
+    /* 读DWT_CTRL，DEMCR/DWT_CTRL各一次读-改-写，读CYCCNT；已使能时只有两次读 */
+    { "Delay_Mark (cold)",     Bus_Delay,        4,  2 },
+    { "Delay_Mark (warm)",     Bus_DelayWarm,    2,  0 },
+    /* ACR一次读-改-写 + 读回确认 */
+    { "Device_TuneFlash",      Bus_Flash,        2,  1 },
+    /* CFGR一次读-改-写 */
+    { "Device_TuneBus",        Bus_ApbTune,      1,  1 },
+    /* AHB1ENR/OTYPER/PUPDR/OSPEEDR/MODER + BSRR */
+    { "SyncPin_InitLeader",    Bus_SyncLeader,   5,  6 },
+    /* AHB1ENR/APB2ENR/MODER/PUPDR/EXTICR/FTSR/RTSR/IMR + PR、ISER */
+    { "SyncPin_InitFollower",  Bus_SyncFollower, 8, 10 },
+#if DEVICE_HAS_TIM(3) && DEVICE_HAS_TIM(4)
+    /* APB1ENR/CCMR2/CCER/AFR/MODER/CR2六次读-改-写 + 读CFGR，另有14次直接写 */
+    { "Indicator_Init",        Bus_Indicator,    7, 20 },
+#endif
+#if DEVICE_HAS_TIM(2)
+    /* 12次读-改-写 + 读CFGR + 等待EN清零，另有9次直接写 */
+    { "Ws2812_Init",           Bus_Ws2812,      14, 21 },
+#endif
+#if DEVICE_HAS_TIM(7)
+    /* 时钟2次 + 两个端口各4次读-改-写，另有10次直接写 */
+    { "Matrix_Init",           Bus_Matrix,      10, 20 },
+#endif
+#if DEVICE_HAS_TIM(6)
+    /* 时钟2次 + 端口4次读-改-写 + 读回MODER，另有8次直接写 */
+    { "Charlie_Init",          Bus_Charlie,      7, 14 },
+#endif
+    /* 11次读-改-写 + 读CFGR + 等待两个EN清零，另有13次直接写 */
+    { "Uart_Init",             Bus_Uart,        14, 24 },
+};
+
+#define BUS_PATH_COUNT                          (sizeof(bus_path) / sizeof(bus_path[0]))
+
+/**
+  * @brief           bus检查：各初始化路径的总线访问次数
+  * @param        argc 参数个数
+  * @param        argv 参数
+  * @retval          0=通过，1=失败
+  */
+static int Check_Bus(int argc, char **argv)
+{
+    RegSim_Stats st;
+    uint32_t i;
+    int fail = 0;
+
+    (void)argc;
+    (void)argv;
+    for(i = 0; i < BUS_PATH_COUNT; i++) {
+        HostCheck_Reset();
+        SimPeriph_GpioAttach(0, 0);
+        bus_path[i].init();
+        RegSim_TakeStats(&st);
+        printf("%s\n", bus_path[i].name);
+        fail |= HostCheck_Expect("reads", st.reads, bus_path[i].reads);
+        fail |= HostCheck_Expect("writes", st.writes, bus_path[i].writes);
+    }
+    return fail;
+}
+
+/* ---------------------------------- soak ---------------------------------- */
+
+#define SOAK_PERIOD                            168000U        /* Delay_Until间隔：168MHz下1毫秒 */
+#define SOAK_TICKS                              200000U        /* 默认循环次数：200秒，CYCCNT回绕7次 */
+#define SOAK_OVERRUN_EVERY                1000U           /* 每隔多少次循环模拟一次循环体超时 */
+#define SOAK_SLACK                               1024U          /* 未超时的循环体比间隔短1~1024个周期 */
+#define SOAK_LONG_COST                       4096U           /* 长延时的单次访问周期数，减少仿真的读次数 */
+
+/**
+  * @brief           测量一次单次延时的超调
+  * @param        delay 延时函数
+  * @param        arg 延时参数
+  * @param        want 期望的周期数
+  * @param        late 输出超调，单位：周期；提前返回时为UINT64_MAX
+  * @retval          None
+  */
+static void Soak_OneShot(void (*delay)(uint32_t), uint32_t arg, uint64_t want, uint64_t *late)
+{
+    uint64_t t0 = RegSim_Now();
+    uint64_t got;
+
+    delay(arg);
+    got = RegSim_Now() - t0;
+    *late = (got >= want) ? got - want : UINT64_MAX;
+}
+
+/**
+  * @brief           soak检查：Delay_Until长时间运行的累计误差和单次延时的超调
+  * @param        argc 参数个数
+  * @param        argv 参数，argv[1]为循环次数（可选）
+  * @retval          0=通过，1=失败
+  * @note           循环体耗时随机，比间隔短1~SOAK_SLACK个周期（等待时的轮询次数有限，仿真较快），
+  *                        每SOAK_OVERRUN_EVERY次超时0~25%，之后几十次循环逐步追回；
+  *                        每次返回后比较 *mark 与 起点 + k × 间隔，不相等即为漂移；
+  *                        调用时未到截止时刻的，返回时刻与截止时刻之差不超过一次寄存器访问的周期数；
+  *                        调用时已过截止时刻的（超时后的追赶），读一次CYCCNT即返回
+  */
+static int Check_Soak(int argc, char **argv)
+{
+    uint32_t ticks = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : SOAK_TICKS;
+    uint32_t seed = 1;
+    uint32_t mark, expect;
+    uint32_t drift = 0;
+    uint32_t overruns = 0;
+    uint32_t k;
+    uint32_t late_ticks = 0;
+    uint64_t t0, deadline, before, now, late, body;
+    uint64_t late_max = 0;
+    uint64_t ret_max = 0;
+    uint64_t us_late = 0;
+    uint64_t ms_late, s_late;
+    int fail = 0;
+
+    HostCheck_Reset();
+    mark = Delay_Mark();
+    expect = mark;
+    /* Delay_Mark()的最后一次访问就是读CYCCNT，返回时的虚拟时间即为起点 */
+    t0 = RegSim_Now();
+    deadline = t0;
+    for(k = 0; k < ticks; k++) {
+        if((k % SOAK_OVERRUN_EVERY) == SOAK_OVERRUN_EVERY - 1U) {
+            body = SOAK_PERIOD + HostCheck_Rand(&seed) % (SOAK_PERIOD / 4U);
+            overruns++;
+        } else {
+            body = SOAK_PERIOD - 1U - HostCheck_Rand(&seed) % SOAK_SLACK;
+        }
+        RegSim_Advance(body);
+        before = RegSim_Now();
+        Delay_Until(&mark, SOAK_PERIOD);
+        expect += SOAK_PERIOD;
+        deadline += SOAK_PERIOD;
+        now = RegSim_Now();
+        if(mark != expect) drift++;
+        if(before >= deadline) {
+            /* 已过截止时刻：应只读一次CYCCNT就返回 */
+            if(now - before > ret_max) ret_max = now - before;
+            late_ticks++;
+            continue;
+        }
+        late = (now >= deadline) ? now - deadline : UINT64_MAX;
+        if(late > late_max) late_max = late;
+    }
+    printf("Delay_Until, %lu ticks of %lu cycles (%llu CYCCNT wraps)\n", (unsigned long)ticks,
+           (unsigned long)SOAK_PERIOD, (unsigned long long)((RegSim_Now() - t0) >> 32));
+    fail |= HostCheck_Expect("deadline drift (ticks)", drift, 0);
+    fail |= HostCheck_ExpectMax("lateness (cycles)", late_max, 1);
+    printf("  %-28s %10lu\n", "overrun ticks", (unsigned long)overruns);
+    printf("  %-28s %10lu\n", "catch-up ticks", (unsigned long)late_ticks);
+    fail |= HostCheck_ExpectMax("catch-up return (cycles)", ret_max, 1);
+
+    printf("one-shot overshoot (cycles)\n");
+    for(k = 1; k <= 100U; k++) {
+        Soak_OneShot(Delay_us, k, (uint64_t)k * SIMPERIPH_CORE_CLOCK / 1000000U, &late);
+        if(late > us_late) us_late = late;
+    }
+    RegSim_SetAccessCost(SOAK_LONG_COST);
+    Soak_OneShot(Delay_ms, 60000U, (uint64_t)60000U * SIMPERIPH_CORE_CLOCK / 1000U, &ms_late);
+    Soak_OneShot(Delay_s, 100U, (uint64_t)100U * SIMPERIPH_CORE_CLOCK, &s_late);
+    RegSim_SetAccessCost(1);
+    /* 进入函数后还有启动读（Delay_Enable + 取起点），超调上限按3次访问计 */
+    fail |= HostCheck_ExpectMax("Delay_us(1..100)", us_late, 3);
+    fail |= HostCheck_ExpectMax("Delay_ms(60000)", ms_late, 3U * SOAK_LONG_COST);
+    fail |= HostCheck_ExpectMax("Delay_s(100)", s_late, 3U * SOAK_LONG_COST);
+    return fail;
+}
+
+/* ---------------------------------- fleet ---------------------------------- */
+
+#define FLEET_CHECK_BOARDS                 64U              /* 默认板数 */
+#define FLEET_CHECK_THREADS               4U               /* 默认线程数 */
+#define FLEET_CHECK_MS                        200U            /* 默认自由运行时长，单位：毫秒 */
+#define FLEET_CHECK_PPB                       100000U       /* 频率误差范围：±100ppm */
+#define FLEET_CHECK_SEED                     2026U           /* 随机种子 */
+#define FLEET_CHECK_DRIFT_PPB             5000000U      /* 离散度检查的频率误差：±5000ppm（HSI级别） */
+#define FLEET_CHECK_DRIFT_MS               1000U           /* 离散度检查的运行时长：预期离散度为20个tick */
+#define FLEET_CHECK_LOCK_PERIOD         100U            /* 同步仿真的呼吸周期，单位：毫秒（缩短以减少仿真量） */
+#define FLEET_CHECK_LOCK_BREATHS       24U             /* 同步仿真的呼吸周期数 */
+#define FLEET_CHECK_LOCK_BOARDS        8U              /* 同步仿真的板数 */
+/* 锁定所需的呼吸周期数上限：第一个脉冲 + 比例项把最大半周期误差（2^31）减半到锁定窗口（2^22）以下
+   的10个脉冲（留1个给频率误差） + 连续PHASELOCK_LOCK_COUNT个窗口内的脉冲 */
+#define FLEET_CHECK_LOCK_BREATHS_MAX (1U + 10U + PHASELOCK_LOCK_COUNT)
+/* 锁定后的残余误差上限，单位：微秒：不超过未修正时一个呼吸周期的漂移（±100ppm × 100ms = 10μs） */
+#define FLEET_CHECK_LOCK_ERR_US        ((uint32_t)((uint64_t)FLEET_CHECK_PPB * FLEET_CHECK_LOCK_PERIOD * 1000U / FLEET_PPB))
+
+/**
+  * @brief           新建并初始化一组板
+  * @param        fleet 板组
+  * @param        count 板数
+  * @param        period_ms 呼吸周期，单位：毫秒
+  * @retval          板数组，失败返回NULL
+  */
+static Fleet_Board *Fleet_New(Fleet *fleet, uint32_t count, uint32_t period_ms)
+{
+    Fleet_Board *boards = (Fleet_Board *)calloc(count, sizeof(Fleet_Board));
+
+    if(boards == NULL) return NULL;
+    if(Fleet_Init(fleet, boards, count, FLEET_CHECK_SEED, FLEET_CHECK_PPB, period_ms, BREATH_PWM_CYCLE) != 0) {
+        free(boards);
+        return NULL;
+    }
+    return boards;
+}
+
+/**
+  * @brief           fleet检查：每块板在自己的RegSim上下文中运行主循环，工作窃取线程池推进
+  * @param        argc 参数个数
+  * @param        argv 参数，argv[1]为板数，argv[2]为线程数，argv[3]为自由运行时长（毫秒），均可选
+  * @retval          0=通过，1=失败
+  * @note           1. 同一种子用1个线程和N个线程推进，各板的相位、tick数和虚拟时间逐项相同
+  *                        2. 每块板的tick数 = 本板经过的CPU周期数（HSE × 21）÷ 标称PWM周期，误差不超过1
+  *                        3. 主循环停在截止时刻之后不超过几次轮询（Delay_Until对每块板独立生效）
+  *                        4. 两块板的频率误差设为±FLEET_CHECK_DRIFT_PPB，运行FLEET_CHECK_DRIFT_MS后
+  *                           相位离散度与 频率误差极差 × 时长 之差不超过一个tick；相位按tick跳变，
+  *                           ±100ppm运行200ms预期只有约40μs，小于一个tick，因此单独用较大的误差检查
+  *                        5. 同步仿真：各板从随机相位开始，从板全部锁定，锁定时刻不晚于FLEET_CHECK_LOCK_BREATHS_MAX个
+  *                           呼吸周期，最后一次捕获的残余误差不超过FLEET_CHECK_LOCK_ERR_US，离散度不超过一个tick
+  */
+static int Check_Fleet(int argc, char **argv)
+{
+    uint32_t count = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : FLEET_CHECK_BOARDS;
+    uint32_t threads = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 0) : FLEET_CHECK_THREADS;
+    uint32_t ms = (argc > 3) ? (uint32_t)strtoul(argv[3], NULL, 0) : FLEET_CHECK_MS;
+    Fleet one, many, drift, lock;
+    Fleet_Board *b1, *bn, *bd, *bl;
+    Fleet_Board *b;
+    PhaseLock *locks;
+    Fleet_RunStats rs1, rsn, rsl;
+    Fleet_Stats st;
+    RegSim_Context *prev;
+    uint64_t now1, nown, want, slip, slip_max = 0;
+    uint32_t mismatch = 0;
+    uint32_t tick_err = 0;
+    uint32_t unlocked = 0;
+    int32_t ppb_min = 0, ppb_max = 0;
+    uint32_t expect_us, diff_us;
+    uint32_t epochs;
+    uint32_t lock_at[FLEET_CHECK_LOCK_BOARDS];                          /* 首次锁定时已运行的轮数，0=未锁定 */
+    uint32_t start[FLEET_CHECK_LOCK_BOARDS];                             /* 初始相位与0号板之差 */
+    uint32_t lock_max = 0;
+    uint32_t err, err_max = 0;
+    uint32_t seed = FLEET_CHECK_SEED;
+    uint32_t i, k;
+    int fail = 0;
+
+    if(count == 0 || threads == 0 || threads > FLEET_THREADS_MAX || ms == 0) return 2;
+    SystemCoreClock = SIMPERIPH_CORE_CLOCK;
+    b1 = Fleet_New(&one, count, BREATH_PERIOD_MS);
+    bn = Fleet_New(&many, count, BREATH_PERIOD_MS);
+    if(b1 == NULL || bn == NULL) {
+        printf("out of memory\n");
+        return 1;
+    }
+
+    /* 自由运行：每轮1毫秒参考时间 */
+    epochs = ms;
+    Fleet_Run(&one, NULL, 1, epochs, 1000U, &rs1);
+    Fleet_Run(&many, NULL, threads, epochs, 1000U, &rsn);
+
+    prev = RegSim_Select(NULL);
+    for(i = 0; i < count; i++) {
+        b = &bn[i];
+        RegSim_Select(b1[i].sim);
+        now1 = RegSim_Now();
+        RegSim_Select(b->sim);
+        nown = RegSim_Now();
+        if(b1[i].eff.phase != b->eff.phase || b1[i].ticks != b->ticks || now1 != nown) mismatch++;
+        /* 最后一个PWM周期的截止时刻为 due - pwm_cycles */
+        slip = nown - (b->due - many.pwm_cycles);
+        if(slip > slip_max) slip_max = slip;
+        /* 本板CPU周期数 ÷ PWM周期，启动时的初始化周期数小于一个PWM周期 */
+        want = b->cycles / many.pwm_cycles;
+        if(b->ticks + 1U < want || b->ticks > want) tick_err++;
+        if(b->ppb < ppb_min) ppb_min = b->ppb;
+        if(b->ppb > ppb_max) ppb_max = b->ppb;
+    }
+    RegSim_Select(prev);
+
+    Fleet_Measure(&many, &st);
+    expect_us = (uint32_t)((uint64_t)(uint32_t)(ppb_max - ppb_min) * ms * 1000U / FLEET_PPB);
+
+    printf("free-running, %lu boards, %lu ms, +/-%lu ppb, pwm %lu cycles\n", (unsigned long)count,
+           (unsigned long)ms, (unsigned long)FLEET_CHECK_PPB, (unsigned long)many.pwm_cycles);
+    fail |= HostCheck_Expect("1 vs N threads mismatches", mismatch, 0);
+    fail |= HostCheck_Expect("ticks off HSE x 21 clock", tick_err, 0);
+    fail |= HostCheck_ExpectMax("loop slip past deadline", slip_max, 3U * FLEET_POLL_CYCLES);
+    printf("  %-28s %10lu us (ppb range %ld..%ld -> %lu us, tick %lu us)\n", "phase spread",
+           (unsigned long)st.spread_us, (long)ppb_min, (long)ppb_max, (unsigned long)expect_us,
+           (unsigned long)BREATH_PWM_CYCLE);
+    printf("  %-28s %10.0f board-ticks/s, %llu steals (1 thread)\n", "throughput", rs1.ticks_per_sec,
+           (unsigned long long)rs1.steals);
+    printf("  %-28s %10.0f board-ticks/s, %llu steals (%lu threads)\n", "", rsn.ticks_per_sec,
+           (unsigned long long)rsn.steals, (unsigned long)rsn.threads);
+    Fleet_Free(&one);
+    Fleet_Free(&many);
+    free(b1);
+    free(bn);
+
+    /* 离散度：两块板分别取误差范围的两端，预期离散度为多个tick */
+    bd = Fleet_New(&drift, 2, BREATH_PERIOD_MS);
+    if(bd == NULL) {
+        printf("out of memory\n");
+        return 1;
+    }
+    Fleet_SetPpb(&drift, 0, -(int32_t)FLEET_CHECK_DRIFT_PPB);
+    Fleet_SetPpb(&drift, 1, (int32_t)FLEET_CHECK_DRIFT_PPB);
+    Fleet_Run(&drift, NULL, 1, FLEET_CHECK_DRIFT_MS, 1000U, NULL);
+    Fleet_Measure(&drift, &st);
+    expect_us = (uint32_t)(2ULL * FLEET_CHECK_DRIFT_PPB * FLEET_CHECK_DRIFT_MS * 1000U / FLEET_PPB);
+    diff_us = (st.spread_us > expect_us) ? st.spread_us - expect_us : expect_us - st.spread_us;
+    printf("drift, 2 boards, %lu ms, +/-%lu ppb\n", (unsigned long)FLEET_CHECK_DRIFT_MS,
+           (unsigned long)FLEET_CHECK_DRIFT_PPB);
+    printf("  %-28s %10lu us (expect %lu us = %lu ticks)\n", "phase spread", (unsigned long)st.spread_us,
+           (unsigned long)expect_us, (unsigned long)(expect_us / BREATH_PWM_CYCLE));
+    fail |= HostCheck_Expect("leading board", (uint32_t)st.lead, 1);
+    fail |= HostCheck_ExpectMax("spread vs expected (us)", diff_us, BREATH_PWM_CYCLE);
+    Fleet_Free(&drift);
+    free(bd);
+
+    /* 同步仿真：各板从随机相位开始，每轮一个tick，主板经过最暗点后的一轮末各从板捕获相位；
+       按呼吸周期分段推进（锁相环只在每个周期一次的脉冲后更新，分段不改变结果），每段之后记录新锁定的从板 */
+    bl = Fleet_New(&lock, FLEET_CHECK_LOCK_BOARDS, FLEET_CHECK_LOCK_PERIOD);
+    locks = (PhaseLock *)calloc(FLEET_CHECK_LOCK_BOARDS, sizeof(PhaseLock));
+    if(bl == NULL || locks == NULL) {
+        printf("out of memory\n");
+        return 1;
+    }
+    for(i = 0; i < FLEET_CHECK_LOCK_BOARDS; i++) {
+        Fleet_SetPhase(&lock, i, HostCheck_Rand(&seed));
+        PhaseLock_Init(&locks[i], &bl[i].eff, PHASELOCK_KP_SHIFT, PHASELOCK_KI_SHIFT);
+        start[i] = bl[i].eff.phase - bl[0].eff.phase;
+        lock_at[i] = 0;
+    }
+    epochs = FLEET_CHECK_LOCK_PERIOD * 1000U / BREATH_PWM_CYCLE;
+    memset(&rsl, 0, sizeof(rsl));
+    for(k = 1; k <= FLEET_CHECK_LOCK_BREATHS; k++) {
+        Fleet_Run(&lock, locks, threads, epochs, BREATH_PWM_CYCLE, &rs1);
+        rsl.ticks += rs1.ticks;
+        rsl.seconds += rs1.seconds;
+        for(i = 1; i < FLEET_CHECK_LOCK_BOARDS; i++) {
+            if(lock_at[i] == 0 && locks[i].locked) lock_at[i] = k * epochs;
+        }
+    }
+    for(i = 1; i < FLEET_CHECK_LOCK_BOARDS; i++) {
+        if(!locks[i].locked) unlocked++;
+        if(lock_at[i] == 0) {
+            lock_max = UINT32_MAX;
+        } else if(lock_at[i] > lock_max) {
+            lock_max = lock_at[i];
+        }
+        err = (uint32_t)(((uint64_t)(uint32_t)((locks[i].err < 0) ? -locks[i].err : locks[i].err)
+                          * FLEET_CHECK_LOCK_PERIOD * 1000U) >> 32);
+        if(err > err_max) err_max = err;
+    }
+    Fleet_Measure(&lock, &st);
+    printf("phase-locked, %lu boards from random phases, %lu breaths of %lu ms\n",
+           (unsigned long)FLEET_CHECK_LOCK_BOARDS, (unsigned long)FLEET_CHECK_LOCK_BREATHS,
+           (unsigned long)FLEET_CHECK_LOCK_PERIOD);
+    for(i = 1; i < FLEET_CHECK_LOCK_BOARDS; i++) {
+        printf("  board %lu: %3lu%% of a breath off board 0, locked by epoch %lu\n", (unsigned long)i,
+               (unsigned long)(((uint64_t)start[i] * 100U) >> 32), (unsigned long)lock_at[i]);
+    }
+    fail |= HostCheck_ExpectMax("breaths to lock",
+                                (lock_max == UINT32_MAX) ? UINT32_MAX : lock_max / epochs, FLEET_CHECK_LOCK_BREATHS_MAX);
+    fail |= HostCheck_ExpectMax("residual error (us)", err_max, FLEET_CHECK_LOCK_ERR_US);
+    fail |= HostCheck_Expect("followers not locked", unlocked, 0);
+    fail |= HostCheck_ExpectMax("phase spread (us)", st.spread_us, BREATH_PWM_CYCLE);
+    printf("  %-28s %10.0f board-ticks/s (%lu threads)\n", "throughput",
+           (rsl.seconds > 0.0) ? (double)rsl.ticks / rsl.seconds : 0.0, (unsigned long)threads);
+    Fleet_Free(&lock);
+    free(bl);
+    free(locks);
+    return fail;
+}
+
+/* ---------------------------------- ws2812 ---------------------------------- */
+
+#define WS_CHECK_PIXELS                      1000U            /* 像素数 */
+#define WS_CHECK_BYTES                        (WS_CHECK_PIXELS * 3U)
+#define WS_CHECK_RESET                        (WS2812_RESET_US * WS2812_BIT_HZ / 1000000U)
+#define WS_CHECK_SLOTS                        (WS_CHECK_BYTES * 8U + WS_CHECK_RESET + 4U * WS2812_HALF_SLOTS)
+#define WS_CHECK_TOL_NS                      150U              /* WS2812数据手册的高电平时间容差 */
+
+#if DEVICE_HAS_TIM(2)
+static uint8_t ws_check_data[WS_CHECK_BYTES];
+static uint32_t ws_check_ccr[WS_CHECK_SLOTS];      /* 每个PWM周期生效的比较值（32位，高半字须为0） */
+static uint64_t ws_check_at[WS_CHECK_SLOTS];        /* 该周期开始的虚拟时间 */
+static uint32_t ws_check_num;
+
+/**
+  * @brief           TIM2更新事件回调：记录本周期生效的CCR1
+  */
+static void Ws_CheckHook(uint32_t n, const SimPeriph_Tim *tim, void *ctx)
+{
+    (void)n;
+    (void)ctx;
+    if(ws_check_num >= WS_CHECK_SLOTS) return;
+    ws_check_ccr[ws_check_num] = tim->ccr_act[0];
+    ws_check_at[ws_check_num] = RegSim_Now();
+    ws_check_num++;
+}
+
+/**
+  * @brief           ws2812检查：逐位比对波形，统计帧耗时
+  * @param        argc 参数个数
+  * @param        argv 参数
+  * @retval          0=通过，1=失败
+  * @note           CCR1预装载，DMA在更新事件写入的值下一个周期才生效，回调记录的是每个周期实际输出的比较值；
+  *                        CCR1为32位，按完整的32位比对，DMA宽度配错时高半字不为0；
+  *                        仿真只计寄存器访问的周期数，ISR耗时不含编码的运算时间
+  */
+static int Check_Ws2812(int argc, char **argv)
+{
+    uint32_t tclk, arr, t0, t1;
+    uint32_t seed = 2026;
+    uint32_t first, bits, i;
+    uint32_t wrong = 0;
+    uint32_t zeros = 0;
+    uint32_t frame, fmin, fmax;
+    uint64_t span;
+    int fail = 0;
+
+    (void)argc;
+    (void)argv;
+    HostCheck_Reset();
+    SimPeriph_GpioAttach(0, 0);
+    SimPeriph_DmaAttach();
+    SimPeriph_TimAttach(2, Ws_CheckHook, 0);
+    RegSim_SetHandler(DMA1_Stream1_IRQn, DMA1_Stream1_IRQHandler);
+    for(i = 0; i < WS_CHECK_BYTES; i++) ws_check_data[i] = (uint8_t)HostCheck_Rand(&seed);
+
+    Ws2812_Init();
+    ws_check_num = 0;
+    if(Ws2812_Show(ws_check_data, WS_CHECK_BYTES) != 0) return 1;
+    while(Ws2812_Busy() && RegSim_Now() < (uint64_t)SIMPERIPH_CORE_CLOCK) RegSim_Advance(64);
+
+    tclk = Device_TimClk1();
+    arr = tclk / WS2812_BIT_HZ - 1U;
+    t0 = (uint32_t)((uint64_t)WS2812_T0H_NS * (tclk / 1000000U) / 1000U);
+    t1 = (uint32_t)((uint64_t)WS2812_T1H_NS * (tclk / 1000000U) / 1000U);
+    bits = WS_CHECK_BYTES * 8U;
+
+    /* 第一个非零比较值为第一位，之后逐位比对 */
+    for(first = 0; first < ws_check_num && ws_check_ccr[first] == 0; first++);
+    for(i = 0; i < bits; i++) {
+        if(first + i >= ws_check_num ||
+           ws_check_ccr[first + i] != (((ws_check_data[i >> 3] >> (7U - (i & 7U))) & 1U) ? t1 : t0)) wrong++;
+    }
+    for(i = first + bits; i < ws_check_num && ws_check_ccr[i] == 0; i++) zeros++;
+    span = (first + bits < ws_check_num) ? ws_check_at[first + bits] - ws_check_at[first] : 0;
+
+    printf("WS2812, %lu pixels, TIM2 %lu Hz, ARR %lu, T0H %lu, T1H %lu counts\n",
+           (unsigned long)WS_CHECK_PIXELS, (unsigned long)tclk, (unsigned long)arr,
+           (unsigned long)t0, (unsigned long)t1);
+    fail |= HostCheck_Expect("still busy", Ws2812_Busy(), 0);
+    fail |= HostCheck_Expect("mismatched bits", wrong, 0);
+    fail |= HostCheck_Expect("trailing slots", ws_check_num - first - bits - zeros, 0);
+    fail |= HostCheck_ExpectMax("reset slots short by", (zeros < WS_CHECK_RESET) ? WS_CHECK_RESET - zeros : 0, 0);
+    fail |= HostCheck_Expect("bit period (ns)",
+                             (uint32_t)(span * 1000000000ULL / bits / SystemCoreClock), 1000000000U / WS2812_BIT_HZ);
+    fail |= HostCheck_ExpectMax("T0H error (ns)",
+                                (uint64_t)abs((int)(t0 * 1000000000ULL / tclk) - (int)WS2812_T0H_NS), WS_CHECK_TOL_NS);
+    fail |= HostCheck_ExpectMax("T1H error (ns)",
+                                (uint64_t)abs((int)(t1 * 1000000000ULL / tclk) - (int)WS2812_T1H_NS), WS_CHECK_TOL_NS);
+
+    /* 帧耗时：数据位 + 复位位，另加排空两半缓冲区和最后一次中断的余量 */
+    frame = Ws2812_FrameCycles();
+    fmin = (bits + WS_CHECK_RESET) * (SystemCoreClock / WS2812_BIT_HZ);
+    fmax = (bits + WS_CHECK_RESET + 3U * WS2812_HALF_SLOTS) * (SystemCoreClock / WS2812_BIT_HZ);
+    printf("  %-28s %10lu  (%lu..%lu)%s\n", "frame (cycles)", (unsigned long)frame,
+           (unsigned long)fmin, (unsigned long)fmax, (frame >= fmin && frame <= fmax) ? "" : "  FAIL");
+    fail |= (frame < fmin || frame > fmax);
+    printf("  %-28s %10.2f ms, %.1f fps\n", "frame time", frame * 1000.0 / SystemCoreClock,
+           (double)SystemCoreClock / frame);
+    printf("  %-28s %10lu cycles (register accesses only)\n", "ISR", (unsigned long)Ws2812_IsrCycles());
+    return fail;
+}
+#else
+static int Check_Ws2812(int argc, char **argv)
+{
+    (void)argc;
+    (void)argv;
+    printf("no TIM2 on this part, skipped\n");
+    return 0;
+}
+#endif
+
+/* ---------------------------------- shift595 ---------------------------------- */
+
+#define SH_CHECK_REGS_MAX                  64U              /* 最长级联 */
+#define SH_CHECK_LEDS_MAX                  (SH_CHECK_REGS_MAX * 8U)
+#define SH_CHECK_REGS                         8U               /* 逐帧核对用的级联长度 */
+#define SH_CHECK_PLANES                      (SHIFT595_BITS * SH_CHECK_REGS_MAX)
+
+/**
+  * @brief   74HC595级联模型和逐帧统计
+  */
+typedef struct
+{
+    uint32_t regs;                                      /* 级联的寄存器数 */
+    uint32_t unit;                                       /* 最低位平面时长，单位：CPU周期 */
+    uint8_t sr[SH_CHECK_REGS_MAX];            /* 移位寄存器，0号靠近MCU */
+    uint8_t out[SH_CHECK_REGS_MAX];           /* 输出锁存 */
+    uint32_t shifted;                                   /* 上次锁存以来移入的字节数 */
+    uint64_t last;                                       /* 上次锁存的虚拟时间，0=尚未锁存 */
+    uint64_t shift_done;                             /* 最后一个字节移出的虚拟时间 */
+    uint64_t slack_min;                               /* 最后一个字节移出到锁存的最短间隔，单位：CPU周期 */
+    uint8_t aligned;                                    /* 1=已从0号平面开始统计 */
+    uint16_t on[SH_CHECK_LEDS_MAX];          /* 本帧各LED点亮的单位数 */
+    const uint8_t *frame[2];                        /* 可能显示的两帧亮度 */
+    uint32_t shown[2];                               /* 两帧各完整显示的次数 */
+    uint32_t mixed;                                     /* 与两帧都不符的帧数 */
+    uint32_t back;                                      /* 显示新帧之后又出现旧帧的次数 */
+    uint32_t bad_shift;                               /* 锁存时移入字节数不等于级联长度的次数 */
+    uint32_t bad_period;                             /* 周期不是单位时长2^k倍的次数 */
+    uint32_t frames;                                   /* 完整帧数 */
+    uint64_t frame_start;                            /* 第一个完整帧开始的虚拟时间 */
+    uint64_t frame_end;                              /* 最后一个完整帧结束的虚拟时间 */
+} Sh_Chain;
+
+static Sh_Chain sh_chain;
+static uint8_t sh_check_level[3][SH_CHECK_LEDS_MAX];
+static uint8_t sh_check_planes[3][SH_CHECK_PLANES];
+
+/**
+  * @brief           SPI2移出一个字节：移入级联
+  */
+static void Sh_CheckSpi(uint32_t n, uint16_t data, void *ctx)
+{
+    Sh_Chain *c = (Sh_Chain *)ctx;
+    uint8_t b = (uint8_t)data;
+    uint8_t r = 0;
+    uint32_t i;
+
+    (void)n;
+    /* 高位先发时第一位最终到达QH；低位先发则位序相反 */
+    if(SimPeriph_Spi(2)->cr1 & SPI_CR1_LSBFIRST) {
+        for(i = 0; i < 8U; i++) r |= (uint8_t)(((b >> i) & 1U) << (7U - i));
+        b = r;
+    }
+    for(i = c->regs - 1U; i > 0; i--) c->sr[i] = c->sr[i - 1U];
+    c->sr[0] = b;
+    c->shifted++;
+    c->shift_done = RegSim_Now();
+}
+
+/**
+  * @brief           核对一个完整帧
+  */
+static void Sh_CheckFrame(Sh_Chain *c)
+{
+    uint32_t f, i;
+    int match = -1;
+
+    for(f = 0; f < 2U && match < 0; f++) {
+        if(c->frame[f] == 0) continue;
+        for(i = 0; i < c->regs * 8U && c->on[i] == c->frame[f][i]; i++);
+        if(i == c->regs * 8U) match = (int)f;
+    }
+    if(match < 0) {
+        c->mixed++;
+    } else {
+        if(match == 0 && c->shown[1] != 0) c->back++;
+        c->shown[match]++;
+    }
+    c->frames++;
+}
+
+/**
+  * @brief           TIM5更新事件：RCLK上升沿锁存，统计刚结束的平面
+  */
+static void Sh_CheckLatch(uint32_t n, const SimPeriph_Tim *tim, void *ctx)
+{
+    Sh_Chain *c = (Sh_Chain *)ctx;
+    uint64_t now = RegSim_Now();
+    uint64_t d;
+    uint32_t k, i;
+
+    (void)n;
+    if(!(tim->cr1 & TIM_CR1_CEN)) return;                                /* 初始化中的UG：输出未打开 */
+    if(c->last != 0) {
+        d = now - c->last;
+        for(k = 0; k < SHIFT595_BITS && ((uint64_t)c->unit << k) != d; k++);
+        if(k == SHIFT595_BITS) {
+            c->bad_period++;
+        } else {
+            if(c->aligned) {
+                for(i = 0; i < c->regs * 8U; i++) {
+                    if((c->out[i >> 3] >> (i & 7U)) & 1U) c->on[i] += (uint16_t)(1U << k);
+                }
+                if(k == SHIFT595_BITS - 1U) {
+                    Sh_CheckFrame(c);
+                    c->frame_end = now;
+                    memset(c->on, 0, sizeof(c->on));
+                }
+            }
+            if(k == SHIFT595_BITS - 1U && !c->aligned) {
+                c->aligned = 1;
+                c->frame_start = now;
+            }
+        }
+        if(c->shifted != c->regs) c->bad_shift++;
+        if(now - c->shift_done < c->slack_min) c->slack_min = now - c->shift_done;
+    }
+    memcpy(c->out, c->sr, c->regs);
+    c->shifted = 0;
+    c->last = now;
+}
+
+/**
+  * @brief           复位仿真层，挂接模型并初始化驱动
+  * @param        regs 级联的寄存器数
+  * @param        planes 第一帧
+  * @param        level 第一帧的亮度
+  * @retval          None
+  */
+static void Sh_CheckStart(uint32_t regs, const uint8_t *planes, const uint8_t *level)
+{
+    HostCheck_Reset();
+    memset(&sh_chain, 0, sizeof(sh_chain));
+    sh_chain.regs = regs;
+    sh_chain.slack_min = UINT64_MAX;
+    sh_chain.frame[0] = level;
+    SimPeriph_GpioAttach(0, 0);
+    SimPeriph_DmaAttach();
+    SimPeriph_SpiAttach(2, Sh_CheckSpi, &sh_chain);
+    SimPeriph_TimAttach(5, Sh_CheckLatch, &sh_chain);
+    RegSim_SetHandler(TIM5_IRQn, TIM5_IRQHandler);
+    Shift595_Init(planes, regs, 0);
+    sh_chain.unit = Shift595_MinUnit(regs) * (SystemCoreClock / Device_TimClk1() == 0 ? 1U :
+                                                 SystemCoreClock / Device_TimClk1());
+}
+
+/**
+  * @brief           推进到完整帧数达到要求
+  */
+static void Sh_CheckRun(uint32_t frames)
+{
+    uint64_t limit = RegSim_Now() + (uint64_t)sh_chain.unit * ((1U << SHIFT595_BITS) - 1U) * (frames + 2U);
+
+    while(sh_chain.frames < frames && RegSim_Now() < limit) RegSim_Advance(256);
+}
+
+/**
+  * @brief           shift595检查：逐帧核对点亮时间、换帧和刷新率
+  * @param        argc 参数个数
+  * @param        argv 参数
+  * @retval          0=通过，1=失败
+  * @note           0号平面在初始化时由CC3E打开产生的上升沿锁存，TIM5模型不模拟该沿，
+  *                        统计从第一次7号平面结束（下一帧的0号平面开始）算起
+  */
+static int Check_Shift595(int argc, char **argv)
+{
+    static const uint32_t chain[] = { 1, 2, 4, 8, 16, 32, 64 };
+    uint32_t seed = 595;
+    uint32_t i, f;
+    uint32_t busy, queued, released;
+    uint32_t hz, want;
+    int fail = 0;
+
+    (void)argc;
+    (void)argv;
+    for(f = 0; f < 3U; f++) {
+        for(i = 0; i < SH_CHECK_LEDS_MAX; i++) sh_check_level[f][i] = (uint8_t)(HostCheck_Rand(&seed) >> 16);  /* 低位周期短，取高位 */
+        Shift595_Pack(sh_check_level[f], SH_CHECK_REGS, sh_check_planes[f]);
+    }
+
+    /* 逐帧核对，运行中换帧 */
+    Sh_CheckStart(SH_CHECK_REGS, sh_check_planes[0], sh_check_level[0]);
+    Sh_CheckRun(2);
+    sh_chain.frame[1] = sh_check_level[1];
+    queued = Shift595_Show(sh_check_planes[1]);
+    busy = Shift595_Show(sh_check_planes[2]);
+    released = Shift595_InUse(sh_check_planes[0]) + Shift595_InUse(sh_check_planes[1]);
+    Sh_CheckRun(sh_chain.frames + 3U);
+    printf("74HC595 x %lu, unit %lu cycles\n", (unsigned long)SH_CHECK_REGS, (unsigned long)sh_chain.unit);
+    fail |= HostCheck_Expect("Show (queued)", queued, 0);
+    fail |= HostCheck_Expect("Show while pending", busy, 1);
+    fail |= HostCheck_Expect("old+new in use before swap", released, 2);
+    fail |= HostCheck_Expect("old in use after swap", Shift595_InUse(sh_check_planes[0]), 0);
+    fail |= HostCheck_Expect("new in use after swap", Shift595_InUse(sh_check_planes[1]), 1);
+    fail |= HostCheck_Expect("Show after swap", Shift595_Show(sh_check_planes[2]), 0);
+    fail |= HostCheck_Expect("old frames shown >= 2", sh_chain.shown[0] >= 2U, 1);
+    fail |= HostCheck_Expect("new frames shown >= 2", sh_chain.shown[1] >= 2U, 1);
+    fail |= HostCheck_Expect("mixed frames", sh_chain.mixed, 0);
+    fail |= HostCheck_Expect("old after new", sh_chain.back, 0);
+    fail |= HostCheck_Expect("latch with partial plane", sh_chain.bad_shift, 0);
+    fail |= HostCheck_Expect("bad plane period", sh_chain.bad_period, 0);
+
+    /* 刷新率与级联长度 */
+    printf("refresh vs chain length (minimum unit)\n");
+    printf("  %6s %8s %10s %10s %12s\n", "regs", "unit", "Hz", "expect", "slack (ns)");
+    for(i = 0; i < sizeof(chain) / sizeof(chain[0]); i++) {
+        Shift595_Pack(sh_check_level[0], chain[i], sh_check_planes[0]);
+        Sh_CheckStart(chain[i], sh_check_planes[0], sh_check_level[0]);
+        Sh_CheckRun(2);
+        hz = (sh_chain.frames != 0) ? (uint32_t)((uint64_t)SystemCoreClock * sh_chain.frames /
+                                                (sh_chain.frame_end - sh_chain.frame_start)) : 0;
+        want = Shift595_RefreshHz(chain[i]);
+        printf("  %6lu %8lu %10lu %10lu %12llu%s\n", (unsigned long)chain[i],
+               (unsigned long)Shift595_MinUnit(chain[i]), (unsigned long)hz, (unsigned long)want,
+               (unsigned long long)(sh_chain.slack_min * 1000000000ULL / SystemCoreClock),
+               (hz == want && sh_chain.mixed == 0 && sh_chain.bad_shift == 0 && sh_chain.bad_period == 0)
+                   ? "" : "  FAIL");
+        fail |= (hz != want || sh_chain.mixed != 0 || sh_chain.bad_shift != 0 || sh_chain.bad_period != 0);
+    }
+    printf("  slack = last byte shifted out to RCLK edge; ISR cost counts register accesses only\n");
+    return fail;
+}
+
+/* ---------------------------------- matrix ---------------------------------- */
+
+#if DEVICE_HAS_TIM(7)
+
+#define MX_CHECK_FRAMES                      4U               /* 核对的帧数 */
+
+/**
+  * @brief   点阵观察状态
+  */
+typedef struct
+{
+    uint8_t lit[8][8];                                  /* 当前点亮的像素 */
+    uint64_t on[8][8];                                /* 本帧各像素点亮的CPU周期数 */
+    uint64_t last;                                       /* 上次累计的虚拟时间 */
+    int32_t row;                                         /* 当前选通的行，-1=无 */
+    uint32_t writes;                                    /* 本次中断中的GPIO写次数（0=消隐，1=行，2=列） */
+    uint8_t boundary;                                  /* 1=本次中断显示0号子帧第0行 */
+    uint32_t rows_max;                               /* 同时选通的最多行数 */
+    uint32_t ghost;                                     /* 换行时列未消隐的次数 */
+    uint64_t blank_at;                                 /* 本次中断写消隐的时刻 */
+    uint64_t gap_min, gap_max;                    /* 消隐到写入列的间隔，单位：CPU周期 */
+    uint32_t isr;                                         /* 中断次数 */
+    uint64_t isr_max;                                  /* 单次中断最多的CPU周期数（含进入/返回） */
+    uint64_t isr_sum;                                  /* 统计期间中断CPU周期数总和 */
+    uint64_t start;                                      /* 开始统计的虚拟时间 */
+    uint8_t arm;                                         /* 1=从下一帧开始统计 */
+    uint8_t counting;                                  /* 1=正在统计帧 */
+    uint32_t frames;                                    /* 已核对的帧数 */
+    uint64_t frame_at;                                /* 本帧开始的虚拟时间 */
+    uint64_t frame_min, frame_max;              /* 帧长，单位：CPU周期 */
+    uint64_t err_max;                                  /* 点亮时间与期望之差的最大值 */
+    uint64_t full_on;                                   /* 满亮度像素在最后一帧的点亮时间 */
+    const uint8_t *level;                             /* 显示的亮度 */
+    uint64_t ratio;                                     /* 每个定时器计数的CPU周期数 */
+} Mx_Watch;
+
+static Mx_Watch mx_watch;
+
+/**
+  * @brief           把上次累计以来的时间计入点亮的像素
+  */
+static void Mx_CheckAccount(Mx_Watch *w, uint64_t now)
+{
+    uint32_t r, c;
+
+    if(w->counting) {
+        for(r = 0; r < 8U; r++) {
+            for(c = 0; c < 8U; c++) {
+                if(w->lit[r][c]) w->on[r][c] += now - w->last;
+            }
+        }
+    }
+    w->last = now;
+}
+
+/**
+  * @brief           核对刚结束的一帧
+  * @param        w 观察状态
+  * @param        now 0号子帧第0行的消隐时刻（上一帧最后一行在此熄灭）
+  * @retval          None
+  */
+static void Mx_CheckFrame(Mx_Watch *w, uint64_t now)
+{
+    uint64_t want, got, err;
+    uint32_t r, c, k, ones;
+
+    if(w->counting) {
+        for(r = 0; r < 8U; r++) {
+            for(c = 0; c < 8U; c++) {
+                /* 每个点亮的子帧从写入列到下一次消隐：子帧时长 - 消隐到写列的间隔 */
+                for(k = 0, ones = 0; k < MATRIX_BITS; k++) ones += (w->level[r * 8U + c] >> k) & 1U;
+                want = (uint64_t)w->level[r * 8U + c] * hc_matrix.unit * w->ratio - (uint64_t)ones * w->gap_min;
+                got = w->on[r][c];
+                err = (got > want) ? got - want : want - got;
+                if(err > w->err_max) w->err_max = err;
+                if(w->level[r * 8U + c] == (1U << MATRIX_BITS) - 1U) w->full_on = got;
+            }
+        }
+        if(now - w->frame_at < w->frame_min) w->frame_min = now - w->frame_at;
+        if(now - w->frame_at > w->frame_max) w->frame_max = now - w->frame_at;
+        w->frames++;
+    }
+    memset(w->on, 0, sizeof(w->on));
+    w->frame_at = now;
+    if(w->arm && !w->counting) {
+        w->counting = 1;
+        w->start = now;
+    }
+}
+
+/**
+  * @brief           GPIO写入后按引脚电平更新点亮的像素
+  */
+static void Mx_CheckGpio(uint32_t port, const SimPeriph_GpioPort *gpio, void *ctx)
+{
+    Mx_Watch *w = (Mx_Watch *)ctx;
+    const SimPeriph_GpioPort *rp = SimPeriph_Gpio(2);                 /* 行：PC，低电平有效 */
+    const SimPeriph_GpioPort *cp = SimPeriph_Gpio(3);                 /* 列：PD，高电平点亮 */
+    uint64_t now = RegSim_Now();
+    uint32_t r, c, rows = 0;
+    uint8_t cols = 0;
+    int32_t row = -1;
+
+    (void)port;
+    (void)gpio;
+    Mx_CheckAccount(w, now);
+    for(c = 0; c < 8U; c++) {
+        if(SimPeriph_GpioDrive(cp, hc_col_pin[c]) == SIMPERIPH_PIN_HIGH) cols |= (uint8_t)(1U << c);
+    }
+    for(r = 0; r < 8U; r++) {
+        if(SimPeriph_GpioDrive(rp, hc_row_pin[r]) == SIMPERIPH_PIN_LOW) {
+            rows++;
+            row = (int32_t)r;
+        }
+        for(c = 0; c < 8U; c++) {
+            w->lit[r][c] = (uint8_t)(SimPeriph_GpioDrive(rp, hc_row_pin[r]) == SIMPERIPH_PIN_LOW &&
+                                     ((cols >> c) & 1U));
+        }
+    }
+    if(rows > w->rows_max) w->rows_max = rows;
+    if(row != w->row && cols != 0) w->ghost++;
+    w->row = row;
+    if(w->writes == 0) {
+        w->blank_at = now;
+        if(w->boundary) Mx_CheckFrame(w, now);
+    } else if(w->writes == 2U) {
+        if(now - w->blank_at < w->gap_min) w->gap_min = now - w->blank_at;
+        if(now - w->blank_at > w->gap_max) w->gap_max = now - w->blank_at;
+    }
+    w->writes++;
+}
+
+/**
+  * @brief           TIM7中断：统计中断开销，标记帧边界
+  */
+static void Mx_CheckIsr(void)
+{
+    Mx_Watch *w = &mx_watch;
+    uint64_t t0 = RegSim_Now();
+
+    w->boundary = (w->isr % (MATRIX_BITS * 8U) == 0) ? 1U : 0U;
+    w->isr++;
+    w->writes = 0;
+    TIM7_IRQHandler();
+    t0 = RegSim_Now() - t0 + HOSTCHECK_IRQ_CYCLES;
+    if(t0 > w->isr_max) w->isr_max = t0;
+    if(w->counting) w->isr_sum += t0;
+}
+
+/**
+  * @brief           matrix检查：亮度、单行选通、消隐、刷新率、占空比、中断开销
+  * @param        argc 参数个数
+  * @param        argv 参数
+  * @retval          0=通过，1=失败
+  * @note           8 × 8点阵（hc_matrix），亮度随机，第0个像素固定为满亮度；
+  *                        中断开销 = 寄存器访问周期数（每次1周期）+ HOSTCHECK_IRQ_CYCLES，不含C代码的运算
+  */
+static int Check_Matrix(int argc, char **argv)
+{
+    static uint8_t level[64];
+    Mx_Watch *w = &mx_watch;
+    uint32_t seed = 66;
+    uint32_t i, slots, hz, want;
+    uint64_t limit;
+    uint64_t ratio;
+    int fail = 0;
+
+    (void)argc;
+    (void)argv;
+    for(i = 0; i < 64U; i++) level[i] = (uint8_t)((HostCheck_Rand(&seed) >> 16) & ((1U << MATRIX_BITS) - 1U));
+    level[0] = (1U << MATRIX_BITS) - 1U;
+
+    HostCheck_Reset();
+    memset(w, 0, sizeof(*w));
+    w->row = -1;
+    w->gap_min = UINT64_MAX;
+    w->frame_min = UINT64_MAX;
+    w->level = level;
+    ratio = SystemCoreClock / Device_TimClk1();                       /* 在中断中不再读寄存器，避免改变被测时序 */
+    w->ratio = ratio;
+    SimPeriph_GpioAttach(Mx_CheckGpio, w);
+    SimPeriph_TimAttach(7, 0, 0);
+    RegSim_SetHandler(TIM7_IRQn, Mx_CheckIsr);
+    w->writes = 3;                                                                 /* 初始化中的写入不计间隔 */
+    Matrix_Init(&hc_matrix, hc_mx_a, hc_mx_b);
+    fail |= HostCheck_Expect("Render", Matrix_Render(level), 0);
+    fail |= HostCheck_Expect("Render while pending", Matrix_Render(level), 1);
+
+    /* 第一帧结束时切换到新帧，从之后的帧边界起核对 */
+    slots = MATRIX_BITS * 8U;
+    limit = RegSim_Now() + (uint64_t)hc_matrix.unit * ratio * 8U * ((1U << MATRIX_BITS) - 1U) * (MX_CHECK_FRAMES + 3U);
+    while(w->isr < slots && RegSim_Now() < limit) RegSim_Advance(64);
+    w->arm = 1;
+    while(w->frames < MX_CHECK_FRAMES && RegSim_Now() < limit) RegSim_Advance(64);
+
+    hz = (w->frame_max != 0) ? (uint32_t)(SystemCoreClock / w->frame_max) : 0;
+    want = Matrix_RefreshHz();
+    printf("8 x 8 matrix, %lu-bit BCM, unit %lu counts\n", (unsigned long)MATRIX_BITS, (unsigned long)hc_matrix.unit);
+    fail |= HostCheck_Expect("frames checked", w->frames, MX_CHECK_FRAMES);
+    fail |= HostCheck_Expect("on-time error (cycles)", (uint32_t)w->err_max, 0);
+    fail |= HostCheck_Expect("rows selected at once (max)", w->rows_max, 1);
+    fail |= HostCheck_Expect("row change without blanking", w->ghost, 0);
+    fail |= HostCheck_Expect("blank->column gap varies", (uint32_t)(w->gap_max - w->gap_min), 0);
+    fail |= HostCheck_Expect("frame jitter (cycles)", (uint32_t)(w->frame_max - w->frame_min), 0);
+    fail |= HostCheck_Expect("refresh (Hz)", hz, want);
+    printf("  %-28s %10.3f %%  (ideal %.3f %%, max 1/rows)\n", "duty at full level",
+           100.0 * (double)w->full_on / (double)w->frame_max, 100.0 / 8.0);
+    printf("  %-28s %10llu cycles max, %.2f %% CPU\n", "ISR", (unsigned long long)w->isr_max,
+           100.0 * (double)w->isr_sum / (double)(RegSim_Now() - w->start));
+    printf("  %-28s %10.2f %%  (ISR max / shortest slot of %llu cycles)\n", "worst-case slot load",
+           100.0 * (double)w->isr_max / (double)(hc_matrix.unit * ratio), (unsigned long long)(hc_matrix.unit * ratio));
+    return fail;
+}
+#else
+static int Check_Matrix(int argc, char **argv)
+{
+    (void)argc;
+    (void)argv;
+    printf("no TIM7 on this part, skipped\n");
+    return 0;
+}
+#endif
+
+/* ---------------------------------- charlie ---------------------------------- */
+
+#if DEVICE_HAS_TIM(6)
+
+#define CH_CHECK_PINS                         6U               /* 引脚数 */
+#define CH_CHECK_LEDS                         (CH_CHECK_PINS * (CH_CHECK_PINS - 1U))
+#define CH_CHECK_FRAMES                      4U               /* 核对的帧数 */
+
+/**
+  * @brief   查理复用观察状态
+  */
+typedef struct
+{
+    uint8_t lit[CH_CHECK_LEDS];                   /* 当前点亮的LED */
+    uint8_t stray[CH_CHECK_LEDS];                /* 当前点亮但不属于所写时隙的LED */
+    uint64_t on[CH_CHECK_LEDS];                 /* 本帧各LED点亮的CPU周期数 */
+    uint64_t last;                                       /* 上次累计的虚拟时间 */
+    uint32_t writes;                                    /* 本次中断中的GPIO写次数（0=消隐，1=BSRR，2=MODER） */
+    uint32_t slot;                                       /* 本次中断写入的时隙 */
+    uint8_t boundary;                                  /* 1=本次中断显示0号时隙 */
+    uint64_t blank_at;                                 /* 本次中断写消隐的时刻 */
+    uint64_t gap_min, gap_max;                    /* 消隐到写入时隙MODER的间隔，单位：CPU周期 */
+    uint32_t ghost;                                     /* 点亮了不属于当前时隙的LED的次数 */
+    uint64_t ghost_cycles;                           /* 这些LED点亮的总时间 */
+    uint32_t isr;                                         /* 中断次数 */
+    uint64_t isr_max;                                  /* 单次中断最多的CPU周期数（含进入/返回） */
+    uint64_t isr_sum;                                  /* 统计期间中断CPU周期数总和 */
+    uint64_t start;                                      /* 开始统计的虚拟时间 */
+    uint8_t arm;                                         /* 1=从下一帧开始统计 */
+    uint8_t counting;                                  /* 1=正在统计帧 */
+    uint32_t frames;                                    /* 已核对的帧数 */
+    uint64_t frame_at;                                /* 本帧开始的虚拟时间 */
+    uint64_t frame_max;                              /* 最长帧，单位：CPU周期 */
+    uint64_t err_max;                                  /* 点亮时间与期望之差的最大值 */
+    uint64_t ratio;                                     /* 每个定时器计数的CPU周期数 */
+    uint32_t unit;                                       /* 最低位子帧的时隙时长，单位：定时器计数 */
+    const uint8_t *level;                             /* 显示的亮度 */
+} Ch_Watch;
+
+static Ch_Watch ch_watch;
+
+/**
+  * @brief           LED编号
+  */
+static uint32_t Ch_CheckLed(uint32_t a, uint32_t c)
+{
+    return a * (CH_CHECK_PINS - 1U) + (c < a ? c : c - 1U);
+}
+
+/**
+  * @brief           核对刚结束的一帧
+  * @param        w 观察状态
+  * @param        now 0号时隙的消隐时刻
+  * @retval          None
+  */
+static void Ch_CheckFrame(Ch_Watch *w, uint64_t now)
+{
+    uint64_t want, err;
+    uint32_t i, k, ones;
+
+    if(w->counting) {
+        for(i = 0; i < CH_CHECK_LEDS; i++) {
+            for(k = 0, ones = 0; k < CHARLIE_BITS; k++) ones += (w->level[i] >> k) & 1U;
+            want = (uint64_t)w->level[i] * w->unit * w->ratio - (uint64_t)ones * w->gap_min;
+            err = (w->on[i] > want) ? w->on[i] - want : want - w->on[i];
+            if(err > w->err_max) w->err_max = err;
+        }
+        if(now - w->frame_at > w->frame_max) w->frame_max = now - w->frame_at;
+        w->frames++;
+    }
+    memset(w->on, 0, sizeof(w->on));
+    w->frame_at = now;
+    if(w->arm && !w->counting) {
+        w->counting = 1;
+        w->start = now;
+    }
+}
+
+/**
+  * @brief           GPIO写入后按引脚三态更新点亮的LED
+  * @note           阳极引脚输出高、阴极引脚输出低时LED点亮；
+  *                        点亮的LED须属于本次中断写入的时隙（阳极相同且该位为1），否则计为鬼影
+  */
+static void Ch_CheckGpio(uint32_t port, const SimPeriph_GpioPort *gpio, void *ctx)
+{
+    Ch_Watch *w = (Ch_Watch *)ctx;
+    uint64_t now = RegSim_Now();
+    uint32_t a, c, led, k, anode;
+    uint8_t lit, stray = 0;
+
+    if(port != 4U) return;                                                        /* PE */
+    k = w->slot / CH_CHECK_PINS;
+    anode = w->slot % CH_CHECK_PINS;
+    for(a = 0; a < CH_CHECK_PINS; a++) {
+        for(c = 0; c < CH_CHECK_PINS; c++) {
+            if(a == c) continue;
+            led = Ch_CheckLed(a, c);
+            if(w->counting && w->lit[led]) {
+                w->on[led] += now - w->last;
+                if(w->stray[led]) w->ghost_cycles += now - w->last;
+            }
+            lit = (uint8_t)(SimPeriph_GpioDrive(gpio, hc_charlie_pin[a]) == SIMPERIPH_PIN_HIGH &&
+                            SimPeriph_GpioDrive(gpio, hc_charlie_pin[c]) == SIMPERIPH_PIN_LOW);
+            w->lit[led] = lit;
+            w->stray[led] = (uint8_t)(lit && !(a == anode && ((w->level[led] >> k) & 1U)));
+            stray |= w->stray[led];
+        }
+    }
+    w->last = now;
+    if(stray && w->counting) w->ghost++;
+
+    if(w->writes == 0) {
+        w->blank_at = now;
+        if(w->boundary) Ch_CheckFrame(w, now);
+    } else if(w->writes == 2U) {
+        if(now - w->blank_at < w->gap_min) w->gap_min = now - w->blank_at;
+        if(now - w->blank_at > w->gap_max) w->gap_max = now - w->blank_at;
+    }
+    w->writes++;
+}
+
+/**
+  * @brief           TIM6中断：统计中断开销，标记帧边界
+  */
+static void Ch_CheckIsr(void)
+{
+    Ch_Watch *w = &ch_watch;
+    uint64_t t0 = RegSim_Now();
+
+    w->slot = w->isr % (CHARLIE_BITS * CH_CHECK_PINS);
+    w->boundary = (w->slot == 0) ? 1U : 0U;
+    w->isr++;
+    w->writes = 0;
+    DEVICE_TIM6_IRQHandler();
+    t0 = RegSim_Now() - t0 + HOSTCHECK_IRQ_CYCLES;
+    if(t0 > w->isr_max) w->isr_max = t0;
+    if(w->counting) w->isr_sum += t0;
+}
+
+/**
+  * @brief           charlie检查：亮度、鬼影、刷新率、时隙开销
+  * @param        argc 参数个数
+  * @param        argv 参数
+  * @retval          0=通过，1=失败
+  * @note           6引脚（30个LED），亮度随机，每4个LED中有1个为0；
+  *                        鬼影按每次GPIO写入后的引脚三态判断，消隐（全输入）期间所有LED熄灭；
+  *                        中断开销 = 寄存器访问周期数（每次1周期）+ HOSTCHECK_IRQ_CYCLES，不含C代码的运算
+  */
+static int Check_Charlie(int argc, char **argv)
+{
+    static uint8_t level[CH_CHECK_LEDS];
+    Ch_Watch *w = &ch_watch;
+    uint32_t seed = 67;
+    uint32_t i, hz;
+    uint64_t limit;
+    int fail = 0;
+
+    (void)argc;
+    (void)argv;
+    for(i = 0; i < CH_CHECK_LEDS; i++) {
+        level[i] = (uint8_t)((HostCheck_Rand(&seed) >> 16) & ((1U << CHARLIE_BITS) - 1U));
+        if((i & 3U) == 3U) level[i] = 0;
+    }
+
+    HostCheck_Reset();
+    memset(w, 0, sizeof(*w));
+    w->gap_min = UINT64_MAX;
+    w->level = level;
+    w->unit = CHARLIE_MIN_UNIT;
+    w->ratio = SystemCoreClock / Device_TimClk1();                  /* 在中断中不再读寄存器，避免改变被测时序 */
+    w->writes = 3;                                                                 /* 初始化中的写入不计间隔 */
+    SimPeriph_GpioAttach(Ch_CheckGpio, w);
+    SimPeriph_TimAttach(6, 0, 0);
+    RegSim_SetHandler(DEVICE_TIM6_IRQn, Ch_CheckIsr);
+    Charlie_Init(GPIOE, hc_charlie_pin, CH_CHECK_PINS, w->unit, hc_ch_a, hc_ch_b);
+    fail |= HostCheck_Expect("Render", Charlie_Render(level), 0);
+
+    /* 第一帧结束时切换到新帧，从之后的帧边界起核对 */
+    limit = RegSim_Now() + (uint64_t)w->unit * w->ratio * CH_CHECK_PINS * ((1U << CHARLIE_BITS) - 1U)
+                         * (CH_CHECK_FRAMES + 3U);
+    while(w->isr < CHARLIE_BITS * CH_CHECK_PINS && RegSim_Now() < limit) RegSim_Advance(64);
+    w->arm = 1;
+    while(w->frames < CH_CHECK_FRAMES && RegSim_Now() < limit) RegSim_Advance(64);
+
+    hz = (w->frame_max != 0) ? (uint32_t)(SystemCoreClock / w->frame_max) : 0;
+    printf("charlieplex, %lu pins, %lu LEDs, %lu-bit BCM, unit %lu counts\n", (unsigned long)CH_CHECK_PINS,
+           (unsigned long)CH_CHECK_LEDS, (unsigned long)CHARLIE_BITS, (unsigned long)w->unit);
+    fail |= HostCheck_Expect("frames checked", w->frames, CH_CHECK_FRAMES);
+    fail |= HostCheck_Expect("on-time error (cycles)", (uint32_t)w->err_max, 0);
+    fail |= HostCheck_Expect("ghost events", w->ghost, 0);
+    fail |= HostCheck_Expect("ghost on-time (cycles)", (uint32_t)w->ghost_cycles, 0);
+    fail |= HostCheck_Expect("blank->slot gap varies", (uint32_t)(w->gap_max - w->gap_min), 0);
+    fail |= HostCheck_Expect("refresh (Hz)", hz, Charlie_RefreshHz());
+    printf("  %-28s %10llu cycles (all LEDs dark per slot change)\n", "blank gap", (unsigned long long)w->gap_min);
+    printf("  %-28s %10llu cycles max, %.2f %% CPU\n", "slot ISR", (unsigned long long)w->isr_max,
+           100.0 * (double)w->isr_sum / (double)(RegSim_Now() - w->start));
+    printf("  %-28s %10.2f %%  (ISR max / shortest slot of %llu cycles)\n", "worst-case slot load",
+           100.0 * (double)w->isr_max / (double)(w->unit * w->ratio), (unsigned long long)(w->unit * w->ratio));
+    return fail;
+}
+#else
+static int Check_Charlie(int argc, char **argv)
+{
+    (void)argc;
+    (void)argv;
+    printf("no TIM6 on this part, skipped\n");
+    return 0;
+}
+#endif
+
+/* ---------------------------------- uart ---------------------------------- */
+
+#define UA_CHECK_STREAM                     16384U           /* 吞吐量测量：连续发送的字节数 */
+#define UA_CHECK_CMDS                        200U              /* 延迟测量：逐条发送的命令数 */
+
+/**
+  * @brief   主循环和线路上的观测
+  */
+typedef struct
+{
+    Cmd_Parser cmd;                                    /* 与main.c相同的解析器 */
+    uint64_t poll;                                        /* 主循环调用间隔（一个PWM周期），单位：CPU周期 */
+    uint64_t next;                                       /* 下一次调用的虚拟时间 */
+    uint64_t service_max;                           /* 一次调用的最长耗时（寄存器访问），单位：CPU周期 */
+    const uint8_t *sent;                              /* 已注入的数据，用于核对交付内容 */
+    uint32_t sent_len;                                /* 已注入的字节数 */
+    uint32_t delivered;                              /* 已交付给解析器的字节数 */
+    uint64_t delivered_at;                          /* 最近一次交付的虚拟时间 */
+    uint32_t wrong;                                    /* 与注入内容不符的字节数 */
+    uint32_t executed;                               /* 已执行（应答）的命令数 */
+    uint32_t reply_pos;                               /* 当前应答已发出的字节数 */
+    uint32_t replies;                                  /* 已发完的应答数 */
+    uint64_t reply_start;                            /* 最近一条应答第一个字节的起始位时刻 */
+} Ua_Loop;
+
+static Ua_Loop ua_loop;
+static uint8_t ua_stream[UA_CHECK_STREAM];
+static const uint8_t ua_ok[] = "OK\n";
+
+/**
+  * @brief           核对交付内容后交给解析器
+  */
+static void Ua_CheckSink(void *ctx, const uint8_t *data, uint32_t len, uint8_t idle)
+{
+    Ua_Loop *l = (Ua_Loop *)ctx;
+    uint32_t i;
+
+    for(i = 0; i < len; i++, l->delivered++) {
+        if(l->delivered >= l->sent_len || data[i] != l->sent[l->delivered]) l->wrong++;
+    }
+    if(len != 0) l->delivered_at = RegSim_Now();
+    Cmd_Feed(&l->cmd, data, len, idle);
+}
+
+/**
+  * @brief           TX线上发完一个字节
+  */
+static void Ua_CheckTx(uint16_t data, uint64_t start, void *ctx)
+{
+    Ua_Loop *l = (Ua_Loop *)ctx;
+
+    if(l->reply_pos++ == 0) l->reply_start = start;
+    if(data == '\n') {
+        l->reply_pos = 0;
+        l->replies++;
+    }
+}
+
+/**
+  * @brief           主循环的串口部分（同main.c的Cmd_Service()，应答固定为OK）
+  */
+static void Ua_CheckService(Ua_Loop *l)
+{
+    uint64_t t0 = RegSim_Now();
+    Cmd_Msg msg;
+
+    Uart_Poll(Ua_CheckSink, l);
+    if(!Uart_TxBusy() && Cmd_Take(&l->cmd, &msg)) {
+        Uart_Send(ua_ok, 3);
+        l->executed++;
+    }
+    if(RegSim_Now() - t0 > l->service_max) l->service_max = RegSim_Now() - t0;
+}
+
+/**
+  * @brief           按主循环节拍运行到指定时刻
+  */
+static void Ua_CheckRun(Ua_Loop *l, uint64_t until)
+{
+    while(l->next <= until) {
+        if(l->next > RegSim_Now()) RegSim_Advance(l->next - RegSim_Now());
+        Ua_CheckService(l);
+        l->next += l->poll;
+    }
+    if(until > RegSim_Now()) RegSim_Advance(until - RegSim_Now());
+}
+
+/**
+  * @brief           复位仿真层，挂接模型并初始化驱动
+  * @param        baud 波特率
+  * @retval          None
+  */
+static void Ua_CheckStart(uint32_t baud)
+{
+    HostCheck_Reset();
+    memset(&ua_loop, 0, sizeof(ua_loop));
+    SimPeriph_GpioAttach(0, 0);
+    SimPeriph_DmaAttach();
+    SimPeriph_UsartAttach(Ua_CheckTx, &ua_loop);
+    RegSim_SetHandler(USART1_IRQn, USART1_IRQHandler);
+    Cmd_Init(&ua_loop.cmd);
+    Uart_Init(baud);
+    ua_loop.poll = (uint64_t)(SystemCoreClock / 1000000U) * BREATH_PWM_CYCLE;
+    ua_loop.next = RegSim_Now() + ua_loop.poll;
+}
+
+/**
+  * @brief           逐条发送命令，测量最后一个字节到应答第一个字节的延迟
+  * @param        baud 波特率
+  * @param        lat_max 输出最大延迟，单位：CPU周期
+  * @param        lat_sum 输出延迟总和，单位：CPU周期
+  * @retval          收到的应答数
+  * @note           命令在主循环节拍内的随机时刻开始发送；偶数条以'\n'结束，奇数条不带结束符，靠空闲线结束
+  */
+static uint32_t Ua_CheckLatency(uint32_t baud, uint64_t *lat_max, uint64_t *lat_sum)
+{
+    static uint8_t line[16];
+    Ua_Loop *l = &ua_loop;
+    uint32_t seed = 68;
+    uint32_t i, n, got;
+    uint64_t lat, limit;
+
+    Ua_CheckStart(baud);
+    *lat_max = 0;
+    *lat_sum = 0;
+    for(i = 0; i < UA_CHECK_CMDS; i++) {
+        Ua_CheckRun(l, l->next + (HostCheck_Rand(&seed) >> 8) % l->poll);
+        n = (uint32_t)sprintf((char *)line, "L%lu%s", (unsigned long)((HostCheck_Rand(&seed) >> 16) & 0xFFU),
+                              (i & 1U) ? "" : "\n");
+        l->sent = line;
+        l->sent_len = n;
+        l->delivered = 0;
+        got = l->replies;
+        SimPeriph_UsartFeed(line, n);
+        limit = RegSim_Now() + 4U * l->poll + 64U * (uint64_t)n * Device_Pclk2() / baud;
+        while(l->replies == got && RegSim_Now() < limit) Ua_CheckRun(l, RegSim_Now() + l->poll);
+        if(l->replies == got) break;
+        lat = l->reply_start - SimPeriph_Usart1()->rx_end;
+        if(lat > *lat_max) *lat_max = lat;
+        *lat_sum += lat;
+    }
+    return i;
+}
+
+/**
+  * @brief           uart检查：最高波特率下的接收吞吐量、交付完整性和命令应答延迟
+  * @param        argc 参数个数
+  * @param        argv 参数
+  * @retval          0=通过，1=失败
+  * @note           最高波特率 = PCLK2 ÷ 16（16倍过采样，BRR = 16）；主循环每个PWM周期调用一次Uart_Poll()，
+  *                        每次最多执行一条命令，超出命令队列的命令计入dropped
+  */
+static int Check_Uart(int argc, char **argv)
+{
+    static const char *const cmds[] = { "L%lu;", "E%lu;", "S;" };
+    Ua_Loop *l = &ua_loop;
+    SimPeriph_Usart *u;
+    Uart_Stats st;
+    Cmd_Msg msg;
+    uint32_t seed = 1068;
+    uint32_t baud_max;
+    uint32_t n = 0, total = 0, queued = 0;
+    uint64_t frame, bound, lat_max, lat_sum, start;
+    uint32_t baud[2];
+    uint32_t i, k;
+    int fail = 0;
+    char buf[16];
+
+    (void)argc;
+    (void)argv;
+
+    /* 吞吐量：最高波特率下连续发送，线路上没有空闲 */
+    HostCheck_Reset();
+    baud_max = Device_Pclk2() / 16U;
+    while(n + 8U < UA_CHECK_STREAM) {
+        k = (HostCheck_Rand(&seed) >> 16) % 3U;
+        i = (uint32_t)sprintf(buf, cmds[k], (unsigned long)((HostCheck_Rand(&seed) >> 16) & 0xFFU));
+        memcpy(&ua_stream[n], buf, i);
+        n += i;
+        total++;
+    }
+    Ua_CheckStart(baud_max);
+    u = SimPeriph_Usart1();
+    frame = 10U * (uint64_t)u->brr * u->ratio;
+    l->sent = ua_stream;
+    l->sent_len = n;
+    start = RegSim_Now();
+    SimPeriph_UsartFeed(ua_stream, n);
+    Ua_CheckRun(l, RegSim_Now() + frame * n + 4U * l->poll);
+    while(Cmd_Take(&l->cmd, &msg)) queued++;
+    Uart_GetStats(&st);
+
+    printf("USART1 %lu baud (PCLK2 %lu Hz, BRR %lu), main loop every %lu cycles\n", (unsigned long)baud_max,
+           (unsigned long)Device_Pclk2(), (unsigned long)u->brr, (unsigned long)l->poll);
+    fail |= HostCheck_Expect("bytes delivered", l->delivered, n);
+    fail |= HostCheck_Expect("bytes out of order/lost", l->wrong, 0);
+    fail |= HostCheck_Expect("USART overruns", u->overruns, 0);
+    fail |= HostCheck_Expect("idle frames", st.frames, 1);
+    fail |= HostCheck_Expect("commands accounted", l->executed + l->cmd.dropped + queued, total);
+    fail |= HostCheck_ExpectMax("bytes per poll", st.rx_peak, UART_RX_SIZE - 1U);
+    printf("  %-28s %10.0f bytes/s (line rate %lu, to last stop bit %.0f)\n", "delivered to parser",
+           (double)l->delivered * SystemCoreClock / (double)(l->delivered_at - start),
+           (unsigned long)(baud_max / 10U), (double)n * SystemCoreClock / (double)(u->rx_end - start));
+    printf("  %-28s %10lu of %lu (%lu dropped, one per loop)\n", "commands executed",
+           (unsigned long)l->executed, (unsigned long)total, (unsigned long)l->cmd.dropped);
+    printf("  %-28s %10.2f ms (ring %lu bytes at line rate)\n", "longest safe poll interval",
+           UART_RX_SIZE * 10000.0 / baud_max, (unsigned long)UART_RX_SIZE);
+    printf("  %-28s %10llu cycles (register accesses)\n", "Uart_Poll + Uart_Send", (unsigned long long)l->service_max);
+
+    /* 延迟：默认波特率和最高波特率 */
+    baud[0] = UART_BAUD;
+    baud[1] = baud_max;
+    printf("command -> reply latency (last RX stop bit to first TX start bit)\n");
+    printf("  %10s %8s %12s %12s %12s\n", "baud", "cmds", "mean (us)", "max (us)", "bound (us)");
+    for(k = 0; k < 2U; k++) {
+        i = Ua_CheckLatency(baud[k], &lat_max, &lat_sum);
+        u = SimPeriph_Usart1();
+        /* 空闲线检测一帧 + 等到下一次主循环 + 本次调用的耗时 */
+        bound = 10U * (uint64_t)u->brr * u->ratio + l->poll + l->service_max;
+        printf("  %10lu %8lu %12.1f %12.1f %12.1f%s\n", (unsigned long)baud[k], (unsigned long)i,
+               i ? (double)lat_sum / i * 1e6 / SystemCoreClock : 0.0, (double)lat_max * 1e6 / SystemCoreClock,
+               (double)bound * 1e6 / SystemCoreClock, (i == UA_CHECK_CMDS && lat_max <= bound) ? "" : "  FAIL");
+        fail |= (i != UA_CHECK_CMDS || lat_max > bound);
+        fail |= (l->wrong != 0 || u->overruns != 0);
+    }
+    return fail;
+}
+
+/* ---------------------------------- device ---------------------------------- */
+
+/**
+  * @brief           在指定主频下运行Device_Init()并核对结果
+  * @param        hz SystemCoreClock
+  * @param        want 期望的Device_Init()返回值
+  * @retval          0=通过，1=失败
+  * @note           APB初始为不分频；期望的等待周期和分频由能力表独立算出
+  */
+static int Device_CheckAt(uint32_t hz, uint32_t want)
+{
+    const Device_Caps *caps = Device_Get();
+    uint32_t ret, ws, pclk1, pclk2;
+    int fail = 0;
+
+    HostCheck_Reset();
+    REG_WRITE(RCC->CFGR, 0);
+    SystemCoreClock = hz;
+    ret = Device_Init();
+    pclk1 = Device_Pclk1();
+    pclk2 = Device_Pclk2();
+    for(ws = 0; ws + 1U < caps->ws_count && hz > caps->ws_mhz[ws] * 1000000U; ws++);
+
+    printf("  %4lu MHz: WS %lu, PCLK1 %3lu MHz, PCLK2 %3lu MHz, TIMCLK1 %3lu MHz, ret %lu",
+           (unsigned long)(hz / 1000000U), (unsigned long)(REG_READ(FLASH->ACR) & FLASH_ACR_LATENCY),
+           (unsigned long)(pclk1 / 1000000U), (unsigned long)(pclk2 / 1000000U),
+           (unsigned long)(Device_TimClk1() / 1000000U), (unsigned long)ret);
+    fail |= (ret != want || Device_CheckClocks() != want);
+    fail |= ((REG_READ(FLASH->ACR) & FLASH_ACR_LATENCY) != ws);
+    if(!(want & DEVICE_CLK_SYSCLK)) {
+        /* 不超限且再少一级分频就会超限 */
+        fail |= (pclk1 > caps->apb1_max || (pclk1 != hz && pclk1 * 2U <= caps->apb1_max));
+        fail |= (pclk2 > caps->apb2_max || (pclk2 != hz && pclk2 * 2U <= caps->apb2_max));
+    }
+    printf("%s\n", fail ? "  FAIL" : "");
+    return fail;
+}
+
+/**
+  * @brief           device检查：能力表与编译期宏一致，按能力表设置Flash和APB
+  * @param        argc 参数个数
+  * @param        argv 参数
+  * @retval          0=通过，1=失败
+  * @note           各型号分别以-D<型号宏>编译运行（见HostMatrix.sh）
+  */
+static int Check_Device(int argc, char **argv)
+{
+    static const uint32_t mhz[] = { 16, 25, 48, 64, 84, 100, 120, 150, 168, 180 };
+    const Device_Caps *caps = Device_Get();
+    uint32_t i;
+    int fail = 0;
+
+    (void)argc;
+    (void)argv;
+    printf("%s, SYSCLK max %lu Hz, APB1 max %lu Hz, APB2 max %lu Hz\n", caps->name,
+           (unsigned long)caps->sysclk_max, (unsigned long)caps->apb1_max, (unsigned long)caps->apb2_max);
+    fail |= HostCheck_Expect("id = DEVICE_ID", caps->id, DEVICE_ID);
+    fail |= HostCheck_Expect("timers = DEVICE_TIMERS", caps->timers, DEVICE_TIMERS);
+    fail |= HostCheck_Expect("gpio_ports = DEVICE_GPIO_PORTS", caps->gpio_ports, DEVICE_GPIO_PORTS);
+    fail |= HostCheck_Expect("ccm_size = DEVICE_CCM_SIZE", caps->ccm_size, DEVICE_CCM_SIZE);
+    fail |= HostCheck_Expect("last WS step = SYSCLK max", caps->ws_mhz[caps->ws_count - 1U] * 1000000U,
+                             caps->sysclk_max);
+    fail |= HostCheck_Expect("APB2 max <= SYSCLK max", caps->apb2_max <= caps->sysclk_max, 1);
+    fail |= HostCheck_Expect("APB1 max <= APB2 max", caps->apb1_max <= caps->apb2_max, 1);
+    for(i = 0; i < sizeof(mhz) / sizeof(mhz[0]) && mhz[i] * 1000000U < caps->sysclk_max; i++) {
+        fail |= Device_CheckAt(mhz[i] * 1000000U, DEVICE_CLK_OK);
+    }
+    fail |= Device_CheckAt(caps->sysclk_max, DEVICE_CLK_OK);
+    fail |= Device_CheckAt(caps->sysclk_max + 1000000U, DEVICE_CLK_SYSCLK);
+    return fail;
+}
+
+/* ---------------------------------- trace ---------------------------------- */
+
+#define TRACE_CHECK_GOLDEN                 "HostData/breath.trace"  /* 黄金跟踪，路径相对Project目录 */
+#define TRACE_CHECK_PERIOD                  200U            /* 呼吸周期，单位：毫秒（缩短以减小黄金文件） */
+#define TRACE_CHECK_MS                        400U            /* 记录时长，单位：毫秒（两个呼吸周期） */
+#define TRACE_CHECK_SIZE                      16384U         /* 跟踪缓冲区大小，单位：字节 */
+
+static uint8_t trace_check_actual[TRACE_CHECK_SIZE];
+static uint8_t trace_check_golden[TRACE_CHECK_SIZE];
+
+/* 边沿±32周期，平均占空比±100ppm，平均周期±8周期 */
+static const Trace_Tolerance trace_check_tol = { 32U, 100U, 8U };
+
+/**
+  * @brief           在RegSim上运行LED主循环并记录边沿
+  * @param        period_ms 呼吸周期，单位：毫秒
+  * @param        len 输出：跟踪长度，单位：字节（数据在trace_check_actual中）
+  * @retval          0=成功，1=内存不足或缓冲区已满
+  * @note           单块板、无频率误差；时间基准为该板的虚拟CYCCNT
+  */
+static int Trace_CheckRecord(uint32_t period_ms, uint32_t *len)
+{
+    Fleet fleet;
+    Fleet_Board *board = (Fleet_Board *)calloc(1, sizeof(Fleet_Board));
+    RegSim_Context *prev;
+    uint32_t dropped;
+
+    SystemCoreClock = SIMPERIPH_CORE_CLOCK;
+    if(board == NULL || Fleet_Init(&fleet, board, 1, FLEET_CHECK_SEED, 0, period_ms, BREATH_PWM_CYCLE) != 0) {
+        free(board);
+        return 1;
+    }
+    prev = RegSim_Select(board->sim);
+    Trace_Init(trace_check_actual, sizeof(trace_check_actual), NULL);
+    RegSim_Select(prev);
+
+    Fleet_Step(&fleet, TRACE_CHECK_MS * 1000U);
+
+    (void)Trace_Data(len);
+    dropped = Trace_Dropped();
+    Trace_Init(NULL, 0, NULL);
+    Fleet_Free(&fleet);
+    free(board);
+    return dropped != 0;
+}
+
+/**
+  * @brief           读入跟踪文件
+  * @param        path 文件名
+  * @param        buf 缓冲区（TRACE_CHECK_SIZE字节）
+  * @param        len 输出：长度，单位：字节
+  * @retval          0=成功，1=打不开或超过缓冲区
+  */
+static int Trace_CheckLoad(const char *path, uint8_t *buf, uint32_t *len)
+{
+    FILE *f = fopen(path, "rb");
+    int c;
+
+    if(f == NULL) {
+        printf("  cannot open %s: %s\n", path, strerror(errno));
+        return 1;
+    }
+    *len = (uint32_t)fread(buf, 1, TRACE_CHECK_SIZE, f);
+    c = fgetc(f);
+    fclose(f);
+    if(c != EOF) {
+        printf("  %s is larger than %lu bytes\n", path, (unsigned long)TRACE_CHECK_SIZE);
+        return 1;
+    }
+    return 0;
+}
+
+/**
+  * @brief           写出跟踪文件
+  * @param        path 文件名
+  * @param        data 跟踪数据
+  * @param        len 长度，单位：字节
+  * @retval          0=成功，1=失败
+  */
+static int Trace_CheckSave(const char *path, const uint8_t *data, uint32_t len)
+{
+    FILE *f = fopen(path, "wb");
+
+    if(f == NULL || fwrite(data, 1, len, f) != len) {
+        printf("  cannot write %s: %s\n", path, strerror(errno));
+        if(f != NULL) fclose(f);
+        return 1;
+    }
+    return fclose(f) != 0;
+}
+
+/**
+  * @brief           统计各通道的边沿数
+  * @param        data 跟踪数据
+  * @param        len 长度，单位：字节
+  * @param        edges 输出：各通道边沿数（TRACE_CHANNELS项）
+  * @retval          总边沿数
+  */
+static uint32_t Trace_CheckCount(const uint8_t *data, uint32_t len, uint32_t *edges)
+{
+    Trace_Reader r;
+    Trace_EdgeRec e;
+    uint32_t n = 0;
+    uint32_t i;
+
+    for(i = 0; i < TRACE_CHANNELS; i++) edges[i] = 0;
+    Trace_ReaderInit(&r, data, len);
+    while(Trace_ReadEdge(&r, &e)) {
+        edges[e.channel]++;
+        n++;
+    }
+    return n;
+}
+
+/**
+  * @brief           比对两段跟踪并输出分歧
+  * @param        golden/golden_len 黄金跟踪
+  * @param        actual/actual_len 实际跟踪
+  * @retval          0=在容差内，1=超差
+  */
+static int Trace_CheckDiff(const uint8_t *golden, uint32_t golden_len, const uint8_t *actual, uint32_t actual_len)
+{
+    Trace_Diff d;
+    uint8_t r = Trace_Compare(golden, golden_len, actual, actual_len, &trace_check_tol, &d);
+    uint32_t i;
+
+    printf("  %-28s %10lu\n", "matching edges", (unsigned long)d.edges);
+    if(d.first_diverge >= 0) {
+        printf("  first divergence at edge %ld: golden ch%u=%u @%llu, actual ch%u=%u @%llu\n", (long)d.first_diverge,
+               (unsigned)d.golden_edge.channel, (unsigned)d.golden_edge.level,
+               (unsigned long long)d.golden_edge.time, (unsigned)d.actual_edge.channel,
+               (unsigned)d.actual_edge.level, (unsigned long long)d.actual_edge.time);
+    }
+    for(i = 0; i < TRACE_CHANNELS; i++) {
+        if(d.duty_err_ppm[i] == 0 && d.period_err_cycles[i] == 0) continue;
+        printf("  ch%lu mean duty off by %lu ppm, mean period off by %lu cycles\n", (unsigned long)i,
+               (unsigned long)d.duty_err_ppm[i], (unsigned long)d.period_err_cycles[i]);
+    }
+    return r;
+}
+
+/**
+  * @brief           trace检查：LED主循环的边沿与黄金跟踪比对
+  * @param        argc 参数个数
+  * @param        argv 参数：无参数时运行检查；
+  *                        record <文件>：记录并写出跟踪（更新黄金文件）；
+  *                        diff <黄金文件> <实际文件>：比对两个跟踪文件；
+  *                        dump <文件>：逐条打印边沿（时间/周期、通道、电平）
+  * @retval          0=通过，1=失败，2=参数错误
+  * @note           1. 须以-DTRACE_ENABLE编译，LED驱动的TRACE_EDGE钩子以板上的虚拟CYCCNT记录边沿
+  *                        2. 记录与黄金跟踪在容差内一致，没有丢弃的边沿
+  *                        3. 呼吸周期改变1毫秒的运行必须被判为超差（比对确实生效）
+  */
+static int Check_Trace(int argc, char **argv)
+{
+    Trace_Reader r;
+    Trace_EdgeRec e;
+    uint32_t edges[TRACE_CHANNELS];
+    uint32_t golden_len;
+    uint32_t len;
+    uint32_t n;
+    int fail = 0;
+
+#ifndef TRACE_ENABLE
+    printf("  built without -DTRACE_ENABLE, LED edges are not recorded\n");
+    return 1;
+#endif
+    if(argc == 3 && strcmp(argv[1], "record") == 0) {
+        if(Trace_CheckRecord(TRACE_CHECK_PERIOD, &len) != 0) return 1;
+        printf("  %lu edges, %lu bytes -> %s\n", (unsigned long)Trace_CheckCount(trace_check_actual, len, edges),
+               (unsigned long)len, argv[2]);
+        return Trace_CheckSave(argv[2], trace_check_actual, len);
+    }
+    if(argc == 4 && strcmp(argv[1], "diff") == 0) {
+        if(Trace_CheckLoad(argv[2], trace_check_golden, &golden_len) != 0) return 1;
+        if(Trace_CheckLoad(argv[3], trace_check_actual, &len) != 0) return 1;
+        return Trace_CheckDiff(trace_check_golden, golden_len, trace_check_actual, len);
+    }
+    if(argc == 3 && strcmp(argv[1], "dump") == 0) {
+        if(Trace_CheckLoad(argv[2], trace_check_actual, &len) != 0) return 1;
+        Trace_ReaderInit(&r, trace_check_actual, len);
+        n = 0;
+        while(Trace_ReadEdge(&r, &e)) {
+            printf("%llu %u %u\n", (unsigned long long)e.time, (unsigned)e.channel, (unsigned)e.level);
+            n++;
+        }
+        /* 读取器停下时仍有数据说明最后一条记录不完整 */
+        return r.pos != r.end;
+    }
+    if(argc > 1) return 2;
+
+    if(Trace_CheckLoad(TRACE_CHECK_GOLDEN, trace_check_golden, &golden_len) != 0) return 1;
+    fail |= HostCheck_Expect("recording overflowed", (uint32_t)Trace_CheckRecord(TRACE_CHECK_PERIOD, &len), 0);
+    n = Trace_CheckCount(trace_check_actual, len, edges);
+    printf("%lu ms of %lu ms breathing: %lu edges (LED1 %lu, LED2 %lu), %lu bytes\n",
+           (unsigned long)TRACE_CHECK_MS, (unsigned long)TRACE_CHECK_PERIOD, (unsigned long)n,
+           (unsigned long)edges[TRACE_CH_LED1], (unsigned long)edges[TRACE_CH_LED2], (unsigned long)len);
+    fail |= HostCheck_Expect("diverging from golden", (uint32_t)Trace_CheckDiff(trace_check_golden,
+                             golden_len, trace_check_actual, len), 0);
+
+    /* 周期差1毫秒：亮度斜率不同，最初几十个边沿内即超过边沿容差 */
+    (void)Trace_CheckRecord(TRACE_CHECK_PERIOD + 1U, &len);
+    printf("%lu ms breathing against the same golden trace:\n", (unsigned long)TRACE_CHECK_PERIOD + 1U);
+    fail |= HostCheck_Expect("detected as diverging", (uint32_t)Trace_CheckDiff(trace_check_golden, golden_len,
+                             trace_check_actual, len), 1);
+    return fail;
+}
+
+/* ---------------------------------- flicker ---------------------------------- */
+
+#define FLICKER_CHECK_PERIOD              1000U            /* PWM周期，单位：微秒（1kHz载波） */
+#define FLICKER_CHECK_PERIODS            1000U            /* 每段波形的周期数（1秒） */
+#define FLICKER_CHECK_WINDOW             100000U         /* 统计窗口，单位：微秒 */
+
+/* 逻辑分析仪导出：表头、触发前的一行、重复行、零宽毛刺 */
+static const char *const flicker_check_csv[] =
+{
+    "Time [s], Channel 0",
+    "-0.001,0",
+    "0,1",
+    "0,1",
+    "0.00025,0",
+    "0.001,1",
+    "0.001,0",
+    "0.001,1",
+    "0.00125,0",
+    "2e-3,1",
+};
+
+/**
+  * @brief           输入一段PWM波形
+  * @param        st 分析状态
+  * @param        t 起始时间，返回时为下一个周期的起点，单位：微秒
+  * @param        count 周期数
+  * @param        even 偶数序号周期的长度
+  * @param        odd 奇数序号周期的长度
+  * @param        duty_ppm 占空比，单位：百万分之一
+  * @param        glitch 1=每个上升沿后在同一时刻再熄灭、点亮一次（零长度周期）
+  * @retval          None
+  */
+static void Flicker_CheckFeed(Flicker_State *st, uint64_t *t, uint32_t count, uint32_t even, uint32_t odd,
+                              uint32_t duty_ppm, uint8_t glitch)
+{
+    uint32_t period;
+    uint32_t i;
+
+    for(i = 0; i < count; i++) {
+        period = (i & 1U) ? odd : even;
+        Flicker_Edge(st, *t, 1);
+        if(glitch) {
+            Flicker_Edge(st, *t, 0);
+            Flicker_Edge(st, *t, 1);
+        }
+        Flicker_Edge(st, *t + (uint64_t)period * duty_ppm / 1000000U, 0);
+        *t += period;
+    }
+}
+
+/**
+  * @brief           运行一段波形并输出指标
+  * @param        name 波形名称
+  * @param        st 分析状态（已输入边沿）
+  * @param        t 结束时间，在此补一个上升沿结束最后一个周期
+  * @param        m 输出指标
+  * @retval          None
+  */
+static void Flicker_CheckClose(const char *name, Flicker_State *st, uint64_t t, Flicker_Metrics *m)
+{
+    Flicker_Edge(st, t, 1);
+    Flicker_Result(st, m);
+    printf("%s: %lu periods, %.1f Hz, jitter %.1f rms / %llu pp, duty err %lu/%lu ppm, "
+           "PF %.0f%%, FI %.3f, step %.4f x%lu\n", name, (unsigned long)m->periods, m->carrier_hz, m->jitter_rms,
+           (unsigned long long)m->jitter_pp, (unsigned long)m->duty_err_mean_ppm, (unsigned long)m->duty_err_max_ppm,
+           m->percent_flicker, m->flicker_index, m->step_max, (unsigned long)m->visible_steps);
+}
+
+/**
+  * @brief           flicker检查：已知波形的闪烁、抖动、占空比和阶跃指标
+  * @param        argc 参数个数
+  * @param        argv 参数
+  * @retval          0=通过，1=失败
+  * @note           时间单位为微秒，浮点指标按千分之一取整后比较：
+  *                        1. 1kHz、25%：无抖动、无占空比误差，百分比闪烁100%，闪烁指数0.75
+  *                        2. 周期900/1100交替：均方根抖动100、峰峰值200，平均载波仍为1kHz
+  *                        3. 25%跳到30%：一次可见阶跃，大小与gamma 2.2模型一致，占空比误差最大50000ppm
+  *                        4. 每个上升沿带零宽毛刺：结果与波形1相同（零长度周期被合并，不除以0）
+  *                        5. CSV：表头被拒绝，重复行和零宽毛刺不产生额外周期
+  */
+static int Check_Flicker(int argc, char **argv)
+{
+    Flicker_Config cfg = { 1000000U, FLICKER_CHECK_WINDOW, 0.0f, 0.0f };
+    Flicker_State st;
+    Flicker_Metrics m, clean;
+    uint64_t t;
+    int64_t csv_t, csv_t0 = 0;
+    uint8_t csv_level;
+    uint32_t rows = 0;
+    uint32_t step;
+    uint32_t i;
+    int fail = 0;
+
+    (void)argc;
+    (void)argv;
+
+    Flicker_Init(&st, &cfg);
+    Flicker_SetTarget(&st, 250000U);
+    t = 0;
+    Flicker_CheckFeed(&st, &t, FLICKER_CHECK_PERIODS, FLICKER_CHECK_PERIOD, FLICKER_CHECK_PERIOD, 250000U, 0);
+    Flicker_CheckClose("1 kHz 25%", &st, t, &clean);
+    fail |= HostCheck_Expect("periods", clean.periods, FLICKER_CHECK_PERIODS);
+    fail |= HostCheck_Expect("carrier (Hz)", (uint32_t)(clean.carrier_hz + 0.5f), 1000U);
+    fail |= HostCheck_Expect("jitter rms x1000", (uint32_t)(clean.jitter_rms * 1000.0f + 0.5f), 0);
+    fail |= HostCheck_Expect("duty error max (ppm)", clean.duty_err_max_ppm, 0);
+    fail |= HostCheck_Expect("percent flicker", (uint32_t)(clean.percent_flicker + 0.5f), 100U);
+    fail |= HostCheck_Expect("flicker index x1000", (uint32_t)(clean.flicker_index * 1000.0f + 0.5f), 750U);
+    fail |= HostCheck_Expect("visible steps", clean.visible_steps, 0);
+
+    Flicker_Init(&st, &cfg);
+    Flicker_SetTarget(&st, 250000U);
+    t = 0;
+    Flicker_CheckFeed(&st, &t, FLICKER_CHECK_PERIODS, 900U, 1100U, 250000U, 0);
+    Flicker_CheckClose("900/1100 us 25%", &st, t, &m);
+    fail |= HostCheck_Expect("carrier (Hz)", (uint32_t)(m.carrier_hz + 0.5f), 1000U);
+    fail |= HostCheck_Expect("jitter rms x1000", (uint32_t)(m.jitter_rms * 1000.0f + 0.5f), 100000U);
+    fail |= HostCheck_Expect("jitter peak-to-peak", (uint32_t)m.jitter_pp, 200U);
+    fail |= HostCheck_Expect("duty error max (ppm)", m.duty_err_max_ppm, 0);
+
+    Flicker_Init(&st, &cfg);
+    Flicker_SetTarget(&st, 250000U);
+    t = 0;
+    Flicker_CheckFeed(&st, &t, FLICKER_CHECK_PERIODS / 2U, FLICKER_CHECK_PERIOD, FLICKER_CHECK_PERIOD, 250000U, 0);
+    Flicker_CheckFeed(&st, &t, FLICKER_CHECK_PERIODS / 2U, FLICKER_CHECK_PERIOD, FLICKER_CHECK_PERIOD, 300000U, 0);
+    Flicker_CheckClose("25% -> 30%", &st, t, &m);
+    step = (uint32_t)((powf(0.30f, 1.0f / 2.2f) - powf(0.25f, 1.0f / 2.2f)) * 1000.0f + 0.5f);
+    fail |= HostCheck_Expect("visible steps", m.visible_steps, 1);
+    fail |= HostCheck_Expect("step x1000", (uint32_t)(m.step_max * 1000.0f + 0.5f), step);
+    fail |= HostCheck_Expect("duty error max (ppm)", m.duty_err_max_ppm, 50000U);
+
+    Flicker_Init(&st, &cfg);
+    Flicker_SetTarget(&st, 250000U);
+    t = 0;
+    Flicker_CheckFeed(&st, &t, FLICKER_CHECK_PERIODS, FLICKER_CHECK_PERIOD, FLICKER_CHECK_PERIOD, 250000U, 1);
+    Flicker_CheckClose("1 kHz 25% + zero-width glitch", &st, t, &m);
+    fail |= HostCheck_Expect("periods", m.periods, clean.periods);
+    fail |= HostCheck_Expect("jitter peak-to-peak", (uint32_t)m.jitter_pp, 0);
+    fail |= HostCheck_Expect("duty error max (ppm)", m.duty_err_max_ppm, 0);
+    fail |= HostCheck_Expect("flicker index x1000", (uint32_t)(m.flicker_index * 1000.0f + 0.5f),
+                             (uint32_t)(clean.flicker_index * 1000.0f + 0.5f));
+
+    Flicker_Init(&st, &cfg);
+    Flicker_SetTarget(&st, 250000U);
+    for(i = 0; i < sizeof(flicker_check_csv) / sizeof(flicker_check_csv[0]); i++) {
+        if(!Flicker_ParseCsv(flicker_check_csv[i], cfg.units_per_sec, &csv_t, &csv_level)) continue;
+        if(rows++ == 0) csv_t0 = csv_t;
+        Flicker_Edge(&st, (uint64_t)(csv_t - csv_t0), csv_level);
+    }
+    Flicker_Result(&st, &m);
+    printf("CSV with a repeated row and a zero-width glitch: %lu rows, %lu periods\n", (unsigned long)rows,
+           (unsigned long)m.periods);
+    fail |= HostCheck_Expect("rows parsed", rows, sizeof(flicker_check_csv) / sizeof(flicker_check_csv[0]) - 1U);
+    fail |= HostCheck_Expect("periods", m.periods, 2);
+    fail |= HostCheck_Expect("duty error max (ppm)", m.duty_err_max_ppm, 0);
+    fail |= HostCheck_Expect("jitter peak-to-peak", (uint32_t)m.jitter_pp, 0);
+    return fail;
+}
+
+/* ---------------------------------- pwmstagger ---------------------------------- */
+
+#define PS_CHECK_PERIOD                     1000U            /* PWM周期，单位：时间单位 */
+#define PS_CHECK_SCALE                      16U              /* 回放时每时间单位的CPU周期数 */
+#define PS_CHECK_CYCLES                     4U               /* 回放的PWM周期数 */
+#define PS_CHECK_MAX                        16U              /* 最多通道数（同一GPIO端口） */
+
+/**
+  * @brief   检查用的一组占空比
+  */
+typedef struct
+{
+    const char *name;                                /* 名称 */
+    uint32_t n;                                         /* 通道数 */
+    uint32_t duty[PS_CHECK_MAX];                /* 各通道导通时间，0xFFFFFFFF=随机 */
+} Ps_CheckCase;
+
+static const Ps_CheckCase ps_check_case[] =
+{
+    { "8 x 30%",             8,  { 300, 300, 300, 300, 300, 300, 300, 300 } },
+    { "4 x 50% (exact)",     4,  { 500, 500, 500, 500 } },
+    { "off, full, mixed",    6,  { 0, 1000, 500, 250, 999, 1 } },
+    { "16 random",           16, { 0xFFFFFFFFU } },
+};
+
+/**
+  * @brief   GPIO回放状态
+  */
+typedef struct
+{
+    uint8_t counting;                                 /* 1=累计导通时间 */
+    uint32_t odr;                                       /* 上一次写入后的ODR */
+    uint64_t last;                                      /* 上一次写入的时刻 */
+    uint64_t on[PS_CHECK_MAX];                    /* 各引脚的高电平时间，单位：CPU周期 */
+    uint32_t peak;                                     /* 同时为高的引脚数峰值 */
+} Ps_Watch;
+
+static Ps_Watch ps_watch;
+
+/**
+  * @brief           GPIO写入后累计各引脚的高电平时间
+  */
+static void Ps_CheckGpio(uint32_t port, const SimPeriph_GpioPort *gpio, void *ctx)
+{
+    Ps_Watch *w = (Ps_Watch *)ctx;
+    uint64_t now = RegSim_Now();
+    uint32_t p, high = 0;
+
+    if(port != 4U) return;                                                        /* PE */
+    for(p = 0; p < PS_CHECK_MAX; p++) {
+        if(w->counting && ((w->odr >> p) & 1U)) w->on[p] += now - w->last;
+        high += (gpio->odr >> p) & 1U;
+    }
+    if(w->counting && high > w->peak) w->peak = high;
+    w->odr = gpio->odr;
+    w->last = now;
+}
+
+/**
+  * @brief           逐个时间单位统计同时导通的通道数（参考值）
+  * @param        duty 各通道导通时间
+  * @param        offset 各通道导通起点
+  * @param        n 通道数
+  * @param        load 输出统计
+  * @retval          None
+  */
+static void Ps_CheckBrute(const uint32_t *duty, const uint32_t *offset, uint32_t n, PwmStagger_Load *load)
+{
+    uint64_t sum = 0, sum_sq = 0;
+    uint32_t t, i, on;
+
+    load->peak = 0;
+    for(t = 0; t < PS_CHECK_PERIOD; t++) {
+        on = 0;
+        for(i = 0; i < n; i++) {
+            on += ((t + PS_CHECK_PERIOD - offset[i]) % PS_CHECK_PERIOD < duty[i]) ? 1U : 0U;
+        }
+        if(on > load->peak) load->peak = on;
+        sum += on;
+        sum_sq += (uint64_t)on * on;
+    }
+    load->mean_x1000 = (uint32_t)(sum * 1000U / PS_CHECK_PERIOD);
+    load->rms_x1000 = (uint32_t)(sqrt((double)sum_sq / PS_CHECK_PERIOD) * 1000.0 + 0.5);
+}
+
+/**
+  * @brief           在GPIO模型上回放BSRR写入表，核对各通道的导通时间
+  * @param        duty 各通道导通时间
+  * @param        offset 各通道导通起点
+  * @param        n 通道数
+  * @param        peak PwmStagger_Measure()给出的峰值
+  * @retval          0=通过，1=失败
+  * @note           通道i接PE的引脚i；每项按周期起点加slots[i].time等待后写BSRR，
+  *                        每次写入的访问耗时相同，各边沿同样推迟，高电平时间不受影响
+  */
+static int Ps_CheckReplay(const uint32_t *duty, const uint32_t *offset, uint32_t n, uint32_t peak)
+{
+    static const uint8_t pin[PS_CHECK_MAX] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+    PwmStagger_Edge edge[2 * PS_CHECK_MAX];
+    PwmStagger_Slot slot[2 * PS_CHECK_MAX + 1];
+    Ps_Watch *w = &ps_watch;
+    uint32_t used, c, i;
+    uint32_t wrong = 0, both = 0;
+    uint64_t base, target;
+    int fail = 0;
+
+    used = PwmStagger_Build(duty, offset, pin, n, PS_CHECK_PERIOD, edge, slot);
+    for(i = 0; i < used; i++) {
+        if(slot[i].bsrr & (slot[i].bsrr >> 16)) both++;
+        if(i > 0 && slot[i].time <= slot[i - 1].time) wrong++;
+    }
+
+    HostCheck_Reset();
+    memset(w, 0, sizeof(*w));
+    SimPeriph_GpioAttach(Ps_CheckGpio, w);
+    REG_WRITE(GPIOE->MODER, 0x55555555U);                               /* 全部为通用输出 */
+
+    /* 回放PS_CHECK_CYCLES个周期，以下一周期第0项的写入结束统计 */
+    base = RegSim_Now() + PS_CHECK_SCALE;
+    for(c = 0; c <= PS_CHECK_CYCLES; c++) {
+        for(i = 0; i < used; i++) {
+            target = base + (uint64_t)(c * PS_CHECK_PERIOD + slot[i].time) * PS_CHECK_SCALE;
+            if(RegSim_Now() < target) RegSim_Advance(target - RegSim_Now());
+            REG_WRITE(GPIOE->BSRR, slot[i].bsrr);
+            w->counting = 1;
+            if(c == PS_CHECK_CYCLES) break;
+        }
+    }
+
+    for(i = 0; i < n; i++) {
+        if(w->on[i] != (uint64_t)duty[i] * PS_CHECK_SCALE * PS_CHECK_CYCLES) {
+            printf("  channel %lu: high %llu cycles, expect %llu\n", (unsigned long)i, (unsigned long long)w->on[i],
+                   (unsigned long long)duty[i] * PS_CHECK_SCALE * PS_CHECK_CYCLES);
+            wrong++;
+        }
+    }
+    fail |= HostCheck_ExpectMax("BSRR slots", used, 2U * n + 1U);
+    fail |= HostCheck_Expect("set and reset in one slot", both, 0);
+    fail |= HostCheck_Expect("replay: wrong channel duty", wrong, 0);
+    fail |= HostCheck_Expect("replay: peak pins high", w->peak, peak);
+    return fail;
+}
+
+/**
+  * @brief           pwmstagger检查：对齐与错开的负载、写入表回放
+  * @param        argc 参数个数
+  * @param        argv 参数
+  * @retval          0=通过，1=失败
+  * @note           每组占空比：
+  *                        1. 对齐（起点全为0）与错开后各自的峰值、均值、均方根，与逐时间单位统计的参考值一致
+  *                        2. 错开后的峰值 = ⌈Σduty ÷ period⌉，对齐时的峰值 = 导通时间非0的通道数，均值不变
+  *                        3. 错开后的写入表在GPIO模型上回放，每个通道的高电平时间等于其导通时间
+  */
+static int Check_PwmStagger(int argc, char **argv)
+{
+    uint32_t duty[PS_CHECK_MAX];
+    uint32_t zero[PS_CHECK_MAX] = { 0 };
+    uint32_t offset[PS_CHECK_MAX];
+    PwmStagger_Edge edge[2 * PS_CHECK_MAX];
+    PwmStagger_Load aligned, staggered, ref;
+    uint32_t seed = 63;
+    uint32_t k, i, n, sum, busy;
+    int fail = 0;
+
+    (void)argc;
+    (void)argv;
+    for(k = 0; k < sizeof(ps_check_case) / sizeof(ps_check_case[0]); k++) {
+        n = ps_check_case[k].n;
+        sum = 0;
+        busy = 0;
+        for(i = 0; i < n; i++) {
+            duty[i] = ps_check_case[k].duty[i];
+            if(ps_check_case[k].duty[0] == 0xFFFFFFFFU) duty[i] = HostCheck_Rand(&seed) % (PS_CHECK_PERIOD + 1U);
+            sum += duty[i];
+            busy += (duty[i] != 0) ? 1U : 0U;
+        }
+
+        PwmStagger_Distribute(duty, offset, n, PS_CHECK_PERIOD);
+        PwmStagger_Measure(duty, zero, n, PS_CHECK_PERIOD, edge, &aligned);
+        PwmStagger_Measure(duty, offset, n, PS_CHECK_PERIOD, edge, &staggered);
+        printf("%s: %lu channels, sum of duty %lu / period %lu\n", ps_check_case[k].name, (unsigned long)n,
+               (unsigned long)sum, (unsigned long)PS_CHECK_PERIOD);
+        printf("  %-28s peak %2lu, mean %6.3f, rms %6.3f\n", "aligned", (unsigned long)aligned.peak,
+               aligned.mean_x1000 / 1000.0, aligned.rms_x1000 / 1000.0);
+        printf("  %-28s peak %2lu, mean %6.3f, rms %6.3f\n", "staggered", (unsigned long)staggered.peak,
+               staggered.mean_x1000 / 1000.0, staggered.rms_x1000 / 1000.0);
+
+        Ps_CheckBrute(duty, zero, n, &ref);
+        fail |= HostCheck_Expect("aligned peak", aligned.peak, busy);
+        fail |= HostCheck_Expect("aligned peak (brute force)", aligned.peak, ref.peak);
+        fail |= HostCheck_ExpectMax("aligned rms err (x1000)",
+                                    (uint64_t)abs((int)aligned.rms_x1000 - (int)ref.rms_x1000), 1);
+        Ps_CheckBrute(duty, offset, n, &ref);
+        fail |= HostCheck_Expect("staggered peak", staggered.peak, (sum + PS_CHECK_PERIOD - 1U) / PS_CHECK_PERIOD);
+        fail |= HostCheck_Expect("staggered peak (brute force)", staggered.peak, ref.peak);
+        fail |= HostCheck_ExpectMax("staggered rms err (x1000)",
+                                    (uint64_t)abs((int)staggered.rms_x1000 - (int)ref.rms_x1000), 1);
+        fail |= HostCheck_Expect("mean x1000", staggered.mean_x1000, aligned.mean_x1000);
+        fail |= HostCheck_ExpectMax("staggered rms over aligned",
+                                    (staggered.rms_x1000 > aligned.rms_x1000) ? staggered.rms_x1000 - aligned.rms_x1000 : 0, 0);
+        fail |= Ps_CheckReplay(duty, offset, n, staggered.peak);
+    }
+    return fail;
+}
+
+/* ---------------------------------- anim ---------------------------------- */
+
+#define ANIM_CHECK_LEVELS                   65536U         /* 最大的原始帧字节数（通道数 × 帧数） */
+#define ANIM_CHECK_TRUNC                    1024U          /* 每组数据最多检查的截断长度个数 */
+#define ANIM_CHECK_DEMO_FRAMES         100U           /* AnimDemo的帧数，与AnimDemo.c文件头一致 */
+#define ANIM_CHECK_DEMO_SUM              816120U       /* AnimDemo各帧亮度之和，与AnimDemo.c文件头一致 */
+
+/**
+  * @brief   检查用的一组动画
+  */
+typedef struct
+{
+    const char *name;                                /* 名称 */
+    uint32_t channels;                               /* 通道数 */
+    uint32_t frames;                                  /* 帧数 */
+    uint8_t kind;                                      /* 内容，见Anim_CheckFill() */
+} Anim_CheckCase;
+
+static const Anim_CheckCase anim_check_case[] =
+{
+    { "all dark",              300,   20, 0 },
+    { "still image",           256,   16, 1 },
+    { "slow ramp (nibble)",    64,    64, 2 },
+    { "fade step (repeat)",    100,   12, 3 },
+    { "random (literal)",      97,    33, 4 },
+    { "sparse changes",        500,   24, 5 },
+    { "wide still (skip)",     20000, 3,  1 },
+    { "mixed regions",         333,   40, 6 },
+};
+
+static uint8_t anim_check_levels[ANIM_CHECK_LEVELS];
+static uint8_t anim_check_data[ANIM_CHECK_LEVELS + ANIM_CHECK_LEVELS / 64U + 64U];
+static uint8_t anim_check_frame[ANIM_CHECK_LEVELS];
+static uint32_t anim_check_ticks;
+
+/**
+  * @brief           生成一组原始帧
+  * @param        c 检查用例
+  * @param        seed 随机数状态
+  * @retval          None
+  * @note           0=全暗，1=随机首帧后不变，2=各通道每帧增加1~7，3=全部通道每帧增加20，
+  *                        4=全部随机，5=每37个通道中有一个随机变化，6=按通道号依次为以上各种
+  */
+static void Anim_CheckFill(const Anim_CheckCase *c, uint32_t *seed)
+{
+    uint32_t f, ch, kind;
+    uint8_t *cur;
+    uint8_t prev;
+
+    for(f = 0; f < c->frames; f++) {
+        cur = &anim_check_levels[f * c->channels];
+        for(ch = 0; ch < c->channels; ch++) {
+            kind = (c->kind == 6U) ? (ch / 7U) % 6U : c->kind;
+            prev = (f > 0) ? anim_check_levels[(f - 1U) * c->channels + ch] : 0;
+            switch(kind) {
+                case 0:  cur[ch] = 0; break;
+                case 1:  cur[ch] = (f == 0) ? (uint8_t)HostCheck_Rand(seed) : prev; break;
+                case 2:  cur[ch] = (uint8_t)(ch * 3U + f * (ch % 7U + 1U)); break;
+                case 3:  cur[ch] = (uint8_t)(f * 20U); break;
+                case 4:  cur[ch] = (uint8_t)HostCheck_Rand(seed); break;
+                default: cur[ch] = (ch % 37U == 0) ? (uint8_t)HostCheck_Rand(seed) : prev; break;
+            }
+        }
+    }
+}
+
+/**
+  * @brief           解码并与原始帧比较
+  * @param        data 编码结果
+  * @param        size 数据长度
+  * @param        c 检查用例
+  * @retval          0=逐帧一致且恰好用完数据，1=不一致
+  */
+static int Anim_CheckDecode(const uint8_t *data, uint32_t size, const Anim_CheckCase *c)
+{
+    Anim_Decoder dec;
+    uint32_t f;
+
+    if(Anim_Open(&dec, data, size, anim_check_frame) != 0 || dec.channels != c->channels
+       || dec.frames != c->frames) return 1;
+    for(f = 0; f < c->frames; f++) {
+        if(Anim_Next(&dec, anim_check_frame) != ANIM_OK
+           || memcmp(anim_check_frame, &anim_check_levels[f * c->channels], c->channels) != 0) return 1;
+    }
+    return (Anim_Next(&dec, anim_check_frame) != ANIM_END || dec.pos != dec.end);
+}
+
+/**
+  * @brief           截断后解码
+  * @param        data 完整的编码结果
+  * @param        len 截断后的长度
+  * @param        c 检查用例
+  * @retval          0=打开失败或解码中途返回ANIM_ERROR，1=截断的数据被当作完整动画，2=读位置越过末尾
+  * @note           截断的数据拷贝到恰好len字节的缓冲中，越界读取可由内存检查工具发现
+  */
+static int Anim_CheckTruncated(const uint8_t *data, uint32_t len, const Anim_CheckCase *c)
+{
+    Anim_Decoder dec;
+    uint8_t *copy = (uint8_t *)malloc(len ? len : 1U);
+    uint32_t f;
+    uint8_t r = ANIM_OK;
+    int ret = 0;
+
+    if(copy == NULL) return 1;
+    memcpy(copy, data, len);
+    if(Anim_Open(&dec, copy, len, anim_check_frame) == 0) {
+        for(f = 0; f < c->frames && r == ANIM_OK; f++) {
+            r = Anim_Next(&dec, anim_check_frame);
+            if(dec.pos > dec.end) ret = 2;
+        }
+        if(r == ANIM_OK && ret == 0) ret = 1;
+    }
+    free(copy);
+    return ret;
+}
+
+/**
+  * @brief           计数时钟：每次调用加1
+  * @param        None
+  * @retval          计数值
+  */
+static uint32_t Anim_CheckClock(void)
+{
+    return ++anim_check_ticks;
+}
+
+/**
+  * @brief           anim检查项
+  * @param        argc 参数个数
+  * @param        argv 参数（无）
+  * @retval          0=通过，1=失败
+  * @note           检查内容：
+  *                        1. 各种内容的动画编码后不超过Anim_Bound()，逐帧解码与原始帧一致，输出缓冲少1字节时编码失败
+  *                        2. 任意长度截断的数据不会被当作完整动画，解码不越过数据末尾
+  *                        3. 文件头的魔数、版本和通道数非法时打开失败
+  *                        4. Anim_Benchmark()解码AnimDemo的帧数和亮度之和与anim程序生成时一致，
+  *                           帧缓冲小于通道数时不解码
+  */
+static int Check_Anim(int argc, char **argv)
+{
+    const Anim_CheckCase *c;
+    Anim_Decoder dec;
+    Anim_Bench b;
+    uint32_t seed = 69;
+    uint32_t k, size, bound, len, step;
+    uint32_t accepted, overrun, tried;
+    uint8_t bad[ANIM_HEADER_SIZE];
+    int fail = 0;
+    int r;
+
+    (void)argc;
+    (void)argv;
+    for(k = 0; k < sizeof(anim_check_case) / sizeof(anim_check_case[0]); k++) {
+        c = &anim_check_case[k];
+        Anim_CheckFill(c, &seed);
+        bound = Anim_Bound(c->channels, c->frames);
+        size = Anim_Encode(anim_check_levels, c->channels, c->frames, 20000U, anim_check_data, bound);
+        printf("%s: %lu channels x %lu frames, %lu -> %lu bytes\n", c->name, (unsigned long)c->channels,
+               (unsigned long)c->frames, (unsigned long)(c->channels * c->frames), (unsigned long)size);
+        fail |= HostCheck_ExpectMax("encoded size", size, bound);
+        fail |= HostCheck_Expect("encoded", size != 0, 1);
+        fail |= HostCheck_Expect("round trip", Anim_CheckDecode(anim_check_data, size, c), 0);
+        fail |= HostCheck_Expect("encode into size - 1",
+                                 Anim_Encode(anim_check_levels, c->channels, c->frames, 20000U,
+                                             anim_check_data, size - 1U), 0);
+
+        /* 重新编码后逐个截断 */
+        Anim_Encode(anim_check_levels, c->channels, c->frames, 20000U, anim_check_data, bound);
+        step = size / ANIM_CHECK_TRUNC + 1U;
+        accepted = 0;
+        overrun = 0;
+        tried = 0;
+        for(len = 0; len < size; len = (len + step < size - 2U) ? len + step : len + 1U) {
+            r = Anim_CheckTruncated(anim_check_data, len, c);
+            accepted += (r == 1) ? 1U : 0U;
+            overrun += (r == 2) ? 1U : 0U;
+            tried++;
+        }
+        printf("  %-28s %10lu\n", "truncated lengths tried", (unsigned long)tried);
+        fail |= HostCheck_Expect("truncated accepted", accepted, 0);
+        fail |= HostCheck_Expect("truncated read past end", overrun, 0);
+    }
+
+    /* 文件头 */
+    printf("header:\n");
+    memcpy(bad, anim_check_data, ANIM_HEADER_SIZE);
+    bad[0] = 'a';
+    fail |= HostCheck_Expect("bad magic rejected", Anim_Open(&dec, bad, ANIM_HEADER_SIZE, anim_check_frame), 1);
+    memcpy(bad, anim_check_data, ANIM_HEADER_SIZE);
+    bad[4] = ANIM_VERSION + 1U;
+    fail |= HostCheck_Expect("bad version rejected", Anim_Open(&dec, bad, ANIM_HEADER_SIZE, anim_check_frame), 1);
+    memcpy(bad, anim_check_data, ANIM_HEADER_SIZE);
+    bad[6] = 0;
+    bad[7] = 0;
+    fail |= HostCheck_Expect("0 channels rejected", Anim_Open(&dec, bad, ANIM_HEADER_SIZE, anim_check_frame), 1);
+
+    /* 目标板A命令的示例动画：计数时钟下每帧恰好1个计数 */
+    printf("AnimDemo (%lu bytes):\n", (unsigned long)AnimDemo_Size);
+    Anim_Benchmark(AnimDemo, AnimDemo_Size, anim_check_frame, ANIM_DEMO_CHANNELS, 3U, Anim_CheckClock, 1U, &b);
+    fail |= HostCheck_Expect("status", b.status, ANIM_END);
+    fail |= HostCheck_Expect("frames", b.frames, ANIM_CHECK_DEMO_FRAMES);
+    fail |= HostCheck_Expect("sum", b.sum, ANIM_CHECK_DEMO_SUM);
+    fail |= HostCheck_Expect("ticks", b.ticks, 3U * ANIM_CHECK_DEMO_FRAMES);
+    fail |= HostCheck_Expect("frame max", b.frame_max, 1);
+    fail |= HostCheck_Expect("frame ns", b.frame_ns, 1000);
+    Anim_Benchmark(AnimDemo, AnimDemo_Size, anim_check_frame, ANIM_DEMO_CHANNELS - 1U, 3U, Anim_CheckClock, 1U, &b);
+    fail |= HostCheck_Expect("short frame buffer status", b.status, ANIM_ERROR);
+    fail |= HostCheck_Expect("short frame buffer frames", b.frames, 0);
+    return fail;
+}
+
+/* ---------------------------------- pool ---------------------------------- */
+
+#define POOL_CHECK_BLOCKS                  64U            /* 各池块数之和的上限 */
+
+static uint8_t pool_check_foreign[64];          /* 不属于任何池的地址 */
+
+/**
+  * @brief           检查一个池的统计
+  * @param        id 池编号
+  * @param        used 期望的当前占用
+  * @param        peak 期望的最高占用
+  * @param        fail 期望的失败次数
+  * @retval          0=一致，1=不一致
+  */
+static int Pool_CheckStats(uint32_t id, uint32_t used, uint32_t peak, uint32_t fail)
+{
+    Pool_Stats st;
+    char what[32];
+    int r = 0;
+
+    Pool_GetStats(id, &st);
+    snprintf(what, sizeof(what), "pool %lu used", (unsigned long)st.block);
+    r |= HostCheck_Expect(what, st.used, used);
+    snprintf(what, sizeof(what), "pool %lu peak", (unsigned long)st.block);
+    r |= HostCheck_Expect(what, st.peak, peak);
+    snprintf(what, sizeof(what), "pool %lu fail", (unsigned long)st.block);
+    r |= HostCheck_Expect(what, st.fail, fail);
+    return r;
+}
+
+/**
+  * @brief           pool检查项
+  * @param        argc 参数个数
+  * @param        argv 参数（无）
+  * @retval          0=通过，1=失败
+  * @note           检查内容：
+  *                        1. 每个池能分配出全部块，块地址按POOL_ALIGN对齐、互不重叠，用完后返回NULL并计入fail
+  *                        2. Pool_Alloc()在最小的合适池用完时改用更大的池，超过最大块时返回NULL
+  *                        3. Pool_Free()拒绝池外地址和池内非块起始地址，统计不变；NULL直接返回0
+  *                        4. 全部释放后占用回到0、最高占用保留，再次分配仍能取出全部块
+  */
+static int Check_Pool(int argc, char **argv)
+{
+    uint8_t *blk[POOL_CHECK_BLOCKS];
+    uint32_t owner[POOL_CHECK_BLOCKS];
+    Pool_Stats st[POOL_COUNT];
+    uint32_t id, k, n = 0, total = 0, misaligned = 0, overlap = 0;
+    uint8_t *p;
+    int fail = 0;
+
+    (void)argc;
+    (void)argv;
+    Pool_Init();
+    for(id = 0; id < POOL_COUNT; id++) {
+        Pool_GetStats(id, &st[id]);
+        total += st[id].count;
+    }
+    if(total > POOL_CHECK_BLOCKS) {
+        printf("  POOL_TABLE has %lu blocks, more than POOL_CHECK_BLOCKS\n", (unsigned long)total);
+        return 1;
+    }
+
+    /* 逐个池分配到用完，每块写满自己的编号 */
+    printf("exhaustion:\n");
+    for(id = 0; id < POOL_COUNT; id++) {
+        for(k = 0; k < st[id].count; k++) {
+            p = (uint8_t *)Pool_AllocFrom(id);
+            if(p == NULL) break;
+            misaligned += ((uintptr_t)p % POOL_ALIGN != 0) ? 1U : 0U;
+            memset(p, (int)n, st[id].block);
+            owner[n] = id;
+            blk[n++] = p;
+        }
+        fail |= HostCheck_Expect("alloc from empty pool", Pool_AllocFrom(id) == NULL, 1);
+        fail |= Pool_CheckStats(id, st[id].count, st[id].count, 1);
+    }
+    for(k = 0; k < n; k++) {
+        for(id = 0; id < st[owner[k]].block; id++) overlap += (blk[k][id] != (uint8_t)k) ? 1U : 0U;
+    }
+    fail |= HostCheck_Expect("blocks allocated", n, total);
+    fail |= HostCheck_Expect("misaligned blocks", misaligned, 0);
+    fail |= HostCheck_Expect("overwritten bytes", overlap, 0);
+    fail |= HostCheck_Expect("alloc when all empty", Pool_Alloc(1) == NULL, 1);
+    fail |= HostCheck_Expect("invalid pool id", Pool_AllocFrom(POOL_COUNT) == NULL, 1);
+
+    /* 非法释放：池外、块内偏移、未对齐，统计不变 */
+    printf("bad free:\n");
+    fail |= HostCheck_Expect("free NULL", Pool_Free(NULL), 0);
+    fail |= HostCheck_Expect("free foreign static", Pool_Free(pool_check_foreign), 1);
+    fail |= HostCheck_Expect("free foreign stack", Pool_Free(&k), 1);
+    fail |= HostCheck_Expect("free block + POOL_ALIGN", Pool_Free(blk[0] + POOL_ALIGN), 1);
+    fail |= HostCheck_Expect("free block + 1", Pool_Free(blk[n - 1U] + 1), 1);
+    fail |= HostCheck_Expect("free middle of block", Pool_Free(blk[n - 1U] + st[POOL_COUNT - 1U].block / 2U), 1);
+    for(id = 0; id < POOL_COUNT; id++) {
+        Pool_GetStats(id, &st[id]);
+        fail |= HostCheck_Expect("used unchanged", st[id].used, st[id].count);
+    }
+
+    /* 全部释放，按大小分配时的回退 */
+    printf("free and fall back:\n");
+    for(k = 0; k < n; k++) fail |= (Pool_Free(blk[k]) != 0);
+    for(id = 0; id < POOL_COUNT; id++) fail |= Pool_CheckStats(id, 0, st[id].count, 2);
+    for(k = 0; k < st[0].count; k++) blk[k] = (uint8_t *)Pool_Alloc(st[0].block);
+    p = (uint8_t *)Pool_Alloc(st[0].block);
+    fail |= HostCheck_Expect("fall back to next pool", p != NULL, 1);
+    fail |= Pool_CheckStats(0, st[0].count, st[0].count, 3);
+    fail |= Pool_CheckStats(1, 1, st[1].count, 2);
+    fail |= HostCheck_Expect("larger than any block", Pool_Alloc(st[POOL_COUNT - 1U].block + 1U) == NULL, 1);
+    fail |= HostCheck_Expect("free fallback block", Pool_Free(p), 0);
+    for(k = 0; k < st[0].count; k++) fail |= (Pool_Free(blk[k]) != 0);
+
+    /* 释放后空闲链表完整：再次取出全部块 */
+    for(k = 0; k < total && Pool_Alloc(1) != NULL; k++) {
+    }
+    fail |= HostCheck_Expect("blocks after free", k, total);
+    Pool_Init();
+    return fail;
+}
+
+/* ---------------------------------- arena ---------------------------------- */
+
+#define ARENA_CHECK_SIZE                    256U           /* 检查用分配区大小，单位：字节 */
+
+static uint64_t arena_check_buf[ARENA_CHECK_SIZE / sizeof(uint64_t) + 1U];
+
+/**
+  * @brief           arena检查项
+  * @param        argc 参数个数
+  * @param        argv 参数（无）
+  * @retval          0=通过，1=失败
+  * @note           检查内容：
+  *                        1. 存储区起始不对齐时，各种对齐要求的分配地址仍按实际地址对齐，ARENA_NEW按类型对齐
+  *                        2. 空间不足时返回NULL、计入fail且不移动当前位置，恰好用满时成功
+  *                        3. 回收后上一帧用量、最高用量和帧数正确，报告中的最高用量包含当前帧
+  *                        4. ARENA_POISON为1时：回收后经旧指针写入在下次分配时被发现，正常使用不误报
+  */
+static int Check_Arena(int argc, char **argv)
+{
+    static const uint32_t align[] = { 1U, 2U, 4U, 8U, 16U, 32U, 64U };
+    Arena a;
+    Arena_Report r;
+    uint8_t *base = (uint8_t *)arena_check_buf + 1;    /* 故意不对齐 */
+    uint8_t *p;
+    uint8_t *q;
+    uint32_t *w;
+    uint64_t *d;
+    uint32_t k, bad = 0, top;
+    int fail = 0;
+
+    (void)argc;
+    (void)argv;
+
+    /* 对齐：每次先分配1字节打乱当前位置 */
+    printf("alignment (base %% 8 = %lu):\n", (unsigned long)((uintptr_t)base % 8U));
+    Arena_Init(&a, base, ARENA_CHECK_SIZE);
+    for(k = 0; k < sizeof(align) / sizeof(align[0]); k++) {
+        fail |= (Arena_Alloc(&a, 1, 1) == NULL);
+        p = (uint8_t *)Arena_Alloc(&a, 3, align[k]);
+        bad += (p == NULL || (uintptr_t)p % align[k] != 0) ? 1U : 0U;
+    }
+    p = (uint8_t *)Arena_Alloc(&a, 1, 0);
+    bad += (p == NULL || (uintptr_t)p % ARENA_ALIGN != 0) ? 1U : 0U;
+    fail |= (Arena_Alloc(&a, 1, 1) == NULL);
+    w = ARENA_NEW(&a, uint32_t, 3);
+    fail |= (Arena_Alloc(&a, 1, 1) == NULL);
+    d = ARENA_NEW(&a, uint64_t, 2);
+    bad += (w == NULL || (uintptr_t)w % __alignof__(uint32_t) != 0) ? 1U : 0U;
+    bad += (d == NULL || (uintptr_t)d % __alignof__(uint64_t) != 0) ? 1U : 0U;
+    fail |= HostCheck_Expect("misaligned results", bad, 0);
+    fail |= HostCheck_Expect("fail", a.fail, 0);
+
+    /* 空间不足 */
+    printf("exhaustion:\n");
+    Arena_Reset(&a);
+    p = (uint8_t *)Arena_Alloc(&a, 100, 1);
+    top = a.top;
+    fail |= HostCheck_Expect("oversize returns NULL", Arena_Alloc(&a, ARENA_CHECK_SIZE - 99U, 1) == NULL, 1);
+    fail |= HostCheck_Expect("alignment pushes past end",
+                             Arena_Alloc(&a, ARENA_CHECK_SIZE - 100U, 64) == NULL, 1);
+    fail |= HostCheck_Expect("fail", a.fail, 2);
+    fail |= HostCheck_Expect("top unchanged", a.top, top);
+    fail |= HostCheck_Expect("exact fit", Arena_Alloc(&a, ARENA_CHECK_SIZE - 100U, 1) != NULL, 1);
+    fail |= HostCheck_Expect("full returns NULL", Arena_Alloc(&a, 1, 1) == NULL, 1);
+
+    /* 水位：3帧分别用200、48、0字节 */
+    printf("watermark:\n");
+    Arena_Init(&a, base, ARENA_CHECK_SIZE);
+    Arena_Alloc(&a, 200, 1);
+    Arena_Reset(&a);
+    Arena_Alloc(&a, 48, 1);
+    Arena_GetReport(&a, &r);
+    fail |= HostCheck_Expect("used (frame 2)", r.used, 48);
+    fail |= HostCheck_Expect("last (frame 1)", r.last, 200);
+    fail |= HostCheck_Expect("peak", r.peak, 200);
+    Arena_Reset(&a);
+    Arena_Reset(&a);
+    Arena_Alloc(&a, 220, 1);
+    Arena_GetReport(&a, &r);
+    fail |= HostCheck_Expect("last (empty frame)", r.last, 0);
+    fail |= HostCheck_Expect("peak incl. current frame", r.peak, 220);
+    fail |= HostCheck_Expect("frames", r.frames, 3);
+    fail |= HostCheck_Expect("size", r.size, ARENA_CHECK_SIZE);
+
+    /* 回收后仍经旧指针写入 */
+    printf("use after reset (ARENA_POISON=%d):\n", ARENA_POISON);
+#if ARENA_POISON
+    Arena_Init(&a, base, ARENA_CHECK_SIZE);
+    p = (uint8_t *)Arena_Alloc(&a, 32, 0);
+    memset(p, 0x11, 32);
+    Arena_Reset(&a);
+    q = (uint8_t *)Arena_Alloc(&a, 32, 0);
+    memset(q, 0x22, 32);
+    Arena_Reset(&a);
+    fail |= HostCheck_Expect("clean frames", a.corrupt, 0);
+    p[5] = 0x33;                                                   /* 上一帧的指针 */
+    Arena_Alloc(&a, 16, 0);
+    Arena_GetReport(&a, &r);
+    fail |= HostCheck_Expect("stale write detected", r.corrupt, 1);
+    Arena_Reset(&a);
+    Arena_Alloc(&a, 16, 0);
+    p = (uint8_t *)Arena_Alloc(&a, 8, 0);
+    Arena_Reset(&a);
+    p[2] = 0x44;                                                   /* 对齐填充之后的第二块 */
+    Arena_Alloc(&a, 40, 0);
+    fail |= HostCheck_Expect("stale write in 2nd block", a.corrupt, 2);
+#else
+    (void)q;
+    printf("  skipped: build with -DARENA_POISON=1\n");
+    fail = 1;
+#endif
+    return fail;
+}
+
+/* ---------------------------------- mapsize ---------------------------------- */
+
+#define MAPSIZE_CHECK_DIR                    "HostData/MapSize/"  /* 夹具目录，路径相对Project目录，由其中的Build.sh生成 */
+#define MAPSIZE_CHECK_FILE_MAX             32768U         /* 夹具文件最大长度，单位：字节 */
+#define MAPSIZE_CHECK_OUT_MAX              8192U           /* 报告输出的最大长度，单位：字节 */
+#define MAPSIZE_CHECK_SYM_CAP              32U             /* 每个映像的符号表容量 */
+#define MAPSIZE_CHECK_MOD_CAP              16U             /* 每个映像的模块表容量 */
+#define MAPSIZE_CHECK_NONE                  0xFFFFFFFFU  /* MapSize_CheckSymbol()：符号不存在 */
+
+static uint8_t mapsize_check_file[MAPSIZE_CHECK_FILE_MAX + 1U];
+static char mapsize_check_out[MAPSIZE_CHECK_OUT_MAX + 1U];
+static MapSize_Symbol mapsize_check_sym[2][MAPSIZE_CHECK_SYM_CAP];
+static MapSize_Module mapsize_check_mod[2][MAPSIZE_CHECK_MOD_CAP];
+
+/**
+  * @brief           读入夹具文件
+  * @param        name 夹具目录下的文件名，或以'/'开头时相对Project目录的路径
+  * @param        len 输出：长度，单位：字节（内容在mapsize_check_file中，末尾补'\0'）
+  * @retval          0=成功，1=打不开或超过缓冲区
+  */
+static int MapSize_CheckRead(const char *name, uint32_t *len)
+{
+    char path[128];
+    FILE *f;
+    int c;
+
+    if(name[0] == '/') {
+        snprintf(path, sizeof(path), "%s", name + 1);
+    } else {
+        snprintf(path, sizeof(path), "%s%s", MAPSIZE_CHECK_DIR, name);
+    }
+    f = fopen(path, "rb");
+    if(f == NULL) {
+        printf("  cannot open %s: %s\n", path, strerror(errno));
+        return 1;
+    }
+    *len = (uint32_t)fread(mapsize_check_file, 1, MAPSIZE_CHECK_FILE_MAX, f);
+    c = fgetc(f);
+    fclose(f);
+    mapsize_check_file[*len] = '\0';
+    if(c != EOF) {
+        printf("  %s is larger than %lu bytes\n", path, (unsigned long)MAPSIZE_CHECK_FILE_MAX);
+        return 1;
+    }
+    return 0;
+}
+
+/**
+  * @brief           读入夹具并解析
+  * @param        name 夹具文件名
+  * @param        img 映像
+  * @param        slot 使用的符号表和模块表（0或1）
+  * @retval          MAPSIZE_FMT_xxx，读不到文件时为MAPSIZE_FMT_NONE
+  */
+static uint8_t MapSize_CheckLoad(const char *name, MapSize_Image *img, uint32_t slot)
+{
+    uint32_t len;
+
+    MapSize_Init(img, mapsize_check_sym[slot], MAPSIZE_CHECK_SYM_CAP, mapsize_check_mod[slot], MAPSIZE_CHECK_MOD_CAP);
+    if(MapSize_CheckRead(name, &len) != 0) return MAPSIZE_FMT_NONE;
+    return MapSize_Load(img, mapsize_check_file, len);
+}
+
+/**
+  * @brief           取回写入临时文件的输出
+  * @param        f 临时文件（关闭）
+  * @retval          输出内容（位于mapsize_check_out，超长截断）
+  */
+static const char *MapSize_CheckOutput(FILE *f)
+{
+    size_t n;
+
+    rewind(f);
+    n = fread(mapsize_check_out, 1, MAPSIZE_CHECK_OUT_MAX, f);
+    fclose(f);
+    mapsize_check_out[n] = '\0';
+    return mapsize_check_out;
+}
+
+/**
+  * @brief           统计输出中字符串出现的次数
+  * @param        text 输出内容
+  * @param        key 字符串
+  * @retval          次数
+  */
+static uint32_t MapSize_CheckCount(const char *text, const char *key)
+{
+    uint32_t n = 0;
+
+    while((text = strstr(text, key)) != NULL) {
+        n++;
+        text += strlen(key);
+    }
+    return n;
+}
+
+/**
+  * @brief           查找以指定名称开头的输出行
+  * @param        text 输出内容
+  * @param        name 第一列的名称
+  * @retval          该行的第二列，NULL=没有这一行
+  */
+static const char *MapSize_CheckRow(const char *text, const char *name)
+{
+    size_t n = strlen(name);
+    const char *p = text;
+
+    while(p != NULL && *p) {
+        if(strncmp(p, name, n) == 0 && p[n] == ' ') return p + n;
+        p = strchr(p, '\n');
+        if(p != NULL) p++;
+    }
+    return NULL;
+}
+
+/**
+  * @brief           符号的大小和所在存储器
+  * @param        img 映像
+  * @param        name 符号名
+  * @param        module 所属模块，NULL=不限
+  * @param        where 输出：MAPSIZE_IN_xxx，可为NULL
+  * @retval          大小，单位：字节；MAPSIZE_CHECK_NONE=不存在
+  */
+static uint32_t MapSize_CheckSymbol(const MapSize_Image *img, const char *name, const char *module, uint8_t *where)
+{
+    uint32_t i;
+
+    for(i = 0; i < img->sym_count; i++) {
+        if(strcmp(img->sym[i].name, name) != 0) continue;
+        if(module != NULL && strcmp(img->sym[i].module, module) != 0) continue;
+        if(where != NULL) *where = img->sym[i].where;
+        return img->sym[i].size;
+    }
+    return MAPSIZE_CHECK_NONE;
+}
+
+/**
+  * @brief           模块的Flash + RAM
+  * @param        img 映像
+  * @param        name 模块名
+  * @retval          大小，单位：字节；MAPSIZE_CHECK_NONE=不存在
+  */
+static uint32_t MapSize_CheckModule(const MapSize_Image *img, const char *name)
+{
+    uint32_t i;
+
+    for(i = 0; i < img->mod_count; i++) {
+        if(strcmp(img->mod[i].name, name) == 0) return img->mod[i].flash + img->mod[i].ram;
+    }
+    return MAPSIZE_CHECK_NONE;
+}
+
+/**
+  * @brief           按预算夹具检查
+  * @param        img 映像
+  * @param        budget 预算文件名
+  * @param        over 输出：超出预算的项数
+  * @retval          输出内容，NULL=读不到预算文件或无法创建临时文件
+  */
+static const char *MapSize_CheckBudget(const MapSize_Image *img, const char *budget, uint32_t *over)
+{
+    FILE *f;
+    uint32_t len;
+
+    if(MapSize_CheckRead(budget, &len) != 0 || (f = tmpfile()) == NULL) return NULL;
+    *over = MapSize_Check(img, (const char *)mapsize_check_file, len, f);
+    return MapSize_CheckOutput(f);
+}
+
+/**
+  * @brief           比较两个映像
+  * @param        old_img 旧映像
+  * @param        new_img 新映像
+  * @retval          输出内容，NULL=无法创建临时文件
+  */
+static const char *MapSize_CheckDiff(const MapSize_Image *old_img, const MapSize_Image *new_img)
+{
+    FILE *f = tmpfile();
+
+    if(f == NULL) return NULL;
+    MapSize_Diff(old_img, new_img, MAPSIZE_CHECK_SYM_CAP, f);
+    return MapSize_CheckOutput(f);
+}
+
+/**
+  * @brief           检查比较结果中的一行
+  * @param        text 输出内容，NULL时失败
+  * @param        name 模块名或符号名
+  * @param        module 符号所属模块，模块行为NULL
+  * @param        old_size 期望的旧大小
+  * @param        new_size 期望的新大小
+  * @retval          0=一致，1=不一致或缺少该行
+  */
+static int MapSize_CheckDelta(const char *text, const char *name, const char *module,
+                              uint32_t old_size, uint32_t new_size)
+{
+    char what[32];
+    char mod[MAPSIZE_MODULE_MAX];
+    const char *row = (text != NULL) ? MapSize_CheckRow(text, name) : NULL;
+    unsigned int o = 0, n = 0;
+    int ok;
+
+    if(module != NULL) {
+        ok = (row != NULL && sscanf(row, "%47s %u %u", mod, &o, &n) == 3 && strcmp(mod, module) == 0);
+    } else {
+        ok = (row != NULL && sscanf(row, "%u %u", &o, &n) == 2);
+    }
+    snprintf(what, sizeof(what), "%.20s old", name);
+    if(!ok) {
+        printf("  %-28s %10s  (expect %lu)  FAIL\n", what, "missing", (unsigned long)old_size);
+        return 1;
+    }
+    snprintf(what, sizeof(what), "%.20s old/new", name);
+    printf("  %-28s %4u/%-5u  (expect %lu/%lu)%s\n", what, o, n, (unsigned long)old_size, (unsigned long)new_size,
+           (o == old_size && n == new_size) ? "" : "  FAIL");
+    return o != old_size || n != new_size;
+}
+
+/**
+  * @brief           mapsize检查项
+  * @param        argc 参数个数
+  * @param        argv 参数
+  * @retval          0=通过，1=失败
+  * @note           夹具（HostData/MapSize/）为同一个小程序的三种输出：
+  *                        keil_map.txt按armlink格式手写，gcc_map.txt和mapsize.elf由ld链接生成，
+  *                        gcc_old_map.txt为接收缓冲区较小且未链接CMSIS-DSP表的旧版本。检查内容：
+  *                        1. Keil：总量取自Total行，Section/Number行和库文件汇总表不计入，模块取自目标文件和库成员表
+  *                        2. GCC与ELF：同一次链接的总量和各符号大小一致，.text.startup.main取为main，本地符号归入源文件
+  *                        3. 报告：标题行、前N项、表满时的丢弃警告；Flag列出CMSIS-DSP模块和符号
+  *                        4. 预算：budget.txt对三种格式的超出项数，SizeBudget.txt每行都能识别
+  *                        5. 比较：新增、删除、变化的符号和模块，未变化的不列出；与自身比较无变化项
+  *                        GCC和ELF中的代码大小随编译器版本变化，只与两者之间或已知的数据大小比较
+  */
+static int Check_MapSize(int argc, char **argv)
+{
+    static const char *const names[] =
+    {
+        "main", "Reset_Handler", "Breath_Tick", "arm_sin_f32", "Key_Table", "sinTable_f32",
+        "tick", "led_state", "uart_rx", "cmd_reply",
+    };
+    static const char title[] = "format keil map: flash 2884 bytes, ram 2216 bytes, 7 modules, 15 symbols\n";
+    MapSize_Image keil, gcc, elf, old, small;
+    MapSize_Symbol small_sym[4];
+    MapSize_Module small_mod[2];
+    FILE *f;
+    const char *out;
+    uint32_t k, bad, over = 0, len;
+    uint8_t where = 0;
+    int fail = 0;
+
+    (void)argc;
+    (void)argv;
+
+    /* Keil：各项按手写夹具中的值 */
+    printf("keil map:\n");
+    fail |= HostCheck_Expect("format", MapSize_CheckLoad("keil_map.txt", &keil, 0), MAPSIZE_FMT_KEIL);
+    fail |= HostCheck_Expect("flash (Total ROM Size)", keil.flash, 2884);
+    fail |= HostCheck_Expect("ram (Total RW Size)", keil.ram, 2216);
+    fail |= HostCheck_Expect("symbols", keil.sym_count, 15);
+    fail |= HostCheck_Expect("modules", keil.mod_count, 7);
+    fail |= HostCheck_Expect("Section/Number skipped", MapSize_CheckSymbol(&keil, "RESET", NULL, NULL) == MAPSIZE_CHECK_NONE
+                             && MapSize_CheckSymbol(&keil, "Region$$Table$$Base", NULL, NULL) == MAPSIZE_CHECK_NONE, 1);
+    fail |= HostCheck_Expect("uart_rx (zero init)", MapSize_CheckSymbol(&keil, "uart_rx", "main.o", &where), 1024);
+    fail |= HostCheck_Expect("  memory", where, MAPSIZE_IN_RAM);
+    fail |= HostCheck_Expect("tick (local .data)", MapSize_CheckSymbol(&keil, "tick", "main.o", &where), 4);
+    fail |= HostCheck_Expect("  memory", where, MAPSIZE_IN_FLASH | MAPSIZE_IN_RAM);
+    fail |= HostCheck_Expect("main (Thumb, odd value)", MapSize_CheckSymbol(&keil, "main", "main.o", &where), 120);
+    fail |= HostCheck_Expect("  memory", where, MAPSIZE_IN_FLASH);
+    fail |= HostCheck_Expect("main.o flash + ram", MapSize_CheckModule(&keil, "main.o"), 188U + 1028U);
+    fail |= HostCheck_Expect("memcpya.o (library member)", MapSize_CheckModule(&keil, "memcpya.o"), 36);
+    fail |= HostCheck_Expect("library summary skipped", MapSize_CheckModule(&keil, "mc_w.l") == MAPSIZE_CHECK_NONE, 1);
+    f = tmpfile();
+    k = (f != NULL) ? MapSize_Flag(&keil, f) : 0;
+    out = (f != NULL) ? MapSize_CheckOutput(f) : "";
+    fail |= HostCheck_Expect("cmsis flagged", k, 4);
+    fail |= HostCheck_Expect("  sinTable_f32 listed", MapSize_CheckCount(out, "cmsis: symbol sinTable_f32"), 1);
+
+    /* 报告 */
+    printf("report:\n");
+    f = tmpfile();
+    if(f != NULL) MapSize_Report(&keil, 3, f);
+    out = (f != NULL) ? MapSize_CheckOutput(f) : "";
+    fail |= HostCheck_Expect("title line", strncmp(out, title, strlen(title)) == 0, 1);
+    fail |= HostCheck_Expect("top 3 incl. sinTable_f32", MapSize_CheckRow(out, "sinTable_f32") != NULL, 1);
+    fail |= HostCheck_Expect("top 3 excl. tick", MapSize_CheckRow(out, "tick") == NULL, 1);
+    MapSize_Init(&small, small_sym, 4, small_mod, 2);
+    fail |= (MapSize_CheckRead("keil_map.txt", &len) != 0);
+    MapSize_Load(&small, mapsize_check_file, len);
+    fail |= HostCheck_Expect("dropped (4 sym, 2 mod)", small.dropped, (15U - 4U) + (7U - 2U));
+    f = tmpfile();
+    if(f != NULL) MapSize_Report(&small, 1, f);
+    out = (f != NULL) ? MapSize_CheckOutput(f) : "";
+    fail |= HostCheck_Expect("  warning printed", MapSize_CheckCount(out, "warning: 16 entries dropped"), 1);
+
+    /* GCC与ELF：同一次链接 */
+    printf("gcc map and elf:\n");
+    fail |= HostCheck_Expect("gcc format", MapSize_CheckLoad("gcc_map.txt", &gcc, 0), MAPSIZE_FMT_GCC);
+    fail |= HostCheck_Expect("elf format", MapSize_CheckLoad("mapsize.elf", &elf, 1), MAPSIZE_FMT_ELF);
+    fail |= HostCheck_Expect("elf flash", elf.flash, gcc.flash);
+    fail |= HostCheck_Expect("elf ram", elf.ram, gcc.ram);
+    fail |= HostCheck_Expect("gcc ram (4 + 4 + 1024 + 160)", gcc.ram, 1192);
+    fail |= HostCheck_Expect("symbols", gcc.sym_count, sizeof(names) / sizeof(names[0]));
+    for(k = 0, bad = 0; k < sizeof(names) / sizeof(names[0]); k++) {
+        len = MapSize_CheckSymbol(&gcc, names[k], NULL, NULL);
+        if(len == MAPSIZE_CHECK_NONE || len != MapSize_CheckSymbol(&elf, names[k], NULL, NULL)) {
+            printf("  %s: gcc %ld, elf %ld\n", names[k], (long)len, (long)MapSize_CheckSymbol(&elf, names[k], NULL, NULL));
+            bad++;
+        }
+    }
+    fail |= HostCheck_Expect("size mismatches", bad, 0);
+    fail |= HostCheck_Expect("gcc led_state (.data)", MapSize_CheckSymbol(&gcc, "led_state", "breath.o", &where), 4);
+    fail |= HostCheck_Expect("  memory", where, MAPSIZE_IN_FLASH | MAPSIZE_IN_RAM);
+    fail |= HostCheck_Expect("elf cmd_reply in breath.c", MapSize_CheckSymbol(&elf, "cmd_reply", "breath.c", &where), 160);
+    fail |= HostCheck_Expect("  memory", where, MAPSIZE_IN_RAM);
+    fail |= HostCheck_Expect("elf global uart_rx in ?", MapSize_CheckSymbol(&elf, "uart_rx", "?", NULL), 1024);
+    fail |= (MapSize_CheckRead("mapsize.elf", &len) != 0);
+    MapSize_Init(&small, small_sym, 4, small_mod, 2);
+    fail |= HostCheck_Expect("truncated elf rejected", MapSize_Load(&small, mapsize_check_file, 64), MAPSIZE_FMT_NONE);
+    mapsize_check_file[4] = 2U;                                    /* ELFCLASS64 */
+    MapSize_Init(&small, small_sym, 4, small_mod, 2);
+    fail |= HostCheck_Expect("elf64 rejected", MapSize_Load(&small, mapsize_check_file, len), MAPSIZE_FMT_NONE);
+    fail |= HostCheck_Expect("unknown text rejected",
+                             MapSize_Load(&small, (const uint8_t *)"no map here\n", 12), MAPSIZE_FMT_NONE);
+
+    /* 预算 */
+    printf("check:\n");
+    out = MapSize_CheckBudget(&keil, "budget.txt", &over);
+    fail |= HostCheck_Expect("keil over budget", (out != NULL) ? over : MAPSIZE_CHECK_NONE, 5);
+    fail |= HostCheck_Expect("  not linked", (out != NULL) ? MapSize_CheckCount(out, "not linked") : 0, 2);
+    fail |= HostCheck_Expect("  unrecognised lines", (out != NULL) ? MapSize_CheckCount(out, "unrecognised") : 0, 1);
+    out = MapSize_CheckBudget(&gcc, "budget.txt", &over);
+    fail |= HostCheck_Expect("gcc over budget", (out != NULL) ? over : MAPSIZE_CHECK_NONE, 4);
+    out = MapSize_CheckBudget(&elf, "budget.txt", &over);
+    fail |= HostCheck_Expect("elf over budget", (out != NULL) ? over : MAPSIZE_CHECK_NONE, 3);
+    out = MapSize_CheckBudget(&keil, "/SizeBudget.txt", &over);
+    fail |= HostCheck_Expect("SizeBudget.txt unrecognised",
+                             (out != NULL) ? MapSize_CheckCount(out, "unrecognised") : MAPSIZE_CHECK_NONE, 0);
+
+    /* 比较：旧版本uart_rx为512字节，没有arm_common_tables.o */
+    printf("diff:\n");
+    fail |= HostCheck_Expect("old format", MapSize_CheckLoad("gcc_old_map.txt", &old, 1), MAPSIZE_FMT_GCC);
+    out = MapSize_CheckDiff(&old, &gcc);
+    fail |= MapSize_CheckDelta(out, "uart_rx", "main.o", 512, 1024);
+    fail |= MapSize_CheckDelta(out, "sinTable_f32", "arm_common_tables.o", 0, 2052);
+    fail |= MapSize_CheckDelta(out, "arm_common_tables.o", NULL, 0,
+                               MapSize_CheckModule(&gcc, "arm_common_tables.o"));
+    fail |= HostCheck_Expect("unchanged not listed", (out != NULL) && MapSize_CheckRow(out, "Key_Table") == NULL
+                                                      && MapSize_CheckRow(out, "breath.o") == NULL, 1);
+    fail |= HostCheck_Expect("ram delta", (out != NULL) ? MapSize_CheckCount(out, "(+512)\n") : 0, 1);
+    out = MapSize_CheckDiff(&gcc, &old);
+    fail |= MapSize_CheckDelta(out, "sinTable_f32", "arm_common_tables.o", 2052, 0);
+    fail |= MapSize_CheckDelta(out, "arm_common_tables.o", NULL,
+                               MapSize_CheckModule(&gcc, "arm_common_tables.o"), 0);
+    out = MapSize_CheckDiff(&gcc, &gcc);
+    /* 总量2行，模块和符号各一个空行加表头 */
+    fail |= HostCheck_Expect("self diff lines", (out != NULL) ? MapSize_CheckCount(out, "\n") : 0, 6);
+    fail |= HostCheck_Expect("  totals unchanged", (out != NULL) ? MapSize_CheckCount(out, "(+0)") : 0, 2);
+    return fail;
+}
+
+/* ---------------------------------- 入口 ---------------------------------- */
+
+static const HostCheck_Item hostcheck_items[] =
+{
+    { "bus",  Check_Bus,  "bus reads/writes of every init path" },
+    { "soak", Check_Soak, "[ticks] Delay_Until drift over CYCCNT wraps, one-shot overshoot" },
+    { "fleet", Check_Fleet, "[boards] [threads] [ms] per-board RegSim firmware loops on a work-stealing pool" },
+    { "ws2812", Check_Ws2812, "TIM2/DMA1 models: bit-exact WS2812 waveform of 1000 pixels, frame time" },
+    { "shift595", Check_Shift595, "TIM5/SPI2/DMA1 models: 74HC595 BAM on-time per frame, frame swap, refresh vs chain" },
+    { "matrix", Check_Matrix, "TIM7/GPIO models: matrix on-time per pixel, one row at a time, refresh, ISR cost" },
+    { "charlie", Check_Charlie, "TIM6/GPIO models: charlieplex on-time per LED, ghosting, refresh, slot ISR cost" },
+    { "uart", Check_Uart, "USART1/DMA2 models: max-baud RX throughput and integrity, command->reply latency" },
+    { "device", Check_Device, "capability table vs compile-time macros, flash WS and APB dividers at each clock" },
+    { "flicker", Check_Flicker, "known waveforms through Flicker: jitter, duty error, flicker index, steps, zero-length periods" },
+    { "pwmstagger", Check_PwmStagger, "aligned vs staggered PWM load, peak = ceil(sum/period), BSRR table replayed on GPIO" },
+    { "anim", Check_Anim, "Anim encode/decode round trip, truncated data rejected, AnimDemo decode bench" },
+    { "pool", Check_Pool, "Pool exhaustion, used/peak/fail stats, fallback, foreign and misaligned free rejected" },
+    { "arena", Check_Arena, "Arena alignment, exhaustion, watermarks, ARENA_POISON use-after-reset detection" },
+    { "mapsize", Check_MapSize, "MapSize on Keil/GCC map and ELF fixtures: sizes, report, budget check, diff" },
+    { "trace", Check_Trace, "[record <file> | diff <golden> <actual> | dump <file>] LED edges vs golden trace" },
+};
+
+#define HOSTCHECK_COUNT                        (sizeof(hostcheck_items) / sizeof(hostcheck_items[0]))
+
+/**
+  * @brief           按名称运行检查项
+  * @param        argc 参数个数
+  * @param        argv 参数
+  * @retval          0=全部通过，1=有检查项失败，2=参数错误
+  */
+int HostCheck_Main(int argc, char **argv)
+{
+    uint32_t i;
+    int ret = 0;
+    int r;
+
+    if(argc < 2 || strcmp(argv[1], "list") == 0) {
+        for(i = 0; i < HOSTCHECK_COUNT; i++) {
+            printf("%-10s %s\n", hostcheck_items[i].name, hostcheck_items[i].help);
+        }
+        return (argc < 2) ? 2 : 0;
+    }
+    for(i = 0; i < HOSTCHECK_COUNT; i++) {
+        if(strcmp(argv[1], "all") != 0 && strcmp(argv[1], hostcheck_items[i].name) != 0) continue;
+        printf("== %s\n", hostcheck_items[i].name);
+        r = (strcmp(argv[1], "all") == 0) ? hostcheck_items[i].run(1, &argv[1])
+                                           : hostcheck_items[i].run(argc - 1, &argv[1]);
+        printf("== %s %s\n", hostcheck_items[i].name, r == 0 ? "PASS" : "FAIL");
+        if(r > ret) ret = r;
+        if(strcmp(argv[1], "all") != 0) return ret;
+    }
+    if(strcmp(argv[1], "all") != 0) {
+        fprintf(stderr, "unknown check: %s\n", argv[1]);
+        return 2;
+    }
+    return ret;
+}
+
+#ifdef HOSTCHECK_MAIN
+/**
+  * @brief           独立程序入口
+  * @param        argc 参数个数
+  * @param        argv 参数
+  * @retval          见HostCheck_Main()
+  */
+int main(int argc, char **argv)
+{
+    return HostCheck_Main(argc, argv);
+}
+#endif
@@ -0,0 +1,277 @@
+/**
+  ************************************************************************************
+  * @file              Key.c
+  * @author         None
+  * @version       V1.2.0
+  * @date            2026-10-17
+  * @brief           关键帧动画引擎源文件
+  *
+  * @details        本文件实现了增量式关键帧插值：
+  *                        1. du = (2^32 - 1) ÷ dur在生成关键帧表时算好，进入一段时u从0开始每tick加du，
+  *                           取u的高16位作为曲线输入，段末直接取终点亮度，不累积舍入误差
+  *                        2. 二次/三次曲线前半段为 2x² / 4x³，后半段与前半段中心对称
+  *                        3. 正弦曲线取Dds_RaisedCosine的前半个周期（129项），9位线性插值
+  *
+  * @note            亮度 = from + span × e ÷ 65536（四舍五入），乘积用64位保存（Cortex-M4上为一条SMULL）
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 增加Key_BreathFrames()
+  *                         - 2026-10-17 V1.2.0 进入一段时从关键帧表取du，段边界上不做除法；增加Key_Prepare()
+  *
+  ************************************************************************************
+  */
+
+#include "Key.h"
+#include "Dds.h"
+
+#define KEY_HALF                                 0x8000U      /* Q16的0.5 */
+#define KEY_ONE                                   0x10000U    /* Q16的1.0 */
+#define KEY_SINE_SHIFT                        9U             /* 进度 >> 9 为表下标（半周期DDS_TABLE_SIZE/2段） */
+
+/**
+  * @brief           进入ch->seg开始的一段
+  * @param        ch 通道状态
+  * @retval          None
+  * @note           长度为0的段（相同时刻的两个关键帧）由调用者跳过
+  */
+static void Key_Enter(Key_Channel *ch)
+{
+    const Key_Frame *a = &ch->keys[ch->seg];
+    const Key_Frame *b = a + 1;
+
+    ch->t = 0;
+    ch->dur = b->time - a->time;
+    ch->u = 0;
+    ch->du = a->du;
+    ch->from = a->level;
+    ch->span = (int32_t)b->level - (int32_t)a->level;
+    ch->ease = a->ease;
+    ch->level = a->level;
+}
+
+/**
+  * @brief           按当前进度计算亮度
+  * @param        ch 通道状态
+  * @retval          亮度（四舍五入）
+  */
+static uint16_t Key_Level(const Key_Channel *ch)
+{
+    int64_t d = (int64_t)ch->span * Key_Ease(ch->ease, ch->u >> 16);
+
+    return (uint16_t)(ch->from + (int32_t)((d + 0x8000) >> 16));
+}
+
+/**
+  * @brief           越过已走完的段
+  * @param        ch 通道状态
+  * @retval          None
+  * @note           走到最后一个关键帧时：循环通道回到第一段，否则结束
+  */
+static void Key_Advance(Key_Channel *ch)
+{
+    while(ch->t >= ch->dur) {
+        if(ch->seg + 2U < ch->count) {
+            ch->seg++;
+        } else if(ch->loop && ch->keys[ch->count - 1U].time > ch->keys[0].time) {
+            ch->seg = 0;
+        } else {
+            ch->level = ch->keys[ch->count - 1U].level;
+            ch->done = 1;
+            return;
+        }
+        Key_Enter(ch);
+    }
+}
+
+/**
+  * @brief           Q16缓动曲线
+  * @param        ease 曲线类型
+  * @param        x 进度（0 ~ 65535）
+  * @retval          曲线值（0 ~ 65536）
+  */
+uint32_t Key_Ease(uint8_t ease, uint32_t x)
+{
+    uint32_t y;
+    uint32_t idx;
+    uint32_t f;
+    uint8_t back = 0;
+
+    switch(ease) {
+        case KEY_EASE_QUAD:
+        case KEY_EASE_CUBIC:
+            /* 后半段：e(x) = 1 - e(1 - x) */
+            if(x >= KEY_HALF) {
+                x = KEY_ONE - x;
+                back = 1;
+            }
+            y = (x * x) >> 15;                                      /* 2x²，x < 0.5时不超过0.5 */
+            if(ease == KEY_EASE_CUBIC) y = (y * x) >> 15;   /* 4x³ */
+            return back ? KEY_ONE - y : y;
+
+        case KEY_EASE_SINE:
+            idx = x >> KEY_SINE_SHIFT;
+            f = x & ((1U << KEY_SINE_SHIFT) - 1U);
+            y = ((uint32_t)Dds_RaisedCosine[idx] * ((1U << KEY_SINE_SHIFT) - f)
+                 + (uint32_t)Dds_RaisedCosine[idx + 1U] * f) >> KEY_SINE_SHIFT;
+            return y << 1;                                              /* Q15 → Q16 */
+
+        case KEY_EASE_STEP:
+            return 0;
+
+        default:
+            return x;
+    }
+}
+
+/**
+  * @brief           按相邻关键帧的时刻填写各段的进度增量du
+  * @param        keys 关键帧表
+  * @param        count 关键帧数
+  * @retval          None
+  */
+void Key_Prepare(Key_Frame *keys, uint16_t count)
+{
+    uint16_t i;
+
+    for(i = 0; i < count; i++) {
+        keys[i].du = (i + 1U < count) ? KEY_DU(keys[i + 1U].time - keys[i].time) : 0;
+    }
+}
+
+/**
+  * @brief           绑定关键帧表并从时刻0开始
+  * @param        ch 通道状态
+  * @param        keys 关键帧表
+  * @param        count 关键帧数
+  * @param        loop 1=循环播放
+  * @retval          None
+  */
+void Key_Bind(Key_Channel *ch, const Key_Frame *keys, uint16_t count, uint8_t loop)
+{
+    ch->keys = keys;
+    ch->count = count;
+    ch->loop = loop;
+    Key_Seek(ch, 0);
+}
+
+/**
+  * @brief           跳到指定时刻
+  * @param        ch 通道状态
+  * @param        time 时刻，单位：tick
+  * @retval          None
+  */
+void Key_Seek(Key_Channel *ch, uint32_t time)
+{
+    uint32_t start;
+    uint32_t period;
+
+    ch->seg = 0;
+    ch->done = 0;
+    if(ch->count < 2U) {
+        ch->level = (ch->count > 0) ? ch->keys[0].level : 0;
+        ch->done = 1;
+        return;
+    }
+
+    /* 时刻换算到关键帧表的时间轴上 */
+    start = ch->keys[0].time;
+    period = ch->keys[ch->count - 1U].time - start;
+    if(ch->loop && period > 0) time %= period;
+    time += start;
+
+    /* 找到包含time的一段 */
+    while(ch->seg + 2U < ch->count && ch->keys[ch->seg + 1U].time <= time) ch->seg++;
+    Key_Enter(ch);
+    ch->t = time - ch->keys[ch->seg].time;
+    if(ch->t >= ch->dur) {
+        Key_Advance(ch);
+        return;
+    }
+    ch->u = ch->du * ch->t;
+    ch->level = Key_Level(ch);
+}
+
+/**
+  * @brief           推进一个tick
+  * @param        ch 通道状态
+  * @retval          当前亮度
+  */
+uint16_t Key_Tick(Key_Channel *ch)
+{
+    if(ch->done) return ch->level;
+
+    if(++ch->t >= ch->dur) {
+        Key_Advance(ch);
+        return ch->level;
+    }
+    ch->u += ch->du;
+    ch->level = Key_Level(ch);
+    return ch->level;
+}
+
+/**
+  * @brief           生成一个呼吸周期的关键帧
+  * @param        keys 输出关键帧表，3项
+  * @param        lo 最暗亮度
+  * @param        hi 最亮亮度
+  * @param        ticks 呼吸周期，单位：tick
+  * @retval          None
+  */
+void Key_BreathFrames(Key_Frame *keys, uint16_t lo, uint16_t hi, uint32_t ticks)
+{
+    keys[0].time = 0;
+    keys[0].level = lo;
+    keys[0].ease = KEY_EASE_SINE;
+    keys[1].time = ticks / 2U;
+    keys[1].level = hi;
+    keys[1].ease = KEY_EASE_SINE;
+    keys[2].time = ticks;
+    keys[2].level = lo;
+    keys[2].ease = KEY_EASE_LINEAR;
+    Key_Prepare(keys, 3);
+}
+
+/**
+  * @brief           初始化引擎
+  * @param        eng 引擎
+  * @param        ch 通道数组
+  * @param        active 活动通道下标表
+  * @param        count 通道数
+  * @retval          None
+  */
+void Key_EngineInit(Key_Engine *eng, Key_Channel *ch, uint16_t *active, uint16_t count)
+{
+    uint16_t i;
+
+    eng->ch = ch;
+    eng->active = active;
+    eng->count = count;
+    eng->n_active = 0;
+    for(i = 0; i < count; i++) {
+        if(!ch[i].done) active[eng->n_active++] = i;
+    }
+}
+
+/**
+  * @brief           所有活动通道推进一个tick
+  * @param        eng 引擎
+  * @retval          仍在播放的通道数
+  * @note           结束的通道用表尾的下标填补，不移动其余元素
+  */
+uint16_t Key_EngineTick(Key_Engine *eng)
+{
+    uint16_t i = 0;
+    Key_Channel *c;
+
+    while(i < eng->n_active) {
+        c = &eng->ch[eng->active[i]];
+        Key_Tick(c);
+        if(c->done) {
+            eng->active[i] = eng->active[--eng->n_active];
+        } else {
+            i++;
+        }
+    }
+    return eng->n_active;
+}
@@ -0,0 +1,1073 @@
+/**
+  ************************************************************************************
+  * @file              MapSize.c
+  * @author         None
+  * @version       V1.0.1
+  * @date            2026-10-17
+  * @brief           映像大小分析工具源文件
+  *
+  * @details        本文件实现了三种输入的解析：
+  *                        1. Keil .map：符号取自Image Symbol Table（跳过Section/Number类型），
+  *                           模块取自Image component sizes的目标文件和库成员表，
+  *                           总量取自Total ROM Size和Total RW Size
+  *                        2. GCC .map：从Linker script and memory map开始，每个输入节为一项
+  *                           （-ffunction-sections/-fdata-sections时即一个符号），过长的节名换行时与下一行合并
+  *                        3. ELF：FUNC/OBJECT符号按所在节的标志分类，总量为所有SHF_ALLOC节之和
+  *                        RAM地址：0x10000000~0x1000FFFF（CCM）和0x20000000~0x3FFFFFFF，
+  *                        Flash地址：0x08000000~0x0FFFFFFF；位于RAM且属于.data的项同时计入Flash
+  *
+  * @note            主机端工具，用到stdio和malloc（只在命令行入口中读取文件）
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.0.1 GCC .map中.text.startup.main等子节取函数名（原为startup.main）
+  *
+  ************************************************************************************
+  */
+
+#include "MapSize.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define MAPSIZE_LINE_MAX                     512U          /* 单行最大长度 */
+#define MAPSIZE_TOKEN_MAX                   16U           /* 单行最多记号数 */
+#define MAPSIZE_DELTA_MAX                   8192U        /* 比较时最多记录的变化项数 */
+#define MAPSIZE_SYM_CAP                       16384U      /* 命令行入口的符号表容量 */
+#define MAPSIZE_MOD_CAP                      1024U        /* 命令行入口的模块表容量 */
+#define MAPSIZE_TOP_DEFAULT               20U           /* 默认列出的项数 */
+
+/**
+  * @brief   比较结果的一项
+  */
+typedef struct
+{
+    const char *name;                                /* 符号名或模块名 */
+    const char *module;                             /* 符号所属模块，模块项为NULL */
+    uint32_t old_size;                               /* 旧大小（模块为Flash + RAM） */
+    uint32_t new_size;                              /* 新大小 */
+} MapSize_Delta;
+
+/* CMSIS-DSP的表和函数：本工程不使用，出现即为误引用 */
+static const char *const mapsize_cmsis[] =
+{
+    "arm_*", "twiddleCoef*", "armBitRevTable*", "armBitRevIndexTable*", "sinTable_*", "cos_factors_*",
+    "realCoefA*", "realCoefB*", "Weights_*", "armRecipTable*", "*arm_common_tables*", "*arm_const_structs*",
+};
+
+#define MAPSIZE_CMSIS_COUNT                (sizeof(mapsize_cmsis) / sizeof(mapsize_cmsis[0]))
+
+static MapSize_Delta mapsize_delta[MAPSIZE_DELTA_MAX];
+
+/**
+  * @brief           地址是否位于RAM
+  * @param        addr 地址
+  * @retval          1=是
+  */
+static uint8_t MapSize_IsRam(uint32_t addr)
+{
+    return (addr >= 0x10000000U && addr < 0x10010000U) || (addr >= 0x20000000U && addr < 0x40000000U);
+}
+
+/**
+  * @brief           地址是否位于Flash
+  * @param        addr 地址
+  * @retval          1=是
+  */
+static uint8_t MapSize_IsFlash(uint32_t addr)
+{
+    return addr >= 0x08000000U && addr < 0x10000000U;
+}
+
+/**
+  * @brief           复制字符串，超长截断
+  * @param        dst 目的缓冲
+  * @param        src 源字符串
+  * @param        len 源字符串长度
+  * @param        max 目的缓冲大小
+  * @retval          None
+  */
+static void MapSize_Copy(char *dst, const char *src, uint32_t len, uint32_t max)
+{
+    if(len >= max) len = max - 1U;
+    memcpy(dst, src, len);
+    dst[len] = '\0';
+}
+
+/**
+  * @brief           路径中的文件名部分
+  * @param        path 路径
+  * @retval          最后一个'/'或'\'之后的部分
+  */
+static const char *MapSize_Base(const char *path)
+{
+    const char *p = path;
+
+    for(; *path; path++) {
+        if(*path == '/' || *path == '\\') p = path + 1;
+    }
+    return p;
+}
+
+/**
+  * @brief           通配符匹配
+  * @param        pat 模式，'*'匹配任意个字符
+  * @param        s 字符串
+  * @retval          1=匹配
+  */
+static uint8_t MapSize_Match(const char *pat, const char *s)
+{
+    if(*pat == '\0') return *s == '\0';
+    if(*pat == '*') {
+        do {
+            if(MapSize_Match(pat + 1, s)) return 1;
+        } while(*s++);
+        return 0;
+    }
+    return *pat == *s && MapSize_Match(pat + 1, s + 1);
+}
+
+/**
+  * @brief           在内容中查找字符串
+  * @param        data 内容
+  * @param        len 内容长度
+  * @param        key 字符串
+  * @retval          1=找到
+  * @note           不用memmem()：MinGW和MSVC没有
+  */
+static uint8_t MapSize_Find(const char *data, uint32_t len, const char *key)
+{
+    uint32_t n = (uint32_t)strlen(key);
+    uint32_t i;
+
+    for(i = 0; i + n <= len; i++) {
+        if(data[i] == key[0] && memcmp(data + i, key, n) == 0) return 1;
+    }
+    return 0;
+}
+
+/**
+  * @brief           读取一行
+  * @param        p 当前位置
+  * @param        end 内容结束位置
+  * @param        buf 行缓冲（去掉行尾的\r\n，超长截断）
+  * @retval          消耗的字节数（含换行符）
+  */
+static uint32_t MapSize_Line(const char *p, const char *end, char *buf)
+{
+    const char *eol = memchr(p, '\n', (size_t)(end - p));
+    uint32_t len;
+
+    if(eol == NULL) eol = end;
+    len = (uint32_t)(eol - p);
+    MapSize_Copy(buf, p, (len > 0 && p[len - 1U] == '\r') ? len - 1U : len, MAPSIZE_LINE_MAX);
+    return len + ((eol < end) ? 1U : 0U);
+}
+
+/**
+  * @brief           按空白拆分记号（原地写入结束符）
+  * @param        line 行
+  * @param        tok 记号指针数组
+  * @retval          记号数（最多MAPSIZE_TOKEN_MAX）
+  */
+static uint32_t MapSize_Split(char *line, char **tok)
+{
+    uint32_t n = 0;
+
+    while(*line && n < MAPSIZE_TOKEN_MAX) {
+        while(*line == ' ' || *line == '\t') *line++ = '\0';
+        if(*line == '\0') break;
+        tok[n++] = line;
+        while(*line && *line != ' ' && *line != '\t') line++;
+    }
+    return n;
+}
+
+/**
+  * @brief           记号是否为0x开头的十六进制数
+  * @param        t 记号
+  * @retval          1=是
+  */
+static uint8_t MapSize_IsHex(const char *t)
+{
+    return t[0] == '0' && (t[1] == 'x' || t[1] == 'X');
+}
+
+/**
+  * @brief           记号是否为十进制数
+  * @param        t 记号
+  * @retval          1=是
+  */
+static uint8_t MapSize_IsNum(const char *t)
+{
+    if(*t == '\0') return 0;
+    for(; *t; t++) {
+        if(*t < '0' || *t > '9') return 0;
+    }
+    return 1;
+}
+
+/**
+  * @brief           查找模块
+  * @param        img 映像
+  * @param        name 模块名
+  * @retval          模块，NULL=不存在
+  */
+static MapSize_Module *MapSize_FindModule(const MapSize_Image *img, const char *name)
+{
+    uint32_t i;
+
+    for(i = 0; i < img->mod_count; i++) {
+        if(strcmp(img->mod[i].name, name) == 0) return &img->mod[i];
+    }
+    return NULL;
+}
+
+/**
+  * @brief           查找或新建模块
+  * @param        img 映像
+  * @param        name 模块名
+  * @param        len 模块名长度
+  * @retval          模块，NULL=模块表已满
+  */
+static MapSize_Module *MapSize_AddModule(MapSize_Image *img, const char *name, uint32_t len)
+{
+    char key[MAPSIZE_MODULE_MAX];
+    MapSize_Module *m;
+
+    MapSize_Copy(key, name, len, sizeof(key));
+    m = MapSize_FindModule(img, key);
+    if(m != NULL) return m;
+    if(img->mod_count >= img->mod_cap) {
+        img->dropped++;
+        return NULL;
+    }
+    m = &img->mod[img->mod_count++];
+    strcpy(m->name, key);
+    m->flash = 0;
+    m->ram = 0;
+    return m;
+}
+
+/**
+  * @brief           记录一项占用
+  * @param        img 映像
+  * @param        name 符号名
+  * @param        module 模块名
+  * @param        module_len 模块名长度
+  * @param        addr 地址
+  * @param        size 大小
+  * @param        where MAPSIZE_IN_FLASH | MAPSIZE_IN_RAM
+  * @param        totals 1=同时计入模块和总量（GCC/ELF），0=只记录符号（Keil的模块和总量另有来源）
+  * @retval          None
+  * @note           同一模块中的同名项合并（GCC中不带后缀的.text等节）
+  */
+static void MapSize_Add(MapSize_Image *img, const char *name, const char *module, uint32_t module_len,
+                        uint32_t addr, uint32_t size, uint8_t where, uint8_t totals)
+{
+    char mod[MAPSIZE_MODULE_MAX];
+    MapSize_Symbol *s;
+    MapSize_Module *m;
+    uint32_t i;
+
+    MapSize_Copy(mod, module, module_len, sizeof(mod));
+    if(totals) {
+        m = MapSize_AddModule(img, mod, (uint32_t)strlen(mod));
+        if(m != NULL) {
+            if(where & MAPSIZE_IN_FLASH) m->flash += size;
+            if(where & MAPSIZE_IN_RAM) m->ram += size;
+        }
+        if(where & MAPSIZE_IN_FLASH) img->flash += size;
+        if(where & MAPSIZE_IN_RAM) img->ram += size;
+    }
+
+    for(i = 0; i < img->sym_count; i++) {
+        s = &img->sym[i];
+        if(s->where == where && strcmp(s->module, mod) == 0 && strncmp(s->name, name, MAPSIZE_NAME_MAX - 1U) == 0) {
+            s->size += size;
+            return;
+        }
+    }
+    if(img->sym_count >= img->sym_cap) {
+        img->dropped++;
+        return;
+    }
+    s = &img->sym[img->sym_count++];
+    MapSize_Copy(s->name, name, (uint32_t)strlen(name), sizeof(s->name));
+    strcpy(s->module, mod);
+    s->addr = addr;
+    s->size = size;
+    s->where = where;
+}
+
+/**
+  * @brief           解析Keil .map
+  * @param        img 映像
+  * @param        p 内容
+  * @param        end 内容结束位置
+  * @retval          None
+  */
+static void MapSize_LoadKeil(MapSize_Image *img, const char *p, const char *end)
+{
+    char line[MAPSIZE_LINE_MAX];
+    char *t[MAPSIZE_TOKEN_MAX];
+    const char *obj;
+    const char *paren;
+    MapSize_Module *m;
+    uint32_t n;
+    uint32_t v;
+    uint32_t i;
+    uint32_t addr;
+    uint32_t size;
+    uint8_t where;
+    uint8_t state = 0;                               /* 1=符号表，2=模块大小表 */
+    uint8_t table = 0;                               /* 1=当前为目标文件或库成员表 */
+
+    while(p < end) {
+        p += MapSize_Line(p, end, line);
+
+        if(strstr(line, "Image Symbol Table")) { state = 1; continue; }
+        if(strstr(line, "Memory Map of the image")) { state = 0; continue; }
+        if(strstr(line, "Image component sizes")) { state = 2; continue; }
+        if(strstr(line, "Total ROM Size") && (paren = strchr(line, ')')) != NULL) {
+            img->flash = (uint32_t)strtoul(paren + 1, NULL, 10);
+            continue;
+        }
+        if(strstr(line, "Total RW") && strstr(line, "Size") && (paren = strchr(line, ')')) != NULL) {
+            img->ram = (uint32_t)strtoul(paren + 1, NULL, 10);
+            continue;
+        }
+
+        if(state == 2) {
+            if(strstr(line, "Object Name") || strstr(line, "Library Member Name")) { table = 1; continue; }
+            if(strstr(line, "Code (inc. data)")) { table = 0; continue; }
+            n = MapSize_Split(line, t);
+            if(!table || n < 7U || t[6][0] == '(' || strcmp(t[n - 1U], "Totals") == 0) continue;
+            for(i = 0; i < 6U && MapSize_IsNum(t[i]); i++);
+            if(i < 6U) continue;
+            m = MapSize_AddModule(img, t[6], (uint32_t)strlen(t[6]));
+            if(m == NULL) continue;
+            /* Code、inc. data、RO Data、RW Data、ZI Data、Debug */
+            m->flash += (uint32_t)(strtoul(t[0], NULL, 10) + strtoul(t[2], NULL, 10) + strtoul(t[3], NULL, 10));
+            m->ram += (uint32_t)(strtoul(t[3], NULL, 10) + strtoul(t[4], NULL, 10));
+            continue;
+        }
+        if(state != 1) continue;
+
+        /* 名称  值  [Ov]  类型  大小  目标文件(节) */
+        n = MapSize_Split(line, t);
+        for(v = 1; v < n && !(MapSize_IsHex(t[v]) && strlen(t[v]) == 10U); v++);
+        if(v + 3U >= n) continue;
+        i = v + 1U;
+        if(strcmp(t[i], "Section") == 0 || strcmp(t[i], "Number") == 0) continue;
+        if(strcmp(t[i], "Thumb") == 0 || strcmp(t[i], "ARM") == 0) i++;
+        i++;
+        if(i + 1U >= n || !MapSize_IsNum(t[i])) continue;
+        size = (uint32_t)strtoul(t[i], NULL, 10);
+        obj = t[i + 1U];
+        addr = (uint32_t)strtoul(t[v], NULL, 16) & ~1U;
+        if(size == 0) continue;
+        if(MapSize_IsRam(addr)) {
+            where = MAPSIZE_IN_RAM | (strstr(obj, "(.data") ? MAPSIZE_IN_FLASH : 0U);
+        } else if(MapSize_IsFlash(addr)) {
+            where = MAPSIZE_IN_FLASH;
+        } else {
+            continue;
+        }
+        paren = strchr(obj, '(');
+        MapSize_Add(img, t[0], obj, paren ? (uint32_t)(paren - obj) : (uint32_t)strlen(obj), addr, size, where, 0);
+    }
+}
+
+/**
+  * @brief           GCC输入节名对应的符号名
+  * @param        name 节名
+  * @retval          .text.Breath_Tick → Breath_Tick；不带后缀的节（.text、COMMON等）返回节名
+  * @note           优化时GCC把main、冷热函数放在.text.startup.、.text.unlikely.等子节中
+  */
+static const char *MapSize_GccSymbol(const char *name)
+{
+    static const char *const sub[] = { ".text.startup.", ".text.unlikely.", ".text.hot.", ".text.exit." };
+    const char *sym;
+    uint32_t n;
+    uint32_t i;
+
+    if(name[0] != '.') return name;
+    for(i = 0; i < sizeof(sub) / sizeof(sub[0]); i++) {
+        n = (uint32_t)strlen(sub[i]);
+        if(strncmp(name, sub[i], n) == 0 && name[n] != '\0') return name + n;
+    }
+    sym = strchr(name + 1, '.');
+    return sym ? sym + 1 : name;
+}
+
+/**
+  * @brief           解析GCC .map
+  * @param        img 映像
+  * @param        p 内容
+  * @param        end 内容结束位置
+  * @retval          None
+  */
+static void MapSize_LoadGcc(MapSize_Image *img, const char *p, const char *end)
+{
+    char line[MAPSIZE_LINE_MAX];
+    char pending[MAPSIZE_LINE_MAX];
+    char out_sec[MAPSIZE_NAME_MAX] = "";
+    char *t[MAPSIZE_TOKEN_MAX];
+    const char *name;
+    const char *mod;
+    uint32_t n;
+    uint32_t addr;
+    uint32_t size;
+    uint8_t where;
+    uint8_t state = 0;
+
+    pending[0] = '\0';
+    while(p < end) {
+        p += MapSize_Line(p, end, line);
+        if(!state) {
+            state = (strstr(line, "Linker script and memory map") != NULL);
+            continue;
+        }
+        if(line[0] != ' ') {
+            /* 输出节：记录节名，节内各项据此区分.data */
+            pending[0] = '\0';
+            if(line[0] == '.' || line[0] == '/') {
+                n = MapSize_Split(line, t);
+                MapSize_Copy(out_sec, t[0], (uint32_t)strlen(t[0]), sizeof(out_sec));
+            }
+            continue;
+        }
+
+        n = MapSize_Split(line, t);
+        if(n == 0) continue;
+        if(pending[0]) {
+            /* 上一行只有节名 */
+            if(n < 3U || !MapSize_IsHex(t[0]) || !MapSize_IsHex(t[1])) {
+                pending[0] = '\0';
+                continue;
+            }
+            name = pending;
+            addr = (uint32_t)strtoul(t[0], NULL, 16);
+            size = (uint32_t)strtoul(t[1], NULL, 16);
+            mod = t[2];
+        } else if(t[0][0] == '.' || strcmp(t[0], "COMMON") == 0 || strcmp(t[0], "*fill*") == 0) {
+            if(n == 1U) {
+                MapSize_Copy(pending, t[0], (uint32_t)strlen(t[0]), sizeof(pending));
+                continue;
+            }
+            if(n < 3U || !MapSize_IsHex(t[1]) || !MapSize_IsHex(t[2])) continue;
+            name = t[0];
+            addr = (uint32_t)strtoul(t[1], NULL, 16);
+            size = (uint32_t)strtoul(t[2], NULL, 16);
+            mod = (n > 3U) ? t[3] : "*fill*";
+        } else {
+            continue;
+        }
+
+        if(size > 0 && MapSize_IsRam(addr)) {
+            where = MAPSIZE_IN_RAM;
+            if(strncmp(out_sec, ".data", 5) == 0 || strncmp(name, ".data", 5) == 0) where |= MAPSIZE_IN_FLASH;
+        } else if(size > 0 && MapSize_IsFlash(addr)) {
+            where = MAPSIZE_IN_FLASH;
+        } else {
+            where = 0;
+        }
+        if(where && strcmp(name, "*fill*") == 0) {
+            /* 对齐填充只计入总量 */
+            if(where & MAPSIZE_IN_FLASH) img->flash += size;
+            if(where & MAPSIZE_IN_RAM) img->ram += size;
+        } else if(where) {
+            mod = MapSize_Base(mod);
+            MapSize_Add(img, MapSize_GccSymbol(name), mod, (uint32_t)strlen(mod), addr, size, where, 1);
+        }
+        pending[0] = '\0';
+    }
+}
+
+/**
+  * @brief           读16位小端数
+  * @param        p 地址
+  * @retval          数值
+  */
+static uint32_t MapSize_Get16(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8);
+}
+
+/**
+  * @brief           读32位小端数
+  * @param        p 地址
+  * @retval          数值
+  */
+static uint32_t MapSize_Get32(const uint8_t *p)
+{
+    return MapSize_Get16(p) | (MapSize_Get16(p + 2) << 16);
+}
+
+/**
+  * @brief           解析ELF32（小端）
+  * @param        img 映像
+  * @param        data 文件内容
+  * @param        len 文件长度
+  * @retval          0=成功，1=格式错误
+  */
+static uint8_t MapSize_LoadElf(MapSize_Image *img, const uint8_t *data, uint32_t len)
+{
+    const uint8_t *sh;
+    const uint8_t *sec;
+    const uint8_t *sym;
+    const char *strtab;
+    const char *file = "?";
+    const char *name;
+    uint32_t shoff = MapSize_Get32(data + 32);
+    uint32_t shentsize = MapSize_Get16(data + 46);
+    uint32_t shnum = MapSize_Get16(data + 48);
+    uint32_t i;
+    uint32_t k;
+    uint32_t flags;
+    uint32_t off;
+    uint32_t size;
+    uint32_t str_off;
+    uint32_t str_size;
+    uint32_t shndx;
+    uint8_t type;
+    uint8_t where;
+
+    if(shentsize < 40U || shoff > len || (uint64_t)shnum * shentsize > len - shoff) return 1;
+    sh = data + shoff;
+
+    for(i = 0; i < shnum; i++) {
+        sec = sh + i * shentsize;
+        flags = MapSize_Get32(sec + 8);
+        size = MapSize_Get32(sec + 20);
+        /* SHF_ALLOC = 2，SHF_WRITE = 1，SHT_NOBITS = 8 */
+        if((flags & 2U) && size > 0) {
+            if(MapSize_Get32(sec + 4) != 8U) img->flash += size;
+            if(flags & 1U) img->ram += size;
+        }
+    }
+
+    for(i = 0; i < shnum; i++) {
+        sec = sh + i * shentsize;
+        if(MapSize_Get32(sec + 4) != 2U) continue;                 /* SHT_SYMTAB */
+        off = MapSize_Get32(sec + 16);
+        size = MapSize_Get32(sec + 20);
+        k = MapSize_Get32(sec + 24);
+        if(k >= shnum || off > len || size > len - off) return 1;
+        str_off = MapSize_Get32(sh + k * shentsize + 16);
+        str_size = MapSize_Get32(sh + k * shentsize + 20);
+        if(str_off > len || str_size > len - str_off || str_size == 0) return 1;
+        strtab = (const char *)data + str_off;
+        if(strtab[str_size - 1U] != '\0') return 1;
+
+        for(k = 0; k + 16U <= size; k += 16U) {
+            sym = data + off + k;
+            if(MapSize_Get32(sym) >= str_size) continue;
+            name = strtab + MapSize_Get32(sym);
+            type = sym[12] & 0x0FU;
+            shndx = MapSize_Get16(sym + 14);
+            if(type == 4U) {                                              /* STT_FILE：其后的本地符号属于该文件 */
+                file = MapSize_Base(name);
+                continue;
+            }
+            if((type != 1U && type != 2U) || MapSize_Get32(sym + 8) == 0 || shndx >= shnum) continue;
+            flags = MapSize_Get32(sh + shndx * shentsize + 8);
+            if(!(flags & 2U)) continue;
+            if(MapSize_Get32(sh + shndx * shentsize + 4) == 8U) {
+                where = MAPSIZE_IN_RAM;
+            } else {
+                where = (flags & 1U) ? (MAPSIZE_IN_FLASH | MAPSIZE_IN_RAM) : MAPSIZE_IN_FLASH;
+            }
+            name = name[0] ? name : "?";
+            MapSize_Add(img, name, (sym[12] >> 4) == 0 ? file : "?", (uint32_t)strlen((sym[12] >> 4) == 0 ? file : "?"),
+                        MapSize_Get32(sym + 4) & ~1U, MapSize_Get32(sym + 8), where, 0);
+        }
+    }
+
+    /* 模块按符号累计（ELF中没有逐文件的节大小） */
+    for(i = 0; i < img->sym_count; i++) {
+        MapSize_Module *m = MapSize_AddModule(img, img->sym[i].module, (uint32_t)strlen(img->sym[i].module));
+
+        if(m == NULL) continue;
+        if(img->sym[i].where & MAPSIZE_IN_FLASH) m->flash += img->sym[i].size;
+        if(img->sym[i].where & MAPSIZE_IN_RAM) m->ram += img->sym[i].size;
+    }
+    return 0;
+}
+
+/**
+  * @brief           符号按大小从大到小排序的比较函数
+  * @param        a 符号
+  * @param        b 符号
+  * @retval          比较结果
+  */
+static int MapSize_CmpSymbol(const void *a, const void *b)
+{
+    const MapSize_Symbol *x = (const MapSize_Symbol *)a;
+    const MapSize_Symbol *y = (const MapSize_Symbol *)b;
+
+    if(x->size != y->size) return (x->size < y->size) ? 1 : -1;
+    return strcmp(x->name, y->name);
+}
+
+/**
+  * @brief           模块按Flash + RAM从大到小排序的比较函数
+  * @param        a 模块
+  * @param        b 模块
+  * @retval          比较结果
+  */
+static int MapSize_CmpModule(const void *a, const void *b)
+{
+    const MapSize_Module *x = (const MapSize_Module *)a;
+    const MapSize_Module *y = (const MapSize_Module *)b;
+    uint32_t sx = x->flash + x->ram;
+    uint32_t sy = y->flash + y->ram;
+
+    if(sx != sy) return (sx < sy) ? 1 : -1;
+    return strcmp(x->name, y->name);
+}
+
+/**
+  * @brief           比较项按变化量绝对值从大到小排序的比较函数
+  * @param        a 比较项
+  * @param        b 比较项
+  * @retval          比较结果
+  */
+static int MapSize_CmpDelta(const void *a, const void *b)
+{
+    const MapSize_Delta *x = (const MapSize_Delta *)a;
+    const MapSize_Delta *y = (const MapSize_Delta *)b;
+    int64_t dx = (int64_t)x->new_size - x->old_size;
+    int64_t dy = (int64_t)y->new_size - y->old_size;
+
+    if(dx < 0) dx = -dx;
+    if(dy < 0) dy = -dy;
+    if(dx != dy) return (dx < dy) ? 1 : -1;
+    return strcmp(x->name, y->name);
+}
+
+/**
+  * @brief           存储器标志的文字
+  * @param        where MAPSIZE_IN_FLASH | MAPSIZE_IN_RAM
+  * @retval          "flash" / "ram" / "flash+ram"
+  */
+static const char *MapSize_Where(uint8_t where)
+{
+    if(where == (MAPSIZE_IN_FLASH | MAPSIZE_IN_RAM)) return "flash+ram";
+    return (where & MAPSIZE_IN_RAM) ? "ram" : "flash";
+}
+
+/**
+  * @brief           解析预算文件中的数值
+  * @param        t 记号，十进制或0x十六进制，可带K后缀（×1024）
+  * @retval          数值
+  */
+static uint32_t MapSize_Number(const char *t)
+{
+    char *e;
+    uint32_t v = (uint32_t)strtoul(t, &e, 0);
+
+    return (*e == 'K' || *e == 'k') ? v * 1024U : v;
+}
+
+/**
+  * @brief           符号名对应的总大小
+  * @param        img 映像
+  * @param        name 符号名（多个模块中的同名本地符号合计）
+  * @param        found 输出：是否存在
+  * @retval          大小，单位：字节
+  */
+static uint32_t MapSize_SymbolSize(const MapSize_Image *img, const char *name, uint8_t *found)
+{
+    uint32_t i;
+    uint32_t size = 0;
+
+    *found = 0;
+    for(i = 0; i < img->sym_count; i++) {
+        if(strcmp(img->sym[i].name, name) == 0) {
+            size += img->sym[i].size;
+            *found = 1;
+        }
+    }
+    return size;
+}
+
+/**
+  * @brief           读取整个文件
+  * @param        path 文件路径
+  * @param        len 输出：文件长度
+  * @retval          文件内容（末尾补'\0'），NULL=失败
+  */
+static uint8_t *MapSize_ReadFile(const char *path, uint32_t *len)
+{
+    FILE *f = fopen(path, "rb");
+    uint8_t *buf;
+    long size;
+
+    if(f == NULL) return NULL;
+    fseek(f, 0, SEEK_END);
+    size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    buf = (size >= 0) ? (uint8_t *)malloc((size_t)size + 1U) : NULL;
+    if(buf != NULL && fread(buf, 1, (size_t)size, f) != (size_t)size) {
+        free(buf);
+        buf = NULL;
+    }
+    fclose(f);
+    if(buf != NULL) {
+        buf[size] = '\0';
+        *len = (uint32_t)size;
+    }
+    return buf;
+}
+
+/**
+  * @brief           初始化映像
+  * @param        img 映像
+  * @param        sym 符号表存储
+  * @param        sym_cap 符号表容量
+  * @param        mod 模块表存储
+  * @param        mod_cap 模块表容量
+  * @retval          None
+  */
+void MapSize_Init(MapSize_Image *img, MapSize_Symbol *sym, uint32_t sym_cap,
+                  MapSize_Module *mod, uint32_t mod_cap)
+{
+    img->sym = sym;
+    img->sym_count = 0;
+    img->sym_cap = sym_cap;
+    img->mod = mod;
+    img->mod_count = 0;
+    img->mod_cap = mod_cap;
+    img->flash = 0;
+    img->ram = 0;
+    img->dropped = 0;
+    img->format = MAPSIZE_FMT_NONE;
+}
+
+/**
+  * @brief           解析.map或ELF文件内容
+  * @param        img 映像
+  * @param        data 文件内容
+  * @param        len 文件长度
+  * @retval          MAPSIZE_FMT_xxx
+  */
+uint8_t MapSize_Load(MapSize_Image *img, const uint8_t *data, uint32_t len)
+{
+    const char *text = (const char *)data;
+
+    if(len >= 52U && memcmp(data, "\177ELF", 4) == 0) {
+        if(data[4] != 1U || data[5] != 1U || MapSize_LoadElf(img, data, len)) return MAPSIZE_FMT_NONE;
+        img->format = MAPSIZE_FMT_ELF;
+    } else if(MapSize_Find(text, len, "Image Symbol Table") || MapSize_Find(text, len, "Image component sizes")) {
+        MapSize_LoadKeil(img, text, text + len);
+        img->format = MAPSIZE_FMT_KEIL;
+    } else if(MapSize_Find(text, len, "Linker script and memory map")) {
+        MapSize_LoadGcc(img, text, text + len);
+        img->format = MAPSIZE_FMT_GCC;
+    } else {
+        return MAPSIZE_FMT_NONE;
+    }
+
+    qsort(img->sym, img->sym_count, sizeof(MapSize_Symbol), MapSize_CmpSymbol);
+    qsort(img->mod, img->mod_count, sizeof(MapSize_Module), MapSize_CmpModule);
+    return img->format;
+}
+
+/**
+  * @brief           输出占用报告
+  * @param        img 映像
+  * @param        top 模块和符号各列出的项数
+  * @param        out 输出文件
+  * @retval          None
+  */
+void MapSize_Report(const MapSize_Image *img, uint32_t top, FILE *out)
+{
+    static const char *const fmt[] = { "?", "keil map", "gcc map", "elf" };
+    uint32_t i;
+
+    fprintf(out, "format %s: flash %u bytes, ram %u bytes, %u modules, %u symbols\n",
+            fmt[img->format & 3U], img->flash, img->ram, img->mod_count, img->sym_count);
+    if(img->dropped) fprintf(out, "warning: %u entries dropped (table full)\n", img->dropped);
+
+    fprintf(out, "\n%-40s %10s %10s\n", "module", "flash", "ram");
+    for(i = 0; i < img->mod_count && i < top; i++) {
+        fprintf(out, "%-40s %10u %10u\n", img->mod[i].name, img->mod[i].flash, img->mod[i].ram);
+    }
+
+    fprintf(out, "\n%-40s %-24s %8s  %s\n", "symbol", "module", "size", "memory");
+    for(i = 0; i < img->sym_count && i < top; i++) {
+        fprintf(out, "%-40s %-24s %8u  %s\n", img->sym[i].name, img->sym[i].module, img->sym[i].size,
+                MapSize_Where(img->sym[i].where));
+    }
+}
+
+/**
+  * @brief           列出被链接进来的CMSIS-DSP表和函数
+  * @param        img 映像
+  * @param        out 输出文件
+  * @retval          匹配数
+  */
+uint32_t MapSize_Flag(const MapSize_Image *img, FILE *out)
+{
+    uint32_t count = 0;
+    uint32_t i;
+    uint32_t k;
+
+    for(i = 0; i < img->mod_count; i++) {
+        for(k = 0; k < MAPSIZE_CMSIS_COUNT && !MapSize_Match(mapsize_cmsis[k], img->mod[i].name); k++);
+        if(k < MAPSIZE_CMSIS_COUNT) {
+            fprintf(out, "cmsis: module %s (flash %u, ram %u)\n", img->mod[i].name, img->mod[i].flash, img->mod[i].ram);
+            count++;
+        }
+    }
+    for(i = 0; i < img->sym_count; i++) {
+        for(k = 0; k < MAPSIZE_CMSIS_COUNT && !MapSize_Match(mapsize_cmsis[k], img->sym[i].name); k++);
+        if(k < MAPSIZE_CMSIS_COUNT) {
+            fprintf(out, "cmsis: symbol %s (%s, %u bytes)\n", img->sym[i].name, img->sym[i].module, img->sym[i].size);
+            count++;
+        }
+    }
+    return count;
+}
+
+/**
+  * @brief           按预算检查
+  * @param        img 映像
+  * @param        budget 预算文件内容
+  * @param        len 预算文件长度
+  * @param        out 输出文件
+  * @retval          超出预算的项数
+  */
+uint32_t MapSize_Check(const MapSize_Image *img, const char *budget, uint32_t len, FILE *out)
+{
+    char line[MAPSIZE_LINE_MAX];
+    char *t[MAPSIZE_TOKEN_MAX];
+    const char *p = budget;
+    const char *end = budget + len;
+    const MapSize_Module *m;
+    uint32_t over = 0;
+    uint32_t line_no = 0;
+    uint32_t n;
+    uint32_t i;
+    uint32_t lim;
+    uint32_t used;
+    uint8_t found;
+
+    while(p < end) {
+        p += MapSize_Line(p, end, line);
+        line_no++;
+        if(strchr(line, '#')) *strchr(line, '#') = '\0';
+        n = MapSize_Split(line, t);
+        if(n == 0) continue;
+
+        if((strcmp(t[0], "flash") == 0 || strcmp(t[0], "ram") == 0) && n == 2U) {
+            lim = MapSize_Number(t[1]);
+            used = (t[0][0] == 'f') ? img->flash : img->ram;
+            fprintf(out, "%-4s %-8s %-32s %8u / %8u\n", (used > lim) ? "OVER" : "ok", t[0], "total", used, lim);
+            over += (used > lim);
+        } else if(strcmp(t[0], "module") == 0 && n == 4U) {
+            m = MapSize_FindModule(img, t[1]);
+            if(m == NULL) {
+                fprintf(out, "%-4s %-8s %-32s not linked\n", "--", "module", t[1]);
+                continue;
+            }
+            lim = MapSize_Number(t[2]);
+            fprintf(out, "%-4s %-8s %-32s %8u / %8u\n", (m->flash > lim) ? "OVER" : "ok", "flash", t[1], m->flash, lim);
+            over += (m->flash > lim);
+            lim = MapSize_Number(t[3]);
+            fprintf(out, "%-4s %-8s %-32s %8u / %8u\n", (m->ram > lim) ? "OVER" : "ok", "ram", t[1], m->ram, lim);
+            over += (m->ram > lim);
+        } else if(strcmp(t[0], "symbol") == 0 && n == 3U) {
+            used = MapSize_SymbolSize(img, t[1], &found);
+            if(!found) {
+                fprintf(out, "%-4s %-8s %-32s not linked\n", "--", "symbol", t[1]);
+                continue;
+            }
+            lim = MapSize_Number(t[2]);
+            fprintf(out, "%-4s %-8s %-32s %8u / %8u\n", (used > lim) ? "OVER" : "ok", "symbol", t[1], used, lim);
+            over += (used > lim);
+        } else if(strcmp(t[0], "forbid") == 0 && n == 2U) {
+            for(i = 0; i < img->sym_count; i++) {
+                if(MapSize_Match(t[1], img->sym[i].name)) {
+                    fprintf(out, "%-4s %-8s %-32s %8u bytes in %s\n", "OVER", "forbid", img->sym[i].name,
+                            img->sym[i].size, img->sym[i].module);
+                    over++;
+                }
+            }
+            for(i = 0; i < img->mod_count; i++) {
+                if(MapSize_Match(t[1], img->mod[i].name)) {
+                    fprintf(out, "%-4s %-8s %-32s linked\n", "OVER", "forbid", img->mod[i].name);
+                    over++;
+                }
+            }
+        } else {
+            fprintf(out, "budget line %u: unrecognised\n", line_no);
+            over++;
+        }
+    }
+    fprintf(out, "%u item(s) over budget\n", over);
+    return over;
+}
+
+/**
+  * @brief           比较两次构建
+  * @param        old_img 旧映像
+  * @param        new_img 新映像
+  * @param        top 模块和符号各列出的项数
+  * @param        out 输出文件
+  * @retval          None
+  */
+void MapSize_Diff(const MapSize_Image *old_img, const MapSize_Image *new_img, uint32_t top, FILE *out)
+{
+    const MapSize_Module *m;
+    const MapSize_Symbol *s;
+    MapSize_Delta *d;
+    uint32_t n = 0;
+    uint32_t i;
+    uint32_t k;
+    uint32_t shown;
+
+    fprintf(out, "flash %u -> %u (%+lld)\n", old_img->flash, new_img->flash,
+            (long long)new_img->flash - (long long)old_img->flash);
+    fprintf(out, "ram   %u -> %u (%+lld)\n", old_img->ram, new_img->ram,
+            (long long)new_img->ram - (long long)old_img->ram);
+
+    /* 模块：新映像中的每个模块，加上只在旧映像中的模块 */
+    for(i = 0; i < new_img->mod_count && n < MAPSIZE_DELTA_MAX; i++) {
+        m = MapSize_FindModule(old_img, new_img->mod[i].name);
+        d = &mapsize_delta[n++];
+        d->name = new_img->mod[i].name;
+        d->module = NULL;
+        d->old_size = m ? m->flash + m->ram : 0;
+        d->new_size = new_img->mod[i].flash + new_img->mod[i].ram;
+    }
+    for(i = 0; i < old_img->mod_count && n < MAPSIZE_DELTA_MAX; i++) {
+        if(MapSize_FindModule(new_img, old_img->mod[i].name)) continue;
+        d = &mapsize_delta[n++];
+        d->name = old_img->mod[i].name;
+        d->module = NULL;
+        d->old_size = old_img->mod[i].flash + old_img->mod[i].ram;
+        d->new_size = 0;
+    }
+    qsort(mapsize_delta, n, sizeof(MapSize_Delta), MapSize_CmpDelta);
+    fprintf(out, "\n%-40s %10s %10s %10s\n", "module (flash+ram)", "old", "new", "delta");
+    for(i = 0, shown = 0; i < n && shown < top; i++) {
+        if(mapsize_delta[i].old_size == mapsize_delta[i].new_size) continue;
+        fprintf(out, "%-40s %10u %10u %+10lld\n", mapsize_delta[i].name, mapsize_delta[i].old_size,
+                mapsize_delta[i].new_size, (long long)mapsize_delta[i].new_size - (long long)mapsize_delta[i].old_size);
+        shown++;
+    }
+
+    /* 符号：按 (名称, 模块) 配对 */
+    n = 0;
+    for(i = 0; i < new_img->sym_count && n < MAPSIZE_DELTA_MAX; i++) {
+        s = &new_img->sym[i];
+        d = &mapsize_delta[n++];
+        d->name = s->name;
+        d->module = s->module;
+        d->old_size = 0;
+        d->new_size = s->size;
+        for(k = 0; k < old_img->sym_count; k++) {
+            if(strcmp(old_img->sym[k].name, s->name) == 0 && strcmp(old_img->sym[k].module, s->module) == 0) {
+                d->old_size += old_img->sym[k].size;
+            }
+        }
+    }
+    for(i = 0; i < old_img->sym_count && n < MAPSIZE_DELTA_MAX; i++) {
+        s = &old_img->sym[i];
+        for(k = 0; k < new_img->sym_count; k++) {
+            if(strcmp(new_img->sym[k].name, s->name) == 0 && strcmp(new_img->sym[k].module, s->module) == 0) break;
+        }
+        if(k < new_img->sym_count) continue;
+        d = &mapsize_delta[n++];
+        d->name = s->name;
+        d->module = s->module;
+        d->old_size = s->size;
+        d->new_size = 0;
+    }
+    qsort(mapsize_delta, n, sizeof(MapSize_Delta), MapSize_CmpDelta);
+    fprintf(out, "\n%-40s %-24s %8s %8s %8s\n", "symbol", "module", "old", "new", "delta");
+    for(i = 0, shown = 0; i < n && shown < top; i++) {
+        if(mapsize_delta[i].old_size == mapsize_delta[i].new_size) continue;
+        fprintf(out, "%-40s %-24s %8u %8u %+8lld\n", mapsize_delta[i].name, mapsize_delta[i].module,
+                mapsize_delta[i].old_size, mapsize_delta[i].new_size,
+                (long long)mapsize_delta[i].new_size - (long long)mapsize_delta[i].old_size);
+        shown++;
+    }
+}
+
+/**
+  * @brief           命令行入口
+  * @param        argc 参数个数
+  * @param        argv 参数
+  * @retval          0=成功，1=超出预算，2=参数或文件错误
+  */
+int MapSize_Main(int argc, char **argv)
+{
+    static MapSize_Symbol sym[2][MAPSIZE_SYM_CAP];
+    static MapSize_Module mod[2][MAPSIZE_MOD_CAP];
+    MapSize_Image img[2];
+    uint8_t *buf[2] = { NULL, NULL };
+    uint32_t len[2];
+    uint32_t files;
+    uint32_t top = MAPSIZE_TOP_DEFAULT;
+    uint32_t i;
+    int ret = 0;
+
+    if(argc < 3 || (strcmp(argv[1], "report") && strcmp(argv[1], "check") && strcmp(argv[1], "diff"))
+       || (strcmp(argv[1], "report") && argc < 4)) {
+        fprintf(stderr, "usage: mapsize report <map|elf> [N]\n"
+                        "       mapsize check <map|elf> <budget>\n"
+                        "       mapsize diff <old map|elf> <new map|elf> [N]\n");
+        return 2;
+    }
+
+    files = (strcmp(argv[1], "diff") == 0) ? 2U : 1U;
+    if(strcmp(argv[1], "report") == 0 && argc > 3) top = (uint32_t)strtoul(argv[3], NULL, 0);
+    if(files == 2U && argc > 4) top = (uint32_t)strtoul(argv[4], NULL, 0);
+
+    for(i = 0; i < files; i++) {
+        MapSize_Init(&img[i], sym[i], MAPSIZE_SYM_CAP, mod[i], MAPSIZE_MOD_CAP);
+        buf[i] = MapSize_ReadFile(argv[2 + i], &len[i]);
+        if(buf[i] == NULL || MapSize_Load(&img[i], buf[i], len[i]) == MAPSIZE_FMT_NONE) {
+            fprintf(stderr, "mapsize: cannot read %s\n", argv[2 + i]);
+            ret = 2;
+            break;
+        }
+    }
+
+    if(ret == 0) {
+        if(strcmp(argv[1], "report") == 0) {
+            MapSize_Report(&img[0], top, stdout);
+            MapSize_Flag(&img[0], stdout);
+        } else if(strcmp(argv[1], "check") == 0) {
+            free(buf[1]);
+            buf[1] = MapSize_ReadFile(argv[3], &len[1]);
+            if(buf[1] == NULL) {
+                fprintf(stderr, "mapsize: cannot read %s\n", argv[3]);
+                ret = 2;
+            } else {
+                ret = (MapSize_Check(&img[0], (const char *)buf[1], len[1], stdout) > 0) ? 1 : 0;
+            }
+        } else {
+            MapSize_Diff(&img[0], &img[1], top, stdout);
+        }
+    }
+    free(buf[0]);
+    free(buf[1]);
+    return ret;
+}
+
+#ifdef MAPSIZE_MAIN
+/**
+  * @brief           独立程序入口
+  * @param        argc 参数个数
+  * @param        argv 参数
+  * @retval          见MapSize_Main()
+  */
+int main(int argc, char **argv)
+{
+    return MapSize_Main(argc, argv);
+}
+#endif
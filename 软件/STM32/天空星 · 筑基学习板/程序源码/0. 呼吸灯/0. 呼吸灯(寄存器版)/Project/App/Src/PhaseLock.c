@@ -0,0 +1,98 @@
+/**
+  ************************************************************************************
+  * @file              PhaseLock.c
+  * @author         None
+  * @version       V1.0.1
+  * @date            2026-10-17
+  * @brief           呼吸相位同步（锁相环）模块源文件
+  *
+  * @details        本文件实现了二阶锁相环：
+  *                        1. 比例项直接修正相位：phase += err >> kp_shift
+  *                        2. 积分项修正相位增量：inc = base_inc + Σ(err >> ki_shift)，
+  *                           积分值限制在base_inc的 ±1/256 以内（约±3900ppm，远大于晶振误差）
+  *                        3. 积分项只在误差进入锁定窗口后累计：捕获阶段的误差可达半个周期，
+  *                           一个脉冲就能使积分饱和，之后每个呼吸周期的漂移超过锁定窗口，数百个脉冲才能退出；
+  *                           窗口外只靠比例项，±100ppm时稳态误差约为每周期漂移的2倍，仍在窗口内
+  *
+  * @note            无
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.0.1 误差在锁定窗口外时不累计积分项（防止捕获阶段积分饱和）
+  *
+  ************************************************************************************
+  */
+
+#include "PhaseLock.h"
+
+/**
+  * @brief           初始化锁相环
+  * @param        pl 锁相环状态
+  * @param        eff 被同步的呼吸效果
+  * @param        kp_shift 比例项移位数
+  * @param        ki_shift 积分项移位数
+  * @retval          None
+  */
+void PhaseLock_Init(PhaseLock *pl, const Breath_Effect *eff, uint8_t kp_shift, uint8_t ki_shift)
+{
+    pl->base_inc = eff->inc;
+    pl->integ = 0;
+    pl->err = 0;
+    pl->captured = 0;
+    pl->pending = 0;
+    pl->kp_shift = kp_shift;
+    pl->ki_shift = ki_shift;
+    pl->locked = 0;
+    pl->good = 0;
+}
+
+/**
+  * @brief           记录同步脉冲时刻的相位
+  * @param        pl 锁相环状态
+  * @param        phase 脉冲时刻的相位
+  * @retval          None
+  */
+void PhaseLock_Capture(PhaseLock *pl, uint32_t phase)
+{
+    pl->captured = phase;
+    pl->pending = 1;
+}
+
+/**
+  * @brief           处理捕获并修正呼吸效果
+  * @param        pl 锁相环状态
+  * @param        eff 被同步的呼吸效果
+  * @retval          1=处理了一个捕获，0=无捕获
+  */
+uint8_t PhaseLock_Update(PhaseLock *pl, Breath_Effect *eff)
+{
+    int32_t limit = (int32_t)(pl->base_inc >> 8);
+    int32_t err;
+
+    if(!pl->pending) return 0;
+    pl->pending = 0;
+
+    /* 脉冲时刻应处于相位0，捕获值按有符号数解释即为超前量 */
+    err = -(int32_t)pl->captured;
+    pl->err = err;
+
+    /* 比例项：修正相位 */
+    eff->phase += (uint32_t)(err >> pl->kp_shift);
+
+    /* 积分项：修正相位增量，只在锁定窗口内累计 */
+    if(err < (int32_t)PHASELOCK_LOCK_WINDOW && err > -(int32_t)PHASELOCK_LOCK_WINDOW) {
+        pl->integ += err >> pl->ki_shift;
+    }
+    if(pl->integ > limit) pl->integ = limit;
+    if(pl->integ < -limit) pl->integ = -limit;
+    eff->inc = pl->base_inc + (uint32_t)pl->integ;
+
+    /* 锁定判断 */
+    if(err < (int32_t)PHASELOCK_LOCK_WINDOW && err > -(int32_t)PHASELOCK_LOCK_WINDOW) {
+        if(pl->good < PHASELOCK_LOCK_COUNT) pl->good++;
+    } else {
+        pl->good = 0;
+    }
+    pl->locked = (pl->good >= PHASELOCK_LOCK_COUNT);
+    return 1;
+}
@@ -0,0 +1,451 @@
+/**
+  ************************************************************************************
+  * @file              Preview.c
+  * @author         None
+  * @version       V2.0.0
+  * @date            2026-10-17
+  * @brief           大规模灯阵效果预览模块源文件
+  *
+  * @details        本文件实现了按帧推进固件效果并生成灰度帧：
+  *                        1. 每帧的tick数 = 10^6 ÷ (tick_us × frame_hz)，小数部分按余数累计
+  *                        2. 相位累加对所有通道相同（增量和余数与偏移无关），
+  *                           通道i的相位 = 共用相位 + offset[i]，与单独运行时逐位一致
+  *                        3. 三角波亮度按Breath_Tick()的公式用SIMD_V4_xxx计算，
+  *                           lo + ((hi - lo) × (tri >> 16) + 0x8000) >> 16，乘数都小于2^16
+  *                        4. 关键帧模式下相位回绕（new < old）即为该通道的最暗点，与main.c相同调用Key_Seek(0)
+  *
+  * @note            三角波模式每帧的开销与tick数无关；关键帧模式与tick数 × 通道数成正比
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V2.0.0 改为渲染固件的呼吸/关键帧效果，主机端SSE2向量化，增加帧文件输出程序
+  *
+  ************************************************************************************
+  */
+
+#include "Preview.h"
+#include "Simd.h"
+#include "Cmd.h"
+
+/**
+  * @brief           帧的行数
+  * @param        count 通道数
+  * @param        width 每行像素数
+  * @retval          行数
+  */
+uint32_t Preview_Height(uint32_t count, uint32_t width)
+{
+    if(width == 0) return 0;
+    return (count + width - 1U) / width;
+}
+
+/**
+  * @brief           初始化预览
+  * @param        st 预览状态
+  * @param        mode 效果模式
+  * @param        count 通道数
+  * @param        offset 相位偏移数组
+  * @param        key 关键帧状态数组
+  * @param        pixels 帧缓冲
+  * @param        width 每行像素数
+  * @param        tick_us tick间隔，单位：微秒
+  * @param        period_ms 呼吸周期，单位：毫秒
+  * @param        hi 最亮亮度
+  * @param        frame_hz 帧率，单位：Hz
+  * @retval          0=成功，1=参数非法
+  */
+uint8_t Preview_Init(Preview_State *st, uint8_t mode, uint32_t count, uint32_t *offset, Key_Channel *key,
+                     uint8_t *pixels, uint32_t width, uint32_t tick_us, uint32_t period_ms,
+                     uint16_t hi, uint32_t frame_hz)
+{
+    uint32_t i;
+
+    if(width == 0 || count == 0 || tick_us == 0 || frame_hz == 0 || hi == 0 || hi > 255U
+       || (uint64_t)tick_us * frame_hz > 1000000U || (mode == PREVIEW_MODE_KEY && key == 0)) {
+        return 1;
+    }
+
+    Breath_Start(&st->ref, period_ms, 0, hi, tick_us);
+    st->offset = offset;
+    st->key = key;
+    st->pixels = pixels;
+    st->gamma = 0;
+    st->count = count;
+    st->width = width;
+    st->height = Preview_Height(count, width);
+    st->den = tick_us * frame_hz;
+    st->steps = 1000000U / st->den;
+    st->rem = 1000000U % st->den;
+    st->acc = 0;
+    st->frame_hz = frame_hz;
+    st->frame = 0;
+    st->ticks = 0;
+    st->mode = mode;
+
+    Preview_Ripple(st, 0);
+
+    /* 最后一行多出的像素保持为0 */
+    for(i = count; i < width * st->height; i++) {
+        pixels[i] = 0;
+    }
+    return 0;
+}
+
+/**
+  * @brief           设置亮度映射表
+  * @param        st 预览状态
+  * @param        gamma 256项映射表
+  * @retval          None
+  */
+void Preview_SetGamma(Preview_State *st, const uint8_t *gamma)
+{
+    st->gamma = gamma;
+}
+
+/**
+  * @brief           设置沿通道方向传播的波纹
+  * @param        st 预览状态
+  * @param        wavelength 一个完整呼吸周期跨越的通道数
+  * @retval          None
+  */
+void Preview_Ripple(Preview_State *st, uint32_t wavelength)
+{
+    uint32_t step = wavelength ? (uint32_t)(((uint64_t)1U << 32) / wavelength) : 0U;
+    uint32_t ticks = st->ref.den / st->ref.tick_us;
+    uint32_t phase = 0;
+    uint32_t i;
+
+    if(st->mode == PREVIEW_MODE_KEY) {
+        Key_BreathFrames(st->keys, st->ref.lo, st->ref.hi, ticks);
+    }
+
+    /* 后一个通道相位落后step，波形沿下标增大的方向传播 */
+    for(i = 0; i < st->count; i++) {
+        st->offset[i] = phase;
+        if(st->mode == PREVIEW_MODE_KEY) {
+            Key_Bind(&st->key[i], st->keys, 3, 1);
+            Key_Seek(&st->key[i], (uint32_t)(((uint64_t)(uint32_t)(st->ref.phase + phase) * ticks) >> 32));
+        }
+        phase -= step;
+    }
+}
+
+/**
+  * @brief           按三角波计算全部通道的亮度
+  * @param        st 预览状态
+  * @retval          None
+  */
+static void Preview_Breath(Preview_State *st)
+{
+    const uint32_t *offset = st->offset;
+    uint8_t *pixels = st->pixels;
+    uint32_t phase = st->ref.phase;
+    uint32_t lo = st->ref.lo;
+    uint32_t range = (uint32_t)(st->ref.hi - st->ref.lo);
+    uint32_t n = st->count;
+    uint32_t i = 0;
+    uint32_t p, tri;
+    Simd_V4 vp, vtri;
+    const Simd_V4 vphase = SIMD_V4_DUP(phase);
+    const Simd_V4 vrange = SIMD_V4_DUP(range);
+    const Simd_V4 vround = SIMD_V4_DUP(0x8000U);
+    const Simd_V4 vlo = SIMD_V4_DUP(lo);
+
+    /* tri = 相位最高位为1时 ~(p << 1)，否则 p << 1：用算术右移得到的全1/全0掩码异或 */
+    for(; i + 4U <= n; i += 4U) {
+        vp = SIMD_V4_ADD(SIMD_V4_LOAD(&offset[i]), vphase);
+        vtri = SIMD_V4_XOR(SIMD_V4_SHL(vp, 1), SIMD_V4_SAR(vp, 31));
+        vtri = SIMD_V4_MUL16(vrange, SIMD_V4_SHR(vtri, 16));
+        SIMD_V4_STORE8(&pixels[i], SIMD_V4_ADD(vlo, SIMD_V4_SHR(SIMD_V4_ADD(vtri, vround), 16)));
+    }
+    for(; i < n; i++) {
+        p = phase + offset[i];
+        tri = (p & 0x80000000U) ? ~(p << 1) : (p << 1);
+        pixels[i] = (uint8_t)(lo + ((range * (tri >> 16) + 0x8000U) >> 16));
+    }
+}
+
+/**
+  * @brief           推进一帧并输出
+  * @param        st 预览状态
+  * @param        sink 帧输出回调
+  * @param        ctx 回调参数
+  * @retval          None
+  */
+void Preview_Frame(Preview_State *st, Preview_Sink sink, void *ctx)
+{
+    uint32_t n = st->steps;
+    uint32_t old;
+    uint32_t i, k;
+
+    st->acc += st->rem;
+    if(st->acc >= st->den) {
+        st->acc -= st->den;
+        n++;
+    }
+
+    if(st->mode == PREVIEW_MODE_KEY) {
+        /* 逐tick：与main.c相同，最暗点重新对齐后推进关键帧 */
+        for(k = 0; k < n; k++) {
+            old = st->ref.phase;
+            (void)Breath_Tick(&st->ref);
+            for(i = 0; i < st->count; i++) {
+                if((uint32_t)(st->ref.phase + st->offset[i]) < (uint32_t)(old + st->offset[i])) {
+                    Key_Seek(&st->key[i], 0);
+                }
+                st->pixels[i] = (uint8_t)Key_Tick(&st->key[i]);
+            }
+        }
+    } else {
+        /* 共用相位推进n个tick，亮度只在帧末计算一次 */
+        for(k = 0; k < n; k++) {
+            (void)Breath_Tick(&st->ref);
+        }
+        Preview_Breath(st);
+    }
+    st->ticks += n;
+
+    if(st->gamma) {
+        for(i = 0; i < st->count; i++) {
+            st->pixels[i] = st->gamma[st->pixels[i]];
+        }
+    }
+
+    if(sink) sink(ctx, st->frame, st->pixels, st->width, st->height);
+    st->frame++;
+}
+
+/**
+  * @brief           连续输出多帧并统计速度
+  * @param        st 预览状态
+  * @param        frames 帧数
+  * @param        clock 时钟读取函数
+  * @param        ticks_per_us 时钟每微秒的计数值
+  * @param        sink 帧输出回调
+  * @param        ctx 回调参数
+  * @param        stats 输出统计
+  * @retval          None
+  */
+void Preview_Run(Preview_State *st, uint32_t frames, uint32_t (*clock)(void), uint32_t ticks_per_us,
+                 Preview_Sink sink, void *ctx, Preview_Stats *stats)
+{
+    uint32_t start = clock();
+    uint32_t i;
+    uint64_t sim_ticks;
+
+    for(i = 0; i < frames; i++) {
+        Preview_Frame(st, sink, ctx);
+    }
+    stats->frames = frames;
+    stats->ticks = clock() - start;
+
+    /* 仿真时长 = frames ÷ frame_hz 秒，折算为时钟计数后与实际耗时相比 */
+    sim_ticks = (uint64_t)frames * ticks_per_us * 1000000U / st->frame_hz;
+    stats->realtime_x1000 = stats->ticks ? (uint32_t)(sim_ticks * 1000U / stats->ticks) : 0;
+}
+
+/**
+  * @brief           生成PGM（P5）文件头
+  * @param        buf 输出缓冲
+  * @param        width 图像宽度
+  * @param        height 图像高度
+  * @retval          文件头长度
+  */
+uint32_t Preview_PgmHeader(char *buf, uint32_t width, uint32_t height)
+{
+    uint32_t n = Cmd_PutText(buf, "P5\n");
+
+    n += Cmd_PutUint(&buf[n], width);
+    buf[n++] = ' ';
+    n += Cmd_PutUint(&buf[n], height);
+    n += Cmd_PutText(&buf[n], "\n255\n");
+    buf[n] = '\0';
+    return n;
+}
+
+#ifdef PREVIEW_MAIN
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/**
+  * @brief   帧文件输出参数
+  */
+typedef struct
+{
+    FILE *raw;                                           /* 原始视频文件，NULL=不输出 */
+    const char *prefix;                               /* PGM图像序列文件名前缀，NULL=不输出 */
+    uint8_t error;                                      /* 1=写文件失败 */
+} Preview_Output;
+
+/**
+  * @brief           主机时钟：单调时间的低32位，单位：纳秒
+  * @param        None
+  * @retval          当前时刻
+  */
+static uint32_t Preview_HostClock(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec);
+}
+
+/**
+  * @brief           帧输出回调：写原始视频或一帧PGM文件
+  */
+static void Preview_WriteFrame(void *ctx, uint32_t frame, const uint8_t *pixels, uint32_t width, uint32_t height)
+{
+    Preview_Output *out = (Preview_Output *)ctx;
+    char header[PREVIEW_PGM_HEADER_MAX];
+    char name[256];
+    uint32_t len;
+    FILE *f;
+
+    if(out->raw != NULL) {
+        if(fwrite(pixels, 1, (size_t)width * height, out->raw) != (size_t)width * height) out->error = 1;
+    }
+    if(out->prefix != NULL) {
+        snprintf(name, sizeof(name), "%s%05lu.pgm", out->prefix, (unsigned long)frame);
+        f = fopen(name, "wb");
+        if(f == NULL) {
+            out->error = 1;
+            return;
+        }
+        len = Preview_PgmHeader(header, width, height);
+        if(fwrite(header, 1, len, f) != len || fwrite(pixels, 1, (size_t)width * height, f) != (size_t)width * height) {
+            out->error = 1;
+        }
+        fclose(f);
+    }
+}
+
+/**
+  * @brief           按固件的主循环单独运行一个通道，与预览结果比较
+  * @param        st 预览状态（已运行若干帧）
+  * @param        index 通道下标
+  * @param        period_ms 呼吸周期，单位：毫秒
+  * @retval          0=一致，1=不一致
+  */
+static int Preview_CheckChannel(const Preview_State *st, uint32_t index, uint32_t period_ms)
+{
+    Breath_Effect e;
+    Key_Channel k;
+    uint32_t ticks;
+    uint64_t t;
+    uint16_t level = 0;
+
+    Breath_Start(&e, period_ms, st->ref.lo, st->ref.hi, st->ref.tick_us);
+    e.phase = st->offset[index];
+    ticks = e.den / e.tick_us;
+    Key_Bind(&k, st->keys, 3, 1);
+    Key_Seek(&k, (uint32_t)(((uint64_t)e.phase * ticks) >> 32));
+    for(t = 0; t < st->ticks; t++) {
+        level = Breath_Tick(&e);
+        if(st->mode == PREVIEW_MODE_KEY) {
+            if(e.event == BREATH_EVT_TROUGH) Key_Seek(&k, 0);
+            level = Key_Tick(&k);
+        }
+    }
+    return (st->gamma ? st->gamma[level] : level) != st->pixels[index];
+}
+
+/**
+  * @brief           主机端预览程序入口
+  * @param        argc 参数个数
+  * @param        argv 参数
+  * @retval          0=成功且抽查通道与单独运行一致，1=失败，2=参数错误
+  */
+int main(int argc, char **argv)
+{
+    uint32_t count = 10000U;
+    uint32_t width = 100U;
+    uint32_t frames = 600U;
+    uint32_t fps = 60U;
+    uint32_t tick_us = BREATH_PWM_CYCLE;
+    uint32_t period_ms = BREATH_PERIOD_MS;
+    uint32_t wavelength = 0;
+    uint8_t mode = PREVIEW_MODE_BREATH;
+    const char *raw = NULL;
+    Preview_Output out = { NULL, NULL, 0 };
+    Preview_State st;
+    Preview_Stats stats;
+    uint32_t *offset;
+    Key_Channel *key = NULL;
+    uint8_t *pixels;
+    uint32_t check[3];
+    int fail = 0;
+    int a;
+    uint32_t i;
+
+    for(a = 1; a < argc; a++) {
+        if(strcmp(argv[a], "-k") == 0) {
+            mode = PREVIEW_MODE_KEY;
+        } else if(a + 1 < argc && argv[a][0] == '-' && strchr("nwfrtplos", argv[a][1]) != NULL && argv[a][2] == '\0') {
+            switch(argv[a++][1]) {
+                case 'n': count = (uint32_t)strtoul(argv[a], NULL, 0); break;
+                case 'w': width = (uint32_t)strtoul(argv[a], NULL, 0); break;
+                case 'f': frames = (uint32_t)strtoul(argv[a], NULL, 0); break;
+                case 'r': fps = (uint32_t)strtoul(argv[a], NULL, 0); break;
+                case 't': tick_us = (uint32_t)strtoul(argv[a], NULL, 0); break;
+                case 'p': period_ms = (uint32_t)strtoul(argv[a], NULL, 0); break;
+                case 'l': wavelength = (uint32_t)strtoul(argv[a], NULL, 0); break;
+                case 'o': raw = argv[a]; break;
+                default:  out.prefix = argv[a]; break;
+            }
+        } else {
+            fprintf(stderr, "usage: preview [-n channels] [-w width] [-f frames] [-r fps] [-t tick_us] [-p period_ms]\n"
+                            "               [-l wavelength] [-k] [-o out.raw | -s prefix]\n");
+            return 2;
+        }
+    }
+    if(wavelength == 0) wavelength = width;
+
+    offset = (uint32_t *)malloc((size_t)count * sizeof(uint32_t));
+    pixels = (uint8_t *)malloc((size_t)width * Preview_Height(count, width) + 1U);
+    if(mode == PREVIEW_MODE_KEY) key = (Key_Channel *)malloc((size_t)count * sizeof(Key_Channel));
+    if(offset == NULL || pixels == NULL || (mode == PREVIEW_MODE_KEY && key == NULL)) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    if(Preview_Init(&st, mode, count, offset, key, pixels, width, tick_us, period_ms,
+                    BREATH_BRIGHTNESS_MAX, fps) != 0) {
+        fprintf(stderr, "bad parameters\n");
+        return 2;
+    }
+    Preview_Ripple(&st, wavelength);
+
+    if(raw != NULL) {
+        out.raw = fopen(raw, "wb");
+        if(out.raw == NULL) {
+            fprintf(stderr, "cannot open %s\n", raw);
+            return 1;
+        }
+    }
+    Preview_Run(&st, frames, Preview_HostClock, 1000U,
+                (out.raw != NULL || out.prefix != NULL) ? Preview_WriteFrame : NULL, &out, &stats);
+    if(out.raw != NULL) fclose(out.raw);
+
+    /* 抽查首、中、尾三个通道 */
+    check[0] = 0;
+    check[1] = count / 2U;
+    check[2] = count - 1U;
+    for(i = 0; i < 3U; i++) {
+        fail |= Preview_CheckChannel(&st, check[i], period_ms);
+    }
+
+    printf("%lu channels, %s, %lu frames at %lu fps (%llu ticks), SIMD_V4_NATIVE=%d\n",
+           (unsigned long)count, mode == PREVIEW_MODE_KEY ? "key" : "breath", (unsigned long)frames,
+           (unsigned long)fps, (unsigned long long)st.ticks, SIMD_V4_NATIVE);
+    printf("  %lu ns, %lu.%03lu x realtime\n", (unsigned long)stats.ticks,
+           (unsigned long)(stats.realtime_x1000 / 1000U), (unsigned long)(stats.realtime_x1000 % 1000U));
+    printf("  spot check vs single-channel firmware loop: %s\n", fail ? "MISMATCH" : "ok");
+    if(out.error) fprintf(stderr, "write error\n");
+
+    free(offset);
+    free(pixels);
+    free(key);
+    return (fail || out.error) ? 1 : 0;
+}
+#endif  /* PREVIEW_MAIN */
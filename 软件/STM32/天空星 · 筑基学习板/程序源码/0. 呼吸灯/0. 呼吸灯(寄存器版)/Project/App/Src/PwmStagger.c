@@ -0,0 +1,220 @@
+/**
+  ************************************************************************************
+  * @file              PwmStagger.c
+  * @author         None
+  * @version       V1.0.1
+  * @date            2026-10-17
+  * @brief           多通道PWM相位错开模块源文件
+  *
+  * @details        本文件实现了相位分配、负载统计和BSRR写入表生成：
+  *                        1. 分配：offset[i] = (duty[0] + … + duty[i-1]) mod period，
+  *                           各导通区间在周期圆上首尾相接，任一时刻被覆盖 ⌊Σ/period⌋ 或 ⌈Σ/period⌉ 次，
+  *                           峰值和均方根同时达到最小
+  *                        2. 统计与生成写入表都先把边沿按时间排序，再扫描一遍
+  *                        3. 均方根用64位整数开方，不依赖libm和浮点
+  *
+  * @note            排序为插入排序，适合几十个通道；通道很多时在主机上使用
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.0.1 均方根改为整数开方，去掉math.h；由hostcheck pwmstagger检查
+  *
+  ************************************************************************************
+  */
+
+#include "PwmStagger.h"
+
+/**
+  * @brief           分配各通道的相位偏移
+  * @param        duty 各通道导通时间
+  * @param        offset 输出各通道导通起点
+  * @param        n 通道数
+  * @param        period PWM周期
+  * @retval          None
+  */
+void PwmStagger_Distribute(const uint32_t *duty, uint32_t *offset, uint32_t n, uint32_t period)
+{
+    uint32_t pos = 0;
+    uint32_t i;
+
+    for(i = 0; i < n; i++) {
+        offset[i] = pos;
+        pos += duty[i] % period;
+        if(pos >= period) pos -= period;
+    }
+}
+
+/**
+  * @brief           64位整数开方，结果四舍五入
+  * @param        v 被开方数
+  * @retval          round(√v)
+  * @note           逐位试商，每次确定结果的一位
+  */
+static uint32_t PwmStagger_Sqrt(uint64_t v)
+{
+    uint64_t root = 0;
+    uint64_t bit = 1ULL << 62;
+
+    while(bit > v) bit >>= 2;
+    while(bit != 0) {
+        if(v >= root + bit) {
+            v -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    /* 余数 v - root² 大于 root 时 √v ≥ root + 0.5 */
+    if(v > root) root++;
+    return (uint32_t)root;
+}
+
+/**
+  * @brief           判断通道在周期起点是否导通
+  * @param        duty 导通时间
+  * @param        offset 导通起点
+  * @param        period PWM周期
+  * @retval          1=导通，0=关断
+  */
+static uint8_t PwmStagger_OnAtZero(uint32_t duty, uint32_t offset, uint32_t period)
+{
+    if(duty == 0) return 0;
+    if(duty >= period) return 1;
+    return (offset == 0 || offset + duty > period);
+}
+
+/**
+  * @brief           收集并排序开关边沿
+  * @param        duty 各通道导通时间
+  * @param        offset 各通道导通起点
+  * @param        n 通道数
+  * @param        period PWM周期
+  * @param        edges 输出边沿
+  * @retval          边沿数
+  * @note           常亮、常灭的通道没有边沿；时刻相同时关断排在导通之前
+  */
+static uint32_t PwmStagger_Sort(const uint32_t *duty, const uint32_t *offset, uint32_t n,
+                                uint32_t period, PwmStagger_Edge *edges)
+{
+    uint32_t count = 0;
+    uint32_t i, j;
+    uint32_t off;
+    PwmStagger_Edge e;
+
+    for(i = 0; i < n; i++) {
+        if(duty[i] == 0 || duty[i] >= period) continue;
+        off = offset[i] % period + duty[i];
+        if(off >= period) off -= period;
+
+        edges[count].time = offset[i] % period;
+        edges[count].ch = (uint16_t)i;
+        edges[count].level = 1;
+        count++;
+        edges[count].time = off;
+        edges[count].ch = (uint16_t)i;
+        edges[count].level = 0;
+        count++;
+    }
+
+    for(i = 1; i < count; i++) {
+        e = edges[i];
+        j = i;
+        while(j > 0 && (edges[j - 1].time > e.time
+                        || (edges[j - 1].time == e.time && edges[j - 1].level > e.level))) {
+            edges[j] = edges[j - 1];
+            j--;
+        }
+        edges[j] = e;
+    }
+    return count;
+}
+
+/**
+  * @brief           统计同时导通的通道数
+  * @param        duty 各通道导通时间
+  * @param        offset 各通道导通起点
+  * @param        n 通道数
+  * @param        period PWM周期
+  * @param        scratch 临时数据
+  * @param        load 输出统计
+  * @retval          None
+  */
+void PwmStagger_Measure(const uint32_t *duty, const uint32_t *offset, uint32_t n, uint32_t period,
+                        PwmStagger_Edge *scratch, PwmStagger_Load *load)
+{
+    uint32_t count = PwmStagger_Sort(duty, offset, n, period, scratch);
+    uint32_t on = 0;
+    uint32_t t = 0;
+    uint64_t sum = 0;
+    uint64_t sum_sq = 0;
+    uint32_t i;
+
+    /* 周期起点的导通数 */
+    for(i = 0; i < n; i++) {
+        on += PwmStagger_OnAtZero(duty[i], offset[i] % period, period);
+    }
+
+    /* 逐个边沿累计：导通数 × 持续时间 */
+    load->peak = 0;
+    for(i = 0; i <= count; i++) {
+        uint32_t next = (i < count) ? scratch[i].time : period;
+
+        if(next > t) {
+            if(on > load->peak) load->peak = on;
+            sum += (uint64_t)on * (next - t);
+            sum_sq += (uint64_t)on * on * (next - t);
+            t = next;
+        }
+        if(i < count) {
+            /* 起点已计入的边沿（时刻0）不重复处理 */
+            if(scratch[i].time == 0) continue;
+            if(scratch[i].level) on++;
+            else on--;
+        }
+    }
+
+    load->mean_x1000 = (uint32_t)(sum * 1000U / period);
+    /* 均方值 × 10^6 分整数部分和余数部分计算，避免sum_sq × 10^6溢出 */
+    load->rms_x1000 = PwmStagger_Sqrt(sum_sq / period * 1000000U + sum_sq % period * 1000000U / period);
+}
+
+/**
+  * @brief           生成BSRR写入表
+  * @param        duty 各通道导通时间
+  * @param        offset 各通道导通起点
+  * @param        pin 各通道的引脚号
+  * @param        n 通道数
+  * @param        period PWM周期
+  * @param        scratch 临时数据
+  * @param        slots 输出写入表
+  * @retval          写入表项数
+  */
+uint32_t PwmStagger_Build(const uint32_t *duty, const uint32_t *offset, const uint8_t *pin,
+                          uint32_t n, uint32_t period, PwmStagger_Edge *scratch, PwmStagger_Slot *slots)
+{
+    uint32_t count = PwmStagger_Sort(duty, offset, n, period, scratch);
+    uint32_t used = 1;
+    uint32_t bit;
+    uint32_t i;
+
+    /* 第0项：周期起点的电平 */
+    slots[0].time = 0;
+    slots[0].bsrr = 0;
+    for(i = 0; i < n; i++) {
+        bit = 1U << (pin[i] & 0x0FU);
+        slots[0].bsrr |= PwmStagger_OnAtZero(duty[i], offset[i] % period, period) ? bit : (bit << 16);
+    }
+
+    for(i = 0; i < count; i++) {
+        if(scratch[i].time == 0) continue;                 /* 已由第0项处理 */
+        bit = 1U << (pin[scratch[i].ch] & 0x0FU);
+        if(slots[used - 1].time != scratch[i].time) {
+            slots[used].time = scratch[i].time;
+            slots[used].bsrr = 0;
+            used++;
+        }
+        slots[used - 1].bsrr |= scratch[i].level ? bit : (bit << 16);
+    }
+    return used;
+}
@@ -0,0 +1,415 @@
+/**
+  ************************************************************************************
+  * @file              Sweep.c
+  * @author         None
+  * @version       V1.1.1
+  * @date            2026-10-17
+  * @brief           呼吸灯参数扫描工具源文件
+  *
+  * @details        本文件实现了多线程网格扫描和结果输出：
+  *                        1. 工作线程用原子加从共享计数器取SWEEP_CHUNK组参数，取完即退出，
+  *                           评估耗时不均匀时各线程的负载自动平衡
+  *                        2. 每个线程的非支配集只含本线程评估过的参数组，插入时删除被新项支配的项；
+  *                           合并时把各线程的非支配集依次插入同一个集合
+  *                        3. CSV：每行一组参数，列为下标、各参数、各指标和是否在前沿上
+  *
+  * @note            主机端工具，用到pthread、stdio和malloc
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 参数轴随Breath_Params改为pwm、bmax、period
+  *                         - 2026-10-17 V1.1.1 输出文件打不开或写入失败时报告原因并返回1
+  *
+  ************************************************************************************
+  */
+
+#include "Sweep.h"
+#include <pthread.h>
+#include <errno.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/**
+  * @brief   非支配集（参数组下标）
+  */
+typedef struct
+{
+    uint32_t *index;                                   /* 下标数组 */
+    uint32_t count;                                    /* 项数 */
+    uint32_t cap;                                       /* 容量 */
+} Sweep_Front;
+
+/**
+  * @brief   扫描任务的共享状态
+  */
+typedef struct
+{
+    const Breath_Grid *grid;                        /* 参数网格 */
+    uint32_t core_clock;                             /* CPU主频 */
+    uint32_t total;                                     /* 参数组数 */
+    uint32_t next;                                      /* 下一块的起始下标（原子访问） */
+    Sweep_Result *results;                          /* 结果数组 */
+} Sweep_Job;
+
+/**
+  * @brief   工作线程状态
+  */
+typedef struct
+{
+    Sweep_Job *job;                                    /* 共享状态 */
+    Sweep_Front front;                               /* 本线程的非支配集 */
+    uint32_t valid;                                      /* 本线程评估的合法参数组数 */
+    uint8_t oom;                                         /* 1=非支配集扩容失败 */
+} Sweep_Worker;
+
+/**
+  * @brief   命令行可设置的参数轴
+  */
+typedef struct
+{
+    const char *name;                                /* 参数名 */
+    size_t offset;                                      /* 在Breath_Params中的偏移 */
+} Sweep_Axis;
+
+static const Sweep_Axis sweep_axis[] =
+{
+    { "pwm",    offsetof(Breath_Params, pwm_cycle) },
+    { "bmax",   offsetof(Breath_Params, brightness_max) },
+    { "period", offsetof(Breath_Params, period_ms) },
+};
+
+#define SWEEP_AXIS_COUNT                     (sizeof(sweep_axis) / sizeof(sweep_axis[0]))
+
+/**
+  * @brief           把一组参数插入非支配集
+  * @param        front 非支配集
+  * @param        results 结果数组
+  * @param        index 参数组下标
+  * @retval          0=成功，1=扩容失败
+  * @note           被已有项支配时不插入；插入时删除被它支配的项
+  */
+static uint8_t Sweep_FrontInsert(Sweep_Front *front, const Sweep_Result *results, uint32_t index)
+{
+    const Breath_Metrics *m = &results[index].metrics;
+    uint32_t *grown;
+    uint32_t i;
+    uint32_t keep = 0;
+
+    for(i = 0; i < front->count; i++) {
+        if(Breath_Dominates(&results[front->index[i]].metrics, m)) return 0;
+    }
+    for(i = 0; i < front->count; i++) {
+        if(!Breath_Dominates(m, &results[front->index[i]].metrics)) front->index[keep++] = front->index[i];
+    }
+    front->count = keep;
+
+    if(front->count == front->cap) {
+        grown = (uint32_t *)realloc(front->index, (front->cap ? front->cap * 2U : 64U) * sizeof(uint32_t));
+        if(grown == NULL) return 1;
+        front->index = grown;
+        front->cap = front->cap ? front->cap * 2U : 64U;
+    }
+    front->index[front->count++] = index;
+    return 0;
+}
+
+/**
+  * @brief           扫描回调：记录结果并更新本线程的非支配集
+  */
+static void Sweep_Visit(uint32_t index, const Breath_Params *params, const Breath_Metrics *metrics, void *ctx)
+{
+    Sweep_Worker *w = (Sweep_Worker *)ctx;
+    Sweep_Result *r = &w->job->results[index];
+
+    (void)params;
+    r->metrics = *metrics;
+    r->valid = 1;
+    w->valid++;
+    w->oom |= Sweep_FrontInsert(&w->front, w->job->results, index);
+}
+
+/**
+  * @brief           工作线程
+  * @param        arg 工作线程状态
+  * @retval          NULL
+  */
+static void *Sweep_Thread(void *arg)
+{
+    Sweep_Worker *w = (Sweep_Worker *)arg;
+    Sweep_Job *job = w->job;
+    uint32_t first;
+
+    for(;;) {
+        first = __atomic_fetch_add(&job->next, SWEEP_CHUNK, __ATOMIC_RELAXED);
+        if(first >= job->total) break;
+        Breath_SweepRange(job->grid, first, SWEEP_CHUNK, job->core_clock, Sweep_Visit, w);
+    }
+    return NULL;
+}
+
+/**
+  * @brief           多线程扫描一个网格
+  * @param        grid 参数网格
+  * @param        core_clock CPU主频，单位：Hz
+  * @param        threads 线程数
+  * @param        results 输出结果
+  * @param        stats 输出统计
+  * @retval          0=成功，1=参数非法或线程创建失败
+  */
+uint8_t Sweep_Run(const Breath_Grid *grid, uint32_t core_clock, uint32_t threads,
+                  Sweep_Result *results, Sweep_Stats *stats)
+{
+    Sweep_Job job;
+    Sweep_Worker worker[SWEEP_THREADS_MAX];
+    pthread_t tid[SWEEP_THREADS_MAX];
+    Sweep_Front front = { NULL, 0, 0 };
+    struct timespec t0, t1;
+    uint32_t started = 0;
+    uint32_t i, k;
+    uint8_t err = 0;
+
+    if(threads == 0 || threads > SWEEP_THREADS_MAX) return 1;
+
+    job.grid = grid;
+    job.core_clock = core_clock;
+    job.total = Breath_GridCount(grid);
+    job.next = 0;
+    job.results = results;
+    memset(results, 0, (size_t)job.total * sizeof(Sweep_Result));
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for(i = 0; i < threads; i++) {
+        worker[i].job = &job;
+        worker[i].front.index = NULL;
+        worker[i].front.count = 0;
+        worker[i].front.cap = 0;
+        worker[i].valid = 0;
+        worker[i].oom = 0;
+    }
+    /* 第0个线程由调用者自己运行 */
+    for(i = 1; i < threads; i++) {
+        if(pthread_create(&tid[i], NULL, Sweep_Thread, &worker[i]) != 0) {
+            err = 1;
+            break;
+        }
+        started++;
+    }
+    Sweep_Thread(&worker[0]);
+    for(i = 1; i <= started; i++) {
+        pthread_join(tid[i], NULL);
+    }
+
+    /* 合并各线程的非支配集 */
+    stats->valid = 0;
+    for(i = 0; i < threads; i++) {
+        stats->valid += worker[i].valid;
+        err |= worker[i].oom;
+        for(k = 0; k < worker[i].front.count; k++) {
+            err |= Sweep_FrontInsert(&front, results, worker[i].front.index[k]);
+        }
+        free(worker[i].front.index);
+    }
+    for(k = 0; k < front.count; k++) {
+        results[front.index[k]].pareto = 1;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+
+    stats->total = job.total;
+    stats->front = front.count;
+    stats->threads = started + 1U;
+    stats->seconds = (double)(t1.tv_sec - t0.tv_sec) + (double)(t1.tv_nsec - t0.tv_nsec) * 1e-9;
+    free(front.index);
+    return err;
+}
+
+/* ---------------------------------- 命令行 ---------------------------------- */
+
+/**
+  * @brief           输出CSV表头
+  * @param        f 文件
+  * @retval          None
+  */
+static void Sweep_CsvHeader(FILE *f)
+{
+    uint32_t a;
+
+    fprintf(f, "index");
+    for(a = 0; a < SWEEP_AXIS_COUNT; a++) fprintf(f, ",%s", sweep_axis[a].name);
+    fprintf(f, ",eff_period_ms,carrier_hz,levels,lost_steps,min_step_cycles,overhead_ppm,flicker_risk,pareto\n");
+}
+
+/**
+  * @brief           输出一行CSV
+  * @param        f 文件
+  * @param        grid 参数网格
+  * @param        index 下标
+  * @param        r 结果
+  * @retval          None
+  */
+static void Sweep_CsvRow(FILE *f, const Breath_Grid *grid, uint32_t index, const Sweep_Result *r)
+{
+    Breath_Params p;
+    const Breath_Metrics *m = &r->metrics;
+    uint32_t a;
+
+    Breath_GridAt(grid, index, &p);
+    fprintf(f, "%lu", (unsigned long)index);
+    for(a = 0; a < SWEEP_AXIS_COUNT; a++) {
+        fprintf(f, ",%lu", (unsigned long)*(const uint32_t *)(const void *)((const uint8_t *)&p + sweep_axis[a].offset));
+    }
+    fprintf(f, ",%lu,%lu,%lu,%lu,%lu,%lu,%u,%u\n", (unsigned long)m->period_ms, (unsigned long)m->carrier_hz,
+            (unsigned long)m->levels, (unsigned long)m->lost_steps, (unsigned long)m->min_step_cycles,
+            (unsigned long)m->overhead_ppm, (unsigned)m->flicker_risk, (unsigned)r->pareto);
+}
+
+/**
+  * @brief           解析"名称=下限:上限:步长"
+  * @param        grid 参数网格
+  * @param        arg 参数
+  * @retval          0=成功，1=格式错误或参数名未知
+  * @note           只给下限时上限等于下限，省略步长时为1
+  */
+static uint8_t Sweep_ParseAxis(Breath_Grid *grid, const char *arg)
+{
+    const char *eq = strchr(arg, '=');
+    unsigned long lo, hi, inc = 1;
+    size_t len;
+    uint32_t a;
+    int n;
+
+    if(eq == NULL) return 1;
+    len = (size_t)(eq - arg);
+    n = sscanf(eq + 1, "%lu:%lu:%lu", &lo, &hi, &inc);
+    if(n < 1) return 1;
+    if(n < 2) hi = lo;
+    for(a = 0; a < SWEEP_AXIS_COUNT; a++) {
+        if(strlen(sweep_axis[a].name) == len && strncmp(arg, sweep_axis[a].name, len) == 0) {
+            *(uint32_t *)(void *)((uint8_t *)&grid->min + sweep_axis[a].offset) = (uint32_t)lo;
+            *(uint32_t *)(void *)((uint8_t *)&grid->max + sweep_axis[a].offset) = (uint32_t)hi;
+            *(uint32_t *)(void *)((uint8_t *)&grid->inc + sweep_axis[a].offset) = (uint32_t)inc;
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+  * @brief           关闭输出文件并检查写入错误
+  * @param        f 文件（stdout时只刷新）
+  * @param        name 文件名，用于错误信息
+  * @retval          0=成功，1=写入失败
+  */
+static int Sweep_Close(FILE *f, const char *name)
+{
+    int err = ferror(f);
+
+    err |= (f == stdout) ? fflush(f) : fclose(f);
+    if(err) {
+        fprintf(stderr, "cannot write %s: %s\n", name, strerror(errno));
+        return 1;
+    }
+    return 0;
+}
+
+/**
+  * @brief           命令行入口
+  * @param        argc 参数个数
+  * @param        argv 参数
+  * @retval          0=成功，1=失败，2=参数错误
+  */
+int Sweep_Main(int argc, char **argv)
+{
+    Breath_Grid grid;
+    Sweep_Result *results;
+    Sweep_Stats st;
+    const char *csv = NULL;
+    const char *pareto = NULL;
+    uint32_t threads = 1;
+    uint32_t clock = 168000000U;
+    uint32_t total;
+    uint32_t i;
+    FILE *f;
+    int ret = 0;
+    int a;
+
+    grid.min.pwm_cycle = grid.max.pwm_cycle = BREATH_PWM_CYCLE;
+    grid.min.brightness_max = grid.max.brightness_max = BREATH_BRIGHTNESS_MAX;
+    grid.min.period_ms = grid.max.period_ms = BREATH_PERIOD_MS;
+    grid.inc.pwm_cycle = grid.inc.brightness_max = grid.inc.period_ms = 1;
+
+    for(a = 1; a < argc; a++) {
+        if(strcmp(argv[a], "-j") == 0 && a + 1 < argc) {
+            threads = (uint32_t)strtoul(argv[++a], NULL, 0);
+        } else if(strcmp(argv[a], "-c") == 0 && a + 1 < argc) {
+            csv = argv[++a];
+        } else if(strcmp(argv[a], "-p") == 0 && a + 1 < argc) {
+            pareto = argv[++a];
+        } else if(strcmp(argv[a], "-k") == 0 && a + 1 < argc) {
+            clock = (uint32_t)strtoul(argv[++a], NULL, 0);
+        } else if(Sweep_ParseAxis(&grid, argv[a]) != 0) {
+            fprintf(stderr, "usage: sweep [-j threads] [-c csv] [-p pareto.csv] [-k clock_hz] [name=lo:hi:inc ...]\n");
+            fprintf(stderr, "names:");
+            for(i = 0; i < SWEEP_AXIS_COUNT; i++) fprintf(stderr, " %s", sweep_axis[i].name);
+            fprintf(stderr, "\n");
+            return 2;
+        }
+    }
+
+    total = Breath_GridCount(&grid);
+    results = (Sweep_Result *)malloc((size_t)(total ? total : 1U) * sizeof(Sweep_Result));
+    if(results == NULL) {
+        fprintf(stderr, "out of memory (%lu points)\n", (unsigned long)total);
+        return 1;
+    }
+    if(Sweep_Run(&grid, clock, threads, results, &st) != 0) {
+        fprintf(stderr, "sweep failed\n");
+        free(results);
+        return 1;
+    }
+
+    if(csv != NULL) {
+        f = fopen(csv, "w");
+        if(f == NULL) {
+            fprintf(stderr, "cannot open %s: %s\n", csv, strerror(errno));
+            ret = 1;
+        } else {
+            Sweep_CsvHeader(f);
+            for(i = 0; i < total; i++) {
+                if(results[i].valid) Sweep_CsvRow(f, &grid, i, &results[i]);
+            }
+            ret |= Sweep_Close(f, csv);
+        }
+    }
+    f = pareto ? fopen(pareto, "w") : stdout;
+    if(f == NULL) {
+        fprintf(stderr, "cannot open %s: %s\n", pareto, strerror(errno));
+        ret = 1;
+    } else {
+        Sweep_CsvHeader(f);
+        for(i = 0; i < total; i++) {
+            if(results[i].pareto) Sweep_CsvRow(f, &grid, i, &results[i]);
+        }
+        ret |= Sweep_Close(f, pareto ? pareto : "stdout");
+    }
+    fprintf(stderr, "%lu points, %lu valid, %lu on front, %lu threads, %.3f s, %.0f points/s\n",
+            (unsigned long)st.total, (unsigned long)st.valid, (unsigned long)st.front, (unsigned long)st.threads,
+            st.seconds, st.seconds > 0 ? (double)st.total / st.seconds : 0.0);
+    free(results);
+    return ret;
+}
+
+#ifdef SWEEP_MAIN
+/**
+  * @brief           独立程序入口
+  * @param        argc 参数个数
+  * @param        argv 参数
+  * @retval          见Sweep_Main()
+  */
+int main(int argc, char **argv)
+{
+    return Sweep_Main(argc, argv);
+}
+#endif
@@ -2,27 +2,306 @@
   ************************************************************************************
   * @file              main.c
   * @author         None
-  * @version       V1.0.0
+  * @version       V1.16.0
   * @date            2026-01-18
   * @brief           主程序文件，实现LED呼吸灯效果
   *
   * @details        本程序实现两个LED的控制：
   *                        1. LED1以1秒为周期闪烁
   *                        2. LED2通过软件PWM实现呼吸灯效果
-  *                        程序使用一个共享的延时计数机制来更新呼吸灯亮度
+  *                        呼吸亮度由Breath_Effect相位累加器生成，周期以毫秒指定；
+  *                        LED2_KEYFRAMES为1时亮度改由关键帧引擎按正弦缓动插值，每个最暗点重新对齐
+  *                        多板运行时按SYNC_ROLE输出或跟随PA1上的同步脉冲
+  *                        LED1_INDICATOR_HW为1时LED1由TIM3→TIM4级联在硬件中产生，
+  *                        PWM节拍改由TIM3溢出提供，两个LED共用同一时间基准
+  *                        UART_CONTROL为1时可经USART1修改亮度和呼吸效果，每个PWM周期的熄灭段
+  *                        开头取出新数据并最多执行一条命令
   *
   * @note            硬件连接：
   *                        - LED1连接PB8引脚
   *                        - LED2连接PB2引脚
   *                        - 低电平点亮LED1，高电平点亮LED2
+  *                        - 同步线连接各板PA1（SYNC_ROLE不为SYNC_ROLE_NONE时使用）
+  *                        - 串口：PA9 = TX，PA10 = RX（UART_CONTROL为1时使用）
+  *                        各定时器和串口的时钟由Device层按所选型号的实际总线分频计算
   *
   * @attention      修改日志：
   *                        - 2026-01-18 V1.0.0 初始版本
+  *                        - 2026-10-17 V1.1.0 调节参数改用Breath.h中的默认值，边界判断改用BRIGHTNESS_MAX
+  *                        - 2026-10-17 V1.2.0 亮度由Breath_Effect按毫秒周期生成，PWM改用Delay_Until定时
+  *                        - 2026-10-17 V1.3.0 增加多板呼吸相位同步
+  *                        - 2026-10-17 V1.4.0 LED1可由定时器级联硬件产生
+  *                        - 2026-10-17 V1.5.0 增加串口命令控制
+  *                        - 2026-10-17 V1.6.0 LED2亮度可由关键帧缓动曲线生成
+  *                        - 2026-10-17 V1.7.0 启动时按器件能力表调整Flash等待周期
+  *                        - 2026-10-17 V1.8.0 S命令应答增加复位到main()的周期数
+  *                        - 2026-10-17 V1.9.0 启动时初始化固定块内存池
+  *                        - 2026-10-17 V1.9.1 更正参数评估说明
+  *                        - 2026-10-17 V1.9.2 LED2关键帧改由Key_BreathFrames()生成
+  *                        - 2026-10-17 V1.10.0 E命令同时修改LED1的TIM4周期，超出16位范围时应答ERR；
+  *                                                          硬件指示时LED2的新周期在下一个最暗点与TIM4同时生效
+  *                        - 2026-10-17 V1.11.0 APB分频由能力表决定，S命令应答增加时钟检查结果
+  *                        - 2026-10-17 V1.12.0 main()入口记录启动周期数，汇编启动文件下boot字段同样有效
+  *                        - 2026-10-17 V1.13.0 增加B命令：内存池与malloc的基准测试
+  *                        - 2026-10-17 V1.14.0 增加A命令：示例动画的逐帧解码耗时
+  *                        - 2026-10-17 V1.15.0 增加D命令：DDS标量与SIMD实现的耗时
+  *                        - 2026-10-17 V1.15.1 S应答最长159字节，改由编译期检查保证不超过应答缓冲区
+  *                        - 2026-10-17 V1.16.0 A/D命令的解码帧和DDS通道组改从帧分配区Arena_Frame分配，每个PWM周期末回收
   *
   ************************************************************************************
   */
  
 #include "main.h"
+#include <stddef.h>
+
+static Breath_Effect breath;                               /* 呼吸效果状态，运行中可用Breath_SetPeriod()修改周期 */
+static uint32_t device_clk;                                /* Device_Init()的时钟检查结果DEVICE_CLK_xxx */
+
+#if SYNC_ROLE == SYNC_ROLE_FOLLOWER
+static PhaseLock breath_lock;                            /* 从板锁相环 */
+
+/**
+  * @brief           同步脉冲回调
+  * @param         None
+  * @retval          None
+  * @note            在EXTI1中断中记录当前呼吸相位，修正在主循环中进行
+  */
+static void Sync_OnPulse(void)
+{
+    PhaseLock_Capture(&breath_lock, breath.phase);
+}
+#endif
+
+#if LED2_KEYFRAMES
+static Key_Frame led2_keys[3];                          /* 最暗 → 最亮 → 最暗 */
+static Key_Channel led2;                                   /* LED2关键帧通道 */
+
+/**
+  * @brief           按呼吸效果的周期和亮度范围生成LED2关键帧
+  * @param         None
+  * @retval          None
+  * @note            并跳到呼吸效果当前相位对应的时刻；周期或亮度范围改变后调用
+  */
+static void Led2_BuildKeys(void)
+{
+    uint32_t ticks = breath.den / breath.tick_us;            /* 呼吸周期对应的tick数 */
+
+    Key_BreathFrames(led2_keys, breath.lo, breath.hi, ticks);
+    Key_Bind(&led2, led2_keys, 3, 1);
+    Key_Seek(&led2, (uint32_t)(((uint64_t)breath.phase * ticks) >> 32));
+}
+#endif
+
+#if UART_CONTROL
+/**
+  * @brief           修改LED2的呼吸周期
+  * @param         period_ms 完整呼吸周期，单位：毫秒
+  * @retval          None
+  * @note            相位增量基准和关键帧随周期一起更新
+  */
+static void Led2_SetPeriod(uint32_t period_ms)
+{
+    Breath_SetPeriod(&breath, period_ms);
+#if SYNC_ROLE == SYNC_ROLE_FOLLOWER
+    /* 周期改变后相位增量基准随之改变 */
+    PhaseLock_Init(&breath_lock, &breath, PHASELOCK_KP_SHIFT, PHASELOCK_KI_SHIFT);
+#endif
+#if LED2_KEYFRAMES
+    Led2_BuildKeys();
+#endif
+}
+
+#if LED1_INDICATOR_HW
+static uint32_t breath_next_ms;                          /* 等待下一个最暗点生效的呼吸周期，0=无 */
+#endif
+static Cmd_Parser cmd;                                    /* 命令解析器与队列 */
+static char cmd_reply[160];                              /* 应答缓冲区，发送完成前不改写 */
+
+/* 最长的应答为S：10个字段的值均为10位时共159字节（最后的空格改为'\n'），增删字段时同步修改 */
+#define CMD_STATS_REPLY_MAX               (CMD_FIELD_MAX("rx") + CMD_FIELD_MAX("frames") + CMD_FIELD_MAX("peak") \
+                                                        + CMD_FIELD_MAX("lat") + CMD_FIELD_MAX("tx") + CMD_FIELD_MAX("drop") \
+                                                        + CMD_FIELD_MAX("level") + CMD_FIELD_MAX("period") \
+                                                        + CMD_FIELD_MAX("boot") + CMD_FIELD_MAX("clk"))
+typedef char cmd_reply_check[(CMD_STATS_REPLY_MAX <= sizeof(cmd_reply)) ? 1 : -1];
+
+/**
+  * @brief           按D命令的参数运行DDS基准测试
+  * @param         count 通道数，超过DDS_BENCH_CHANNELS_MAX时按最大值处理
+  * @param         rounds 每种实现的更新轮数，超过DDS_BENCH_ROUNDS_MAX时按最大值处理
+  * @param         result 输出测试结果
+  * @retval          0=完成，1=帧分配区空间不足
+  * @note            各通道的相位、频率和偏移与主机端dds程序相同，两边的结果可直接比较；
+  *                        通道组从Arena_Frame分配，本PWM周期末回收
+  */
+static uint8_t Dds_RunBench(uint32_t count, uint32_t rounds, Dds_Bench *result)
+{
+    Dds_Bank bank;
+    uint32_t i;
+
+    if(count == 0) count = 1U;
+    if(count > DDS_BENCH_CHANNELS_MAX) count = DDS_BENCH_CHANNELS_MAX;
+    if(rounds > DDS_BENCH_ROUNDS_MAX) rounds = DDS_BENCH_ROUNDS_MAX;
+    bank.phase = ARENA_NEW(&Arena_Frame, uint32_t, count);
+    bank.freq = ARENA_NEW(&Arena_Frame, uint32_t, count);
+    /* offset[]/out[]须4字节对齐，按默认的ARENA_ALIGN分配 */
+    bank.offset = (int16_t *)Arena_Alloc(&Arena_Frame, count * sizeof(int16_t), 0);
+    bank.out = (int16_t *)Arena_Alloc(&Arena_Frame, count * sizeof(int16_t), 0);
+    if(bank.phase == NULL || bank.freq == NULL || bank.offset == NULL || bank.out == NULL) return 1;
+
+    for(i = 0; i < count; i++) {
+        bank.phase[i] = i * 0x9E3779B9U;
+        bank.freq[i] = Dds_FreqWord(250U + i * 7U, 2000U);
+        bank.offset[i] = (int16_t)(i & 0xFFU);
+    }
+    bank.table = Dds_RaisedCosine;
+    bank.count = count;
+    Dds_Benchmark(&bank, rounds, Delay_Mark, SystemCoreClock / 1000000U, result);
+    return 0;
+}
+
+/**
+  * @brief           执行一条命令并生成应答
+  * @param         msg 命令
+  * @param         brightness 当前亮度
+  * @retval          应答字节数
+  * @note            亮度参数超过BREATH_BRIGHTNESS_MAX时按最大值处理
+  */
+static uint32_t Cmd_Execute(const Cmd_Msg *msg, uint32_t brightness)
+{
+    Uart_Stats st;
+    Pool_Bench bench;
+    Anim_Bench anim;
+    Dds_Bench dds;
+    uint8_t *frame;
+    uint32_t lo;
+    uint32_t hi;
+#if LED1_INDICATOR_HW
+    uint32_t ticks;
+#endif
+    uint32_t n = 0;
+
+    switch(msg->type) {
+        case CMD_LEVEL:
+            lo = (msg->arg[0] < BREATH_BRIGHTNESS_MAX) ? msg->arg[0] : BREATH_BRIGHTNESS_MAX;
+            Breath_SetRange(&breath, (uint16_t)lo, (uint16_t)lo);
+#if LED2_KEYFRAMES
+            Led2_BuildKeys();
+#endif
+            n = Cmd_PutText(cmd_reply, "OK\n");
+            break;
+
+        case CMD_EFFECT:
+#if LED1_INDICATOR_HW
+            /* LED1由16位的TIM4计数：整个周期须在2 ~ 65536个tick内（PWM周期500微秒时1 ~ 32768毫秒），
+               超出时不截断，效果保持不变并应答ERR */
+            ticks = (msg->arg[0] <= UINT32_MAX / 1000U) ? msg->arg[0] * 1000U / BREATH_PWM_CYCLE : 0;
+            if(Indicator_SetPeriod(ticks) != 0) {
+                n = Cmd_PutText(cmd_reply, "ERR\n");
+                break;
+            }
+#endif
+            lo = (msg->argc == 3U) ? msg->arg[1] : 0;
+            hi = (msg->argc == 3U) ? msg->arg[2] : BREATH_BRIGHTNESS_MAX;
+            if(lo > BREATH_BRIGHTNESS_MAX) lo = BREATH_BRIGHTNESS_MAX;
+            if(hi > BREATH_BRIGHTNESS_MAX) hi = BREATH_BRIGHTNESS_MAX;
+            Breath_SetRange(&breath, (uint16_t)lo, (uint16_t)hi);
+#if LED1_INDICATOR_HW
+            /* TIM4在下一次溢出（最暗点）装入新周期，LED2在同一个最暗点切换，两者保持同相 */
+            breath_next_ms = msg->arg[0];
+#if LED2_KEYFRAMES
+            Led2_BuildKeys();                                    /* 新的亮度范围立即生效 */
+#endif
+#else
+            Led2_SetPeriod(msg->arg[0]);
+#endif
+            n = Cmd_PutText(cmd_reply, "OK\n");
+            break;
+
+        case CMD_STATS:
+            Uart_GetStats(&st);
+            n += Cmd_PutField(&cmd_reply[n], "rx", st.rx_bytes);
+            n += Cmd_PutField(&cmd_reply[n], "frames", st.frames);
+            n += Cmd_PutField(&cmd_reply[n], "peak", st.rx_peak);
+            n += Cmd_PutField(&cmd_reply[n], "lat", st.latency_max);
+            n += Cmd_PutField(&cmd_reply[n], "tx", st.tx_bytes);
+            n += Cmd_PutField(&cmd_reply[n], "drop", cmd.dropped);
+            n += Cmd_PutField(&cmd_reply[n], "level", brightness);
+            n += Cmd_PutField(&cmd_reply[n], "period", breath.den / 1000U);
+            n += Cmd_PutField(&cmd_reply[n], "boot", Startup_Cycles);
+            n += Cmd_PutField(&cmd_reply[n], "clk", device_clk);
+            cmd_reply[n - 1U] = '\n';
+            break;
+
+        case CMD_BENCH:
+            /* 平均值单位为纳秒，最长单轮耗时单位为CPU周期；malloc字段只在POOL_BENCH_MALLOC为1时有效 */
+            Pool_Benchmark((msg->argc >= 1U) ? msg->arg[0] : BENCH_SIZE, (msg->argc == 2U) ? msg->arg[1] : BENCH_DEPTH,
+                           BENCH_ROUNDS, Delay_Mark, SystemCoreClock / 1000000U, &bench);
+            n += Cmd_PutField(&cmd_reply[n], "pool", bench.pool_pair_ns);
+            n += Cmd_PutField(&cmd_reply[n], "pmax", bench.pool_max);
+            n += Cmd_PutField(&cmd_reply[n], "malloc", bench.malloc_pair_ns);
+            n += Cmd_PutField(&cmd_reply[n], "mmax", bench.malloc_max);
+            n += Cmd_PutField(&cmd_reply[n], "fail", bench.fail);
+            cmd_reply[n - 1U] = '\n';
+            break;
+
+        case CMD_ANIM:
+            /* 平均值单位为纳秒，单帧最长耗时单位为CPU周期；err=1表示数据损坏 */
+            lo = (msg->argc == 1U) ? msg->arg[0] : ANIM_BENCH_ROUNDS;
+            if(lo > ANIM_BENCH_ROUNDS_MAX) lo = ANIM_BENCH_ROUNDS_MAX;
+            frame = ARENA_NEW(&Arena_Frame, uint8_t, ANIM_DEMO_CHANNELS);      /* 解码帧缓冲，本PWM周期末回收 */
+            if(frame == NULL) {
+                n = Cmd_PutText(cmd_reply, "ERR\n");
+                break;
+            }
+            Anim_Benchmark(AnimDemo, AnimDemo_Size, frame, ANIM_DEMO_CHANNELS, lo,
+                           Delay_Mark, SystemCoreClock / 1000000U, &anim);
+            n += Cmd_PutField(&cmd_reply[n], "frames", anim.frames);
+            n += Cmd_PutField(&cmd_reply[n], "ns", anim.frame_ns);
+            n += Cmd_PutField(&cmd_reply[n], "max", anim.frame_max);
+            n += Cmd_PutField(&cmd_reply[n], "sum", anim.sum);
+            n += Cmd_PutField(&cmd_reply[n], "err", anim.status == ANIM_ERROR);
+            cmd_reply[n - 1U] = '\n';
+            break;
+
+        case CMD_DDS:
+            /* 吞吐量为每微秒处理的通道数 × 1000，总耗时单位为CPU周期；match=0表示两种实现输出不一致 */
+            if(Dds_RunBench((msg->argc >= 1U) ? msg->arg[0] : DDS_BENCH_CHANNELS_MAX,
+                            (msg->argc == 2U) ? msg->arg[1] : DDS_BENCH_ROUNDS, &dds) != 0) {
+                n = Cmd_PutText(cmd_reply, "ERR\n");
+                break;
+            }
+            n += Cmd_PutField(&cmd_reply[n], "scalar", dds.scalar_ch_per_us);
+            n += Cmd_PutField(&cmd_reply[n], "simd", dds.simd_ch_per_us);
+            n += Cmd_PutField(&cmd_reply[n], "scyc", dds.scalar_ticks);
+            n += Cmd_PutField(&cmd_reply[n], "vcyc", dds.simd_ticks);
+            n += Cmd_PutField(&cmd_reply[n], "match", dds.match);
+            cmd_reply[n - 1U] = '\n';
+            break;
+
+        default:
+            n = Cmd_PutText(cmd_reply, "ERR\n");
+            break;
+    }
+    return n;
+}
+
+/**
+  * @brief           处理串口控制
+  * @param         brightness 当前亮度
+  * @retval          None
+  * @note            解析在接收缓冲区上原地进行；上一条应答发送完成后才取下一条命令，
+  *                        每次调用最多执行一条，单个PWM周期内的耗时有上限
+  */
+static void Cmd_Service(uint32_t brightness)
+{
+    Cmd_Msg msg;
+
+    Uart_Poll(Cmd_Feed, &cmd);
+    if(!Uart_TxBusy() && Cmd_Take(&cmd, &msg)) {
+        Uart_Send((const uint8_t *)cmd_reply, Cmd_Execute(&msg, brightness));
+    }
+}
+#endif
 
 /**
   * @brief           主函数
@@ -33,53 +312,106 @@
   */
 int main(void)
 {   
-    /* 完整呼吸周期(秒) =  (BRIGHTNESS_MAX ÷ STEP) ×  (UPDATE_EVERY × PWM_CYCLE ÷ 1,000,000) × 2 */
-    static const int PWM_CYCLE = 500;         // PWM周期 = 500微秒/* PWM周期 */ 
-     static const int BRIGHTNESS_MAX = 255; // 亮度最大值 = 255（256级亮度）
-    static const int UPDATE_EVERY = 15;      // 更新间隔 = 每15个PWM周期更新一次
-    static const int STEP = 1;                          // 亮度步长 = 每次变化1级/* 每次亮度变化的步进值 */       
-
-    static int brightness = 0;                             /* 当前亮度值，范围0-255 */                                     
-    static int direction = 1;                                /* 亮度变化方向：1=递增，-1=递减 */                                        
-    static int counter = 0;                                  /* 循环计数器，用于控制亮度更新频率 */                                     
+    /* 参数取值见Breath.h；Breath_Evaluate()按本循环（Breath_Tick() + Delay_Until截止时刻）评估，
+       主机上可用Sweep工具扫描参数网格 */
+    static const int PWM_CYCLE = BREATH_PWM_CYCLE;                 // PWM周期 = 500微秒
+    static const int BRIGHTNESS_MAX = BREATH_BRIGHTNESS_MAX; // 亮度最大值 = 255（256级亮度）
+    static const int PERIOD_MS = BREATH_PERIOD_MS;                 // 完整呼吸周期 = 3825毫秒
+
+    uint32_t pwm_cycles;                                      /* PWM周期对应的CPU周期数 */
+    uint32_t mark;                                                /* 周期定时基准 */
     
+    Startup_MarkMain();                                         /* 启动耗时终点，须为第一条语句 */
+
     /* 硬件初始化 */
+    device_clk = Device_Init();                             /* 按实际主频设置Flash等待周期和缓存，按能力表设置APB分频 */
+    Pool_Init();                                                 /* 内存池：在任何分配之前初始化 */
     LED_Init();                                                  /* 初始化LED相关硬件（GPIO等） */
     
+    /* 效果初始化：每个PWM周期推进一次 */
+    Breath_Start(&breath, PERIOD_MS, 0, BRIGHTNESS_MAX, PWM_CYCLE);
+    pwm_cycles = SystemCoreClock / 1000000U * PWM_CYCLE;
+#if LED2_KEYFRAMES
+    Led2_BuildKeys();
+#endif
+
+#if SYNC_ROLE == SYNC_ROLE_LEADER
+    SyncPin_InitLeader();
+#elif SYNC_ROLE == SYNC_ROLE_FOLLOWER
+    PhaseLock_Init(&breath_lock, &breath, PHASELOCK_KP_SHIFT, PHASELOCK_KI_SHIFT);
+    SyncPin_InitFollower(Sync_OnPulse);
+#endif
+
+#if LED1_INDICATOR_HW
+    /* LED1：半个呼吸周期熄灭、半个周期点亮，与Breath_Tick()的节拍相同 */
+    Indicator_Init(PWM_CYCLE, PERIOD_MS * 1000U / PWM_CYCLE);
+#endif
+
+#if UART_CONTROL
+    Cmd_Init(&cmd);
+    Uart_Init(UART_BAUD);
+#endif
+    mark = Delay_Mark();
+    
     /* 主循环 */
     while(1) {        
-        /* 计算PWM占空比对应的亮灭时间 */
-        int on_time =(brightness * PWM_CYCLE) / BRIGHTNESS_MAX;       /* 高电平时间（有效亮度时间） */     
-        int off_time = PWM_CYCLE - on_time;                      /* 低电平时间（剩余时间） */                   
+#if LED1_INDICATOR_HW
+        /* 以TIM3溢出作为PWM周期起点 */
+        Indicator_WaitTick();
+        mark = Delay_Mark();
+#endif
+
+        /* 更新亮度并计算PWM占空比对应的亮灭时间 */
+        uint32_t brightness = Breath_Tick(&breath);                                            /* 当前亮度值，范围0-255 */
+#if UART_CONTROL && LED1_INDICATOR_HW
+        /* E命令的新周期：TIM4已在本次溢出装入，LED2在同一个最暗点切换 */
+        if(breath.event == BREATH_EVT_TROUGH && breath_next_ms != 0) {
+            Led2_SetPeriod(breath_next_ms);
+            breath_next_ms = 0;
+        }
+#endif
+#if LED2_KEYFRAMES
+        /* 每个最暗点回到第一个关键帧，消除整数tick与相位累加器之间的舍入差 */
+        if(breath.event == BREATH_EVT_TROUGH) Key_Seek(&led2, 0);
+        brightness = Key_Tick(&led2);
+#endif
+        uint32_t on_time = brightness * pwm_cycles / BRIGHTNESS_MAX;       /* 高电平时间（CPU周期） */     
+        uint32_t off_time = pwm_cycles - on_time;                                             /* 低电平时间（CPU周期） */                   
         
-        /* 执行一个PWM周期 */
+        /* 执行一个PWM周期：按截止时刻定时，循环体耗时不累积 */
         if(on_time > 0) {
-            LED_On_2();                 /* LED2点亮 */
-            Delay_us(on_time);       /* 保持高电平时间 */
+            LED_On_2();                                    /* LED2点亮 */
+            Delay_Until(&mark, on_time);         /* 保持高电平时间 */
         }
         if(off_time > 0) {
-            LED_Off_2();                 /* LED2熄灭 */
-            Delay_us(off_time);       /* 保持低电平时间 */
+            LED_Off_2();                                    /* LED2熄灭 */
         }
+#if UART_CONTROL
+        Cmd_Service(brightness);                   /* 耗时计入熄灭段，由截止时刻吸收 */
+#endif
+        Arena_Reset(&Arena_Frame);                 /* 本周期从帧分配区取得的临时内存全部回收 */
+#if !LED1_INDICATOR_HW
+        if(off_time > 0) {
+            Delay_Until(&mark, off_time);         /* 保持低电平时间（硬件指示时由Indicator_WaitTick()等待） */
+        }
+#endif
 
-         /* 亮度值更新逻辑 */
-        if(++counter >= UPDATE_EVERY) {
-            counter = 0;                                                 /* 重置计数器 */                                          
-            
-            /* 更新亮度值 */
-            brightness += direction * STEP;
-            
-             /* 亮度边界检查与方向控制 */
-            if(brightness >= 255) {
-                direction = -1;                                         /* 达到最大值，转为递减 */
-                brightness = 255;                                    /* 防止越界，确保值为255 */
-                LED_On_1();                                          /* 点亮LED1 */
-            } else if(brightness <= 0) {
-                direction = 1;                                           /* 达到最小值，转为递增 */          
-                brightness = 0;                                         /* 防止越界，确保值为0 */
-                LED_Off_1();                                           /* 熄灭LED1 */
-            }
+#if !LED1_INDICATOR_HW
+        /* 最亮点点亮LED1，最暗点熄灭LED1 */
+        if(breath.event == BREATH_EVT_PEAK) {
+            LED_On_1();
+        } else if(breath.event == BREATH_EVT_TROUGH) {
+            LED_Off_1();
         }
+#endif
+
+#if SYNC_ROLE == SYNC_ROLE_LEADER
+        /* 最暗点输出一个PWM周期宽的同步脉冲 */
+        SyncPin_Set(breath.event == BREATH_EVT_TROUGH);
+#elif SYNC_ROLE == SYNC_ROLE_FOLLOWER
+        /* 处理同步脉冲捕获，修正相位和相位增量 */
+        PhaseLock_Update(&breath_lock, &breath);
+#endif
     }
     
     /* 主循环理论上不应退出，此处返回语句仅用于语法完整性 */
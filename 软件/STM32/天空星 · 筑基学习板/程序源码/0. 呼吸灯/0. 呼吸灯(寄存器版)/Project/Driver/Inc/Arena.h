@@ -0,0 +1,142 @@
+/**
+  ************************************************************************************
+  * @file              Arena.h
+  * @author         None
+  * @version       V1.0.2
+  * @date            2026-10-17
+  * @brief           帧内临时内存（线性分配区）头文件
+  *
+  * @details        本文件提供按帧整体回收的线性分配区：
+  *                        1. 分配：Arena_Alloc()从当前位置按对齐要求向后切出一段，不能单独释放
+  *                        2. 回收：每帧结束调用一次Arena_Reset()，本帧分配的内存全部作废
+  *                        3. 水位：记录上一帧的用量、历史最高用量和失败次数，用于确定ARENA_FRAME_SIZE
+  *                        4. 调试：ARENA_POISON为1时回收时用ARENA_POISON_BYTE填充本帧用过的区域，
+  *                           下次分配时检查填充值，发现帧结束后仍经旧指针写入的情况
+  *                        Arena_Frame是效果渲染共用的帧分配区（排序后的边表、插值中间值、BAM位平面等），
+  *                        固件主循环在每个PWM周期末调用Arena_Reset(&Arena_Frame)（见main.c）
+  *
+  * @note            ARENA_FRAME_CCM为1时Arena_Frame放在CCM数据RAM（有CCM的型号），CPU访问无等待且不与DMA争用总线；
+  *                        GCC下有CCM的型号默认为1，Keil下默认为0：工程未勾选IRAM2，没有覆盖0x10000000的执行区，
+  *                        固定地址节会链接失败（L6985E）
+  *
+  * @attention     注意事项：
+  *                         1. CCM不能被DMA访问：要交给DMA发送的缓冲区不能从Arena_Frame分配
+  *                         2. 帧分配区不是线程安全的：只在主循环中分配和回收，中断中使用内存池（Pool.h）
+  *                         3. Arena_Reset()之后本帧的指针全部失效
+  *                         4. Keil下放入CCM：目标设置中勾选IRAM2（0x10000000，大小为DEVICE_CCM_SIZE）并定义ARENA_FRAME_CCM=1；
+  *                            勾选后自动生成的分散加载文件中RW_IRAM2也接收.ANY(+RW +ZI)，
+  *                            须确认DMA缓冲区（Uart、Ws2812、Shift595等）没有被放进CCM
+  *
+  *                         修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.0.1 Keil下ARENA_FRAME_CCM默认为0（工程没有IRAM2执行区）
+  *                         - 2026-10-17 V1.0.2 注明固件主循环的回收位置
+  *
+  ************************************************************************************
+  */
+
+#ifndef __ARENA_H
+#define __ARENA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "Device.h"
+
+#ifndef ARENA_FRAME_SIZE
+#define ARENA_FRAME_SIZE                      4096U        /* 帧分配区大小，单位：字节（8的倍数） */
+#endif
+
+#ifndef ARENA_FRAME_CCM
+#if defined(__CC_ARM) || defined(__ARMCC_VERSION)
+#define ARENA_FRAME_CCM                       0               /* 0=放在普通SRAM（Project.uvprojx未启用IRAM2） */
+#else
+#define ARENA_FRAME_CCM                       (DEVICE_CCM_SIZE > 0U)  /* 1=放在CCM数据RAM，0=放在普通SRAM */
+#endif
+#endif
+
+#ifndef ARENA_POISON
+#define ARENA_POISON                             0               /* 1=回收时填充并在分配时检查（调试用） */
+#endif
+
+#define ARENA_POISON_BYTE                    0xA5U          /* 填充值 */
+#define ARENA_ALIGN                               8U             /* 默认对齐，单位：字节 */
+
+/** 分配n个type，按type的对齐要求对齐 */
+#define ARENA_NEW(a, type, n)                  ((type *)Arena_Alloc((a), (uint32_t)sizeof(type) * (uint32_t)(n), \
+                                                                                 (uint32_t)__alignof__(type)))
+
+/**
+  * @brief   分配区
+  */
+typedef struct
+{
+    uint8_t *base;                                      /* 存储区 */
+    uint32_t size;                                      /* 存储区大小，单位：字节 */
+    uint32_t top;                                        /* 当前帧已用字节数（含对齐填充） */
+    uint32_t last;                                       /* 上一帧结束时的用量 */
+    uint32_t peak;                                      /* 历史最高用量 */
+    uint32_t fail;                                        /* 空间不足的次数 */
+    uint32_t frames;                                   /* 已回收的帧数 */
+    uint32_t poisoned;                               /* [0, poisoned)已填充（ARENA_POISON为1时使用） */
+    uint32_t corrupt;                                  /* 分配时发现填充值被改写的次数 */
+} Arena;
+
+/**
+  * @brief   用量报告
+  */
+typedef struct
+{
+    uint32_t size;                                      /* 存储区大小，单位：字节 */
+    uint32_t used;                                      /* 当前帧已用字节数 */
+    uint32_t last;                                       /* 上一帧的用量 */
+    uint32_t peak;                                      /* 历史最高用量（含当前帧） */
+    uint32_t fail;                                        /* 空间不足的次数 */
+    uint32_t frames;                                   /* 已回收的帧数 */
+    uint32_t corrupt;                                  /* 帧结束后仍被写入的次数 */
+} Arena_Report;
+
+/** 效果渲染共用的帧分配区 */
+extern Arena Arena_Frame;
+
+/**
+  * @brief           初始化分配区
+  * @param        a 分配区
+  * @param        buf 存储区
+  * @param        size 存储区大小，单位：字节
+  * @retval          None
+  */
+void Arena_Init(Arena *a, void *buf, uint32_t size);
+
+/**
+  * @brief           分配一段内存
+  * @param        a 分配区
+  * @param        size 字节数
+  * @param        align 对齐，单位：字节（2的幂），0表示ARENA_ALIGN
+  * @retval          地址，NULL=本帧剩余空间不足（不改变当前位置）
+  * @note           内容不清零
+  */
+void *Arena_Alloc(Arena *a, uint32_t size, uint32_t align);
+
+/**
+  * @brief           回收本帧的全部分配
+  * @param        a 分配区
+  * @retval          None
+  * @note           更新水位；ARENA_POISON为1时填充本帧用过的区域
+  */
+void Arena_Reset(Arena *a);
+
+/**
+  * @brief           读取用量报告
+  * @param        a 分配区
+  * @param        r 输出：报告
+  * @retval          None
+  */
+void Arena_GetReport(const Arena *a, Arena_Report *r);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __ARENA_H */
@@ -0,0 +1,65 @@
+/**
+  ************************************************************************************
+  * @file              Atomic.h
+  * @author         None
+  * @version       V1.0.0
+  * @date            2026-10-17
+  * @brief           独占访问（LDREX/STREX）封装头文件
+  *
+  * @details        本文件把32位独占读写封装为ATOMIC_xxx，供无锁的链表头和交换槽使用：
+  *                        1. ATOMIC_LDREX(p)：独占读*p
+  *                        2. ATOMIC_STREX(v, p)：独占写*p = v，返回0=成功，1=独占已失效，须重新读取
+  *                        3. ATOMIC_CLREX()：放弃独占（读到的值不需要写回时）
+  *                        Cortex-M4（ARMCC或GCC）上映射到LDREX/STREX/CLREX指令；
+  *                        主机端（REG_SIM或非ARM编译器）单线程运行，退化为普通读写，STREX总是成功
+  *
+  * @note            CMSIS V4.10的__LDREXW/__STREXW直接展开为__ldrex/__strex，ARMCC 5.06对其报#3731-D（已弃用），
+  *                        按CMSIS V4.3之后的写法在展开处局部屏蔽，不影响其他代码的诊断
+  *
+  * @attention     注意事项：
+  *                         1. 异常进入和返回会清除独占监视器，LDREX与STREX之间被中断时STREX失败，调用者循环重试
+  *                         2. LDREX与STREX之间不要访问其他独占地址，保持尽量少的指令
+  *
+  *                         修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本（由Pool.c和Shift595.c中相同的宏合并而来）
+  *
+  ************************************************************************************
+  */
+
+#ifndef __ATOMIC_H
+#define __ATOMIC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#if !defined(REG_SIM) && (defined(__CC_ARM) || defined(__ARM_ARCH_7EM__))
+
+#include "stm32f4xx.h"
+
+#if defined(__CC_ARM)
+#define ATOMIC_LDREX(p)                        _Pragma("push") _Pragma("diag_suppress 3731") \
+                                                       ((uint32_t)__ldrex((volatile uint32_t *)(p))) _Pragma("pop")
+#define ATOMIC_STREX(v, p)                    _Pragma("push") _Pragma("diag_suppress 3731") \
+                                                       ((uint32_t)__strex((uint32_t)(v), (volatile uint32_t *)(p))) _Pragma("pop")
+#else
+#define ATOMIC_LDREX(p)                        __LDREXW((volatile uint32_t *)(p))
+#define ATOMIC_STREX(v, p)                    __STREXW((uint32_t)(v), (volatile uint32_t *)(p))
+#endif
+#define ATOMIC_CLREX()                          __CLREX()
+
+#else
+
+#define ATOMIC_LDREX(p)                        (*(p))
+#define ATOMIC_STREX(v, p)                    ((*(p) = (v)), 0U)
+#define ATOMIC_CLREX()                          ((void)0)
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __ATOMIC_H */
@@ -0,0 +1,95 @@
+/**
+  ************************************************************************************
+  * @file              Charlie.h
+  * @author         None
+  * @version       V1.2.0
+  * @date            2026-10-17
+  * @brief           查理复用（Charlieplexing）LED驱动头文件
+  *
+  * @details        本文件提供用N个引脚驱动N×(N-1)个LED的接口：
+  *                        1. 每个扫描时隙选一个引脚输出高电平作阳极，要点亮的LED的阴极引脚输出低电平，
+  *                           其余引脚为输入（高阻）
+  *                        2. 每个时隙的MODER和BSRR在Charlie_Render()中预先算好整字，
+  *                           TIM6中断中只写MODER（消隐）、BSRR、MODER三次引脚相关寄存器，不做读-改-写
+  *                        3. 亮度按位拆成CHARLIE_BITS个子帧，第k个子帧的时隙时长为 unit × 2^k
+  *
+  * @note            LED编号：阳极引脚a、阴极引脚c（a≠c）的LED编号为 a × (N-1) + (c < a ? c : c-1)，
+  *                        其中a、c为引脚在pin[]中的下标
+  *                        刷新率 = 定时器时钟 ÷ (unit × N × (2^CHARLIE_BITS - 1))
+  *
+  * @attention     注意事项：
+  *                         1. 初始化时记录端口上其他引脚的MODER，运行中不得再修改该端口的MODER
+  *                         2. 换时隙时先把全部复用引脚切为输入再写BSRR，消隐期间（约2个周期）所有LED熄灭，
+  *                            不会有旧时隙的引脚输出新电平造成鬼影
+  *
+  *                         修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 TIM6中断名随型号变化
+  *                         - 2026-10-17 V1.2.0 中断中先消隐再写BSRR，消除鬼影
+  *
+  ************************************************************************************
+  */
+
+#ifndef __CHARLIE_H
+#define __CHARLIE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "stm32f4xx.h"
+#include "Device.h"
+
+#define CHARLIE_BITS                           4U             /* 亮度位数（子帧数） */
+#define CHARLIE_MAX_PINS                    16U           /* 最多引脚数 */
+#define CHARLIE_MIN_UNIT                     168U          /* 最短单位时长，单位：定时器计数（2μs） */
+
+/**
+  * @brief   一个扫描时隙的寄存器映像
+  */
+typedef struct
+{
+    uint32_t bsrr;                                     /* 阳极置高、阴极置低 */
+    uint32_t moder;                                   /* 整个端口的MODER值 */
+    uint32_t arr;                                       /* 时隙时长 - 1 */
+} Charlie_Slot;
+
+/**
+  * @brief           初始化并开始扫描
+  * @param        port GPIO端口
+  * @param        pin 引脚号列表（由调用者保持有效）
+  * @param        n 引脚数（2 ~ CHARLIE_MAX_PINS）
+  * @param        unit 最低位子帧的时隙时长，单位：定时器计数（Device_TimClk1()，F407上84MHz）
+  * @param        front 显示缓冲区，CHARLIE_BITS × n项
+  * @param        back 后台缓冲区，CHARLIE_BITS × n项
+  * @retval          None
+  */
+void Charlie_Init(GPIO_TypeDef *port, const uint8_t *pin, uint32_t n, uint32_t unit,
+                  Charlie_Slot *front, Charlie_Slot *back);
+
+/**
+  * @brief           计算新一帧并在扫描完当前帧后切换
+  * @param        level 各LED亮度（0 ~ 2^CHARLIE_BITS - 1），n × (n-1)项
+  * @retval          0=已提交，1=上一帧尚未切换
+  */
+uint8_t Charlie_Render(const uint8_t *level);
+
+/**
+  * @brief           当前配置的刷新率
+  * @param        None
+  * @retval          刷新率，单位：Hz
+  */
+uint32_t Charlie_RefreshHz(void);
+
+/**
+  * @brief           TIM6中断处理函数（TIM6_DAC_IRQHandler，F412上为TIM6_IRQHandler）
+  * @param        None
+  * @retval          None
+  */
+void DEVICE_TIM6_IRQHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __CHARLIE_H */
@@ -2,7 +2,7 @@
   ************************************************************************************
   * @file              Delay.h
   * @author         None
-  * @version       V1.0.0
+  * @version       V1.1.1
   * @date            2026-01-18
   * @brief           延时函数模块头文件
   *
@@ -11,12 +11,15 @@
   *                        1. 微秒延时：Delay_us()
   *                        2. 毫秒延时：Delay_ms()
   *                        3. 秒延时：Delay_s()
+  *                        另提供按周期延时Delay_Cycles()和无漂移周期定时Delay_Mark()/Delay_Until()
   *
-  * @note            延时函数基于系统时钟实现，延时精度与系统时钟频率相关
+  * @note            延时函数基于自由运行的DWT周期计数器实现，延时精度与系统时钟频率相关
   *                        使用前需确保系统时钟已正确配置
   *
   * @attention     修改日志：
   *                         - 2026-01-18 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 增加Delay_Cycles/Delay_Mark/Delay_Until，长延时不再截断
+  *                         - 2026-10-17 V1.1.1 更正毫秒/秒延时的参数范围说明
   *
   ************************************************************************************
   */
@@ -34,13 +37,12 @@ extern "C" {
   * @brief           微秒级延时函数
   * @param        us 延时时间，单位：微秒
   * @retval          None
-  * @note           使用SysTick定时器或软件循环实现微秒级延时
+  * @note           使用DWT周期计数器实现微秒级延时
   *                        延时时间与实际时钟频率相关
   *
   * @attention    注意事项：
-  *                        1. 参数范围：1-1000000微秒
+  *                        1. 参数范围：0-4294967295微秒，不截断
   *                        2. 延时精度受中断影响
-  *                        3. 长时间延时请使用Delay_ms或Delay_s
   */
 void Delay_us(uint32_t us);
 
@@ -48,11 +50,11 @@ void Delay_us(uint32_t us);
   * @brief           毫秒级延时函数
   * @param        ms 延时时间，单位：毫秒
   * @retval          None
-  * @note           基于Delay_us函数实现的毫秒级延时
+  * @note           换算成总周期数后一次连续计数
   *                        实际延时 = ms * 1000微秒
   *
   * @attention    注意事项：
-  *                        1. 参数范围：1-4294967毫秒（约71.5分钟）
+  *                        1. 参数范围：0-4294967295毫秒（约49.7天），不截断
   *                        2. 长时间延时可能影响系统实时性
   *                        3. 延时期间CPU处于忙等待状态
   */
@@ -62,16 +64,44 @@ void Delay_ms(uint32_t ms);
   * @brief           秒级延时函数
   * @param        s 延时时间，单位：秒
   * @retval          None
-  * @note           基于Delay_ms函数实现的秒级延时
+  * @note           换算成总周期数后一次连续计数
   *                        实际延时 = s * 1000毫秒
   *
   * @attention    注意事项：
-  *                        1. 参数范围：1-4294967秒（约49.7天）
+  *                        1. 参数范围：0-4294967295秒（约136年），不截断
   *                        2. 超长时间延时建议使用硬件定时器
   *                        3. 延时期间CPU无法处理其他任务
   */
 void Delay_s(uint32_t s);
 
+/**
+  * @brief           按CPU周期延时函数
+  * @param        cycles 延时时长，单位：CPU周期
+  * @retval          None
+  * @note           64位累计经过的周期数，任意时长都不截断
+  */
+void Delay_Cycles(uint64_t cycles);
+
+/**
+  * @brief           取周期性定时的起点
+  * @param        None
+  * @retval          当前时刻（DWT->CYCCNT）
+  */
+uint32_t Delay_Mark(void);
+
+/**
+  * @brief           周期性定时：等待到 *mark + cycles，并把 *mark 推进cycles
+  * @param        mark 上一次的截止时刻
+  * @param        cycles 间隔，单位：CPU周期（小于2^31）
+  * @retval          None
+  * @note           截止时刻按固定间隔推进，循环体耗时不累积，长时间运行累计误差为0个周期
+  *
+  * @attention    注意事项：
+  *                        1. 用法：mark = Delay_Mark(); while(1) { ...; Delay_Until(&mark, n); }
+  *                        2. 循环体耗时超过间隔时立即返回，后续周期自动追赶
+  */
+void Delay_Until(uint32_t *mark, uint32_t cycles);
+
 #ifdef __cplusplus
 }
 #endif
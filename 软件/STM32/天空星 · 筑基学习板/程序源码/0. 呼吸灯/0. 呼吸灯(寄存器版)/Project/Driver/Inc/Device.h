@@ -0,0 +1,242 @@
+/**
+  ************************************************************************************
+  * @file              Device.h
+  * @author         None
+  * @version       V1.1.0
+  * @date            2026-10-17
+  * @brief           器件能力表头文件
+  *
+  * @details        本文件按芯片型号宏（STM32F40_41xxx、STM32F401xx等）提供器件差异：
+  *                        1. 编译期宏：DEVICE_ID、DEVICE_TIMERS、DEVICE_GPIO_PORTS、DEVICE_CCM_SIZE等，
+  *                           可用在#if中，驱动据此只在有对应定时器的型号上编译
+  *                        2. 运行期能力表：Device_Get()返回当前型号的最高主频、总线上限、
+  *                           Flash等待周期曲线、CCM大小、GPIO端口和定时器集合
+  *                        3. 时钟换算：Device_Pclk1()/Device_TimClk1()等按RCC->CFGR中的实际分频计算，
+  *                           驱动不再假设APB1 = APB2 = SystemCoreClock ÷ 2
+  *                        4. Device_Init()：按实际主频设置最少的Flash等待周期并打开预取和指令/数据缓存，
+  *                           按能力表中的APB上限把APB1/APB2设为不超限的最小分频
+  *                        5. Device_CheckClocks()：按能力表核对当前主频和APB频率
+  *
+  * @note            各型号的最高主频由system_stm32f4xx.c的PLL配置决定（F40x 168MHz、F42x/F446/F469 180MHz、
+  *                        F401 84MHz、F410/F411/F412/F413 100MHz），同一份驱动在各型号上都按实际时钟计算
+  *                        驱动用到的DMA请求（DMA1 Stream1通道3 = TIM2_UP、DMA1 Stream4通道0 = SPI2_TX、
+  *                        DMA2 Stream2/Stream7通道4 = USART1_RX/TX）在所有F4型号上相同，不放入能力表
+  *
+  * @attention     注意事项：
+  *                         1. 更换型号时同时修改Keil工程中的型号宏和启动文件（Firmware/StartUp/startup_xxx.s）
+  *                         2. 能力表与本文件的编译期宏需保持一致（主机检查程序hostcheck device逐项核对）
+  *
+  *                         修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 增加Device_TuneBus()和Device_CheckClocks()，APB分频由能力表决定
+  *
+  ************************************************************************************
+  */
+
+#ifndef __DEVICE_H
+#define __DEVICE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "stm32f4xx.h"
+
+/**
+  * @brief   型号编号（Device_Get()->id）
+  */
+#define DEVICE_F40X                              0U             /* STM32F405/407/415/417 */
+#define DEVICE_F427                              1U             /* STM32F427/437 */
+#define DEVICE_F429                              2U             /* STM32F429/439 */
+#define DEVICE_F401                              3U             /* STM32F401 */
+#define DEVICE_F410                              4U             /* STM32F410 */
+#define DEVICE_F411                              5U             /* STM32F411 */
+#define DEVICE_F412                              6U             /* STM32F412 */
+#define DEVICE_F413                              7U             /* STM32F413/423 */
+#define DEVICE_F446                              8U             /* STM32F446 */
+#define DEVICE_F469                              9U             /* STM32F469/479 */
+#define DEVICE_COUNT                           10U           /* 型号数 */
+
+#define DEVICE_WS_MAX                         8U             /* 等待周期曲线最多项数 */
+
+/**
+  * @brief   时钟检查结果（可按位组合）
+  */
+#define DEVICE_CLK_OK                            0U             /* 全部在上限内 */
+#define DEVICE_CLK_SYSCLK                      0x01U         /* SystemCoreClock超过最高主频 */
+#define DEVICE_CLK_APB1                          0x02U         /* PCLK1超过APB1上限 */
+#define DEVICE_CLK_APB2                          0x04U         /* PCLK2超过APB2上限 */
+#define DEVICE_CCM_BASE                       0x10000000U /* CCM数据RAM起始地址 */
+
+/* ---------------------------------- 编译期能力 ---------------------------------- */
+
+/*
+ * DEVICE_TIMERS：第n位为1表示有TIMn
+ * DEVICE_GPIO_PORTS：第n位为1表示有GPIO端口A+n
+ * DEVICE_CCM_SIZE：CCM数据RAM字节数，0表示没有
+ */
+#if defined(STM32F40_41xxx)
+#define DEVICE_ID                                  DEVICE_F40X
+#define DEVICE_TIMERS                          0x7FFEU     /* TIM1~TIM14 */
+#define DEVICE_GPIO_PORTS                  0x01FFU     /* A~I */
+#define DEVICE_CCM_SIZE                       0x10000U
+#elif defined(STM32F427_437xx)
+#define DEVICE_ID                                  DEVICE_F427
+#define DEVICE_TIMERS                          0x7FFEU
+#define DEVICE_GPIO_PORTS                  0x07FFU     /* A~K */
+#define DEVICE_CCM_SIZE                       0x10000U
+#elif defined(STM32F429_439xx)
+#define DEVICE_ID                                  DEVICE_F429
+#define DEVICE_TIMERS                          0x7FFEU
+#define DEVICE_GPIO_PORTS                  0x07FFU
+#define DEVICE_CCM_SIZE                       0x10000U
+#elif defined(STM32F401xx)
+#define DEVICE_ID                                  DEVICE_F401
+#define DEVICE_TIMERS                          0x0E3EU     /* TIM1~TIM5、TIM9~TIM11 */
+#define DEVICE_GPIO_PORTS                  0x009FU     /* A~E、H */
+#define DEVICE_CCM_SIZE                       0U
+#elif defined(STM32F410xx)
+#define DEVICE_ID                                  DEVICE_F410
+#define DEVICE_TIMERS                          0x0A62U     /* TIM1、TIM5、TIM6、TIM9、TIM11 */
+#define DEVICE_GPIO_PORTS                  0x0087U     /* A~C、H */
+#define DEVICE_CCM_SIZE                       0U
+#elif defined(STM32F411xE)
+#define DEVICE_ID                                  DEVICE_F411
+#define DEVICE_TIMERS                          0x0E3EU
+#define DEVICE_GPIO_PORTS                  0x009FU
+#define DEVICE_CCM_SIZE                       0U
+#elif defined(STM32F412xG)
+#define DEVICE_ID                                  DEVICE_F412
+#define DEVICE_TIMERS                          0x7FFEU
+#define DEVICE_GPIO_PORTS                  0x00FFU     /* A~H */
+#define DEVICE_CCM_SIZE                       0U
+#elif defined(STM32F413_423xx)
+#define DEVICE_ID                                  DEVICE_F413
+#define DEVICE_TIMERS                          0x7FFEU
+#define DEVICE_GPIO_PORTS                  0x00FFU
+#define DEVICE_CCM_SIZE                       0U
+#elif defined(STM32F446xx)
+#define DEVICE_ID                                  DEVICE_F446
+#define DEVICE_TIMERS                          0x7FFEU
+#define DEVICE_GPIO_PORTS                  0x00FFU
+#define DEVICE_CCM_SIZE                       0U
+#elif defined(STM32F469_479xx)
+#define DEVICE_ID                                  DEVICE_F469
+#define DEVICE_TIMERS                          0x7FFEU
+#define DEVICE_GPIO_PORTS                  0x07FFU
+#define DEVICE_CCM_SIZE                       0x10000U
+#else
+#error "Device.h: unsupported STM32F4 part"
+#endif
+
+/** 有TIMn时为1（可用在#if中） */
+#define DEVICE_HAS_TIM(n)                    ((DEVICE_TIMERS >> (n)) & 1U)
+
+/** 有GPIO端口（0=A）时为1（可用在#if中） */
+#define DEVICE_HAS_GPIO(port)               ((DEVICE_GPIO_PORTS >> (port)) & 1U)
+
+/* F412的TIM6不带DAC，中断名不同 */
+#if defined(STM32F412xG)
+#define DEVICE_TIM6_IRQn                     TIM6_IRQn
+#define DEVICE_TIM6_IRQHandler           TIM6_IRQHandler
+#else
+#define DEVICE_TIM6_IRQn                     TIM6_DAC_IRQn
+#define DEVICE_TIM6_IRQHandler           TIM6_DAC_IRQHandler
+#endif
+
+/**
+  * @brief   器件能力
+  */
+typedef struct
+{
+    const char *name;                               /* 型号名 */
+    uint8_t id;                                          /* 型号编号DEVICE_xxx */
+    uint8_t ws_count;                                /* 等待周期曲线项数 */
+    uint8_t ws_mhz[DEVICE_WS_MAX];        /* 第n项：n个等待周期允许的最高HCLK，单位：MHz（2.7~3.6V） */
+    uint32_t sysclk_max;                            /* 最高SYSCLK，单位：Hz */
+    uint32_t apb1_max;                              /* APB1最高频率，单位：Hz */
+    uint32_t apb2_max;                              /* APB2最高频率，单位：Hz */
+    uint32_t ccm_size;                              /* CCM数据RAM字节数，0=没有 */
+    uint16_t gpio_ports;                            /* GPIO端口集合，第n位 = 端口A+n */
+    uint16_t timers;                                  /* 定时器集合，第n位 = TIMn */
+} Device_Caps;
+
+/**
+  * @brief           当前型号的能力
+  * @param        None
+  * @retval          能力表中DEVICE_ID对应的一项
+  */
+const Device_Caps *Device_Get(void);
+
+/**
+  * @brief           指定HCLK所需的最少Flash等待周期
+  * @param        hclk HCLK频率，单位：Hz
+  * @retval          等待周期数；超过最高主频时返回曲线的最后一项
+  */
+uint32_t Device_FlashLatency(uint32_t hclk);
+
+/**
+  * @brief           按SystemCoreClock设置Flash等待周期，并打开预取和指令/数据缓存
+  * @param        None
+  * @retval          设置的等待周期数
+  * @note           只能在时钟已切换到目标频率后调用；提高主频前须先增加等待周期
+  */
+uint32_t Device_TuneFlash(void);
+
+/**
+  * @brief           按能力表设置APB1/APB2分频
+  * @param        None
+  * @retval          DEVICE_CLK_xxx的组合（SYSCLK超限时APB按最大分频16仍可能超限）
+  * @note           每条总线取使PCLK不超过上限的最小分频；须在外设初始化之前调用，
+  *                        之后Device_Pclk1()等返回新的频率
+  */
+uint32_t Device_TuneBus(void);
+
+/**
+  * @brief           按能力表核对当前时钟
+  * @param        None
+  * @retval          DEVICE_CLK_xxx的组合
+  */
+uint32_t Device_CheckClocks(void);
+
+/**
+  * @brief           更新SystemCoreClock，调整Flash和APB分频
+  * @param        None
+  * @retval          Device_TuneBus()的返回值
+  * @note           在main()开头、任何按时钟计算参数的驱动初始化之前调用
+  */
+uint32_t Device_Init(void);
+
+/**
+  * @brief           APB1外设时钟
+  * @param        None
+  * @retval          频率，单位：Hz
+  */
+uint32_t Device_Pclk1(void);
+
+/**
+  * @brief           APB2外设时钟
+  * @param        None
+  * @retval          频率，单位：Hz
+  */
+uint32_t Device_Pclk2(void);
+
+/**
+  * @brief           APB1定时器时钟（TIM2~TIM7、TIM12~TIM14）
+  * @param        None
+  * @retval          频率，单位：Hz；APB1分频不为1时为PCLK1 × 2
+  */
+uint32_t Device_TimClk1(void);
+
+/**
+  * @brief           APB2定时器时钟（TIM1、TIM8~TIM11）
+  * @param        None
+  * @retval          频率，单位：Hz；APB2分频不为1时为PCLK2 × 2
+  */
+uint32_t Device_TimClk2(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __DEVICE_H */
@@ -0,0 +1,69 @@
+/**
+  ************************************************************************************
+  * @file              Indicator.h
+  * @author         None
+  * @version       V1.1.1
+  * @date            2026-10-17
+  * @brief           LED1硬件指示驱动头文件
+  *
+  * @details        本文件提供由定时器级联产生LED1指示的接口：
+  *                        1. TIM3为主定时器，每个PWM周期溢出一次，更新事件作为TRGO输出
+  *                        2. TIM4为从定时器，经内部触发ITR2对TIM3的溢出计数（外部时钟模式1）
+  *                        3. TIM4_CH3（PB8）工作在PWM模式2：前半个呼吸周期熄灭，后半个周期点亮
+  *                        主循环用Indicator_WaitTick()等待TIM3溢出推进呼吸效果，
+  *                        两个LED共用同一个时间基准，LED1翻转不需要CPU参与
+  *                        运行中用Indicator_SetPeriod()修改呼吸周期，新周期从下一个最暗点开始
+  *
+  * @note            硬件连接：
+  *                        - LED1连接PB8引脚（TIM4_CH3，AF2），低电平点亮
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 增加Indicator_SetPeriod()
+  *                         - 2026-10-17 V1.1.1 Indicator_SetPeriod()写入期间屏蔽更新事件
+  *
+  ************************************************************************************
+  */
+
+#ifndef __INDICATOR_H
+#define __INDICATOR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "stm32f4xx.h"
+
+/**
+  * @brief           初始化定时器级联
+  * @param        tick_us 主定时器溢出周期（PWM周期），单位：微秒，1-65536
+  * @param        period_ticks 完整呼吸周期包含的tick数（偶数），2-65536
+  * @retval          None
+  * @note           须在LED_Init()之后调用，PB8由通用输出切换为TIM4_CH3复用输出；
+  *                        两个定时器同时从0开始计数，对应呼吸效果的最暗点
+  */
+void Indicator_Init(uint32_t tick_us, uint32_t period_ticks);
+
+/**
+  * @brief           运行中修改呼吸周期
+  * @param        period_ticks 完整呼吸周期包含的tick数（偶数），2-65536
+  * @retval          0=成功，1=超出TIM4的16位范围
+  * @note           ARR和CCR3都有预装载，写入后当前周期照常走完，
+  *                        在TIM4下一次溢出（即最暗点）同时生效，LED1不会出现半截的亮灭段；
+  *                        两次写入期间置TIM4的UDIS，溢出恰好落在写入期间时新周期推迟到再下一个最暗点
+  */
+uint8_t Indicator_SetPeriod(uint32_t period_ticks);
+
+/**
+  * @brief           等待主定时器溢出
+  * @param        None
+  * @retval          None
+  * @note           返回时清除TIM3更新标志；若上次调用后已溢出则立即返回
+  */
+void Indicator_WaitTick(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __INDICATOR_H */
@@ -0,0 +1,104 @@
+/**
+  ************************************************************************************
+  * @file              Matrix.h
+  * @author         None
+  * @version       V1.1.0
+  * @date            2026-10-17
+  * @brief           行扫描LED点阵驱动头文件
+  *
+  * @details        本文件提供行扫描点阵的驱动接口：
+  *                        1. 行、列分别接在两个GPIO端口上（各不超过16个引脚），引脚号和有效电平可配置
+  *                        2. 亮度按位拆成MATRIX_BITS个子帧，第k个子帧每行显示 unit × 2^k 个定时器计数
+  *                        3. TIM7每次更新显示一行：先关闭全部列（消隐），再切换行，再写入该行的列，
+  *                           最后写入本行的显示时长；除清除标志外每次中断固定4次寄存器写
+  *
+  * @note            刷新率 = 定时器时钟 ÷ (unit × 行数 × (2^MATRIX_BITS - 1))
+  *                        单个像素的最大占空比为 1 ÷ 行数
+  *
+  * @attention     注意事项：
+  *                         1. Matrix_Render()在后台缓冲区中预先计算所有BSRR字，中断中只做查表写入
+  *                         2. unit须大于中断响应时间（不小于MATRIX_MIN_UNIT）
+  *
+  *                         修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 时长单位按实际定时器时钟说明
+  *
+  ************************************************************************************
+  */
+
+#ifndef __MATRIX_H
+#define __MATRIX_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "stm32f4xx.h"
+
+#define MATRIX_BITS                              4U             /* 亮度位数（子帧数） */
+#define MATRIX_MAX_ROWS                     16U           /* 最多行数 */
+#define MATRIX_MAX_COLS                      16U           /* 最多列数 */
+#define MATRIX_MIN_UNIT                       168U          /* 最短单位时长，单位：定时器计数（2μs） */
+
+/**
+  * @brief   点阵配置
+  */
+typedef struct
+{
+    GPIO_TypeDef *row_port;                      /* 行端口 */
+    GPIO_TypeDef *col_port;                       /* 列端口 */
+    const uint8_t *row_pin;                       /* 各行引脚号 */
+    const uint8_t *col_pin;                        /* 各列引脚号 */
+    uint8_t rows;                                     /* 行数 */
+    uint8_t cols;                                      /* 列数 */
+    uint8_t row_active_low;                       /* 1=行低电平有效 */
+    uint8_t col_active_low;                        /* 1=列低电平点亮 */
+    uint32_t unit;                                     /* 最低位子帧每行的时长，单位：定时器计数（Device_TimClk1()，F407上84MHz） */
+} Matrix_Config;
+
+/**
+  * @brief   一次扫描的预计算数据
+  */
+typedef struct
+{
+    uint32_t row;                                      /* 行端口BSRR：选中本行，释放其他行 */
+    uint32_t col;                                      /* 列端口BSRR：本行各列的亮灭 */
+    uint32_t arr;                                       /* 本行的显示时长 - 1 */
+} Matrix_Slot;
+
+/**
+  * @brief           初始化点阵并开始扫描
+  * @param        cfg 点阵配置（由调用者保持有效）
+  * @param        front 显示缓冲区，MATRIX_BITS × rows项
+  * @param        back 后台缓冲区，MATRIX_BITS × rows项
+  * @retval          None
+  * @note           两个缓冲区初始为全灭
+  */
+void Matrix_Init(const Matrix_Config *cfg, Matrix_Slot *front, Matrix_Slot *back);
+
+/**
+  * @brief           计算新一帧并在扫描完当前帧后切换
+  * @param        level 各像素亮度（0 ~ 2^MATRIX_BITS - 1），按行存放，rows × cols项
+  * @retval          0=已提交，1=上一帧尚未切换
+  */
+uint8_t Matrix_Render(const uint8_t *level);
+
+/**
+  * @brief           当前配置的刷新率
+  * @param        None
+  * @retval          刷新率，单位：Hz
+  */
+uint32_t Matrix_RefreshHz(void);
+
+/**
+  * @brief           TIM7中断处理函数
+  * @param        None
+  * @retval          None
+  */
+void TIM7_IRQHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __MATRIX_H */
@@ -0,0 +1,157 @@
+/**
+  ************************************************************************************
+  * @file              Pool.h
+  * @author         None
+  * @version       V1.1.0
+  * @date            2026-10-17
+  * @brief           固定块内存池头文件
+  *
+  * @details        本文件提供替代malloc/free的固定块内存池：
+  *                        1. 配置：POOL_TABLE(X)静态列出各池的块大小和块数，存储区在编译期分配
+  *                        2. 分配：Pool_Alloc()取块大小不小于请求的最小池，该池用完时依次尝试更大的池；
+  *                           Pool_AllocFrom()只从指定池分配
+  *                        3. 释放：Pool_Free()按地址范围找到所属池，放回空闲链表
+  *                        4. 统计：每个池的当前占用、最高占用和分配失败次数
+  *                        5. 基准测试：Pool_Benchmark()按同一分配/释放序列比较本模块与malloc/free，
+  *                           在板上经串口B命令运行（见Cmd.h）
+  *
+  * @note            每个池是一个空闲块单链表，分配和释放都只操作链表头，耗时与块数无关；
+  *                        链表头和统计用LDREX/STREX更新，中断与主循环可同时分配和释放，不关中断
+  *                        （异常进入和返回会清除独占监视器，被打断的STREX失败后重试，不会出现ABA问题）
+  *
+  * @attention     注意事项：
+  *                         1. C启动代码没有定义堆，MicroLIB的malloc无法链接，动态内存统一从本模块分配；
+  *                            与MicroLIB malloc对比时在Keil的C/C++宏定义中加入STARTUP_C=0和POOL_BENCH_MALLOC=1，
+  *                            改用startup_stm32f40_41xxx.s（堆Heap_Size = 512字节，见Startup.h）
+  *                         2. 块大小须为POOL_ALIGN的倍数，分配的地址按POOL_ALIGN对齐
+  *                         3. 使用前调用一次Pool_Init()
+  *
+  *                         修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 增加Pool_Benchmark()
+  *
+  ************************************************************************************
+  */
+
+#ifndef __POOL_H
+#define __POOL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#define POOL_ALIGN                                 8U             /* 块对齐，单位：字节（可存放uint64_t和double） */
+#define POOL_BENCH_DEPTH_MAX               16U           /* Pool_Benchmark()每轮最多分配的块数 */
+
+#ifndef POOL_BENCH_MALLOC
+#define POOL_BENCH_MALLOC                    0               /* 1=Pool_Benchmark()同时测量malloc/free（须链接有堆的启动文件） */
+#endif
+
+/**
+  * @brief   内存池配置：X(编号, 块大小, 块数)，按块大小从小到大排列
+  * @note   共1792字节：16字节块放命令和定时器节点，64字节块放效果对象，256字节块放命令缓冲区
+  */
+#define POOL_TABLE(X)                            \
+    X(POOL_16,    16U, 16U)                             \
+    X(POOL_64,    64U,  8U)                             \
+    X(POOL_256,  256U,  4U)
+
+/**
+  * @brief   池编号
+  */
+#define POOL_ENUM(id, block, count)           id,
+enum
+{
+    POOL_TABLE(POOL_ENUM)
+    POOL_COUNT                                          /* 池数 */
+};
+
+/**
+  * @brief   单个池的统计
+  */
+typedef struct
+{
+    uint32_t block;                                       /* 块大小，单位：字节 */
+    uint32_t count;                                       /* 块数 */
+    uint32_t used;                                        /* 当前占用块数 */
+    uint32_t peak;                                        /* 最高占用块数 */
+    uint32_t fail;                                          /* 该池无空闲块的次数 */
+} Pool_Stats;
+
+/**
+  * @brief   基准测试结果
+  */
+typedef struct
+{
+    uint32_t pool_ticks;                             /* 内存池总耗时，单位：时钟计数 */
+    uint32_t malloc_ticks;                          /* malloc/free总耗时（POOL_BENCH_MALLOC为0时为0） */
+    uint32_t pool_max;                               /* 内存池单轮最长耗时，单位：时钟计数 */
+    uint32_t malloc_max;                            /* malloc/free单轮最长耗时 */
+    uint32_t pool_pair_ns;                          /* 内存池平均每次分配 + 释放的耗时，单位：纳秒 */
+    uint32_t malloc_pair_ns;                       /* malloc/free平均每次分配 + 释放的耗时，单位：纳秒 */
+    uint32_t fail;                                        /* 两种分配器分配失败的总次数 */
+} Pool_Bench;
+
+/**
+  * @brief           初始化所有池
+  * @param        None
+  * @retval          None
+  * @note           把每个池的块串成空闲链表并清零统计；已分配的块全部作废
+  */
+void Pool_Init(void);
+
+/**
+  * @brief           分配一块
+  * @param        size 需要的字节数
+  * @retval          块地址（按POOL_ALIGN对齐），NULL=没有足够大的空闲块
+  * @note           可在中断中调用
+  */
+void *Pool_Alloc(uint32_t size);
+
+/**
+  * @brief           从指定池分配一块
+  * @param        id 池编号POOL_xxx
+  * @retval          块地址，NULL=该池已用完或编号无效
+  * @note           可在中断中调用
+  */
+void *Pool_AllocFrom(uint32_t id);
+
+/**
+  * @brief           释放一块
+  * @param        p 块地址，NULL时不做任何事
+  * @retval          0=成功，1=不是池中块的起始地址
+  * @note           可在中断中调用；同一块释放两次会破坏空闲链表
+  */
+uint8_t Pool_Free(void *p);
+
+/**
+  * @brief           读取统计
+  * @param        id 池编号POOL_xxx
+  * @param        st 输出：统计
+  * @retval          None
+  */
+void Pool_GetStats(uint32_t id, Pool_Stats *st);
+
+/**
+  * @brief           比较内存池与malloc/free的耗时
+  * @param        size 每块字节数
+  * @param        depth 每轮分配的块数（1 ~ POOL_BENCH_DEPTH_MAX）
+  * @param        rounds 轮数
+  * @param        clock 时钟读取函数（如Delay_Mark，返回递增的计数值）
+  * @param        ticks_per_us 时钟每微秒的计数值（如SystemCoreClock / 1000000）
+  * @param        result 输出测试结果
+  * @retval          None
+  * @note           每轮连续分配depth块，先释放奇数项再释放偶数项，两种分配器执行相同序列；
+  *                        测试期间占用所选池的depth块，最高占用统计随之改变；
+  *                        单次测量不能超过2^32个时钟计数（168MHz下约25秒）
+  */
+void Pool_Benchmark(uint32_t size, uint32_t depth, uint32_t rounds, uint32_t (*clock)(void),
+                    uint32_t ticks_per_us, Pool_Bench *result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __POOL_H */
@@ -0,0 +1,113 @@
+/**
+  ************************************************************************************
+  * @file              Reg.h
+  * @author         None
+  * @version       V1.1.0
+  * @date            2026-10-17
+  * @brief           寄存器位域构造宏头文件
+  *
+  * @details        本文件提供编译期组合寄存器位域的宏：
+  *                        1. 通用位域：REG_FIELD() / REG_MASK()
+  *                        2. GPIO引脚位域：GPIO_MODE_xxx() / GPIO_SPEED_xxx() 等
+  *                        3. 寄存器访问：REG_READ() / REG_WRITE() / REG_MODIFY()
+  *                           定义REG_SIM时这三个宏转到主机端仿真层RegSim
+  *                        多个引脚的位域先用 | 在编译期合并成一个常量，
+  *                        再对每个寄存器只做一次读-改-写或一次直接写
+  *
+  * @note            所有位域参数应为编译期常量，编译器会将其折叠为立即数
+  *                        不要在位域参数中使用带副作用的表达式
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 增加REG_SIM主机仿真访问路径
+  *
+  ************************************************************************************
+  */
+
+#ifndef __REG_H
+#define __REG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/* ---------------------------------- 通用位域 ---------------------------------- */
+
+/** 起始位pos、宽度width的位域掩码 */
+#define REG_MASK(pos, width)              ((((uint32_t)1U << (width)) - 1U) << (pos))
+
+/** 起始位pos、宽度width、取值val的位域值（超宽部分被截掉） */
+#define REG_FIELD(pos, width, val)       (((uint32_t)(val) << (pos)) & REG_MASK(pos, width))
+
+/* ---------------------------------- 寄存器访问 ---------------------------------- */
+
+#ifdef REG_SIM
+
+/* 主机端仿真：按寄存器地址转到RegSim模块，不直接访问硬件地址 */
+#include "RegSim.h"
+
+#define REG_ADDR(reg)                          ((uint32_t)(uintptr_t)&(reg))
+#define REG_READ(reg)                          RegSim_Read32(REG_ADDR(reg))
+#define REG_WRITE(reg, val)                   RegSim_Write32(REG_ADDR(reg), (uint32_t)(val))
+#define REG_MODIFY(reg, clr, set)          RegSim_Write32(REG_ADDR(reg), \
+                                                            (RegSim_Read32(REG_ADDR(reg)) & ~(uint32_t)(clr)) | (uint32_t)(set))
+
+#else
+
+/** 读寄存器 */
+#define REG_READ(reg)                          (reg)
+
+/** 直接写寄存器（一次总线写） */
+#define REG_WRITE(reg, val)                   ((reg) = (uint32_t)(val))
+
+/** 读-改-写：先清除clr中的位，再置位set中的位（一次总线读+一次总线写） */
+#define REG_MODIFY(reg, clr, set)          ((reg) = ((reg) & ~(uint32_t)(clr)) | (uint32_t)(set))
+
+#endif  /* REG_SIM */
+
+/* ---------------------------------- GPIO位域 ---------------------------------- */
+
+/* MODER：每引脚2位 */
+#define GPIO_MODE_IN                             0x0U       /* 输入 */
+#define GPIO_MODE_OUT                           0x1U       /* 通用输出 */
+#define GPIO_MODE_AF                             0x2U       /* 复用功能 */
+#define GPIO_MODE_AN                             0x3U       /* 模拟 */
+
+/* OSPEEDR：每引脚2位 */
+#define GPIO_SPEED_LOW                         0x0U
+#define GPIO_SPEED_MEDIUM                  0x1U
+#define GPIO_SPEED_FAST                        0x2U
+#define GPIO_SPEED_HIGH                        0x3U
+
+/* PUPDR：每引脚2位 */
+#define GPIO_PUPD_NONE                         0x0U
+#define GPIO_PUPD_UP                             0x1U
+#define GPIO_PUPD_DOWN                       0x2U
+
+/* OTYPER：每引脚1位 */
+#define GPIO_OTYPE_PP                            0x0U       /* 推挽 */
+#define GPIO_OTYPE_OD                           0x1U       /* 开漏 */
+
+/** 引脚pin在2位宽寄存器（MODER/OSPEEDR/PUPDR）中的掩码与取值 */
+#define GPIO_2BIT_MASK(pin)                  REG_MASK(2U * (pin), 2U)
+#define GPIO_2BIT(pin, val)                    REG_FIELD(2U * (pin), 2U, (val))
+
+/** 引脚pin在1位宽寄存器（OTYPER/ODR）中的掩码与取值 */
+#define GPIO_1BIT_MASK(pin)                  REG_MASK((pin), 1U)
+#define GPIO_1BIT(pin, val)                    REG_FIELD((pin), 1U, (val))
+
+/** 引脚pin在AFR[0]/AFR[1]中的掩码与取值（pin为0-15，宏内自动取低3位） */
+#define GPIO_AF_MASK(pin)                      REG_MASK(4U * ((pin) & 7U), 4U)
+#define GPIO_AF(pin, af)                          REG_FIELD(4U * ((pin) & 7U), 4U, (af))
+
+/** BSRR置位/复位单个引脚 */
+#define GPIO_BSRR_SET(pin)                    ((uint32_t)1U << (pin))
+#define GPIO_BSRR_RESET(pin)               ((uint32_t)1U << ((pin) + 16U))
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __REG_H */
@@ -0,0 +1,219 @@
+/**
+  ************************************************************************************
+  * @file              RegSim.h
+  * @author         None
+  * @version       V1.3.0
+  * @date            2026-10-17
+  * @brief           主机端寄存器仿真层头文件
+  *
+  * @details        定义REG_SIM编译时，Reg.h中的REG_READ/REG_WRITE/REG_MODIFY
+  *                        不再直接访问硬件地址，而是转到本模块：
+  *                        1. 外设模型：按stm32f4xx.h中的外设基地址挂接读/写钩子
+  *                        2. 虚拟时间：以CPU周期计的虚拟时钟和定时事件调度
+  *                        3. 中断注入：模型挂起中断，由仿真层调用对应的处理函数
+  *                        未挂接模型的地址落到一个简单的寄存器存储中
+  *                        以上状态都属于一个仿真上下文（一块虚拟板）：RegSim_Create()新建上下文，
+  *                        RegSim_Select()为当前线程选择上下文，其余接口都作用于当前线程选择的上下文
+  *
+  * @note            本模块只用于主机端（PC）编译，不加入Keil工程
+  *                        内置SysTick和DWT周期计数器模型，使Delay模块可以直接在主机上运行
+  *
+  * @attention     注意事项：
+  *                         1. 驱动中需要仿真的寄存器访问必须经过REG_xxx宏
+  *                         2. 每次寄存器读写使虚拟时间前进RegSim_SetAccessCost()设定的周期数
+  *                         3. 一个上下文同一时刻只能由一个线程使用；外设模型的ctx由挂接者管理，
+  *                            多个上下文挂接同一个模型时共享该模型的状态
+  *
+  *                         修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 增加内置DWT模型
+  *                         - 2026-10-17 V1.2.0 增加仿真上下文（RegSim_Create/RegSim_Destroy/RegSim_Select）
+  *                         - 2026-10-17 V1.3.0 增加总线主设备访问（RegSim_BusRead32/RegSim_BusWrite32）
+  *
+  ************************************************************************************
+  */
+
+#ifndef __REGSIM_H
+#define __REGSIM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#define REGSIM_MAX_MODELS                16U           /* 可挂接的外设模型数 */
+#define REGSIM_MAX_EVENTS                  32U           /* 同时挂起的定时事件数 */
+#define REGSIM_MAX_PLAIN                    256U          /* 未挂接模型的寄存器存储容量 */
+#define REGSIM_IRQ_OFFSET                 16                /* 中断号到处理函数表下标的偏移（系统异常为负数） */
+#define REGSIM_IRQ_NUM                      (REGSIM_IRQ_OFFSET + 112)
+
+/**
+  * @brief   仿真上下文（内容见RegSim.c）
+  */
+typedef struct RegSim_Context RegSim_Context;
+
+/**
+  * @brief   外设模型
+  * @note   offset为相对base的字节偏移；read为NULL时该模型只写，write为NULL时写被忽略
+  */
+typedef struct
+{
+    const char *name;                                                        /* 模型名称 */
+    uint32_t base;                                                              /* 外设基地址，如TIM2_BASE */
+    uint32_t size;                                                               /* 地址范围，单位：字节 */
+    uint32_t (*read)(void *ctx, uint32_t offset);                    /* 读钩子 */
+    void (*write)(void *ctx, uint32_t offset, uint32_t value);  /* 写钩子 */
+    void *ctx;                                                                     /* 模型私有数据 */
+} RegSim_Model;
+
+/**
+  * @brief   定时事件回调
+  */
+typedef void (*RegSim_Event)(void *ctx);
+
+/**
+  * @brief   中断处理函数
+  */
+typedef void (*RegSim_Handler)(void);
+
+/**
+  * @brief   总线访问统计
+  */
+typedef struct
+{
+    uint32_t reads;                                       /* 读次数 */
+    uint32_t writes;                                      /* 写次数 */
+} RegSim_Stats;
+
+/**
+  * @brief           复位仿真层
+  * @param        None
+  * @retval          None
+  * @note           复位当前线程选择的上下文：清除所有模型、事件、中断和统计，虚拟时间归零，
+  *                        并重新挂接内置SysTick和DWT模型
+  */
+void RegSim_Init(void);
+
+/**
+  * @brief           新建一个仿真上下文
+  * @param        None
+  * @retval          上下文指针，内存不足返回NULL
+  * @note           新上下文已复位（相当于对它调用过RegSim_Init()），不改变当前线程的选择
+  */
+RegSim_Context *RegSim_Create(void);
+
+/**
+  * @brief           释放一个仿真上下文
+  * @param        s 上下文（RegSim_Create()的返回值，可为NULL）
+  * @retval          None
+  * @note           释放前须确保没有线程仍选择着它
+  */
+void RegSim_Destroy(RegSim_Context *s);
+
+/**
+  * @brief           选择当前线程使用的仿真上下文
+  * @param        s 上下文，为NULL时选择默认上下文
+  * @retval          之前选择的上下文
+  * @note           每个线程启动时选择的是默认上下文
+  */
+RegSim_Context *RegSim_Select(RegSim_Context *s);
+
+/**
+  * @brief           挂接外设模型
+  * @param        model 模型描述（由调用者保持有效）
+  * @retval          0=成功，1=模型表已满或地址重叠
+  */
+uint8_t RegSim_Attach(const RegSim_Model *model);
+
+/**
+  * @brief           32位寄存器读
+  * @param        addr 寄存器地址
+  * @retval          寄存器值
+  */
+uint32_t RegSim_Read32(uint32_t addr);
+
+/**
+  * @brief           32位寄存器写
+  * @param        addr 寄存器地址
+  * @param        value 写入值
+  * @retval          None
+  */
+void RegSim_Write32(uint32_t addr, uint32_t value);
+
+/**
+  * @brief           总线主设备读
+  * @param        addr 寄存器地址
+  * @retval          寄存器值
+  * @note           供模型（如DMA）访问其他外设：不消耗访问周期、不计入统计、不分发中断
+  */
+uint32_t RegSim_BusRead32(uint32_t addr);
+
+/**
+  * @brief           总线主设备写
+  * @param        addr 寄存器地址
+  * @param        value 写入值
+  * @retval          None
+  * @note           同RegSim_BusRead32()
+  */
+void RegSim_BusWrite32(uint32_t addr, uint32_t value);
+
+/**
+  * @brief           当前虚拟时间
+  * @param        None
+  * @retval          自复位起的CPU周期数
+  */
+uint64_t RegSim_Now(void);
+
+/**
+  * @brief           推进虚拟时间
+  * @param        cycles 推进的周期数
+  * @retval          None
+  * @note           按时间顺序触发到期事件，并处理挂起的中断
+  */
+void RegSim_Advance(uint64_t cycles);
+
+/**
+  * @brief           设置每次寄存器访问消耗的周期数
+  * @param        cycles 周期数（默认为1）
+  * @retval          None
+  */
+void RegSim_SetAccessCost(uint32_t cycles);
+
+/**
+  * @brief           安排一个定时事件
+  * @param        delay 距当前虚拟时间的周期数
+  * @param        cb 事件回调
+  * @param        ctx 回调参数
+  * @retval          0=成功，1=事件表已满
+  */
+uint8_t RegSim_Schedule(uint64_t delay, RegSim_Event cb, void *ctx);
+
+/**
+  * @brief           注册中断处理函数
+  * @param        irq 中断号（IRQn_Type的值，系统异常为负数）
+  * @param        handler 处理函数，为NULL时注销
+  * @retval          None
+  */
+void RegSim_SetHandler(int32_t irq, RegSim_Handler handler);
+
+/**
+  * @brief           由模型挂起一个中断
+  * @param        irq 中断号
+  * @retval          None
+  * @note           在当前访问或事件结束后调用处理函数，处理函数中不会嵌套分发
+  */
+void RegSim_SetPending(int32_t irq);
+
+/**
+  * @brief           获取并清零总线访问统计
+  * @param        stats 输出统计值
+  * @retval          None
+  */
+void RegSim_TakeStats(RegSim_Stats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __REGSIM_H */
@@ -0,0 +1,104 @@
+/**
+  ************************************************************************************
+  * @file              Shift595.h
+  * @author         None
+  * @version       V1.1.0
+  * @date            2026-10-17
+  * @brief           74HC595级联LED驱动头文件
+  *
+  * @details        本文件提供SPI + DMA驱动级联74HC595并用位角度调制（BAM）调光的接口：
+  *                        1. 亮度按位拆成SHIFT595_BITS个位平面，第k个平面显示 2^k 个时间单位
+  *                        2. SPI2（PB13=SRCLK，PB15=SER）由DMA1 Stream4送出下一平面的全部字节
+  *                        3. TIM5_CH3（PA2=RCLK）在每个平面开始时输出锁存脉冲，
+  *                           更新中断中只写入下一平面的时长并启动一次DMA，逐位无CPU参与
+  *
+  * @note            刷新率 = 定时器时钟 ÷ (单位时长 × (2^SHIFT595_BITS - 1))，
+  *                        单位时长不小于送出一个平面的时间：Shift595_MinUnit()
+  *                        SPI2时钟 = APB1 ÷ 2 = 21MHz，每个寄存器8位约0.38μs
+  *
+  * @attention     注意事项：
+  *                         1. 0号寄存器靠近MCU，LED编号 = 寄存器号 × 8 + 输出号（QA=0 … QH=7）
+  *                         2. 显示中和等待切换的位平面缓冲区不能修改，换帧用Shift595_Show()，
+  *                            旧缓冲区在Shift595_InUse()返回0后才可改写（双缓冲：写空闲的一个，Show后等旧的释放）
+  *                         3. 待切换的帧只有一个，上一帧尚未切换时Shift595_Show()返回1，须稍后重试
+  *
+  *                         修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 Shift595_Show()返回是否已排队，增加Shift595_InUse()
+  *
+  ************************************************************************************
+  */
+
+#ifndef __SHIFT595_H
+#define __SHIFT595_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#define SHIFT595_BITS                          8U             /* 亮度位数（位平面数） */
+#define SHIFT595_ISR_TICKS                  84U           /* 中断响应和启动DMA的余量，单位：定时器计数（1μs） */
+#define SHIFT595_LATCH_TICKS              8U             /* 锁存脉冲宽度，单位：定时器计数 */
+
+/**
+  * @brief           把亮度数组打包为位平面
+  * @param        level 各LED亮度（0 ~ 2^SHIFT595_BITS - 1），共regs × 8项
+  * @param        regs 级联的寄存器数
+  * @param        planes 输出位平面，SHIFT595_BITS × regs字节，第k平面从planes[k × regs]开始
+  * @retval          None
+  * @note           每个平面内按发送顺序排列：先发最远的寄存器
+  */
+void Shift595_Pack(const uint8_t *level, uint32_t regs, uint8_t *planes);
+
+/**
+  * @brief           最短单位时长
+  * @param        regs 级联的寄存器数
+  * @retval          定时器计数
+  */
+uint32_t Shift595_MinUnit(uint32_t regs);
+
+/**
+  * @brief           按最短单位时长计算的最高刷新率
+  * @param        regs 级联的寄存器数
+  * @retval          刷新率，单位：Hz
+  */
+uint32_t Shift595_RefreshHz(uint32_t regs);
+
+/**
+  * @brief           初始化并开始显示
+  * @param        planes 第一帧的位平面
+  * @param        regs 级联的寄存器数
+  * @param        unit 最低位平面的显示时长，单位：定时器计数（为0或小于Shift595_MinUnit()时取最小值）
+  * @retval          None
+  */
+void Shift595_Init(const uint8_t *planes, uint32_t regs, uint32_t unit);
+
+/**
+  * @brief           切换显示的帧
+  * @param        planes 新一帧的位平面
+  * @retval          0=已排队，1=上一次排队的帧尚未切换，本帧未排队
+  * @note           从下一个最低位平面开始生效，不会出现半帧；可在主循环和中断中调用
+  */
+uint8_t Shift595_Show(const uint8_t *planes);
+
+/**
+  * @brief           查询位平面缓冲区是否仍被驱动使用
+  * @param        planes 位平面缓冲区
+  * @retval          1=显示中或等待切换，0=已释放，可以改写
+  */
+uint8_t Shift595_InUse(const uint8_t *planes);
+
+/**
+  * @brief           TIM5中断处理函数
+  * @param        None
+  * @retval          None
+  */
+void TIM5_IRQHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __SHIFT595_H */
@@ -0,0 +1,314 @@
+/**
+  ************************************************************************************
+  * @file              SimPeriph.h
+  * @author         None
+  * @version       V1.3.0
+  * @date            2026-10-17
+  * @brief           主机端外设模型头文件
+  *
+  * @details        本文件提供挂接到RegSim上的片上外设模型，驱动代码不做修改即可在主机上运行：
+  *                        1. GPIO：端口A~K的MODER/OTYPER/OSPEEDR/PUPDR/IDR/ODR/BSRR/AFR，
+  *                           BSRR写入转为ODR的置位/复位，每次改变输出的写入后调用观察回调
+  *                        2. 主机时钟：SystemCoreClock和SystemCoreClockUpdate()（不读RCC，保持设定值）
+  *                        3. TIM2~TIM7：内部时钟按RCC->CFGR的APB分频计数，PSC/ARR/CCRx预装载在更新事件装入，
+  *                           UIE挂起中断、UDE向DMA发请求，MMS = 010时更新事件驱动SMS = 111的从定时器
+  *                        4. DMA1/DMA2：8个数据流，外设请求按数据流号和CHSEL匹配，每个请求搬运一项，
+  *                           NDTR/MINC/PINC/CIRC、半传输/传输完成标志和中断，软件关闭EN时置TCIF
+  *                        5. SPI1~SPI3：只模拟主机发送，TXE触发DMA请求
+  *                        6. USART1：8N1/9N1收发，测试程序注入的字节按波特率逐个到达，RXNE/TXE触发DMA请求，
+  *                           最后一个字节之后线路空闲一帧置IDLE
+  *
+  * @note            只用于主机端（REG_SIM）编译，不加入Keil工程
+  *                        模型状态为全局变量，与RegSim的当前实例配合使用
+  *
+  * @attention     注意事项：
+  *                         1. 先调用RegSim_Init()，再挂接本文件中的模型
+  *                         2. 引脚电平只按寄存器计算：输出模式取ODR，其他模式视为不驱动
+  *                         3. DMA的存储器地址按32位主机地址直接访问，缓冲区须为静态变量并以-no-pie编译；
+  *                            搬运不消耗虚拟时间
+  *
+  *                         修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 增加TIM和DMA模型
+  *                         - 2026-10-17 V1.2.0 增加SPI1~SPI3发送模型
+  *                         - 2026-10-17 V1.3.0 增加USART1收发模型
+  *
+  ************************************************************************************
+  */
+
+#ifndef __SIMPERIPH_H
+#define __SIMPERIPH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#define SIMPERIPH_GPIO_PORTS              11U           /* 端口A~K */
+#define SIMPERIPH_CORE_CLOCK             168000000U  /* 默认SystemCoreClock，单位：Hz */
+#define SIMPERIPH_TIM_FIRST                2U             /* 模拟的定时器：TIM2~TIM7 */
+#define SIMPERIPH_TIM_LAST                  7U
+#define SIMPERIPH_SPI_NUM                   3U             /* 模拟的SPI：SPI1~SPI3 */
+
+/**
+  * @brief   引脚驱动状态（SimPeriph_GpioDrive()返回值）
+  */
+#define SIMPERIPH_PIN_FLOAT                0U             /* 不驱动（输入、复用、模拟） */
+#define SIMPERIPH_PIN_LOW                   1U             /* 输出低电平 */
+#define SIMPERIPH_PIN_HIGH                  2U             /* 输出高电平 */
+
+/**
+  * @brief   GPIO端口状态
+  */
+typedef struct
+{
+    uint32_t moder;                                   /* MODER */
+    uint32_t otyper;                                  /* OTYPER */
+    uint32_t ospeedr;                                /* OSPEEDR */
+    uint32_t pupdr;                                   /* PUPDR */
+    uint32_t idr;                                       /* IDR（外部输入电平，由测试程序设置） */
+    uint32_t odr;                                      /* ODR */
+    uint32_t afr[2];                                   /* AFR[0]、AFR[1] */
+} SimPeriph_GpioPort;
+
+/**
+  * @brief   GPIO观察回调
+  * @param   port 端口序号（0=A）
+  * @param   gpio 写入后的端口状态
+  * @param   ctx 回调参数
+  */
+typedef void (*SimPeriph_GpioHook)(uint32_t port, const SimPeriph_GpioPort *gpio, void *ctx);
+
+/**
+  * @brief   定时器状态
+  * @note   psc/arr/ccr为软件读写的预装载值，xxx_act为计数使用的影子值
+  */
+typedef struct
+{
+    uint32_t cr1;                                        /* CR1 */
+    uint32_t cr2;                                        /* CR2 */
+    uint32_t smcr;                                      /* SMCR */
+    uint32_t dier;                                       /* DIER */
+    uint32_t sr;                                          /* SR */
+    uint32_t ccmr[2];                                 /* CCMR1、CCMR2 */
+    uint32_t ccer;                                      /* CCER */
+    uint32_t cnt;                                        /* 停止时或从模式下的CNT */
+    uint32_t psc;                                        /* PSC */
+    uint32_t arr;                                         /* ARR */
+    uint32_t ccr[4];                                    /* CCR1~CCR4 */
+    uint32_t psc_act;                                 /* 影子PSC */
+    uint32_t arr_act;                                  /* 影子ARR */
+    uint32_t ccr_act[4];                             /* 影子CCR1~CCR4（决定当前周期的输出） */
+    uint64_t origin;                                  /* 内部时钟运行时CNT为0对应的虚拟时间 */
+    uint64_t due;                                       /* 下一次溢出的虚拟时间，0=未安排 */
+    uint32_t updates;                                 /* 更新事件次数 */
+} SimPeriph_Tim;
+
+/**
+  * @brief   定时器观察回调
+  * @param   n 定时器编号（2~7）
+  * @param   tim 更新事件装入影子值之后的状态
+  * @param   ctx 回调参数
+  */
+typedef void (*SimPeriph_TimHook)(uint32_t n, const SimPeriph_Tim *tim, void *ctx);
+
+/**
+  * @brief   DMA数据流状态
+  */
+typedef struct
+{
+    uint32_t cr;                                          /* SxCR */
+    uint32_t ndtr;                                      /* SxNDTR */
+    uint32_t par;                                        /* SxPAR */
+    uint32_t m0ar;                                     /* SxM0AR */
+    uint32_t m1ar;                                     /* SxM1AR（不模拟双缓冲） */
+    uint32_t fcr;                                        /* SxFCR（不模拟FIFO） */
+    uint32_t reload;                                   /* EN置位时的NDTR */
+    uint32_t mptr;                                     /* 当前存储器地址 */
+    uint32_t pptr;                                      /* 当前外设地址 */
+    uint32_t items;                                    /* 已搬运的项数 */
+} SimPeriph_DmaStream;
+
+/**
+  * @brief   SPI状态
+  * @note   只模拟主机发送：DR写入发送缓冲，移位寄存器空闲时立即装入，
+  *              每帧 (8或16) × 2^(BR+1) 个PCLK后移出
+  */
+typedef struct
+{
+    uint32_t cr1;                                        /* CR1 */
+    uint32_t cr2;                                        /* CR2 */
+    uint32_t sr;                                          /* SR（TXE、BSY） */
+    uint16_t shift;                                      /* 移位中的数据 */
+    uint16_t txbuf;                                     /* 发送缓冲中的数据（TXE = 0时有效） */
+    uint64_t due;                                       /* 移位中的数据移出完成的虚拟时间，0=空闲 */
+    uint32_t ratio;                                     /* 每个PCLK的CPU周期数 */
+    uint32_t frames;                                   /* 已移出的数据帧数 */
+    uint8_t requesting;                              /* 正在向DMA请求（防止重入） */
+} SimPeriph_SpiPort;
+
+/**
+  * @brief   SPI观察回调
+  * @param   n SPI编号（1~3）
+  * @param   data 刚移出的数据帧
+  * @param   ctx 回调参数
+  */
+typedef void (*SimPeriph_SpiHook)(uint32_t n, uint16_t data, void *ctx);
+
+/**
+  * @brief   USART状态
+  * @note   16倍过采样（OVER8不模拟），每位BRR个PCLK；接收和发送各自独立计时，不模拟奇偶校验和流控
+  */
+typedef struct
+{
+    uint32_t sr;                                          /* SR（TXE、TC、RXNE、IDLE、ORE） */
+    uint32_t rdr;                                        /* 接收数据 */
+    uint32_t brr;                                        /* BRR */
+    uint32_t cr1;                                        /* CR1 */
+    uint32_t cr2;                                        /* CR2 */
+    uint32_t cr3;                                        /* CR3 */
+    uint32_t ratio;                                     /* 每个PCLK的CPU周期数 */
+    uint8_t sr_read;                                   /* 1=上次访问为读SR（随后读DR清除IDLE/ORE） */
+    uint8_t requesting;                              /* 正在向DMA请求（防止重入） */
+    uint16_t shift;                                      /* 发送移位中的数据 */
+    uint16_t txbuf;                                     /* 发送缓冲中的数据（TXE = 0时有效） */
+    uint64_t tx_due;                                   /* 发送中的一帧结束的虚拟时间，0=空闲 */
+    const uint8_t *rx_data;                         /* 正在注入的数据 */
+    uint32_t rx_len;                                    /* 注入的字节数 */
+    uint32_t rx_pos;                                    /* 已到达的字节数 */
+    uint64_t rx_due;                                   /* 下一个字节到达（停止位结束）的虚拟时间，0=无 */
+    uint64_t rx_end;                                   /* 最后一个字节到达的虚拟时间 */
+    uint64_t idle_due;                                /* 空闲线检测的虚拟时间，0=未安排 */
+    uint8_t idle_armed;                              /* 1=上次IDLE之后收到过数据 */
+    uint32_t tx_frames;                              /* 已发送的帧数 */
+    uint32_t rx_frames;                              /* 已到达的帧数 */
+    uint32_t overruns;                                /* RXNE未清除时新帧到达（丢弃）的次数 */
+    uint32_t idles;                                     /* IDLE置位次数 */
+} SimPeriph_Usart;
+
+/**
+  * @brief   USART观察回调
+  * @param   data 刚发送完的数据帧
+  * @param   start 该帧起始位开始的虚拟时间
+  * @param   ctx 回调参数
+  */
+typedef void (*SimPeriph_UsartHook)(uint16_t data, uint64_t start, void *ctx);
+
+/**
+  * @brief           挂接GPIO模型
+  * @param        hook 观察回调，MODER/ODR/BSRR写入后调用，为NULL时不调用
+  * @param        ctx 回调参数
+  * @retval          0=成功，1=RegSim模型表已满
+  * @note           全部寄存器清零（不模拟端口A/B调试引脚的非零复位值）
+  */
+uint8_t SimPeriph_GpioAttach(SimPeriph_GpioHook hook, void *ctx);
+
+/**
+  * @brief           取端口状态
+  * @param        port 端口序号（0=A）
+  * @retval          端口状态，可直接修改idr
+  */
+SimPeriph_GpioPort *SimPeriph_Gpio(uint32_t port);
+
+/**
+  * @brief           引脚的驱动状态
+  * @param        gpio 端口状态
+  * @param        pin 引脚号（0~15）
+  * @retval          SIMPERIPH_PIN_xxx
+  */
+uint8_t SimPeriph_GpioDrive(const SimPeriph_GpioPort *gpio, uint32_t pin);
+
+/**
+  * @brief           挂接一个定时器模型
+  * @param        n 定时器编号（SIMPERIPH_TIM_FIRST~SIMPERIPH_TIM_LAST，且该型号有此定时器）
+  * @param        hook 观察回调，每次更新事件后调用，为NULL时不调用
+  * @param        ctx 回调参数
+  * @retval          0=成功，1=编号非法或RegSim模型表已满
+  * @note           寄存器清零；定时器时钟按挂接后RCC->CFGR中的APB分频计算
+  */
+uint8_t SimPeriph_TimAttach(uint32_t n, SimPeriph_TimHook hook, void *ctx);
+
+/**
+  * @brief           取定时器状态
+  * @param        n 定时器编号
+  * @retval          状态，编号非法返回NULL
+  */
+SimPeriph_Tim *SimPeriph_Timer(uint32_t n);
+
+/**
+  * @brief           挂接DMA1和DMA2模型
+  * @param        None
+  * @retval          0=成功，1=RegSim模型表已满
+  */
+uint8_t SimPeriph_DmaAttach(void);
+
+/**
+  * @brief           取DMA数据流状态
+  * @param        dma 控制器（1或2）
+  * @param        stream 数据流（0~7）
+  * @retval          状态
+  */
+SimPeriph_DmaStream *SimPeriph_Dma(uint32_t dma, uint32_t stream);
+
+/**
+  * @brief           外设向DMA发出一次请求
+  * @param        dma 控制器（1或2）
+  * @param        stream 数据流（0~7）
+  * @param        channel 请求所在的通道（CHSEL）
+  * @retval          1=该数据流已使能且通道匹配，搬运了一项；0=未搬运
+  * @note           供外设模型调用，也可由测试程序直接注入请求
+  */
+uint8_t SimPeriph_DmaRequest(uint32_t dma, uint32_t stream, uint32_t channel);
+
+/**
+  * @brief           挂接一个SPI模型
+  * @param        n SPI编号（1~SIMPERIPH_SPI_NUM）
+  * @param        hook 观察回调，每移出一帧调用一次，为NULL时不调用
+  * @param        ctx 回调参数
+  * @retval          0=成功，1=编号非法或RegSim模型表已满
+  * @note           TXE为1且TXDMAEN置位时持续向DMA请求（SPI1_TX：DMA2 Stream3/5通道3，
+  *                        SPI2_TX：DMA1 Stream4通道0，SPI3_TX：DMA1 Stream5/7通道0）；
+  *                        数据流使能时补发请求，须在SimPeriph_DmaAttach()之后挂接。PCLK按挂接时RCC->CFGR中的APB分频计算
+  */
+uint8_t SimPeriph_SpiAttach(uint32_t n, SimPeriph_SpiHook hook, void *ctx);
+
+/**
+  * @brief           取SPI状态
+  * @param        n SPI编号
+  * @retval          状态，编号非法返回NULL
+  */
+SimPeriph_SpiPort *SimPeriph_Spi(uint32_t n);
+
+/**
+  * @brief           挂接USART1模型
+  * @param        hook 观察回调，每发送完一帧调用一次，为NULL时不调用
+  * @param        ctx 回调参数
+  * @retval          0=成功，1=RegSim模型表已满
+  * @note           RXNE为1且DMAR置位时向DMA2 Stream2/5通道4请求，TXE为1且DMAT置位时向DMA2 Stream7通道4请求；
+  *                        数据流使能时补发请求，须在SimPeriph_DmaAttach()之后挂接。PCLK2按挂接时RCC->CFGR中的分频计算
+  */
+uint8_t SimPeriph_UsartAttach(SimPeriph_UsartHook hook, void *ctx);
+
+/**
+  * @brief           从RX线注入一段数据
+  * @param        data 数据（全部到达前须保持有效）
+  * @param        len 字节数
+  * @retval          0=已开始，1=上一段尚未全部到达
+  * @note           从当前虚拟时间开始逐帧首尾相接到达，每帧 (10或11) × BRR × ratio 个CPU周期；
+  *                        未使能UE/RE时字节丢失，但线路时序照常
+  */
+uint8_t SimPeriph_UsartFeed(const uint8_t *data, uint32_t len);
+
+/**
+  * @brief           取USART1状态
+  * @param        None
+  * @retval          状态
+  */
+SimPeriph_Usart *SimPeriph_Usart1(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __SIMPERIPH_H */
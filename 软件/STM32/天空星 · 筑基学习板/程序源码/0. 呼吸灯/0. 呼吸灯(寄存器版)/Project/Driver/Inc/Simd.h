@@ -0,0 +1,234 @@
+/**
+  ************************************************************************************
+  * @file              Simd.h
+  * @author         None
+  * @version       V1.1.0
+  * @date            2026-10-17
+  * @brief           双16位SIMD运算封装头文件
+  *
+  * @details        本文件把core_cmSimd.h中用到的双16位指令封装为SIMD_xxx：
+  *                        1. Cortex-M4（ARMCC或带DSP扩展的GCC）：直接映射到__SADD16等内建函数
+  *                        2. 其他平台（如主机端PC）：使用等价的C语言实现，结果逐位一致
+  *                        另有主机端4 × 32位向量运算SIMD_V4_xxx：带SSE2的x86映射到SSE2内建函数，
+  *                        其他平台为C语言实现
+  *
+  * @note            打包格式：低16位为第一个通道，高16位为第二个通道
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 增加4 × 32位向量运算（主机端SSE2）
+  *
+  ************************************************************************************
+  */
+
+#ifndef __SIMD_H
+#define __SIMD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__CC_ARM) || defined(__ARM_FEATURE_DSP)
+
+#include "stm32f4xx.h"
+
+#define SIMD_NATIVE                               1
+
+#define SIMD_SADD16(a, b)                     __SADD16((a), (b))
+#define SIMD_SSUB16(a, b)                     __SSUB16((a), (b))
+#define SIMD_SMLAD(a, b, acc)               __SMLAD((a), (b), (acc))
+#define SIMD_PKHBT(a, b, sh)                __PKHBT((a), (b), (sh))
+#define SIMD_PKHTB(a, b, sh)                __PKHTB((a), (b), (sh))
+
+/** 读写一个打包字，地址需4字节对齐 */
+#define SIMD_LOAD32(p)                          (*(const uint32_t *)(const void *)(p))
+#define SIMD_STORE32(p, v)                    (*(uint32_t *)(void *)(p) = (v))
+
+#else
+
+#define SIMD_NATIVE                               0
+
+/**
+  * @brief   双16位有符号加法（不饱和）
+  */
+static __inline uint32_t SIMD_SADD16(uint32_t a, uint32_t b)
+{
+    uint32_t lo = (uint16_t)((int16_t)a + (int16_t)b);
+    uint32_t hi = (uint16_t)((int16_t)(a >> 16) + (int16_t)(b >> 16));
+    return lo | (hi << 16);
+}
+
+/**
+  * @brief   双16位有符号减法（不饱和）
+  */
+static __inline uint32_t SIMD_SSUB16(uint32_t a, uint32_t b)
+{
+    uint32_t lo = (uint16_t)((int16_t)a - (int16_t)b);
+    uint32_t hi = (uint16_t)((int16_t)(a >> 16) - (int16_t)(b >> 16));
+    return lo | (hi << 16);
+}
+
+/**
+  * @brief   双16位有符号乘加：acc + a.lo × b.lo + a.hi × b.hi
+  */
+static __inline uint32_t SIMD_SMLAD(uint32_t a, uint32_t b, uint32_t acc)
+{
+    int32_t sum = (int32_t)(int16_t)a * (int16_t)b
+                + (int32_t)(int16_t)(a >> 16) * (int16_t)(b >> 16);
+    return (uint32_t)((int32_t)acc + sum);
+}
+
+/**
+  * @brief   打包：a的低半字 | (b << sh)的高半字
+  */
+static __inline uint32_t SIMD_PKHBT(uint32_t a, uint32_t b, uint32_t sh)
+{
+    return (a & 0x0000FFFFU) | ((b << sh) & 0xFFFF0000U);
+}
+
+/**
+  * @brief   打包：a的高半字 | (b >> sh)的低半字（算术右移）
+  */
+static __inline uint32_t SIMD_PKHTB(uint32_t a, uint32_t b, uint32_t sh)
+{
+    return (a & 0xFFFF0000U) | ((uint32_t)((int32_t)b >> sh) & 0x0000FFFFU);
+}
+
+static __inline uint32_t SIMD_LOAD32(const void *p)
+{
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static __inline void SIMD_STORE32(void *p, uint32_t v)
+{
+    memcpy(p, &v, sizeof(v));
+}
+
+#endif  /* __CC_ARM || __ARM_FEATURE_DSP */
+
+/* ---------------------------------- 4 × 32位向量 ---------------------------------- */
+
+/* 主机端批量计算用（如Preview）：带SSE2的x86映射到__m128i，其他平台为4元素数组的C语言实现；
+   M4没有4 × 32位运算，固件中不使用这一组 */
+#if defined(__SSE2__)
+
+#include <emmintrin.h>
+
+#define SIMD_V4_NATIVE                          1
+
+typedef __m128i Simd_V4;
+
+#define SIMD_V4_LOAD(p)                        _mm_loadu_si128((const __m128i *)(const void *)(p))
+#define SIMD_V4_STORE(p, v)                  _mm_storeu_si128((__m128i *)(void *)(p), (v))
+#define SIMD_V4_DUP(x)                         _mm_set1_epi32((int)(x))
+#define SIMD_V4_ADD(a, b)                     _mm_add_epi32((a), (b))
+#define SIMD_V4_XOR(a, b)                     _mm_xor_si128((a), (b))
+#define SIMD_V4_SHL(a, n)                      _mm_slli_epi32((a), (n))
+#define SIMD_V4_SHR(a, n)                      _mm_srli_epi32((a), (n))
+#define SIMD_V4_SAR(a, n)                      _mm_srai_epi32((a), (n))
+
+/**
+  * @brief   各通道低16位相乘得32位积（两个乘数都须小于2^16）
+  */
+static __inline Simd_V4 SIMD_V4_MUL16(Simd_V4 a, Simd_V4 b)
+{
+    /* 高半字为0，16位乘法的低、高半部分拼成32位积 */
+    return _mm_or_si128(_mm_mullo_epi16(a, b), _mm_slli_epi32(_mm_mulhi_epu16(a, b), 16));
+}
+
+/**
+  * @brief   把4个通道的值（0~255）写成4个字节
+  */
+static __inline void SIMD_V4_STORE8(uint8_t *p, Simd_V4 v)
+{
+    uint32_t w = (uint32_t)_mm_cvtsi128_si32(_mm_packus_epi16(_mm_packs_epi32(v, v), v));
+    memcpy(p, &w, sizeof(w));
+}
+
+#else
+
+#define SIMD_V4_NATIVE                          0
+
+typedef struct
+{
+    uint32_t v[4];
+} Simd_V4;
+
+static __inline Simd_V4 SIMD_V4_LOAD(const void *p)
+{
+    Simd_V4 r;
+    memcpy(r.v, p, sizeof(r.v));
+    return r;
+}
+
+static __inline void SIMD_V4_STORE(void *p, Simd_V4 a)
+{
+    memcpy(p, a.v, sizeof(a.v));
+}
+
+static __inline Simd_V4 SIMD_V4_DUP(uint32_t x)
+{
+    Simd_V4 r = { { x, x, x, x } };
+    return r;
+}
+
+static __inline Simd_V4 SIMD_V4_ADD(Simd_V4 a, Simd_V4 b)
+{
+    uint32_t i;
+    for(i = 0; i < 4U; i++) a.v[i] += b.v[i];
+    return a;
+}
+
+static __inline Simd_V4 SIMD_V4_XOR(Simd_V4 a, Simd_V4 b)
+{
+    uint32_t i;
+    for(i = 0; i < 4U; i++) a.v[i] ^= b.v[i];
+    return a;
+}
+
+static __inline Simd_V4 SIMD_V4_SHL(Simd_V4 a, uint32_t n)
+{
+    uint32_t i;
+    for(i = 0; i < 4U; i++) a.v[i] <<= n;
+    return a;
+}
+
+static __inline Simd_V4 SIMD_V4_SHR(Simd_V4 a, uint32_t n)
+{
+    uint32_t i;
+    for(i = 0; i < 4U; i++) a.v[i] >>= n;
+    return a;
+}
+
+static __inline Simd_V4 SIMD_V4_SAR(Simd_V4 a, uint32_t n)
+{
+    uint32_t i;
+    for(i = 0; i < 4U; i++) a.v[i] = (uint32_t)((int32_t)a.v[i] >> n);
+    return a;
+}
+
+static __inline Simd_V4 SIMD_V4_MUL16(Simd_V4 a, Simd_V4 b)
+{
+    uint32_t i;
+    for(i = 0; i < 4U; i++) a.v[i] *= b.v[i];
+    return a;
+}
+
+static __inline void SIMD_V4_STORE8(uint8_t *p, Simd_V4 a)
+{
+    uint32_t i;
+    for(i = 0; i < 4U; i++) p[i] = (uint8_t)a.v[i];
+}
+
+#endif  /* __SSE2__ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __SIMD_H */
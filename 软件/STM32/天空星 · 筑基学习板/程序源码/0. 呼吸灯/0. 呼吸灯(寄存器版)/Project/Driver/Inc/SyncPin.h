@@ -0,0 +1,72 @@
+/**
+  ************************************************************************************
+  * @file              SyncPin.h
+  * @author         None
+  * @version       V1.0.0
+  * @date            2026-10-17
+  * @brief           多板同步脉冲引脚驱动头文件
+  *
+  * @details        本文件提供同步脉冲的输出与捕获接口：
+  *                        1. 主板：SyncPin_InitLeader() / SyncPin_Set()，推挽输出同步脉冲
+  *                        2. 从板：SyncPin_InitFollower()，上升沿触发EXTI1中断并调用回调
+  *
+  * @note            硬件连接：
+  *                        - 同步线连接各板PA1，各板共地
+  *                        - 一块板为主板，其余为从板
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *
+  ************************************************************************************
+  */
+
+#ifndef __SYNCPIN_H
+#define __SYNCPIN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "stm32f4xx.h"
+
+/**
+  * @brief   同步脉冲回调（在EXTI1中断中调用）
+  */
+typedef void (*SyncPin_Callback)(void);
+
+/**
+  * @brief           初始化为主板（同步脉冲输出）
+  * @param        None
+  * @retval          None
+  * @note           PA1配置为推挽输出，初始为低电平
+  */
+void SyncPin_InitLeader(void);
+
+/**
+  * @brief           设置同步引脚电平
+  * @param        level 1=高电平，0=低电平
+  * @retval          None
+  * @note           使用BSRR寄存器原子操作
+  */
+void SyncPin_Set(uint8_t level);
+
+/**
+  * @brief           初始化为从板（同步脉冲捕获）
+  * @param        cb 上升沿回调
+  * @retval          None
+  * @note           PA1配置为下拉输入，EXTI1上升沿触发，使能NVIC中断
+  */
+void SyncPin_InitFollower(SyncPin_Callback cb);
+
+/**
+  * @brief           EXTI1中断处理函数
+  * @param        None
+  * @retval          None
+  */
+void EXTI1_IRQHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __SYNCPIN_H */
@@ -0,0 +1,182 @@
+/**
+  ************************************************************************************
+  * @file              Trace.h
+  * @author         None
+  * @version       V1.1.0
+  * @date            2026-10-17
+  * @brief           引脚边沿跟踪记录与比对模块头文件
+  *
+  * @details        本文件提供LED引脚边沿的记录、回放和比对接口：
+  *                        1. 记录：Trace_Init() / Trace_Edge() / Trace_Flush()
+  *                        2. 回放：Trace_ReaderInit() / Trace_ReadEdge()
+  *                        3. 比对：Trace_Compare()，与黄金跟踪按容差比较
+  *                        主机端流程（hostcheck trace，见HostCheck.h）：在RegSim上运行LED主循环，
+  *                        以虚拟CYCCNT记录边沿，与HostData/breath.trace比对；record、diff、dump子命令生成、比对和打印跟踪文件
+  *
+  * @note            跟踪格式（增量编码，流式写出）：
+  *                        - 每个边沿一条记录，LEB128变长整数编码
+  *                        - 记录值 = (距上一边沿的周期数 << 3) | (通道 << 1) | 电平
+  *                        - 时间基准为DWT->CYCCNT，第一条记录的增量为0
+  *                        - 典型PWM边沿间隔下每条记录2-3字节
+  *
+  * @attention     注意事项：
+  *                         1. 相邻两个边沿的间隔不能超过2^32个周期（168MHz下约25.5秒）
+  *                         2. 只有定义了TRACE_ENABLE时LED驱动才会调用记录函数；未初始化或已停止时Trace_Edge()不访问寄存器
+  *
+  *                         修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 Trace_Init()的buf为NULL时停止记录；增加主机端黄金跟踪流程说明
+  *
+  ************************************************************************************
+  */
+
+#ifndef __TRACE_H
+#define __TRACE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#define TRACE_CHANNELS                      4U             /* 最大通道数（记录中占2位） */
+#define TRACE_CH_LED1                        0U             /* LED1（PB8） */
+#define TRACE_CH_LED2                        1U             /* LED2（PB2） */
+
+/**
+  * @brief   LED驱动中的边沿记录钩子
+  * @note   未定义TRACE_ENABLE时展开为空，不产生任何代码
+  */
+#ifdef TRACE_ENABLE
+#define TRACE_EDGE(ch, level)              Trace_Edge((ch), (level))
+#else
+#define TRACE_EDGE(ch, level)              ((void)0)
+#endif
+
+/**
+  * @brief   跟踪数据输出回调
+  * @note   缓冲区满或调用Trace_Flush()时被调用，可将数据写往串口、调试器等
+  */
+typedef void (*Trace_Sink)(const uint8_t *data, uint32_t len);
+
+/**
+  * @brief   解码后的一条边沿记录
+  */
+typedef struct
+{
+    uint64_t time;                                   /* 相对第一个边沿的时间，单位：CPU周期 */
+    uint8_t channel;                                /* 通道号 */
+    uint8_t level;                                    /* 1=点亮，0=熄灭 */
+} Trace_EdgeRec;
+
+/**
+  * @brief   跟踪数据读取器
+  */
+typedef struct
+{
+    const uint8_t *pos;                            /* 当前读位置 */
+    const uint8_t *end;                           /* 数据末尾 */
+    uint64_t time;                                    /* 已累加的时间 */
+} Trace_Reader;
+
+/**
+  * @brief   比对容差
+  */
+typedef struct
+{
+    uint32_t edge_cycles;                        /* 单个边沿允许的时间偏差，单位：周期 */
+    uint32_t duty_ppm;                             /* 平均占空比允许的偏差，单位：百万分之一 */
+    uint32_t period_cycles;                      /* 平均周期允许的偏差，单位：周期 */
+} Trace_Tolerance;
+
+/**
+  * @brief   比对结果
+  */
+typedef struct
+{
+    uint32_t edges;                                  /* 成功配对比较的边沿数 */
+    int32_t first_diverge;                         /* 第一个超差边沿的序号，-1表示无 */
+    Trace_EdgeRec golden_edge;             /* 超差处的黄金边沿 */
+    Trace_EdgeRec actual_edge;              /* 超差处的实际边沿 */
+    uint32_t duty_err_ppm[TRACE_CHANNELS];        /* 各通道平均占空比偏差 */
+    uint32_t period_err_cycles[TRACE_CHANNELS]; /* 各通道平均周期偏差 */
+} Trace_Diff;
+
+/**
+  * @brief           初始化跟踪记录
+  * @param        buf 记录缓冲区
+  * @param        size 缓冲区大小，单位：字节（至少16字节）
+  * @param        sink 输出回调，为NULL时缓冲区满后丢弃新记录
+  * @retval          None
+  * @note           同时使能DWT周期计数器作为时间基准；buf为NULL时停止记录
+  */
+void Trace_Init(uint8_t *buf, uint32_t size, Trace_Sink sink);
+
+/**
+  * @brief           记录一个边沿
+  * @param        ch 通道号（0-3）
+  * @param        level 1=点亮，0=熄灭
+  * @retval          None
+  * @attention    不可重入，不要在中断和主循环中同时调用
+  */
+void Trace_Edge(uint8_t ch, uint8_t level);
+
+/**
+  * @brief           把缓冲区中剩余的记录交给输出回调
+  * @param        None
+  * @retval          None
+  */
+void Trace_Flush(void);
+
+/**
+  * @brief           获取缓冲区中尚未输出的数据
+  * @param        len 输出数据长度，单位：字节
+  * @retval          缓冲区首地址
+  */
+const uint8_t *Trace_Data(uint32_t *len);
+
+/**
+  * @brief           获取因缓冲区满而丢弃的边沿数
+  * @param        None
+  * @retval          丢弃的边沿数
+  */
+uint32_t Trace_Dropped(void);
+
+/**
+  * @brief           初始化读取器
+  * @param        r 读取器
+  * @param        data 跟踪数据
+  * @param        len 数据长度，单位：字节
+  * @retval          None
+  */
+void Trace_ReaderInit(Trace_Reader *r, const uint8_t *data, uint32_t len);
+
+/**
+  * @brief           读取下一个边沿
+  * @param        r 读取器
+  * @param        e 输出的边沿记录
+  * @retval          1=读到一条记录，0=数据结束或数据损坏
+  */
+uint8_t Trace_ReadEdge(Trace_Reader *r, Trace_EdgeRec *e);
+
+/**
+  * @brief           将实际跟踪与黄金跟踪按容差比对
+  * @param        golden 黄金跟踪数据
+  * @param        golden_len 黄金跟踪长度
+  * @param        actual 实际跟踪数据
+  * @param        actual_len 实际跟踪长度
+  * @param        tol 容差
+  * @param        diff 输出比对结果
+  * @retval          0=在容差内，1=超差
+  * @note           边沿按顺序逐条配对，通道、电平不一致或时间超差均视为分歧；
+  *                        占空比和周期按各通道相邻上升沿统计
+  */
+uint8_t Trace_Compare(const uint8_t *golden, uint32_t golden_len,
+                      const uint8_t *actual, uint32_t actual_len,
+                      const Trace_Tolerance *tol, Trace_Diff *diff);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __TRACE_H */
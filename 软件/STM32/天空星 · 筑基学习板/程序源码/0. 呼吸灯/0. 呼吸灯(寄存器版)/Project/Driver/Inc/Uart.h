@@ -0,0 +1,115 @@
+/**
+  ************************************************************************************
+  * @file              Uart.h
+  * @author         None
+  * @version       V1.1.0
+  * @date            2026-10-17
+  * @brief           USART1 DMA收发驱动头文件
+  *
+  * @details        本文件提供不经过中间拷贝的串口收发接口：
+  *                        1. 接收：DMA2 Stream2（通道4）循环写入环形缓冲区，CPU不逐字节搬运
+  *                        2. 帧边界：USART空闲线（IDLE）中断记录一帧结束的时刻
+  *                        3. Uart_Poll()把上次读取之后的新数据以缓冲区内的指针交给回调，
+  *                           跨过缓冲区末尾时分两段交付，数据不拷贝
+  *                        4. 发送：DMA2 Stream7（通道4）直接从调用者的缓冲区发送
+  *
+  * @note            引脚：PA9 = USART1_TX，PA10 = USART1_RX（AF7）
+  *                        USART1挂在APB2上，16倍过采样时最高波特率 = APB2时钟 ÷ 16（F407上5.25Mbps）
+  *                        （168MHz时为5.25Mbit/s，约525KB/s）
+  *
+  * @attention     注意事项：
+  *                         1. 两次Uart_Poll()之间收到的数据不能超过UART_RX_SIZE，否则旧数据被覆盖
+  *                            （最高波特率下两次调用的间隔不能超过约1.95ms，主循环每个PWM周期500μs调用一次）
+  *                         2. Uart_Send()的缓冲区在发送完成（Uart_TxBusy()返回0）前须保持有效
+  *
+  *                         修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 最高波特率按APB2实际时钟说明
+  *
+  ************************************************************************************
+  */
+
+#ifndef __UART_H
+#define __UART_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#define UART_RX_SIZE                          1024U        /* 接收环形缓冲区大小，单位：字节（最高波特率下约1.95ms的数据） */
+#define UART_BAUD                               115200U    /* 默认波特率 */
+
+/**
+  * @brief   接收回调
+  * @param   ctx 回调参数
+  * @param   data 新数据在环形缓冲区中的起始地址（回调返回后可能被覆盖）
+  * @param   len 字节数（可能为0）
+  * @param   idle 1=本段之后线路已空闲（一帧结束），0=帧尚未结束
+  */
+typedef void (*Uart_Sink)(void *ctx, const uint8_t *data, uint32_t len, uint8_t idle);
+
+/**
+  * @brief   收发统计
+  */
+typedef struct
+{
+    uint32_t rx_bytes;                                 /* 累计接收字节数 */
+    uint32_t frames;                                     /* 累计空闲线帧数 */
+    uint32_t rx_peak;                                   /* 一次Uart_Poll()取出的最大字节数 */
+    uint32_t latency_max;                            /* 空闲中断到Uart_Poll()交付的最大耗时，单位：CPU周期 */
+    uint32_t tx_bytes;                                  /* 累计发送字节数 */
+} Uart_Stats;
+
+/**
+  * @brief           初始化USART1及收发DMA
+  * @param        baud 波特率
+  * @retval          None
+  * @note           初始化后立即开始接收
+  */
+void Uart_Init(uint32_t baud);
+
+/**
+  * @brief           交付新收到的数据
+  * @param        sink 接收回调
+  * @param        ctx 回调参数
+  * @retval          本次交付的字节数
+  * @note           在主循环中调用；有空闲线事件时最后一次回调的idle为1
+  */
+uint32_t Uart_Poll(Uart_Sink sink, void *ctx);
+
+/**
+  * @brief           用DMA发送一段数据
+  * @param        data 数据（发送完成前须保持有效）
+  * @param        len 字节数（1 ~ 65535）
+  * @retval          0=已开始，1=上一段尚未发送完，2=参数非法
+  */
+uint8_t Uart_Send(const uint8_t *data, uint32_t len);
+
+/**
+  * @brief           查询是否正在发送
+  * @param        None
+  * @retval          1=发送中，0=空闲
+  */
+uint8_t Uart_TxBusy(void);
+
+/**
+  * @brief           读取收发统计
+  * @param        stats 输出统计
+  * @retval          None
+  */
+void Uart_GetStats(Uart_Stats *stats);
+
+/**
+  * @brief           USART1中断处理函数
+  * @param        None
+  * @retval          None
+  */
+void USART1_IRQHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __UART_H */
@@ -0,0 +1,130 @@
+/**
+  ************************************************************************************
+  * @file              Ws2812.h
+  * @author         None
+  * @version       V1.1.0
+  * @date            2026-10-17
+  * @brief           WS2812/SK6812可寻址LED驱动头文件
+  *
+  * @details        本文件提供基于定时器PWM + DMA的灯带驱动接口：
+  *                        1. TIM2_CH1（PA5）输出800kHz PWM，每个周期发送一位，
+  *                           比较值为WS2812_T0H_NS或WS2812_T1H_NS对应的计数值
+  *                        2. DMA1 Stream1（通道3，TIM2_UP）循环搬运乒乓缓冲区到TIM2->CCR1，
+  *                           半传输/传输完成中断中编码下一半，缓冲区大小与灯带长度无关；
+  *                           CCR1为32位寄存器，缓冲区和DMA传输都按字
+  *                        3. 数据发送完后输出WS2812_RESET_US的低电平，然后停止定时器
+  *
+  * @note            帧数据按线上顺序存放：WS2812为G、R、B，SK6812 RGBW为G、R、B、W，每字节高位先发
+  *                        发送一帧的时间 = 字节数 × 8 × 1.25μs + WS2812_RESET_US
+  *                        （1000个RGB像素约30.3ms，最高约33帧/秒）
+  *
+  * @attention     注意事项：
+  *                         1. 发送期间帧数据不能修改，Ws2812_Busy()返回0后才可写入下一帧
+  *                         2. Ws2812_Fill()为纯编码函数，不访问硬件，可在主机上验证
+  *
+  *                         修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 Ws2812_Fill()输出改为32位比较值
+  *
+  ************************************************************************************
+  */
+
+#ifndef __WS2812_H
+#define __WS2812_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#define WS2812_BIT_HZ                         800000U      /* 位速率 */
+#define WS2812_T0H_NS                         400U           /* 0码高电平时间，单位：纳秒 */
+#define WS2812_T1H_NS                         800U           /* 1码高电平时间，单位：纳秒 */
+#define WS2812_RESET_US                     300U           /* 帧间复位低电平时间，单位：微秒 */
+#define WS2812_HALF_SLOTS                  64U            /* 乒乓缓冲区每一半的位数（2个RGBW像素） */
+
+/**
+  * @brief   编码状态
+  */
+typedef struct
+{
+    const uint8_t *data;                             /* 帧数据 */
+    uint32_t bits;                                       /* 数据总位数 */
+    uint32_t pos;                                        /* 下一个要编码的位 */
+    uint32_t reset_left;                              /* 剩余的复位低电平位数 */
+    uint16_t t0;                                         /* 0码比较值 */
+    uint16_t t1;                                         /* 1码比较值 */
+} Ws2812_Stream;
+
+/**
+  * @brief           开始编码一帧
+  * @param        s 编码状态
+  * @param        data 帧数据
+  * @param        len 数据字节数
+  * @param        t0 0码比较值
+  * @param        t1 1码比较值
+  * @param        reset_slots 数据之后的低电平位数
+  * @retval          None
+  */
+void Ws2812_Begin(Ws2812_Stream *s, const uint8_t *data, uint32_t len,
+                  uint16_t t0, uint16_t t1, uint32_t reset_slots);
+
+/**
+  * @brief           编码下一段比较值
+  * @param        s 编码状态
+  * @param        dst 输出比较值
+  * @param        slots 输出个数
+  * @retval          写入的有效位数（数据位 + 复位位），其余位置填0
+  */
+uint32_t Ws2812_Fill(Ws2812_Stream *s, uint32_t *dst, uint32_t slots);
+
+/**
+  * @brief           初始化灯带驱动
+  * @param        None
+  * @retval          None
+  * @note           配置PA5、TIM2和DMA1 Stream1，引脚保持低电平
+  */
+void Ws2812_Init(void);
+
+/**
+  * @brief           开始发送一帧
+  * @param        data 帧数据（发送完成前须保持有效且不被修改）
+  * @param        len 数据字节数
+  * @retval          0=已开始，1=上一帧尚未发送完
+  */
+uint8_t Ws2812_Show(const uint8_t *data, uint32_t len);
+
+/**
+  * @brief           查询是否正在发送
+  * @param        None
+  * @retval          1=发送中，0=空闲
+  */
+uint8_t Ws2812_Busy(void);
+
+/**
+  * @brief           上一帧的发送耗时
+  * @param        None
+  * @retval          从Ws2812_Show()到停止定时器的CPU周期数
+  */
+uint32_t Ws2812_FrameCycles(void);
+
+/**
+  * @brief           上一帧在中断中编码的耗时
+  * @param        None
+  * @retval          CPU周期数，除以Ws2812_FrameCycles()即编码占用的CPU比例
+  */
+uint32_t Ws2812_IsrCycles(void);
+
+/**
+  * @brief           DMA1 Stream1中断处理函数
+  * @param        None
+  * @retval          None
+  */
+void DMA1_Stream1_IRQHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __WS2812_H */
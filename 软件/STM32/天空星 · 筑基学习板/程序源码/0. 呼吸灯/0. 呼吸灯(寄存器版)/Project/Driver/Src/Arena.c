@@ -0,0 +1,139 @@
+/**
+  ************************************************************************************
+  * @file              Arena.c
+  * @author         None
+  * @version       V1.0.1
+  * @date            2026-10-17
+  * @brief           帧内临时内存（线性分配区）源文件
+  *
+  * @details        本文件实现了线性分配区：
+  *                        1. 分配按实际地址对齐（存储区起始只保证8字节对齐，更大的对齐在分配时补齐）
+  *                        2. 回收只把当前位置归零，耗时与本帧分配次数无关（调试填充除外）
+  *                        3. ARENA_FRAME_CCM为1时Arena_Frame的存储区固定在DEVICE_CCM_BASE：
+  *                           Keil用.ARM.__at_0x10000000节（须在目标设置中勾选IRAM2，否则L6985E，见Arena.h），
+  *                           GCC放在.ccmram节（链接脚本需把.ccmram放到CCM）
+  *
+  * @note            Arena_Frame静态初始化，不需要调用Arena_Init()
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.0.1 更正CCM放置的前提说明
+  *
+  ************************************************************************************
+  */
+
+#include "Arena.h"
+#include <stddef.h>
+#include <string.h>
+
+#if ARENA_FRAME_CCM && !defined(REG_SIM)
+#if defined(__CC_ARM) || defined(__ARMCC_VERSION)
+#define ARENA_FRAME_SECTION                __attribute__((section(".ARM.__at_0x10000000"), zero_init))  /* DEVICE_CCM_BASE */
+#else
+#define ARENA_FRAME_SECTION                __attribute__((section(".ccmram")))
+#endif
+#else
+#define ARENA_FRAME_SECTION
+#endif
+
+static uint64_t arena_frame_buf[ARENA_FRAME_SIZE / sizeof(uint64_t)] ARENA_FRAME_SECTION;
+
+Arena Arena_Frame = { (uint8_t *)arena_frame_buf, sizeof(arena_frame_buf), 0, 0, 0, 0, 0, 0, 0 };
+
+/**
+  * @brief           初始化分配区
+  * @param        a 分配区
+  * @param        buf 存储区
+  * @param        size 存储区大小，单位：字节
+  * @retval          None
+  */
+void Arena_Init(Arena *a, void *buf, uint32_t size)
+{
+    a->base = (uint8_t *)buf;
+    a->size = size;
+    a->top = 0;
+    a->last = 0;
+    a->peak = 0;
+    a->fail = 0;
+    a->frames = 0;
+    a->corrupt = 0;
+#if ARENA_POISON
+    memset(buf, ARENA_POISON_BYTE, size);
+    a->poisoned = size;
+#else
+    a->poisoned = 0;
+#endif
+}
+
+/**
+  * @brief           分配一段内存
+  * @param        a 分配区
+  * @param        size 字节数
+  * @param        align 对齐，单位：字节（2的幂），0表示ARENA_ALIGN
+  * @retval          地址，NULL=本帧剩余空间不足
+  */
+void *Arena_Alloc(Arena *a, uint32_t size, uint32_t align)
+{
+    uintptr_t addr;
+    uint32_t start;
+
+    if(align == 0) align = ARENA_ALIGN;
+    addr = ((uintptr_t)a->base + a->top + (align - 1U)) & ~(uintptr_t)(align - 1U);
+    start = (uint32_t)(addr - (uintptr_t)a->base);
+    if(start > a->size || size > a->size - start) {
+        a->fail++;
+        return NULL;
+    }
+
+#if ARENA_POISON
+    {
+        /* 从上次位置到本次末尾（含对齐填充）在上一帧回收后不应被写过 */
+        uint32_t end = (start + size < a->poisoned) ? start + size : a->poisoned;
+        uint32_t i;
+
+        for(i = a->top; i < end; i++) {
+            if(a->base[i] != ARENA_POISON_BYTE) {
+                a->corrupt++;
+                break;
+            }
+        }
+    }
+#endif
+
+    a->top = start + size;
+    return (void *)addr;
+}
+
+/**
+  * @brief           回收本帧的全部分配
+  * @param        a 分配区
+  * @retval          None
+  */
+void Arena_Reset(Arena *a)
+{
+#if ARENA_POISON
+    memset(a->base, ARENA_POISON_BYTE, a->top);
+    if(a->top > a->poisoned) a->poisoned = a->top;
+#endif
+    if(a->top > a->peak) a->peak = a->top;
+    a->last = a->top;
+    a->top = 0;
+    a->frames++;
+}
+
+/**
+  * @brief           读取用量报告
+  * @param        a 分配区
+  * @param        r 输出：报告
+  * @retval          None
+  */
+void Arena_GetReport(const Arena *a, Arena_Report *r)
+{
+    r->size = a->size;
+    r->used = a->top;
+    r->last = a->last;
+    r->peak = (a->top > a->peak) ? a->top : a->peak;
+    r->fail = a->fail;
+    r->frames = a->frames;
+    r->corrupt = a->corrupt;
+}
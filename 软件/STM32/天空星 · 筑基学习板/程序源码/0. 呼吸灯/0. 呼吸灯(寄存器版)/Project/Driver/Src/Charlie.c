@@ -0,0 +1,191 @@
+/**
+  ************************************************************************************
+  * @file              Charlie.c
+  * @author         None
+  * @version       V1.2.0
+  * @date            2026-10-17
+  * @brief           查理复用（Charlieplexing）LED驱动源文件
+  *
+  * @details        本文件实现了三态映像的预计算和定时扫描：
+  *                        1. MODER映像 = 其他引脚的原值 | 本时隙阳极和阴极的输出模式（01），
+  *                           未用到的复用引脚保持00（输入）
+  *                        2. BSRR映像只涉及复用引脚：阳极置位，阴极复位，输入引脚复位（关闭前的残留电平无效）
+  *                        3. 扫描顺序与Matrix相同：子帧0的各阳极，子帧1的各阳极，……
+  *                        4. 换时隙：先写全部复用引脚为输入的MODER（消隐），再写BSRR，最后写本时隙的MODER，
+  *                           写BSRR时没有引脚处于输出模式，旧时隙的引脚不会输出新电平
+  *
+  * @note            TIM6挂在APB1上，定时器时钟取Device_TimClk1()；不使用ARR预装载
+  *                        没有TIM6的型号（F401/F411）不编译本驱动，F412的中断名为TIM6_IRQHandler
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 定时器时钟改由Device层计算，按型号选择TIM6中断名，无TIM6的型号不编译
+  *                         - 2026-10-17 V1.2.0 中断中先写全输入的MODER再写BSRR，消除换时隙时的鬼影
+  *
+  ************************************************************************************
+  */
+
+#include "Charlie.h"
+#include "Reg.h"
+#include "Device.h"
+
+#if DEVICE_HAS_TIM(6)
+
+static GPIO_TypeDef *ch_port;                          /* GPIO端口 */
+static const uint8_t *ch_pin;                          /* 引脚号列表 */
+static uint32_t ch_n;                                       /* 引脚数 */
+static uint32_t ch_unit;                                   /* 最低位子帧的时隙时长 */
+static uint32_t ch_moder_rest;                         /* 其他引脚的MODER值 */
+static Charlie_Slot *ch_front;                          /* 显示缓冲区 */
+static Charlie_Slot *ch_back;                           /* 后台缓冲区 */
+static Charlie_Slot *ch_slot;                            /* 下一次显示的时隙 */
+static Charlie_Slot *ch_end;                             /* 显示缓冲区末尾 */
+static volatile uint8_t ch_pending;                  /* 后台缓冲区待切换 */
+
+/**
+  * @brief           填充一个缓冲区
+  * @param        slots 缓冲区
+  * @param        level 各LED亮度，为NULL时全灭
+  * @retval          None
+  */
+static void Charlie_Fill(Charlie_Slot *slots, const uint8_t *level)
+{
+    uint32_t k, a, c;
+    uint32_t moder, bsrr;
+    const uint8_t *row;
+
+    for(k = 0; k < CHARLIE_BITS; k++) {
+        for(a = 0; a < ch_n; a++) {
+            /* 阳极：输出高电平 */
+            moder = ch_moder_rest | GPIO_2BIT(ch_pin[a], GPIO_MODE_OUT);
+            bsrr = GPIO_BSRR_SET(ch_pin[a]);
+            row = level ? &level[a * (ch_n - 1U)] : 0;
+
+            for(c = 0; c < ch_n; c++) {
+                if(c == a) continue;
+                /* 要点亮的阴极输出低电平，其余为输入；两者ODR都清零 */
+                bsrr |= GPIO_BSRR_RESET(ch_pin[c]);
+                if(row != 0 && ((row[c < a ? c : c - 1U] >> k) & 1U)) {
+                    moder |= GPIO_2BIT(ch_pin[c], GPIO_MODE_OUT);
+                }
+            }
+            slots->bsrr = bsrr;
+            slots->moder = moder;
+            slots->arr = (ch_unit << k) - 1U;
+            slots++;
+        }
+    }
+}
+
+/**
+  * @brief           初始化并开始扫描
+  * @param        port GPIO端口
+  * @param        pin 引脚号列表
+  * @param        n 引脚数
+  * @param        unit 最低位子帧的时隙时长
+  * @param        front 显示缓冲区
+  * @param        back 后台缓冲区
+  * @retval          None
+  */
+void Charlie_Init(GPIO_TypeDef *port, const uint8_t *pin, uint32_t n, uint32_t unit,
+                  Charlie_Slot *front, Charlie_Slot *back)
+{
+    uint32_t mask2 = 0;
+    uint32_t mask1 = 0;
+    uint32_t i;
+
+    ch_port = port;
+    ch_pin = pin;
+    ch_n = n;
+    ch_unit = (unit < CHARLIE_MIN_UNIT) ? CHARLIE_MIN_UNIT : unit;
+    ch_front = front;
+    ch_back = back;
+    ch_slot = front;
+    ch_end = front + CHARLIE_BITS * n;
+    ch_pending = 0;
+
+    for(i = 0; i < n; i++) {
+        mask2 |= GPIO_2BIT_MASK(pin[i]);
+        mask1 |= GPIO_1BIT_MASK(pin[i]);
+    }
+
+    /* 1. 使能端口和TIM6时钟（GPIOx时钟位 = 端口序号） */
+    REG_MODIFY(RCC->AHB1ENR, 0, 1U << (((uint32_t)(uintptr_t)port - AHB1PERIPH_BASE) >> 10));
+    REG_MODIFY(RCC->APB1ENR, 0, RCC_APB1ENR_TIM6EN);
+
+    /* 2. 复用引脚：输入、推挽、无上下拉、中速，记录其他引脚的MODER */
+    REG_MODIFY(port->MODER, mask2, 0);
+    REG_MODIFY(port->OTYPER, mask1, 0);
+    REG_MODIFY(port->PUPDR, mask2, 0);
+    REG_MODIFY(port->OSPEEDR, mask2, mask2 & 0x55555555U);
+    ch_moder_rest = REG_READ(port->MODER) & ~mask2;
+
+    Charlie_Fill(front, 0);
+    Charlie_Fill(back, 0);
+
+    /* 3. TIM6：更新中断，ARR不预装载 */
+    REG_WRITE(TIM6->CR1, 0);
+    REG_WRITE(TIM6->PSC, 0);
+    REG_WRITE(TIM6->ARR, ch_unit - 1U);
+    REG_WRITE(TIM6->EGR, TIM_EGR_UG);
+    REG_WRITE(TIM6->SR, 0);
+    REG_WRITE(TIM6->DIER, TIM_DIER_UIE);
+    REG_WRITE(NVIC->ISER[(uint32_t)DEVICE_TIM6_IRQn >> 5], 1U << ((uint32_t)DEVICE_TIM6_IRQn & 0x1FU));
+    REG_WRITE(TIM6->CR1, TIM_CR1_CEN);
+}
+
+/**
+  * @brief           计算新一帧并在扫描完当前帧后切换
+  * @param        level 各LED亮度
+  * @retval          0=已提交，1=上一帧尚未切换
+  */
+uint8_t Charlie_Render(const uint8_t *level)
+{
+    if(ch_pending) return 1;
+    Charlie_Fill(ch_back, level);
+    ch_pending = 1;
+    return 0;
+}
+
+/**
+  * @brief           当前配置的刷新率
+  * @param        None
+  * @retval          刷新率，单位：Hz
+  */
+uint32_t Charlie_RefreshHz(void)
+{
+    return Device_TimClk1() / (ch_unit * ch_n * ((1U << CHARLIE_BITS) - 1U));
+}
+
+/**
+  * @brief           TIM6中断处理函数
+  * @param        None
+  * @retval          None
+  * @note           全输入MODER → BSRR → MODER → ARR，均为整字写入；
+  *                        若先写BSRR，旧时隙仍为输出的引脚会立即输出新电平（例如旧阴极变为新阳极时，
+  *                        旧阳极被拉低），点亮不属于任何时隙的LED
+  */
+void DEVICE_TIM6_IRQHandler(void)
+{
+    const Charlie_Slot *s = ch_slot;
+    Charlie_Slot *t;
+
+    REG_WRITE(TIM6->SR, 0);
+    REG_WRITE(ch_port->MODER, ch_moder_rest);
+    REG_WRITE(ch_port->BSRR, s->bsrr);
+    REG_WRITE(ch_port->MODER, s->moder);
+    REG_WRITE(TIM6->ARR, s->arr);
+
+    if(++ch_slot == ch_end) {
+        if(ch_pending) {
+            t = ch_front;
+            ch_front = ch_back;
+            ch_back = t;
+            ch_end = ch_front + (ch_end - ch_back);
+            ch_pending = 0;
+        }
+        ch_slot = ch_front;
+    }
+}
+
+#endif  /* DEVICE_HAS_TIM(6) */
@@ -2,107 +2,142 @@
   ************************************************************************************
   * @file              Delay.c
   * @author         None
-  * @version       V1.0.0
+  * @version       V1.2.0
   * @date            2026-01-18
   * @brief           延时函数模块源文件
   *
-  * @details        本文件实现了基于SysTick定时器的延时函数：
+  * @details        本文件实现了基于DWT周期计数器的延时函数：
   *                        1. 微秒级延时（Delay_us）
   *                        2. 毫秒级延时（Delay_ms）
   *                        3. 秒级延时（Delay_s）
+  *                        4. 周期性定时（Delay_Mark / Delay_Until）
   *                        使用SystemCoreClock自动计算计数值，支持不同频率MCU
   *
-  * @note            SysTick配置：
-  *                        - 使用HCLK作为时钟源
-  *                        - 24位递减计数器
-  *                        - 最大计数值：0xFFFFFF (16,777,215)
+  * @note            DWT->CYCCNT配置：
+  *                        - 32位递增计数器，以HCLK计数，始终自由运行，不被延时函数重装
+  *                        - 延时按64位累计经过的周期数，任意时长都不会截断
+  *                        - Delay_Until以上一次的截止时刻为基准推进，调用开销不累积
   *
   * @attention      注意事项：
   *                        1. 延时精度受系统时钟频率影响
   *                        2. 延时期间会占用CPU资源（忙等待）
-  *                        3. 微秒延时最大值为0xFFFFFF/(SystemCoreClock/1000000)
-  *                        
+  *                        3. 等待期间被中断占用超过2^32个周期（168MHz下约25.5秒）会少计一圈
+  *
   *                        修改日志：
   *                        - 2026-01-18 V1.0.0 初始版本
+  *                        - 2026-10-17 V1.1.0 SysTick控制字改用CMSIS位域宏，去除魔数
+  *                        - 2026-10-17 V1.2.0 改用自由运行的DWT周期计数器，去除24位截断和毫秒/秒延时的累积误差
   *
   ************************************************************************************
   */
 #include "stm32f4xx.h"
+#include "Reg.h"
+#include "Delay.h"
+
+/**
+  * @brief           确保DWT周期计数器已运行
+  * @param        None
+  * @retval          None
+  * @note           已使能时只有一次寄存器读；不清零CYCCNT，不影响其他使用者
+  */
+static void Delay_Enable(void)
+{
+    if(!(REG_READ(DWT->CTRL) & DWT_CTRL_CYCCNTENA_Msk)) {
+        REG_MODIFY(CoreDebug->DEMCR, 0, CoreDebug_DEMCR_TRCENA_Msk);
+        REG_MODIFY(DWT->CTRL, 0, DWT_CTRL_CYCCNTENA_Msk);
+    }
+}
+
+/**
+  * @brief           按CPU周期延时
+  * @param        cycles 延时时长，单位：CPU周期
+  * @retval          None
+  * @note           每次读取CYCCNT时累加与上次读数之差，32位回绕自动处理
+  */
+void Delay_Cycles(uint64_t cycles)
+{
+    uint32_t last;
+    uint32_t now;
+    uint64_t elapsed = 0;
+
+    Delay_Enable();
+    last = REG_READ(DWT->CYCCNT);
+    while(elapsed < cycles) {
+        now = REG_READ(DWT->CYCCNT);
+        elapsed += now - last;
+        last = now;
+    }
+}
 
 /**
   * @brief           微秒级延时函数
   * @param         xus 延时时长，单位：微秒 (μs)
   * @retval          None
-  * @note           使用SysTick定时器实现精确微秒延时
-  *                        - 根据SystemCoreClock自动计算计数值
-  *                        - 24位计数器最大值为0xFFFFFF
-  *                        - F407系统时钟为168MHz时，最大延时约233,015μs
+  * @note           计数值 = xus × SystemCoreClock ÷ 1,000,000，按64位计算
   *
   * @attention    注意事项：
   *                        1. 延时期间会阻塞CPU执行
-  *                        2. 超过最大值的延时将被截断为最大值
-  *                        3. 使用前需确保SystemCoreClock已正确设置
+  *                        2. 使用前需确保SystemCoreClock已正确设置
   */
 void Delay_us(uint32_t xus)
 {
-    /* 计算需要的计数值 */
-    uint32_t ticks = SystemCoreClock / 1000000 * xus; 
-    
-    /* 防止计数值超过24位计数器最大值 */
-    if(ticks > 0xFFFFFF) ticks = 0xFFFFFF;
-    
-    /* 配置SysTick定时器 */
-    SysTick->LOAD = ticks;                                       /* 设置定时器重装值，F407的时钟频率是168MHz */
-    SysTick->VAL = 0x00;                                          /* 清空当前计数值 */
-    SysTick->CTRL = 0x00000005;                          /* 设置时钟源为HCLK，启动定时器 */
-    
-    /* 等待计数到0 */
-    while(!(SysTick->CTRL & 0x00010000));           
-    
-    /* 关闭定时器 */
-    SysTick->CTRL = 0x00000004;                          
+    Delay_Cycles((uint64_t)xus * SystemCoreClock / 1000000U);
 }
 
 /**
   * @brief           毫秒级延时函数
   * @param        xms 延时时长，单位：毫秒 (ms)
   * @retval          None
-  * @note           基于Delay_us函数实现的毫秒级延时
-  *                        - 通过循环调用Delay_us(1000)实现
+  * @note           一次换算成总周期数后连续计数，不再循环调用Delay_us(1000)
   *                        - 支持最大延时：4,294,967,295毫秒
   *
   * @attention    注意事项：
-  *                        1. 延时精度受微秒延时精度影响
-  *                        2. 长时间延时会占用CPU资源
-  *                        3. 参数为0时函数直接返回
+  *                        1. 长时间延时会占用CPU资源
+  *                        2. 参数为0时函数直接返回
   */
 void Delay_ms(uint32_t xms)
 {
-    /* 循环调用微秒延时函数实现毫秒延时 */
-	while(xms--)
-	{
-		Delay_us(1000);             /* 延时1毫秒 */
-	}
+    Delay_Cycles((uint64_t)xms * SystemCoreClock / 1000U);
 }
- 
+
 /**
   * @brief           秒级延时函数
   * @param        xs 延时时长，单位：秒 (s)
   * @retval          None
-  * @note           基于Delay_ms函数实现的秒级延时
-  *                        - 通过循环调用Delay_ms(1000)实现
+  * @note           一次换算成总周期数后连续计数
   *                        - 支持最大延时：4,294,967,295秒
   *
   * @attention    注意事项：
-  *                        1. 延时精度受毫秒延时精度影响
-  *                        2. 非常长的延时可能因计数器溢出而不准确
-  *                        3. 实际应用中建议使用硬件定时器实现长时间延时
+  *                        1. 实际应用中建议使用硬件定时器实现长时间延时
   */
 void Delay_s(uint32_t xs)
 {
-    /* 循环调用毫秒延时函数实现秒延时 */
-	while(xs--)
-	{
-		Delay_ms(1000);             /* 延时1秒 */
-	}
-} 
+    Delay_Cycles((uint64_t)xs * SystemCoreClock);
+}
+
+/**
+  * @brief           取当前时刻作为周期性定时的起点
+  * @param        None
+  * @retval          当前CYCCNT值
+  */
+uint32_t Delay_Mark(void)
+{
+    Delay_Enable();
+    return REG_READ(DWT->CYCCNT);
+}
+
+/**
+  * @brief           等待到 *mark + cycles 时刻，并把 *mark 推进cycles
+  * @param        mark 上一次的截止时刻（由Delay_Mark()初始化）
+  * @param        cycles 间隔，单位：CPU周期（小于2^31）
+  * @retval          None
+  * @note           截止时刻只由起点和间隔决定，循环体和调用本身的耗时不会累积成漂移；
+  *                        若调用时已超过截止时刻则立即返回
+  */
+void Delay_Until(uint32_t *mark, uint32_t cycles)
+{
+    uint32_t deadline = *mark + cycles;
+
+    while((int32_t)(REG_READ(DWT->CYCCNT) - deadline) < 0);
+    *mark = deadline;
+}
@@ -0,0 +1,227 @@
+/**
+  ************************************************************************************
+  * @file              Device.c
+  * @author         None
+  * @version       V1.1.0
+  * @date            2026-10-17
+  * @brief           器件能力表源文件
+  *
+  * @details        本文件实现了器件能力表和时钟换算：
+  *                        1. 能力表按型号编号排列，数据取自各型号参考手册和数据手册（VDD 2.7~3.6V）
+  *                        2. APB分频：PPRE < 4为不分频，4~7依次为2、4、8、16分频
+  *                        3. 定时器时钟：APB不分频时等于PCLK，否则为PCLK × 2（RCC_DCKCFGR.TIMPRE = 0）
+  *                        4. APB分频：按能力表的总线上限取最小分频，外设时钟在各型号上都取到允许的最高值
+  *
+  * @note            Flash等待周期：数值越小取指越快，ART加速器（预取 + 指令缓存）掩盖大部分等待周期
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 增加Device_TuneBus()和Device_CheckClocks()
+  *
+  ************************************************************************************
+  */
+
+#include "Device.h"
+#include "Reg.h"
+
+#define DEVICE_MHZ                                1000000U
+
+/**
+  * @brief   能力表
+  */
+static const Device_Caps Device_Table[DEVICE_COUNT] =
+{
+    { "STM32F40x", DEVICE_F40X, 6, { 30, 60, 90, 120, 150, 168 },
+      168000000U, 42000000U, 84000000U, 0x10000U, 0x01FFU, 0x7FFEU },
+    { "STM32F427", DEVICE_F427, 6, { 30, 60, 90, 120, 150, 180 },
+      180000000U, 45000000U, 90000000U, 0x10000U, 0x07FFU, 0x7FFEU },
+    { "STM32F429", DEVICE_F429, 6, { 30, 60, 90, 120, 150, 180 },
+      180000000U, 45000000U, 90000000U, 0x10000U, 0x07FFU, 0x7FFEU },
+    { "STM32F401", DEVICE_F401, 3, { 30, 60, 84 },
+      84000000U, 42000000U, 84000000U, 0, 0x009FU, 0x0E3EU },
+    { "STM32F410", DEVICE_F410, 4, { 30, 64, 90, 100 },
+      100000000U, 50000000U, 100000000U, 0, 0x0087U, 0x0A62U },
+    { "STM32F411", DEVICE_F411, 4, { 30, 64, 90, 100 },
+      100000000U, 50000000U, 100000000U, 0, 0x009FU, 0x0E3EU },
+    { "STM32F412", DEVICE_F412, 4, { 30, 64, 90, 100 },
+      100000000U, 50000000U, 100000000U, 0, 0x00FFU, 0x7FFEU },
+    { "STM32F413", DEVICE_F413, 4, { 25, 50, 75, 100 },
+      100000000U, 50000000U, 100000000U, 0, 0x00FFU, 0x7FFEU },
+    { "STM32F446", DEVICE_F446, 6, { 30, 60, 90, 120, 150, 180 },
+      180000000U, 45000000U, 90000000U, 0, 0x00FFU, 0x7FFEU },
+    { "STM32F469", DEVICE_F469, 6, { 30, 60, 90, 120, 150, 180 },
+      180000000U, 45000000U, 90000000U, 0x10000U, 0x07FFU, 0x7FFEU },
+};
+
+/**
+  * @brief           APB分频字段换算为右移位数
+  * @param        ppre PPRE1或PPRE2字段值（0~7）
+  * @retval          右移位数（0~4）
+  */
+static uint32_t Device_ApbShift(uint32_t ppre)
+{
+    return (ppre < 4U) ? 0U : ppre - 3U;
+}
+
+/**
+  * @brief           不超过上限的最小APB分频
+  * @param        limit 总线上限，单位：Hz
+  * @retval          右移位数（0~4）
+  */
+static uint32_t Device_ApbFit(uint32_t limit)
+{
+    uint32_t shift = 0;
+
+    while(shift < 4U && (SystemCoreClock >> shift) > limit) shift++;
+    return shift;
+}
+
+/**
+  * @brief           右移位数换算为PPRE字段值
+  */
+static uint32_t Device_ApbField(uint32_t shift)
+{
+    return (shift == 0) ? 0U : shift + 3U;
+}
+
+/**
+  * @brief           按能力表核对一组时钟
+  * @param        pclk1 APB1频率
+  * @param        pclk2 APB2频率
+  * @retval          DEVICE_CLK_xxx的组合
+  */
+static uint32_t Device_Check(uint32_t pclk1, uint32_t pclk2)
+{
+    const Device_Caps *caps = Device_Get();
+    uint32_t ret = DEVICE_CLK_OK;
+
+    if(SystemCoreClock > caps->sysclk_max) ret |= DEVICE_CLK_SYSCLK;
+    if(pclk1 > caps->apb1_max) ret |= DEVICE_CLK_APB1;
+    if(pclk2 > caps->apb2_max) ret |= DEVICE_CLK_APB2;
+    return ret;
+}
+
+/**
+  * @brief           当前型号的能力
+  * @param        None
+  * @retval          能力表中的一项
+  */
+const Device_Caps *Device_Get(void)
+{
+    return &Device_Table[DEVICE_ID];
+}
+
+/**
+  * @brief           指定HCLK所需的最少Flash等待周期
+  * @param        hclk HCLK频率，单位：Hz
+  * @retval          等待周期数
+  */
+uint32_t Device_FlashLatency(uint32_t hclk)
+{
+    const Device_Caps *caps = Device_Get();
+    uint32_t ws = 0;
+
+    while(ws + 1U < caps->ws_count && hclk > (uint32_t)caps->ws_mhz[ws] * DEVICE_MHZ) ws++;
+    return ws;
+}
+
+/**
+  * @brief           按SystemCoreClock设置Flash等待周期，并打开预取和指令/数据缓存
+  * @param        None
+  * @retval          设置的等待周期数
+  */
+uint32_t Device_TuneFlash(void)
+{
+    uint32_t ws = Device_FlashLatency(SystemCoreClock);
+
+    REG_MODIFY(FLASH->ACR, FLASH_ACR_LATENCY,
+               REG_FIELD(0, 4, ws) | FLASH_ACR_PRFTEN | FLASH_ACR_ICEN | FLASH_ACR_DCEN);
+    while((REG_READ(FLASH->ACR) & FLASH_ACR_LATENCY) != ws);        /* 读回确认新的等待周期已生效 */
+    return ws;
+}
+
+/**
+  * @brief           按能力表设置APB1/APB2分频
+  * @param        None
+  * @retval          DEVICE_CLK_xxx的组合
+  */
+uint32_t Device_TuneBus(void)
+{
+    const Device_Caps *caps = Device_Get();
+    uint32_t s1 = Device_ApbFit(caps->apb1_max);
+    uint32_t s2 = Device_ApbFit(caps->apb2_max);
+
+    /* 只改分频，一次读-改-写；分频在下一个总线周期生效，无须等待 */
+    REG_MODIFY(RCC->CFGR, RCC_CFGR_PPRE1 | RCC_CFGR_PPRE2,
+               REG_FIELD(10, 3, Device_ApbField(s1)) | REG_FIELD(13, 3, Device_ApbField(s2)));
+    return Device_Check(SystemCoreClock >> s1, SystemCoreClock >> s2);
+}
+
+/**
+  * @brief           按能力表核对当前时钟
+  * @param        None
+  * @retval          DEVICE_CLK_xxx的组合
+  */
+uint32_t Device_CheckClocks(void)
+{
+    uint32_t cfgr = REG_READ(RCC->CFGR);
+
+    return Device_Check(SystemCoreClock >> Device_ApbShift((cfgr & RCC_CFGR_PPRE1) >> 10),
+                        SystemCoreClock >> Device_ApbShift((cfgr & RCC_CFGR_PPRE2) >> 13));
+}
+
+/**
+  * @brief           更新SystemCoreClock，调整Flash和APB分频
+  * @param        None
+  * @retval          Device_TuneBus()的返回值
+  */
+uint32_t Device_Init(void)
+{
+    SystemCoreClockUpdate();
+    Device_TuneFlash();
+    return Device_TuneBus();
+}
+
+/**
+  * @brief           APB1外设时钟
+  * @param        None
+  * @retval          频率，单位：Hz
+  */
+uint32_t Device_Pclk1(void)
+{
+    return SystemCoreClock >> Device_ApbShift((REG_READ(RCC->CFGR) & RCC_CFGR_PPRE1) >> 10);
+}
+
+/**
+  * @brief           APB2外设时钟
+  * @param        None
+  * @retval          频率，单位：Hz
+  */
+uint32_t Device_Pclk2(void)
+{
+    return SystemCoreClock >> Device_ApbShift((REG_READ(RCC->CFGR) & RCC_CFGR_PPRE2) >> 13);
+}
+
+/**
+  * @brief           APB1定时器时钟
+  * @param        None
+  * @retval          频率，单位：Hz
+  */
+uint32_t Device_TimClk1(void)
+{
+    uint32_t pclk = Device_Pclk1();
+
+    return (pclk == SystemCoreClock) ? pclk : pclk * 2U;
+}
+
+/**
+  * @brief           APB2定时器时钟
+  * @param        None
+  * @retval          频率，单位：Hz
+  */
+uint32_t Device_TimClk2(void)
+{
+    uint32_t pclk = Device_Pclk2();
+
+    return (pclk == SystemCoreClock) ? pclk : pclk * 2U;
+}
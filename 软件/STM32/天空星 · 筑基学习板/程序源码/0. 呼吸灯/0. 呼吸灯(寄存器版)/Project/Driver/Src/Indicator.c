@@ -0,0 +1,111 @@
+/**
+  ************************************************************************************
+  * @file              Indicator.c
+  * @author         None
+  * @version       V1.2.1
+  * @date            2026-10-17
+  * @brief           LED1硬件指示驱动源文件
+  *
+  * @details        本文件实现了TIM3→TIM4级联：
+  *                        1. TIM3：计数频率1MHz，ARR = tick_us - 1，MMS = 010（更新事件作为TRGO）
+  *                        2. TIM4：SMS = 111（外部时钟模式1），TS = 010（ITR2 = TIM3），
+  *                           ARR = period_ticks - 1，CCR3 = period_ticks ÷ 2
+  *                        3. CH3为PWM模式2、低电平有效：CNT < CCR3时PB8为高（熄灭），否则为低（点亮）
+  *                        4. 修改周期只写ARR/CCR3的预装载值（ARPE、OC3PE），由TIM4的更新事件同时装入；
+  *                           两次写入期间置UDIS，更新事件不会只装入其中一个
+  *
+  * @note            TIM3、TIM4挂在APB1上，定时器时钟取Device_TimClk1()；没有TIM3/TIM4的型号（F410）不编译本驱动
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 定时器时钟改由Device层计算，无TIM3/TIM4的型号不编译
+  *                         - 2026-10-17 V1.2.0 增加Indicator_SetPeriod()，运行中修改周期在最暗点生效
+  *                         - 2026-10-17 V1.2.1 Indicator_SetPeriod()写CCR3、ARR期间置UDIS，两者总在同一次更新事件装入
+  *
+  ************************************************************************************
+  */
+
+#include "Indicator.h"
+#include "Reg.h"
+#include "Device.h"
+
+#if DEVICE_HAS_TIM(3) && DEVICE_HAS_TIM(4)
+
+#define INDICATOR_PIN            8U              /* LED1：PB8 */
+#define INDICATOR_AF             2U              /* AF2：TIM3/TIM4/TIM5 */
+
+#define TIM_OCM_PWM2             0x7U           /* 输出比较模式：PWM模式2 */
+#define TIM_SMS_EXTCLK1          0x7U           /* 从模式：外部时钟模式1 */
+#define TIM_TS_ITR2                0x2U           /* 触发源：ITR2（TIM4的ITR2连接TIM3） */
+#define TIM_MMS_UPDATE          0x2U           /* 主模式：更新事件作为TRGO */
+
+/**
+  * @brief           初始化定时器级联
+  * @param        tick_us 主定时器溢出周期，单位：微秒
+  * @param        period_ticks 完整呼吸周期包含的tick数
+  * @retval          None
+  */
+void Indicator_Init(uint32_t tick_us, uint32_t period_ticks)
+{
+    /* 1. 使能TIM3、TIM4时钟 */
+    REG_MODIFY(RCC->APB1ENR, 0, RCC_APB1ENR_TIM3EN | RCC_APB1ENR_TIM4EN);
+
+    /* 2. 从定时器TIM4：对TIM3溢出计数，CH3输出半周期方波 */
+    REG_WRITE(TIM4->CR1, 0);
+    REG_WRITE(TIM4->PSC, 0);
+    REG_WRITE(TIM4->ARR, period_ticks - 1U);
+    REG_WRITE(TIM4->CCR3, period_ticks / 2U);
+    REG_MODIFY(TIM4->CCMR2, TIM_CCMR2_OC3M | TIM_CCMR2_OC3PE | REG_MASK(0, 2),
+               REG_FIELD(4, 3, TIM_OCM_PWM2) | TIM_CCMR2_OC3PE);
+    REG_MODIFY(TIM4->CCER, TIM_CCER_CC3P | TIM_CCER_CC3E, TIM_CCER_CC3P | TIM_CCER_CC3E);
+    REG_WRITE(TIM4->SMCR, REG_FIELD(4, 3, TIM_TS_ITR2) | REG_FIELD(0, 3, TIM_SMS_EXTCLK1));
+    REG_WRITE(TIM4->EGR, TIM_EGR_UG);                         /* 装载预装载寄存器，CNT清零 */
+    REG_WRITE(TIM4->CR1, TIM_CR1_ARPE | TIM_CR1_CEN);
+
+    /* 3. PB8切换为TIM4_CH3复用输出（LED_Init()已配置推挽、高速） */
+    REG_MODIFY(GPIOB->AFR[1], GPIO_AF_MASK(INDICATOR_PIN), GPIO_AF(INDICATOR_PIN, INDICATOR_AF));
+    REG_MODIFY(GPIOB->MODER, GPIO_2BIT_MASK(INDICATOR_PIN), GPIO_2BIT(INDICATOR_PIN, GPIO_MODE_AF));
+
+    /* 4. 主定时器TIM3：1MHz计数，每tick_us溢出一次 */
+    REG_WRITE(TIM3->CR1, 0);
+    REG_WRITE(TIM3->PSC, Device_TimClk1() / 1000000U - 1U);
+    REG_WRITE(TIM3->ARR, tick_us - 1U);
+    REG_MODIFY(TIM3->CR2, REG_MASK(4, 3), REG_FIELD(4, 3, TIM_MMS_UPDATE));
+    REG_WRITE(TIM3->EGR, TIM_EGR_UG);                         /* 装载PSC，会输出一次TRGO */
+
+    /* UG产生的TRGO使TIM4多计一次，重新清零两者的计数和标志 */
+    REG_WRITE(TIM4->CNT, 0);
+    REG_WRITE(TIM3->SR, 0);
+    REG_WRITE(TIM3->CR1, TIM_CR1_ARPE | TIM_CR1_CEN);
+}
+
+/**
+  * @brief           运行中修改呼吸周期
+  * @param        period_ticks 完整呼吸周期包含的tick数
+  * @retval          0=成功，1=超出范围
+  */
+uint8_t Indicator_SetPeriod(uint32_t period_ticks)
+{
+    if(period_ticks < 2U || period_ticks > 0x10000U) return 1;
+
+    /* UDIS期间溢出照常回绕但不产生更新事件，影子寄存器保持旧值；
+       两者在清除UDIS后的下一次更新事件一起装入，最多晚一个呼吸周期生效 */
+    REG_MODIFY(TIM4->CR1, 0, TIM_CR1_UDIS);
+    REG_WRITE(TIM4->CCR3, period_ticks / 2U);
+    REG_WRITE(TIM4->ARR, period_ticks - 1U);
+    REG_MODIFY(TIM4->CR1, TIM_CR1_UDIS, 0);
+    return 0;
+}
+
+/**
+  * @brief           等待主定时器溢出
+  * @param        None
+  * @retval          None
+  */
+void Indicator_WaitTick(void)
+{
+    while((REG_READ(TIM3->SR) & TIM_SR_UIF) == 0);
+    REG_WRITE(TIM3->SR, (uint16_t)~TIM_SR_UIF);              /* 写0清除，其余位写1不影响 */
+}
+
+#endif  /* DEVICE_HAS_TIM(3) && DEVICE_HAS_TIM(4) */
@@ -2,7 +2,7 @@
   ************************************************************************************
   * @file              LED.c
   * @author         Yan
-  * @version       V1.0.0
+  * @version       V1.3.0
   * @date            2026-01-18
   * @brief            LED驱动模块源文件
   *
@@ -17,43 +17,53 @@
   *
   * @attention     修改日志：
   *                         - 2026-01-18 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 LED_Init改用Reg.h位域宏，每个寄存器只访问一次
+  *                         - 2026-10-17 V1.2.0 开关函数增加TRACE_EDGE边沿记录钩子
+  *                         - 2026-10-17 V1.3.0 开关函数改用REG_xxx宏访问寄存器，支持主机仿真
   *
   ************************************************************************************
   */
  
 #include "LED.h"
+#include "Reg.h"
+#include "Trace.h"
+
+#define LED1_PIN                 8U              /* LED1：PB8 */
+#define LED2_PIN                 2U              /* LED2：PB2 */
 
 /**
   * @brief           LED初始化函数
   * @param        None
   * @retval          None
-  * @note           初始化PB2引脚为推挽输出模式，配置输出速度为高速
-  * @attention    使用寄存器直接操作方式配置GPIO
+  * @note           初始化PB2、PB8引脚为推挽输出模式，配置输出速度为超高速
+  * @attention    使用Reg.h位域宏在编译期合并两个引脚的配置，
+  *                        每个寄存器只访问一次
   */
 void LED_Init()
 {
     /* 1. 使能GPIOB时钟 */
-    // RCC->AHB1ENR |= (0x01 << 1);                                 // 使用位运算使能GPIOB时钟
-    RCC->AHB1ENR |= RCC_AHB1ENR_GPIOBEN;       // 使用预定义宏使能GPIOB时钟
+    REG_MODIFY(RCC->AHB1ENR, 0, RCC_AHB1ENR_GPIOBEN);
    
-    /* 2. 配置输出模式 */
-    GPIOB->MODER &= ~(3U << (2 * 2));                           // 清除PB2的模式位
-    GPIOB->MODER |= (1U << (2 * 2));                               // 将PB2配置为输出模式
-    GPIOB->MODER &= ~(3U << (2 * 8));                           // 清除PB8的模式位
-    GPIOB->MODER |= (1U << (2 * 8));                               // 将PB8配置为输出模式
+    /* 2. 配置输出模式：PB2、PB8为通用输出 */
+    REG_MODIFY(GPIOB->MODER,
+               GPIO_2BIT_MASK(LED1_PIN) | GPIO_2BIT_MASK(LED2_PIN),
+               GPIO_2BIT(LED1_PIN, GPIO_MODE_OUT) | GPIO_2BIT(LED2_PIN, GPIO_MODE_OUT));
        
-    // 3. 配置为推挽输出，无上拉下拉 */
-    GPIOB->OTYPER &= ~(1U << 2);                                 // 配置PB2为推挽输出
-    GPIOB->PUPDR &= ~(3U << (2 * 2));                           // 配置PB2无上拉下拉
-    GPIOB->OTYPER &= ~(1U << 8);                                 // 配置PB8为推挽输出
-    GPIOB->PUPDR &= ~(3U << (2 * 8));                           // 配置PB8无上拉下拉
+    /* 3. 配置为推挽输出，无上拉下拉 */
+    REG_MODIFY(GPIOB->OTYPER,
+               GPIO_1BIT_MASK(LED1_PIN) | GPIO_1BIT_MASK(LED2_PIN),
+               GPIO_1BIT(LED1_PIN, GPIO_OTYPE_PP) | GPIO_1BIT(LED2_PIN, GPIO_OTYPE_PP));
+    REG_MODIFY(GPIOB->PUPDR,
+               GPIO_2BIT_MASK(LED1_PIN) | GPIO_2BIT_MASK(LED2_PIN),
+               GPIO_2BIT(LED1_PIN, GPIO_PUPD_NONE) | GPIO_2BIT(LED2_PIN, GPIO_PUPD_NONE));
       
-    /* 4. 配置输出速度 */
-    GPIOB->OSPEEDR |= ( 0x03 << 2 * 2 );                      // 配置PB2输出速度为超高速
-    GPIOB->OSPEEDR |= ( 0x03 << 2 * 8 );                      // 配置PB8输出速度为超高速
+    /* 4. 配置输出速度为超高速 */
+    REG_MODIFY(GPIOB->OSPEEDR,
+               GPIO_2BIT_MASK(LED1_PIN) | GPIO_2BIT_MASK(LED2_PIN),
+               GPIO_2BIT(LED1_PIN, GPIO_SPEED_HIGH) | GPIO_2BIT(LED2_PIN, GPIO_SPEED_HIGH));
     
-    GPIOB->ODR &= ~ (0x01 << 2); 
-    GPIOB->BSRR = (1U << 8);
+    /* 5. 初始电平：PB2低（LED2熄灭），PB8高（LED1熄灭），一次BSRR写完成 */
+    REG_WRITE(GPIOB->BSRR, GPIO_BSRR_RESET(LED2_PIN) | GPIO_BSRR_SET(LED1_PIN));
 }
 
 /**
@@ -65,7 +75,8 @@ void LED_Init()
   */
 void LED_On_1(void) 
 {
-    GPIOB->BSRR = (1U << (8 + 16));                                 // BSRR低16位写1，将ODR对应位清零
+    REG_WRITE(GPIOB->BSRR, GPIO_BSRR_RESET(LED1_PIN));     // BSRR高16位写1，将ODR对应位清零
+    TRACE_EDGE(TRACE_CH_LED1, 1);
 }
 
 /**
@@ -77,7 +88,8 @@ void LED_On_1(void)
   */
 void LED_Off_1(void)
 {
-    GPIOB->BSRR = (1U << 8);                                            // BSRR高16位写1，将ODR对应位置1
+    REG_WRITE(GPIOB->BSRR, GPIO_BSRR_SET(LED1_PIN));          // BSRR低16位写1，将ODR对应位置1
+    TRACE_EDGE(TRACE_CH_LED1, 0);
 }
 
 /**
@@ -89,7 +101,8 @@ void LED_Off_1(void)
   */
 void LED_On_2(void)
 {
-    GPIOB->ODR |= ( 0x01 << 2);                                      // 设置ODR第2位，输出高电平点亮LED
+    REG_MODIFY(GPIOB->ODR, 0, GPIO_1BIT(LED2_PIN, 1));         // 设置ODR第2位，输出高电平点亮LED
+    TRACE_EDGE(TRACE_CH_LED2, 1);
 }
 
 /**
@@ -101,7 +114,8 @@ void LED_On_2(void)
   */
 void LED_Off_2(void)
 {
-    GPIOB->ODR &= ~ (0x01 << 2);                                   // 清除ODR第2位，输出低电平熄灭LED
+    REG_MODIFY(GPIOB->ODR, GPIO_1BIT_MASK(LED2_PIN), 0);     // 清除ODR第2位，输出低电平熄灭LED
+    TRACE_EDGE(TRACE_CH_LED2, 0);
 }
 
 
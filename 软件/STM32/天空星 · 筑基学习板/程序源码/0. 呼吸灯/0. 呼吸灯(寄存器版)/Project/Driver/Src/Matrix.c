@@ -0,0 +1,210 @@
+/**
+  ************************************************************************************
+  * @file              Matrix.c
+  * @author         None
+  * @version       V1.1.0
+  * @date            2026-10-17
+  * @brief           行扫描LED点阵驱动源文件
+  *
+  * @details        本文件实现了点阵的预计算和定时扫描：
+  *                        1. 扫描顺序：子帧0的第0~rows-1行，子帧1的第0~rows-1行，……
+  *                        2. TIM7不使用ARR预装载，中断开头写入的ARR立即作用于本次显示
+  *                        3. 扫描到最后一项时若有待切换的帧则交换缓冲区，不会显示半帧
+  *
+  * @note            TIM7挂在APB1上，定时器时钟取Device_TimClk1()；没有TIM7的型号（F401/F410/F411）不编译本驱动
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 定时器时钟改由Device层计算，无TIM7的型号不编译
+  *
+  ************************************************************************************
+  */
+
+#include "Matrix.h"
+#include "Reg.h"
+#include "Device.h"
+
+#if DEVICE_HAS_TIM(7)
+
+static const Matrix_Config *mx_cfg;                 /* 点阵配置 */
+static Matrix_Slot *mx_front;                         /* 显示缓冲区 */
+static Matrix_Slot *mx_back;                          /* 后台缓冲区 */
+static Matrix_Slot *mx_slot;                           /* 下一次显示的项 */
+static Matrix_Slot *mx_end;                            /* 显示缓冲区末尾 */
+static volatile uint8_t mx_pending;                 /* 后台缓冲区待切换 */
+static uint32_t mx_blank;                               /* 列端口BSRR：关闭全部列 */
+
+/**
+  * @brief           由引脚列表生成BSRR字
+  * @param        pin 引脚号列表
+  * @param        n 引脚数
+  * @param        on 点亮/选中的引脚位图（第i位对应pin[i]）
+  * @param        active_low 1=低电平有效
+  * @retval          BSRR字
+  */
+static uint32_t Matrix_Bsrr(const uint8_t *pin, uint32_t n, uint32_t on, uint8_t active_low)
+{
+    uint32_t set = 0;
+    uint32_t reset = 0;
+    uint32_t i;
+
+    for(i = 0; i < n; i++) {
+        if(((on >> i) & 1U) ^ (active_low ? 1U : 0U)) {
+            set |= GPIO_BSRR_SET(pin[i] & 0x0FU);
+        } else {
+            reset |= GPIO_BSRR_RESET(pin[i] & 0x0FU);
+        }
+    }
+    return set | reset;
+}
+
+/**
+  * @brief           填充一个缓冲区
+  * @param        slots 缓冲区
+  * @param        level 各像素亮度，为NULL时全灭
+  * @retval          None
+  */
+static void Matrix_Fill(Matrix_Slot *slots, const uint8_t *level)
+{
+    const Matrix_Config *cfg = mx_cfg;
+    uint32_t k, r, c;
+    uint32_t on;
+
+    for(k = 0; k < MATRIX_BITS; k++) {
+        for(r = 0; r < cfg->rows; r++) {
+            on = 0;
+            if(level != 0) {
+                for(c = 0; c < cfg->cols; c++) {
+                    on |= (uint32_t)((level[r * cfg->cols + c] >> k) & 1U) << c;
+                }
+            }
+            slots->row = Matrix_Bsrr(cfg->row_pin, cfg->rows, 1U << r, cfg->row_active_low);
+            slots->col = Matrix_Bsrr(cfg->col_pin, cfg->cols, on, cfg->col_active_low);
+            slots->arr = (cfg->unit << k) - 1U;
+            slots++;
+        }
+    }
+}
+
+/**
+  * @brief           配置一组引脚为推挽高速输出
+  * @param        port GPIO端口
+  * @param        pin 引脚号列表
+  * @param        n 引脚数
+  * @retval          None
+  */
+static void Matrix_PinInit(GPIO_TypeDef *port, const uint8_t *pin, uint32_t n)
+{
+    uint32_t mask2 = 0;
+    uint32_t mask1 = 0;
+    uint32_t i;
+
+    for(i = 0; i < n; i++) {
+        mask2 |= GPIO_2BIT_MASK(pin[i] & 0x0FU);
+        mask1 |= GPIO_1BIT_MASK(pin[i] & 0x0FU);
+    }
+    /* 各引脚的2位字段统一写01（通用输出）/11（超高速），1位字段写0（推挽） */
+    REG_MODIFY(port->OTYPER, mask1, 0);
+    REG_MODIFY(port->PUPDR, mask2, 0);
+    REG_MODIFY(port->OSPEEDR, 0, mask2);
+    REG_MODIFY(port->MODER, mask2, mask2 & 0x55555555U);
+}
+
+/**
+  * @brief           初始化点阵并开始扫描
+  * @param        cfg 点阵配置
+  * @param        front 显示缓冲区
+  * @param        back 后台缓冲区
+  * @retval          None
+  */
+void Matrix_Init(const Matrix_Config *cfg, Matrix_Slot *front, Matrix_Slot *back)
+{
+    uint32_t ports;
+
+    mx_cfg = cfg;
+    mx_front = front;
+    mx_back = back;
+    mx_slot = front;
+    mx_end = front + MATRIX_BITS * cfg->rows;
+    mx_pending = 0;
+    mx_blank = Matrix_Bsrr(cfg->col_pin, cfg->cols, 0, cfg->col_active_low);
+
+    Matrix_Fill(front, 0);
+    Matrix_Fill(back, 0);
+
+    /* 1. 使能两个端口和TIM7的时钟（GPIOx时钟位 = 端口序号） */
+    ports = (1U << (((uint32_t)(uintptr_t)cfg->row_port - AHB1PERIPH_BASE) >> 10))
+          | (1U << (((uint32_t)(uintptr_t)cfg->col_port - AHB1PERIPH_BASE) >> 10));
+    REG_MODIFY(RCC->AHB1ENR, 0, ports);
+    REG_MODIFY(RCC->APB1ENR, 0, RCC_APB1ENR_TIM7EN);
+
+    /* 2. 先输出全灭、全部行释放，再切换为输出 */
+    REG_WRITE(cfg->col_port->BSRR, mx_blank);
+    REG_WRITE(cfg->row_port->BSRR, Matrix_Bsrr(cfg->row_pin, cfg->rows, 0, cfg->row_active_low));
+    Matrix_PinInit(cfg->row_port, cfg->row_pin, cfg->rows);
+    Matrix_PinInit(cfg->col_port, cfg->col_pin, cfg->cols);
+
+    /* 3. TIM7：更新中断，ARR不预装载 */
+    REG_WRITE(TIM7->CR1, 0);
+    REG_WRITE(TIM7->PSC, 0);
+    REG_WRITE(TIM7->ARR, cfg->unit - 1U);
+    REG_WRITE(TIM7->EGR, TIM_EGR_UG);
+    REG_WRITE(TIM7->SR, 0);
+    REG_WRITE(TIM7->DIER, TIM_DIER_UIE);
+    REG_WRITE(NVIC->ISER[(uint32_t)TIM7_IRQn >> 5], 1U << ((uint32_t)TIM7_IRQn & 0x1FU));
+    REG_WRITE(TIM7->CR1, TIM_CR1_CEN);
+}
+
+/**
+  * @brief           计算新一帧并在扫描完当前帧后切换
+  * @param        level 各像素亮度
+  * @retval          0=已提交，1=上一帧尚未切换
+  */
+uint8_t Matrix_Render(const uint8_t *level)
+{
+    if(mx_pending) return 1;
+    Matrix_Fill(mx_back, level);
+    mx_pending = 1;
+    return 0;
+}
+
+/**
+  * @brief           当前配置的刷新率
+  * @param        None
+  * @retval          刷新率，单位：Hz
+  */
+uint32_t Matrix_RefreshHz(void)
+{
+    return Device_TimClk1() / (mx_cfg->unit * mx_cfg->rows * ((1U << MATRIX_BITS) - 1U));
+}
+
+/**
+  * @brief           TIM7中断处理函数
+  * @param        None
+  * @retval          None
+  * @note           消隐 → 切换行 → 写列 → 写时长
+  */
+void TIM7_IRQHandler(void)
+{
+    const Matrix_Slot *s = mx_slot;
+    Matrix_Slot *t;
+
+    REG_WRITE(TIM7->SR, 0);
+    REG_WRITE(mx_cfg->col_port->BSRR, mx_blank);
+    REG_WRITE(mx_cfg->row_port->BSRR, s->row);
+    REG_WRITE(mx_cfg->col_port->BSRR, s->col);
+    REG_WRITE(TIM7->ARR, s->arr);
+
+    if(++mx_slot == mx_end) {
+        if(mx_pending) {
+            t = mx_front;
+            mx_front = mx_back;
+            mx_back = t;
+            mx_end = mx_front + (mx_end - mx_back);
+            mx_pending = 0;
+        }
+        mx_slot = mx_front;
+    }
+}
+
+#endif  /* DEVICE_HAS_TIM(7) */
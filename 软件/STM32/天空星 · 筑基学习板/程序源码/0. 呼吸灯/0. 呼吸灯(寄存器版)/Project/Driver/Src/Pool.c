@@ -0,0 +1,329 @@
+/**
+  ************************************************************************************
+  * @file              Pool.c
+  * @author         None
+  * @version       V1.1.1
+  * @date            2026-10-17
+  * @brief           固定块内存池源文件
+  *
+  * @details        本文件实现了固定块内存池：
+  *                        1. 存储区和配置表由POOL_TABLE(X)在编译期生成，块大小不是POOL_ALIGN倍数时编译报错
+  *                        2. 空闲块的前4字节存放下一个空闲块的地址，链表头为0表示池已用完
+  *                        3. 出栈：LDREX读链表头 → 读下一块地址 → STREX写回，失败则重试；入栈同理
+  *                        4. 统计用同样的LDREX/STREX循环累加，最高占用用比较后写入
+  *                        5. Pool_Benchmark()：按同一分配/释放序列比较本模块与malloc/free的耗时
+  *
+  * @note            无竞争时LDREX/STREX循环只执行一次，分配和释放的耗时与块数、占用情况无关；
+  *                        主机端（REG_SIM或非ARM编译器）单线程运行，独占访问退化为普通读写
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 ARMCC下局部屏蔽__ldrex/__strex的#3731-D；增加Pool_Benchmark()
+  *                         - 2026-10-17 V1.1.1 独占访问宏改用Atomic.h中与Shift595共用的ATOMIC_xxx
+  *
+  ************************************************************************************
+  */
+
+#include "Pool.h"
+#include "Atomic.h"
+#include <stddef.h>
+#if POOL_BENCH_MALLOC
+#include <stdlib.h>
+#endif
+
+/**
+  * @brief   空闲块
+  */
+typedef struct Pool_Block
+{
+    struct Pool_Block *next;                       /* 下一个空闲块，NULL=链表结束 */
+} Pool_Block;
+
+/**
+  * @brief   池配置
+  */
+typedef struct
+{
+    uint8_t *base;                                      /* 存储区 */
+    uint16_t block;                                     /* 块大小，单位：字节 */
+    uint16_t count;                                     /* 块数 */
+} Pool_Config;
+
+/**
+  * @brief   池运行状态
+  */
+typedef struct
+{
+    volatile uintptr_t head;                        /* 空闲链表头（Pool_Block *） */
+    volatile uint32_t used;                          /* 当前占用块数 */
+    volatile uint32_t peak;                          /* 最高占用块数 */
+    volatile uint32_t fail;                            /* 无空闲块的次数 */
+} Pool_State;
+
+/* 存储区：按uint64_t定义，保证8字节对齐 */
+#define POOL_STORAGE(id, block, count)     \
+    typedef char pool_check_##id[((block) % POOL_ALIGN == 0U && (block) >= sizeof(Pool_Block)) ? 1 : -1]; \
+    static uint64_t pool_mem_##id[(block) * (count) / sizeof(uint64_t)];
+#define POOL_CONFIG(id, block, count)      { (uint8_t *)pool_mem_##id, (block), (count) },
+
+POOL_TABLE(POOL_STORAGE)
+
+static const Pool_Config pool_config[POOL_COUNT] =
+{
+    POOL_TABLE(POOL_CONFIG)
+};
+
+static Pool_State pool_state[POOL_COUNT];
+
+/**
+  * @brief           原子加
+  * @param        p 计数
+  * @param        d 增量（补码，可为负）
+  * @retval          加后的值
+  */
+static uint32_t Pool_AtomicAdd(volatile uint32_t *p, uint32_t d)
+{
+    uint32_t v;
+
+    do {
+        v = ATOMIC_LDREX(p) + d;
+    } while(ATOMIC_STREX(v, p));
+    return v;
+}
+
+/**
+  * @brief           原子取最大值
+  * @param        p 最大值记录
+  * @param        v 新值
+  * @retval          None
+  */
+static void Pool_AtomicMax(volatile uint32_t *p, uint32_t v)
+{
+    do {
+        if(ATOMIC_LDREX(p) >= v) {
+            ATOMIC_CLREX();
+            return;
+        }
+    } while(ATOMIC_STREX(v, p));
+}
+
+/**
+  * @brief           初始化所有池
+  * @param        None
+  * @retval          None
+  */
+void Pool_Init(void)
+{
+    const Pool_Config *cfg;
+    Pool_Block *b;
+    uint32_t i;
+    uint32_t k;
+
+    for(i = 0; i < POOL_COUNT; i++) {
+        cfg = &pool_config[i];
+        /* 从后往前串，链表头为第一块，分配顺序与地址顺序一致 */
+        b = NULL;
+        for(k = cfg->count; k > 0; k--) {
+            Pool_Block *cur = (Pool_Block *)(void *)(cfg->base + (k - 1U) * cfg->block);
+
+            cur->next = b;
+            b = cur;
+        }
+        pool_state[i].head = (uintptr_t)b;
+        pool_state[i].used = 0;
+        pool_state[i].peak = 0;
+        pool_state[i].fail = 0;
+    }
+}
+
+/**
+  * @brief           从指定池分配一块
+  * @param        id 池编号POOL_xxx
+  * @retval          块地址，NULL=该池已用完或编号无效
+  */
+void *Pool_AllocFrom(uint32_t id)
+{
+    Pool_State *s;
+    Pool_Block *b;
+
+    if(id >= POOL_COUNT) return NULL;
+    s = &pool_state[id];
+    do {
+        b = (Pool_Block *)ATOMIC_LDREX(&s->head);
+        if(b == NULL) {
+            ATOMIC_CLREX();
+            Pool_AtomicAdd(&s->fail, 1U);
+            return NULL;
+        }
+    } while(ATOMIC_STREX((uintptr_t)b->next, &s->head));
+
+    Pool_AtomicMax(&s->peak, Pool_AtomicAdd(&s->used, 1U));
+    return b;
+}
+
+/**
+  * @brief           分配一块
+  * @param        size 需要的字节数
+  * @retval          块地址（按POOL_ALIGN对齐），NULL=没有足够大的空闲块
+  */
+void *Pool_Alloc(uint32_t size)
+{
+    void *p;
+    uint32_t i;
+
+    for(i = 0; i < POOL_COUNT; i++) {
+        if(pool_config[i].block < size) continue;
+        p = Pool_AllocFrom(i);
+        if(p != NULL) return p;
+    }
+    return NULL;
+}
+
+/**
+  * @brief           释放一块
+  * @param        p 块地址，NULL时不做任何事
+  * @retval          0=成功，1=不是池中块的起始地址
+  */
+uint8_t Pool_Free(void *p)
+{
+    const Pool_Config *cfg;
+    Pool_State *s;
+    Pool_Block *b = (Pool_Block *)p;
+    uint32_t off;
+    uint32_t i;
+
+    if(p == NULL) return 0;
+    for(i = 0; i < POOL_COUNT; i++) {
+        cfg = &pool_config[i];
+        if((uintptr_t)p - (uintptr_t)cfg->base >= (uintptr_t)cfg->block * cfg->count) continue;
+        off = (uint32_t)((uintptr_t)p - (uintptr_t)cfg->base);
+        if(off % cfg->block) return 1;
+
+        s = &pool_state[i];
+        do {
+            b->next = (Pool_Block *)ATOMIC_LDREX(&s->head);
+        } while(ATOMIC_STREX((uintptr_t)b, &s->head));
+        Pool_AtomicAdd(&s->used, (uint32_t)-1);
+        return 0;
+    }
+    return 1;
+}
+
+/**
+  * @brief           读取统计
+  * @param        id 池编号POOL_xxx
+  * @param        st 输出：统计
+  * @retval          None
+  */
+void Pool_GetStats(uint32_t id, Pool_Stats *st)
+{
+    if(id >= POOL_COUNT) return;
+    st->block = pool_config[id].block;
+    st->count = pool_config[id].count;
+    st->used = pool_state[id].used;
+    st->peak = pool_state[id].peak;
+    st->fail = pool_state[id].fail;
+}
+
+/**
+  * @brief   基准测试的分配/释放函数，两种分配器经同样的函数指针调用，调用开销相同
+  */
+typedef void *(*Pool_BenchAlloc)(uint32_t size);
+typedef void (*Pool_BenchFree)(void *p);
+
+static void *Pool_BenchPoolAlloc(uint32_t size)
+{
+    return Pool_Alloc(size);
+}
+
+static void Pool_BenchPoolFree(void *p)
+{
+    (void)Pool_Free(p);
+}
+
+#if POOL_BENCH_MALLOC
+static void *Pool_BenchMalloc(uint32_t size)
+{
+    return malloc(size);
+}
+
+static void Pool_BenchRelease(void *p)
+{
+    free(p);
+}
+#endif
+
+/**
+  * @brief           按测试序列运行一种分配器
+  * @param        alloc 分配函数
+  * @param        release 释放函数
+  * @param        size 每块字节数
+  * @param        depth 每轮分配的块数
+  * @param        rounds 轮数
+  * @param        clock 时钟读取函数
+  * @param        max 输出：单轮最长耗时，单位：时钟计数
+  * @param        fail 输出：累加分配失败次数
+  * @retval          总耗时，单位：时钟计数
+  * @note           每轮先连续分配depth块，再释放奇数项、最后释放偶数项：
+  *                       中间状态空闲块与占用块交错，malloc须在释放偶数项时合并相邻空闲块
+  */
+static uint32_t Pool_BenchRun(Pool_BenchAlloc alloc, Pool_BenchFree release, uint32_t size, uint32_t depth,
+                              uint32_t rounds, uint32_t (*clock)(void), uint32_t *max, uint32_t *fail)
+{
+    void *p[POOL_BENCH_DEPTH_MAX];
+    uint32_t total = 0;
+    uint32_t start;
+    uint32_t t;
+    uint32_t r;
+    uint32_t i;
+
+    *max = 0;
+    for(r = 0; r < rounds; r++) {
+        start = clock();
+        for(i = 0; i < depth; i++) p[i] = alloc(size);
+        for(i = 1; i < depth; i += 2U) release(p[i]);
+        for(i = 0; i < depth; i += 2U) release(p[i]);
+        t = clock() - start;
+
+        total += t;
+        if(t > *max) *max = t;
+        for(i = 0; i < depth; i++) {
+            if(p[i] == NULL) (*fail)++;
+        }
+    }
+    return total;
+}
+
+/**
+  * @brief           比较内存池与malloc/free的耗时
+  * @param        size 每块字节数
+  * @param        depth 每轮分配的块数（1 ~ POOL_BENCH_DEPTH_MAX，超出时截断）
+  * @param        rounds 轮数
+  * @param        clock 时钟读取函数（如Delay_Mark）
+  * @param        ticks_per_us 时钟每微秒的计数值（如SystemCoreClock / 1000000）
+  * @param        result 输出测试结果
+  * @retval          None
+  */
+void Pool_Benchmark(uint32_t size, uint32_t depth, uint32_t rounds, uint32_t (*clock)(void),
+                    uint32_t ticks_per_us, Pool_Bench *result)
+{
+    uint64_t den;                                             /* 分配 + 释放的次数 × 每微秒时钟计数 */
+
+    if(depth == 0) depth = 1U;
+    if(depth > POOL_BENCH_DEPTH_MAX) depth = POOL_BENCH_DEPTH_MAX;
+    den = (uint64_t)depth * rounds * ticks_per_us;
+
+    result->fail = 0;
+    result->pool_ticks = Pool_BenchRun(Pool_BenchPoolAlloc, Pool_BenchPoolFree, size, depth, rounds, clock,
+                                       &result->pool_max, &result->fail);
+#if POOL_BENCH_MALLOC
+    result->malloc_ticks = Pool_BenchRun(Pool_BenchMalloc, Pool_BenchRelease, size, depth, rounds, clock,
+                                         &result->malloc_max, &result->fail);
+#else
+    result->malloc_ticks = 0;
+    result->malloc_max = 0;
+#endif
+
+    result->pool_pair_ns = den ? (uint32_t)((uint64_t)result->pool_ticks * 1000U / den) : 0;
+    result->malloc_pair_ns = den ? (uint32_t)((uint64_t)result->malloc_ticks * 1000U / den) : 0;
+}
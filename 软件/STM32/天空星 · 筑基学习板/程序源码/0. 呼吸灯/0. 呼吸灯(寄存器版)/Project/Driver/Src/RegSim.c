@@ -0,0 +1,662 @@
+/**
+  ************************************************************************************
+  * @file              RegSim.c
+  * @author         None
+  * @version       V1.3.0
+  * @date            2026-10-17
+  * @brief           主机端寄存器仿真层源文件
+  *
+  * @details        本文件实现了寄存器访问分发、虚拟时间调度和中断注入：
+  *                        1. 按地址在模型表中查找外设模型并调用读/写钩子
+  *                        2. 定时事件按时间顺序在RegSim_Advance()中触发
+  *                        3. 挂起的中断在访问或事件结束后依次调用处理函数
+  *                        4. 内置SysTick模型（LOAD/VAL/CTRL，COUNTFLAG读清零，TICKINT）
+  *                        5. 内置DWT模型（CTRL/CYCCNT，CYCCNT即虚拟时间的低32位）
+  *                        6. 全部状态放在RegSim_Context中，每个线程经RegSim_Select()选择自己的上下文，
+  *                           未选择时使用默认上下文
+  *
+  * @note            仅在定义REG_SIM时编译，不加入Keil工程
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 增加DWT周期计数器模型
+  *                         - 2026-10-17 V1.2.0 状态改为可独立创建的上下文（每块虚拟板一个），线程局部选择；
+  *                                                        缓存最早事件时间和挂起中断数，无事件时访问不再扫描整表
+  *                         - 2026-10-17 V1.3.0 增加总线主设备访问RegSim_BusRead32/RegSim_BusWrite32（DMA模型用）
+  *
+  ************************************************************************************
+  */
+
+#ifdef REG_SIM
+
+#include <stdlib.h>
+#include "RegSim.h"
+#include "stm32f4xx.h"
+
+/**
+  * @brief   定时事件
+  */
+typedef struct
+{
+    uint64_t time;                                     /* 触发时间 */
+    RegSim_Event cb;                                 /* 回调，NULL表示空闲 */
+    void *ctx;                                           /* 回调参数 */
+} RegSim_EventSlot;
+
+/**
+  * @brief   未挂接模型的寄存器存储项
+  */
+typedef struct
+{
+    uint32_t addr;
+    uint32_t value;
+} RegSim_Plain;
+
+/**
+  * @brief   内置SysTick模型状态
+  */
+typedef struct
+{
+    uint32_t ctrl;                                       /* CTRL中ENABLE/TICKINT/CLKSOURCE位 */
+    uint32_t load;                                      /* 重装值 */
+    uint32_t val;                                        /* 停止时的当前值 */
+    uint8_t flag;                                        /* COUNTFLAG */
+    uint64_t next_zero;                              /* 下一次计到0的时间 */
+    uint64_t irq_due;                                 /* 下一次中断事件的时间 */
+} RegSim_SysTick;
+
+/**
+  * @brief   内置DWT模型状态
+  */
+typedef struct
+{
+    uint32_t ctrl;                                       /* CTRL */
+    uint32_t frozen;                                  /* 停止时的CYCCNT */
+    uint64_t origin;                                  /* CYCCNT为0对应的虚拟时间 */
+} RegSim_Dwt;
+
+/**
+  * @brief   仿真上下文：一块虚拟板的全部寄存器、事件和中断状态
+  */
+struct RegSim_Context
+{
+    const RegSim_Model *models[REGSIM_MAX_MODELS];
+    uint32_t model_num;
+    RegSim_EventSlot events[REGSIM_MAX_EVENTS];
+    uint64_t next_event;                            /* 最早的事件时间，无事件时为UINT64_MAX */
+    RegSim_Plain plain[REGSIM_MAX_PLAIN];
+    uint32_t plain_num;
+    RegSim_Handler handlers[REGSIM_IRQ_NUM];
+    uint8_t pending[REGSIM_IRQ_NUM];
+    uint32_t pending_num;                          /* 挂起的中断数 */
+    uint8_t in_handler;
+    uint64_t now;
+    uint32_t cost;
+    RegSim_Stats stats;
+    RegSim_SysTick systick;
+    RegSim_Dwt dwt;
+    RegSim_Model systick_model;
+    RegSim_Model dwt_model;
+};
+
+static RegSim_Context sim_default;
+static __thread RegSim_Context *sim_cur = &sim_default;
+
+static uint32_t SysTick_ModelRead(void *ctx, uint32_t offset);
+static void SysTick_ModelWrite(void *ctx, uint32_t offset, uint32_t value);
+
+static uint32_t Dwt_ModelRead(void *ctx, uint32_t offset);
+static void Dwt_ModelWrite(void *ctx, uint32_t offset, uint32_t value);
+
+/* ---------------------------------- 内部函数 ---------------------------------- */
+
+/**
+  * @brief           依次调用挂起中断的处理函数
+  * @param        s 仿真上下文
+  * @retval          None
+  * @note           中断号小者优先；处理函数内挂起的中断在本轮继续处理
+  */
+static void RegSim_Dispatch(RegSim_Context *s)
+{
+    uint32_t i;
+    uint8_t again;
+
+    if(s->pending_num == 0 || s->in_handler) return;
+    s->in_handler = 1;
+    do {
+        again = 0;
+        for(i = 0; i < REGSIM_IRQ_NUM; i++) {
+            if(s->pending[i] && s->handlers[i] != 0) {
+                s->pending[i] = 0;
+                s->pending_num--;
+                s->handlers[i]();
+                again = 1;
+            }
+        }
+    } while(again);
+    s->in_handler = 0;
+}
+
+/**
+  * @brief           按地址查找外设模型
+  * @param        s 仿真上下文
+  * @param        addr 寄存器地址
+  * @retval          模型指针，未找到返回NULL
+  */
+static const RegSim_Model *RegSim_Find(const RegSim_Context *s, uint32_t addr)
+{
+    uint32_t i;
+
+    for(i = 0; i < s->model_num; i++) {
+        if(addr - s->models[i]->base < s->models[i]->size) return s->models[i];
+    }
+    return 0;
+}
+
+/**
+  * @brief           在寄存器存储中查找或新建一项
+  * @param        s 仿真上下文
+  * @param        addr 寄存器地址
+  * @retval          存储项指针，存储已满返回NULL
+  */
+static RegSim_Plain *RegSim_PlainSlot(RegSim_Context *s, uint32_t addr)
+{
+    uint32_t i;
+
+    for(i = 0; i < s->plain_num; i++) {
+        if(s->plain[i].addr == addr) return &s->plain[i];
+    }
+    if(s->plain_num >= REGSIM_MAX_PLAIN) return 0;
+    s->plain[s->plain_num].addr = addr;
+    s->plain[s->plain_num].value = 0;
+    return &s->plain[s->plain_num++];
+}
+
+/**
+  * @brief           重新计算最早的事件时间
+  * @param        s 仿真上下文
+  * @retval          None
+  */
+static void RegSim_NextEvent(RegSim_Context *s)
+{
+    uint32_t i;
+
+    s->next_event = UINT64_MAX;
+    for(i = 0; i < REGSIM_MAX_EVENTS; i++) {
+        if(s->events[i].cb != 0 && s->events[i].time < s->next_event) s->next_event = s->events[i].time;
+    }
+}
+
+/* ---------------------------------- SysTick模型 ---------------------------------- */
+
+/**
+  * @brief           SysTick计数周期（LOAD+1）
+  */
+static uint64_t SysTick_Period(const RegSim_SysTick *st)
+{
+    return (uint64_t)st->load + 1U;
+}
+
+/**
+  * @brief           把SysTick状态更新到当前虚拟时间
+  * @param        s 仿真上下文
+  * @retval          None
+  */
+static void SysTick_Update(RegSim_Context *s)
+{
+    RegSim_SysTick *st = &s->systick;
+    uint64_t n;
+
+    if(!(st->ctrl & SysTick_CTRL_ENABLE_Msk) || s->now < st->next_zero) return;
+    n = (s->now - st->next_zero) / SysTick_Period(st) + 1U;
+    st->next_zero += n * SysTick_Period(st);
+    st->flag = 1;
+}
+
+/**
+  * @brief           SysTick中断事件
+  * @param        ctx 仿真上下文
+  * @retval          None
+  * @note           重新使能或修改配置后旧的事件链因时间不匹配自动失效
+  */
+static void SysTick_Event(void *ctx)
+{
+    RegSim_Context *s = (RegSim_Context *)ctx;
+    RegSim_SysTick *st = &s->systick;
+
+    if(s->now != st->irq_due) return;
+    SysTick_Update(s);
+    if((st->ctrl & SysTick_CTRL_ENABLE_Msk) && (st->ctrl & SysTick_CTRL_TICKINT_Msk)) {
+        RegSim_SetPending(SysTick_IRQn);
+        st->irq_due = st->next_zero;
+        RegSim_Schedule(st->next_zero - s->now, SysTick_Event, s);
+    }
+}
+
+/**
+  * @brief           SysTick模型读钩子
+  * @param        ctx 仿真上下文
+  * @param        offset 寄存器偏移
+  * @retval          寄存器值
+  * @note           读CTRL清除COUNTFLAG
+  */
+static uint32_t SysTick_ModelRead(void *ctx, uint32_t offset)
+{
+    RegSim_Context *s = (RegSim_Context *)ctx;
+    RegSim_SysTick *st = &s->systick;
+    uint32_t value;
+
+    SysTick_Update(s);
+    switch(offset) {
+    case 0x0:                                                                  /* CTRL */
+        value = st->ctrl | (st->flag ? SysTick_CTRL_COUNTFLAG_Msk : 0U);
+        st->flag = 0;
+        return value;
+    case 0x4:                                                                  /* LOAD */
+        return st->load;
+    case 0x8:                                                                  /* VAL */
+        if(!(st->ctrl & SysTick_CTRL_ENABLE_Msk)) return st->val;
+        return (uint32_t)((st->next_zero - s->now) % SysTick_Period(st));
+    default:                                                                    /* CALIB */
+        return 0;
+    }
+}
+
+/**
+  * @brief           SysTick模型写钩子
+  * @param        ctx 仿真上下文
+  * @param        offset 寄存器偏移
+  * @param        value 写入值
+  * @retval          None
+  */
+static void SysTick_ModelWrite(void *ctx, uint32_t offset, uint32_t value)
+{
+    RegSim_Context *s = (RegSim_Context *)ctx;
+    RegSim_SysTick *st = &s->systick;
+    uint32_t was_enabled = st->ctrl & SysTick_CTRL_ENABLE_Msk;
+
+    SysTick_Update(s);
+    switch(offset) {
+    case 0x0:                                                                  /* CTRL */
+        st->ctrl = value & (SysTick_CTRL_ENABLE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_CLKSOURCE_Msk);
+        if(!was_enabled && (st->ctrl & SysTick_CTRL_ENABLE_Msk)) {
+            /* VAL为0时先装载LOAD，再递减到0 */
+            st->next_zero = s->now + (st->val ? st->val : SysTick_Period(st));
+        } else if(was_enabled && !(st->ctrl & SysTick_CTRL_ENABLE_Msk)) {
+            st->val = (uint32_t)((st->next_zero - s->now) % SysTick_Period(st));
+        }
+        if((st->ctrl & SysTick_CTRL_ENABLE_Msk) && (st->ctrl & SysTick_CTRL_TICKINT_Msk)) {
+            st->irq_due = st->next_zero;
+            RegSim_Schedule(st->next_zero - s->now, SysTick_Event, s);
+        } else {
+            st->irq_due = 0;
+        }
+        break;
+    case 0x4:                                                                  /* LOAD */
+        st->load = value & SysTick_LOAD_RELOAD_Msk;
+        break;
+    case 0x8:                                                                  /* VAL：写任意值清零并清除COUNTFLAG */
+        st->val = 0;
+        st->flag = 0;
+        if(st->ctrl & SysTick_CTRL_ENABLE_Msk) st->next_zero = s->now + SysTick_Period(st);
+        break;
+    default:
+        break;
+    }
+}
+
+/* ---------------------------------- DWT模型 ---------------------------------- */
+
+/**
+  * @brief           DWT模型读钩子
+  * @param        ctx 仿真上下文
+  * @param        offset 寄存器偏移
+  * @retval          寄存器值
+  */
+static uint32_t Dwt_ModelRead(void *ctx, uint32_t offset)
+{
+    RegSim_Context *s = (RegSim_Context *)ctx;
+    RegSim_Dwt *dwt = &s->dwt;
+
+    if(offset == 0x0) return dwt->ctrl;                                /* CTRL */
+    if(!(dwt->ctrl & DWT_CTRL_CYCCNTENA_Msk)) return dwt->frozen;     /* CYCCNT */
+    return (uint32_t)(s->now - dwt->origin);
+}
+
+/**
+  * @brief           DWT模型写钩子
+  * @param        ctx 仿真上下文
+  * @param        offset 寄存器偏移
+  * @param        value 写入值
+  * @retval          None
+  */
+static void Dwt_ModelWrite(void *ctx, uint32_t offset, uint32_t value)
+{
+    RegSim_Context *s = (RegSim_Context *)ctx;
+    RegSim_Dwt *dwt = &s->dwt;
+    uint32_t cyccnt = Dwt_ModelRead(ctx, 0x4);
+
+    /* cyccnt为写之前的计数值：停止时为冻结值，运行时为当前值 */
+    if(offset == 0x0) {                                                          /* CTRL */
+        dwt->ctrl = value;
+    } else {                                                                         /* CYCCNT */
+        cyccnt = value;
+    }
+    dwt->frozen = cyccnt;
+    dwt->origin = s->now - cyccnt;
+}
+
+/* ---------------------------------- 接口函数 ---------------------------------- */
+
+/**
+  * @brief           复位仿真层
+  * @param        None
+  * @retval          None
+  */
+void RegSim_Init(void)
+{
+    RegSim_Context *s = sim_cur;
+    uint32_t i;
+
+    s->model_num = 0;
+    s->plain_num = 0;
+    s->now = 0;
+    s->cost = 1;
+    s->in_handler = 0;
+    s->stats.reads = 0;
+    s->stats.writes = 0;
+    for(i = 0; i < REGSIM_MAX_EVENTS; i++) s->events[i].cb = 0;
+    s->next_event = UINT64_MAX;
+    for(i = 0; i < REGSIM_IRQ_NUM; i++) {
+        s->handlers[i] = 0;
+        s->pending[i] = 0;
+    }
+    s->pending_num = 0;
+    s->systick.ctrl = 0;
+    s->systick.load = 0;
+    s->systick.val = 0;
+    s->systick.flag = 0;
+    s->systick.next_zero = 0;
+    s->systick.irq_due = 0;
+    s->dwt.ctrl = 0;
+    s->dwt.frozen = 0;
+    s->dwt.origin = 0;
+    s->systick_model.name = "SysTick";
+    s->systick_model.base = SysTick_BASE;
+    s->systick_model.size = 0x10;
+    s->systick_model.read = SysTick_ModelRead;
+    s->systick_model.write = SysTick_ModelWrite;
+    s->systick_model.ctx = s;
+    s->dwt_model.name = "DWT";
+    s->dwt_model.base = DWT_BASE;
+    s->dwt_model.size = 0x08;
+    s->dwt_model.read = Dwt_ModelRead;
+    s->dwt_model.write = Dwt_ModelWrite;
+    s->dwt_model.ctx = s;
+    /* DWT在前：周期定时轮询CYCCNT时第一项即命中 */
+    RegSim_Attach(&s->dwt_model);
+    RegSim_Attach(&s->systick_model);
+}
+
+/**
+  * @brief           新建一个仿真上下文
+  * @param        None
+  * @retval          上下文指针，内存不足返回NULL
+  */
+RegSim_Context *RegSim_Create(void)
+{
+    RegSim_Context *s = (RegSim_Context *)malloc(sizeof(RegSim_Context));
+    RegSim_Context *prev;
+
+    if(s == 0) return 0;
+    prev = RegSim_Select(s);
+    RegSim_Init();
+    RegSim_Select(prev);
+    return s;
+}
+
+/**
+  * @brief           释放一个仿真上下文
+  * @param        s 上下文（RegSim_Create()的返回值，可为NULL）
+  * @retval          None
+  */
+void RegSim_Destroy(RegSim_Context *s)
+{
+    if(s == &sim_default) return;
+    free(s);
+}
+
+/**
+  * @brief           选择当前线程使用的仿真上下文
+  * @param        s 上下文，为NULL时选择默认上下文
+  * @retval          之前选择的上下文
+  */
+RegSim_Context *RegSim_Select(RegSim_Context *s)
+{
+    RegSim_Context *prev = sim_cur;
+
+    sim_cur = (s != 0) ? s : &sim_default;
+    return prev;
+}
+
+/**
+  * @brief           挂接外设模型
+  * @param        model 模型描述
+  * @retval          0=成功，1=模型表已满或地址重叠
+  */
+uint8_t RegSim_Attach(const RegSim_Model *model)
+{
+    RegSim_Context *s = sim_cur;
+    uint32_t i;
+
+    if(s->model_num >= REGSIM_MAX_MODELS) return 1;
+    for(i = 0; i < s->model_num; i++) {
+        if(model->base < s->models[i]->base + s->models[i]->size
+           && s->models[i]->base < model->base + model->size) return 1;
+    }
+    s->models[s->model_num++] = model;
+    return 0;
+}
+
+/**
+  * @brief           32位寄存器读
+  * @param        addr 寄存器地址
+  * @retval          寄存器值
+  */
+uint32_t RegSim_Read32(uint32_t addr)
+{
+    RegSim_Context *s = sim_cur;
+    const RegSim_Model *m;
+    RegSim_Plain *p;
+    uint32_t value = 0;
+
+    RegSim_Advance(s->cost);
+    s->stats.reads++;
+    m = RegSim_Find(s, addr);
+    if(m != 0) {
+        if(m->read != 0) value = m->read(m->ctx, addr - m->base);
+    } else {
+        p = RegSim_PlainSlot(s, addr);
+        if(p != 0) value = p->value;
+    }
+    RegSim_Dispatch(s);
+    return value;
+}
+
+/**
+  * @brief           32位寄存器写
+  * @param        addr 寄存器地址
+  * @param        value 写入值
+  * @retval          None
+  */
+void RegSim_Write32(uint32_t addr, uint32_t value)
+{
+    RegSim_Context *s = sim_cur;
+    const RegSim_Model *m;
+    RegSim_Plain *p;
+
+    RegSim_Advance(s->cost);
+    s->stats.writes++;
+    m = RegSim_Find(s, addr);
+    if(m != 0) {
+        if(m->write != 0) m->write(m->ctx, addr - m->base, value);
+    } else {
+        p = RegSim_PlainSlot(s, addr);
+        if(p != 0) p->value = value;
+    }
+    RegSim_Dispatch(s);
+}
+
+/**
+  * @brief           总线主设备读（DMA）
+  * @param        addr 寄存器地址
+  * @retval          寄存器值
+  */
+uint32_t RegSim_BusRead32(uint32_t addr)
+{
+    RegSim_Context *s = sim_cur;
+    const RegSim_Model *m = RegSim_Find(s, addr);
+    RegSim_Plain *p;
+
+    if(m != 0) return (m->read != 0) ? m->read(m->ctx, addr - m->base) : 0U;
+    p = RegSim_PlainSlot(s, addr);
+    return (p != 0) ? p->value : 0U;
+}
+
+/**
+  * @brief           总线主设备写（DMA）
+  * @param        addr 寄存器地址
+  * @param        value 写入值
+  * @retval          None
+  */
+void RegSim_BusWrite32(uint32_t addr, uint32_t value)
+{
+    RegSim_Context *s = sim_cur;
+    const RegSim_Model *m = RegSim_Find(s, addr);
+    RegSim_Plain *p;
+
+    if(m != 0) {
+        if(m->write != 0) m->write(m->ctx, addr - m->base, value);
+        return;
+    }
+    p = RegSim_PlainSlot(s, addr);
+    if(p != 0) p->value = value;
+}
+
+/**
+  * @brief           当前虚拟时间
+  * @param        None
+  * @retval          自复位起的CPU周期数
+  */
+uint64_t RegSim_Now(void)
+{
+    return sim_cur->now;
+}
+
+/**
+  * @brief           推进虚拟时间
+  * @param        cycles 推进的周期数
+  * @retval          None
+  */
+void RegSim_Advance(uint64_t cycles)
+{
+    RegSim_Context *s = sim_cur;
+    uint64_t target = s->now + cycles;
+    RegSim_EventSlot *next;
+    RegSim_Event cb;
+    uint32_t i;
+
+    while(s->next_event <= target) {
+        /* 找出最早到期的事件 */
+        next = 0;
+        for(i = 0; i < REGSIM_MAX_EVENTS; i++) {
+            if(s->events[i].cb != 0 && s->events[i].time == s->next_event) {
+                next = &s->events[i];
+                break;
+            }
+        }
+        s->now = next->time;
+        cb = next->cb;
+        next->cb = 0;
+        RegSim_NextEvent(s);
+        cb(next->ctx);
+        RegSim_Dispatch(s);
+    }
+    s->now = target;
+}
+
+/**
+  * @brief           设置每次寄存器访问消耗的周期数
+  * @param        cycles 周期数
+  * @retval          None
+  */
+void RegSim_SetAccessCost(uint32_t cycles)
+{
+    sim_cur->cost = cycles;
+}
+
+/**
+  * @brief           安排一个定时事件
+  * @param        delay 距当前虚拟时间的周期数
+  * @param        cb 事件回调
+  * @param        ctx 回调参数
+  * @retval          0=成功，1=事件表已满
+  */
+uint8_t RegSim_Schedule(uint64_t delay, RegSim_Event cb, void *ctx)
+{
+    RegSim_Context *s = sim_cur;
+    uint32_t i;
+
+    for(i = 0; i < REGSIM_MAX_EVENTS; i++) {
+        if(s->events[i].cb == 0) {
+            s->events[i].time = s->now + delay;
+            s->events[i].cb = cb;
+            s->events[i].ctx = ctx;
+            if(s->events[i].time < s->next_event) s->next_event = s->events[i].time;
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+  * @brief           注册中断处理函数
+  * @param        irq 中断号
+  * @param        handler 处理函数
+  * @retval          None
+  */
+void RegSim_SetHandler(int32_t irq, RegSim_Handler handler)
+{
+    if(irq + REGSIM_IRQ_OFFSET < 0 || irq + REGSIM_IRQ_OFFSET >= (int32_t)REGSIM_IRQ_NUM) return;
+    sim_cur->handlers[irq + REGSIM_IRQ_OFFSET] = handler;
+}
+
+/**
+  * @brief           挂起一个中断
+  * @param        irq 中断号
+  * @retval          None
+  */
+void RegSim_SetPending(int32_t irq)
+{
+    RegSim_Context *s = sim_cur;
+
+    if(irq + REGSIM_IRQ_OFFSET < 0 || irq + REGSIM_IRQ_OFFSET >= (int32_t)REGSIM_IRQ_NUM) return;
+    if(!s->pending[irq + REGSIM_IRQ_OFFSET]) s->pending_num++;
+    s->pending[irq + REGSIM_IRQ_OFFSET] = 1;
+}
+
+/**
+  * @brief           获取并清零总线访问统计
+  * @param        stats 输出统计值
+  * @retval          None
+  */
+void RegSim_TakeStats(RegSim_Stats *stats)
+{
+    RegSim_Context *s = sim_cur;
+
+    *stats = s->stats;
+    s->stats.reads = 0;
+    s->stats.writes = 0;
+}
+
+#endif  /* REG_SIM */
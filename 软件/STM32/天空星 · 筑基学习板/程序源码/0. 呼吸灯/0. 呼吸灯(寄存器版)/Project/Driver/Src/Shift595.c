@@ -0,0 +1,259 @@
+/**
+  ************************************************************************************
+  * @file              Shift595.c
+  * @author         None
+  * @version       V1.2.1
+  * @date            2026-10-17
+  * @brief           74HC595级联LED驱动源文件
+  *
+  * @details        本文件实现了位平面打包、SPI/DMA发送和定时器锁存：
+  *                        1. TIM5为32位定时器，计数时钟取Device_TimClk1()（F407上84MHz）；CH3为PWM模式1，
+  *                           CNT < SHIFT595_LATCH_TICKS时RCLK为高，每次更新产生一个锁存上升沿
+  *                        2. ARR预装载：第k个周期中写入的ARR作用于第k+1个周期，
+  *                           与本周期内移入、下个周期锁存的平面一一对应
+  *                        3. 更新中断：刚锁存的平面开始显示，写入下一平面的时长，启动DMA送出下一平面
+  *                        4. 换帧：待切换的帧只有一个槽位，Shift595_Show()比较为空后写入，中断中取出并清空，
+  *                           两处都用LDREX/STREX，任一方被打断时重试，帧不会被覆盖或丢失
+  *
+  * @note            TIM5、SPI2挂在APB1上：定时器时钟取Device_TimClk1()，SPI时钟 = PCLK1 ÷ 2
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 定时器时钟改由Device层按实际分频计算
+  *                         - 2026-10-17 V1.2.0 待切换帧改为比较后写入、原子取出，Shift595_Show()在已有待切换帧时返回1；
+  *                                                        增加Shift595_InUse()查询缓冲区是否已释放
+  *                         - 2026-10-17 V1.2.1 独占访问宏改用Atomic.h中与Pool共用的ATOMIC_xxx
+  *
+  ************************************************************************************
+  */
+
+#include "Shift595.h"
+#include "stm32f4xx.h"
+#include "Reg.h"
+#include "Device.h"
+#include "Atomic.h"
+
+#define SHIFT595_SCK_PIN       13U            /* SRCLK：PB13（SPI2_SCK） */
+#define SHIFT595_MOSI_PIN      15U            /* SER：PB15（SPI2_MOSI） */
+#define SHIFT595_SPI_AF          5U              /* AF5：SPI1/SPI2 */
+#define SHIFT595_LATCH_PIN     2U              /* RCLK：PA2（TIM5_CH3） */
+#define SHIFT595_TIM_AF          2U              /* AF2：TIM3/TIM4/TIM5 */
+#define SHIFT595_DMA_CHANNEL 0U             /* DMA1 Stream4通道0：SPI2_TX */
+
+#define TIM_OCM_PWM1             0x6U           /* 输出比较模式：PWM模式1 */
+
+/* DMA1 Stream4在HISR/HIFCR中的标志位 */
+#define SHIFT595_DMA_FLAGS     (DMA_HIFCR_CFEIF4 | DMA_HIFCR_CDMEIF4 | DMA_HIFCR_CTEIF4 | \
+                                DMA_HIFCR_CHTIF4 | DMA_HIFCR_CTCIF4)
+
+static const uint8_t *volatile sh_planes;        /* 显示中的帧 */
+static volatile uintptr_t sh_pending;              /* 待切换的帧（const uint8_t *），0=无 */
+static uint32_t sh_regs;                                /* 级联的寄存器数 */
+static uint32_t sh_unit;                                 /* 最低位平面的时长 */
+static uint8_t sh_queued;                              /* 已移入、等待锁存的平面 */
+
+/**
+  * @brief           把亮度数组打包为位平面
+  * @param        level 各LED亮度
+  * @param        regs 级联的寄存器数
+  * @param        planes 输出位平面
+  * @retval          None
+  */
+void Shift595_Pack(const uint8_t *level, uint32_t regs, uint8_t *planes)
+{
+    uint32_t k, r, q;
+    uint8_t byte;
+    const uint8_t *led;
+
+    for(k = 0; k < SHIFT595_BITS; k++) {
+        for(r = 0; r < regs; r++) {
+            led = &level[r * 8U];
+            byte = 0;
+            for(q = 0; q < 8U; q++) {
+                byte |= (uint8_t)(((led[q] >> k) & 1U) << q);
+            }
+            /* 先发送的字节移到最远的寄存器 */
+            planes[k * regs + (regs - 1U - r)] = byte;
+        }
+    }
+}
+
+/**
+  * @brief           最短单位时长
+  * @param        regs 级联的寄存器数
+  * @retval          定时器计数
+  */
+uint32_t Shift595_MinUnit(uint32_t regs)
+{
+    /* 每位占 定时器时钟 ÷ SPI时钟 = 4 个计数 */
+    return regs * 8U * 4U + SHIFT595_ISR_TICKS;
+}
+
+/**
+  * @brief           按最短单位时长计算的最高刷新率
+  * @param        regs 级联的寄存器数
+  * @retval          刷新率，单位：Hz
+  */
+uint32_t Shift595_RefreshHz(uint32_t regs)
+{
+    return Device_TimClk1() / (Shift595_MinUnit(regs) * ((1U << SHIFT595_BITS) - 1U));
+}
+
+/**
+  * @brief           启动DMA送出一个平面
+  * @param        plane 平面序号
+  * @retval          None
+  */
+static void Shift595_Send(uint8_t plane)
+{
+    REG_MODIFY(DMA1_Stream4->CR, DMA_SxCR_EN, 0);
+    REG_WRITE(DMA1->HIFCR, SHIFT595_DMA_FLAGS);
+    REG_WRITE(DMA1_Stream4->M0AR, (uint32_t)(uintptr_t)&sh_planes[plane * sh_regs]);
+    REG_WRITE(DMA1_Stream4->NDTR, sh_regs);
+    REG_MODIFY(DMA1_Stream4->CR, 0, DMA_SxCR_EN);
+}
+
+/**
+  * @brief           取出并清空待切换的帧
+  * @param        None
+  * @retval          待切换的帧，没有时返回NULL
+  * @note           读和清空之间被打断（写入方的STREX或异常返回清除独占监视器）时重试
+  */
+static const uint8_t *Shift595_Take(void)
+{
+    uintptr_t p;
+
+    do {
+        p = ATOMIC_LDREX(&sh_pending);
+        if(p == 0) {
+            ATOMIC_CLREX();
+            return 0;
+        }
+    } while(ATOMIC_STREX(0, &sh_pending));
+    return (const uint8_t *)p;
+}
+
+/**
+  * @brief           排队下一个平面
+  * @param        None
+  * @retval          None
+  * @note           刚锁存的平面开始显示，下一平面在本周期内移入、下个周期开始时锁存；
+  *                        换帧时旧帧的最后一个平面已锁存，DMA不再读取旧帧
+  */
+static void Shift595_Advance(void)
+{
+    const uint8_t *next;
+
+    sh_queued = (uint8_t)((sh_queued + 1U) % SHIFT595_BITS);
+    if(sh_queued == 0) {
+        next = Shift595_Take();
+        if(next != 0) sh_planes = next;
+    }
+    REG_WRITE(TIM5->ARR, (sh_unit << sh_queued) - 1U);
+    Shift595_Send(sh_queued);
+}
+
+/**
+  * @brief           初始化并开始显示
+  * @param        planes 第一帧的位平面
+  * @param        regs 级联的寄存器数
+  * @param        unit 最低位平面的显示时长
+  * @retval          None
+  */
+void Shift595_Init(const uint8_t *planes, uint32_t regs, uint32_t unit)
+{
+    sh_planes = planes;
+    sh_pending = 0;
+    sh_regs = regs;
+    sh_unit = (unit < Shift595_MinUnit(regs)) ? Shift595_MinUnit(regs) : unit;
+    sh_queued = 0;
+
+    /* 1. 使能时钟 */
+    REG_MODIFY(RCC->AHB1ENR, 0, RCC_AHB1ENR_GPIOAEN | RCC_AHB1ENR_GPIOBEN | RCC_AHB1ENR_DMA1EN);
+    REG_MODIFY(RCC->APB1ENR, 0, RCC_APB1ENR_SPI2EN | RCC_APB1ENR_TIM5EN);
+
+    /* 2. 引脚：PB13/PB15为SPI2复用，PA2为TIM5_CH3复用，均为推挽高速 */
+    REG_MODIFY(GPIOB->AFR[1], GPIO_AF_MASK(SHIFT595_SCK_PIN) | GPIO_AF_MASK(SHIFT595_MOSI_PIN),
+               GPIO_AF(SHIFT595_SCK_PIN, SHIFT595_SPI_AF) | GPIO_AF(SHIFT595_MOSI_PIN, SHIFT595_SPI_AF));
+    REG_MODIFY(GPIOB->OSPEEDR, GPIO_2BIT_MASK(SHIFT595_SCK_PIN) | GPIO_2BIT_MASK(SHIFT595_MOSI_PIN),
+               GPIO_2BIT(SHIFT595_SCK_PIN, GPIO_SPEED_HIGH) | GPIO_2BIT(SHIFT595_MOSI_PIN, GPIO_SPEED_HIGH));
+    REG_MODIFY(GPIOB->MODER, GPIO_2BIT_MASK(SHIFT595_SCK_PIN) | GPIO_2BIT_MASK(SHIFT595_MOSI_PIN),
+               GPIO_2BIT(SHIFT595_SCK_PIN, GPIO_MODE_AF) | GPIO_2BIT(SHIFT595_MOSI_PIN, GPIO_MODE_AF));
+    REG_MODIFY(GPIOA->AFR[0], GPIO_AF_MASK(SHIFT595_LATCH_PIN), GPIO_AF(SHIFT595_LATCH_PIN, SHIFT595_TIM_AF));
+    REG_MODIFY(GPIOA->OSPEEDR, GPIO_2BIT_MASK(SHIFT595_LATCH_PIN), GPIO_2BIT(SHIFT595_LATCH_PIN, GPIO_SPEED_HIGH));
+    REG_MODIFY(GPIOA->MODER, GPIO_2BIT_MASK(SHIFT595_LATCH_PIN), GPIO_2BIT(SHIFT595_LATCH_PIN, GPIO_MODE_AF));
+
+    /* 3. SPI2：主机，模式0，高位先发，fPCLK/2，软件NSS，只发送 */
+    REG_WRITE(SPI2->CR1, SPI_CR1_MSTR | SPI_CR1_SSM | SPI_CR1_SSI);
+    REG_WRITE(SPI2->CR2, SPI_CR2_TXDMAEN);
+    REG_MODIFY(SPI2->CR1, 0, SPI_CR1_SPE);
+
+    /* 4. DMA1 Stream4：存储器→SPI2->DR，字节，单次传输 */
+    REG_MODIFY(DMA1_Stream4->CR, DMA_SxCR_EN, 0);
+    while(REG_READ(DMA1_Stream4->CR) & DMA_SxCR_EN);
+    REG_WRITE(DMA1_Stream4->PAR, (uint32_t)(uintptr_t)&SPI2->DR);
+    REG_WRITE(DMA1_Stream4->CR, REG_FIELD(25, 3, SHIFT595_DMA_CHANNEL) | DMA_SxCR_MINC | DMA_SxCR_DIR_0);
+
+    /* 5. 先送出0号平面，等待移位完成 */
+    Shift595_Send(0);
+    while((REG_READ(DMA1->HISR) & DMA_HISR_TCIF4) == 0);
+    while(REG_READ(SPI2->SR) & SPI_SR_BSY);
+
+    /* 6. TIM5：PWM模式1输出锁存脉冲，ARR预装载，更新中断 */
+    REG_WRITE(TIM5->CR1, 0);
+    REG_WRITE(TIM5->PSC, 0);
+    REG_WRITE(TIM5->ARR, sh_unit - 1U);
+    REG_WRITE(TIM5->CCR3, SHIFT595_LATCH_TICKS);
+    REG_MODIFY(TIM5->CCMR2, TIM_CCMR2_OC3M | TIM_CCMR2_OC3PE | REG_MASK(0, 2),
+               REG_FIELD(4, 3, TIM_OCM_PWM1) | TIM_CCMR2_OC3PE);
+    REG_WRITE(TIM5->EGR, TIM_EGR_UG);
+    REG_WRITE(TIM5->SR, 0);
+    REG_WRITE(TIM5->DIER, TIM_DIER_UIE);
+    REG_WRITE(NVIC->ISER[(uint32_t)TIM5_IRQn >> 5], 1U << ((uint32_t)TIM5_IRQn & 0x1FU));
+
+    /* 7. 打开输出产生第一个锁存沿（0号平面），启动计数并排队1号平面 */
+    REG_MODIFY(TIM5->CCER, TIM_CCER_CC3P | TIM_CCER_CC3E, TIM_CCER_CC3E);
+    REG_WRITE(TIM5->CR1, TIM_CR1_ARPE | TIM_CR1_CEN);
+    Shift595_Advance();
+}
+
+/**
+  * @brief           切换显示的帧
+  * @param        planes 新一帧的位平面
+  * @retval          0=已排队，1=上一次排队的帧尚未切换，本帧未排队
+  */
+uint8_t Shift595_Show(const uint8_t *planes)
+{
+    do {
+        if(ATOMIC_LDREX(&sh_pending) != 0) {
+            ATOMIC_CLREX();
+            return 1;
+        }
+    } while(ATOMIC_STREX((uintptr_t)planes, &sh_pending));
+    return 0;
+}
+
+/**
+  * @brief           查询位平面缓冲区是否仍被驱动使用
+  * @param        planes 位平面缓冲区
+  * @retval          1=显示中或等待切换，0=已释放，可以改写
+  * @note           先读待切换槽位再读显示中的帧：中断在两次读取之间换帧时，新帧在第二次读取中出现
+  */
+uint8_t Shift595_InUse(const uint8_t *planes)
+{
+    if((const uint8_t *)sh_pending == planes) return 1;
+    return (sh_planes == planes) ? 1U : 0U;
+}
+
+/**
+  * @brief           TIM5中断处理函数
+  * @param        None
+  * @retval          None
+  */
+void TIM5_IRQHandler(void)
+{
+    if(REG_READ(TIM5->SR) & TIM_SR_UIF) {
+        REG_WRITE(TIM5->SR, (uint16_t)~TIM_SR_UIF);
+        Shift595_Advance();
+    }
+}
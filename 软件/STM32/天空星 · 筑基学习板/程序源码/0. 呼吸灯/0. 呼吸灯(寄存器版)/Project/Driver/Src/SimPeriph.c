@@ -0,0 +1,1239 @@
+/**
+  ************************************************************************************
+  * @file              SimPeriph.c
+  * @author         None
+  * @version       V1.4.0
+  * @date            2026-10-17
+  * @brief           主机端外设模型源文件
+  *
+  * @details        本文件实现了挂接到RegSim上的外设模型：
+  *                        1. GPIO：一个模型覆盖端口A~K（每端口0x400字节），按偏移分发到各寄存器，
+  *                           BSRR高16位复位、低16位置位，同一位同时写入时置位优先
+  *                        2. 主机时钟：SystemCoreClock由测试程序直接赋值
+  *                        3. TIM：运行中的CNT由虚拟时间算出，溢出时刻用RegSim_Schedule()安排，
+  *                           重新配置后旧的事件因时间不匹配自动失效（同SysTick模型）
+  *                        4. DMA：请求到来时按方向和数据宽度经RegSim_BusRead32/RegSim_BusWrite32访问外设，
+  *                           存储器一侧直接访问主机内存；数据流使能时回调挂在该数据流上的外设，补发电平请求；
+  *                           直接模式下两侧都按PSIZE，字节/半字写外设时按APB的规则复制到整个字
+  *                        5. SPI：发送缓冲 + 移位寄存器两级，移出完成用RegSim_Schedule()安排
+  *                        6. USART：发送同SPI；接收由注入的字节逐帧到达，RXNE未清除时新帧计为溢出，
+  *                           最后一帧之后空闲一帧置IDLE（先读SR再读DR清除）
+  *
+  * @note            仅在定义REG_SIM时编译，不加入Keil工程
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 增加TIM2~TIM7和DMA1/DMA2模型
+  *                         - 2026-10-17 V1.2.0 增加SPI1~SPI3发送模型
+  *                         - 2026-10-17 V1.3.0 增加USART1收发模型
+  *                         - 2026-10-17 V1.4.0 DMA直接模式下忽略MSIZE，字节/半字写外设时复制到整个字
+  *
+  ************************************************************************************
+  */
+
+#ifdef REG_SIM
+
+#include "SimPeriph.h"
+#include "RegSim.h"
+#include "stm32f4xx.h"
+#include "Device.h"
+
+/**
+  * @brief   定时器的固定连接
+  */
+typedef struct
+{
+    uint32_t base;                                     /* 基地址，0=该型号没有此定时器 */
+    int32_t irq;                                         /* 中断号 */
+    uint8_t itr[4];                                     /* ITR0~ITR3连接的主定时器编号，0=不模拟 */
+    uint8_t dma_num;                                /* TIMx_UP在DMA1上的请求数 */
+    uint8_t dma_stream[2];                        /* 请求所在的数据流 */
+    uint8_t dma_channel[2];                      /* 请求所在的通道 */
+} SimPeriph_TimInfo;
+
+#define SIM_TIM_NUM                           (SIMPERIPH_TIM_LAST - SIMPERIPH_TIM_FIRST + 1U)
+#define SIM_TIM(n)                              (&sim_tim[(n) - SIMPERIPH_TIM_FIRST])
+
+/* RM0090：TIMx内部触发连接表、DMA1请求映射表 */
+static const SimPeriph_TimInfo sim_tim_info[SIM_TIM_NUM] = {
+#if DEVICE_HAS_TIM(2)
+    { TIM2_BASE, TIM2_IRQn, { 1, 8, 3, 4 }, 2, { 1, 7 }, { 3, 3 } },
+#else
+    { 0 },
+#endif
+#if DEVICE_HAS_TIM(3)
+    { TIM3_BASE, TIM3_IRQn, { 1, 2, 5, 4 }, 1, { 2, 0 }, { 5, 0 } },
+#else
+    { 0 },
+#endif
+#if DEVICE_HAS_TIM(4)
+    { TIM4_BASE, TIM4_IRQn, { 1, 2, 3, 8 }, 1, { 6, 0 }, { 2, 0 } },
+#else
+    { 0 },
+#endif
+#if DEVICE_HAS_TIM(5)
+    { TIM5_BASE, TIM5_IRQn, { 2, 3, 4, 8 }, 2, { 0, 6 }, { 6, 6 } },
+#else
+    { 0 },
+#endif
+#if DEVICE_HAS_TIM(6)
+    { TIM6_BASE, DEVICE_TIM6_IRQn, { 0, 0, 0, 0 }, 1, { 1, 0 }, { 7, 0 } },
+#else
+    { 0 },
+#endif
+#if DEVICE_HAS_TIM(7)
+    { TIM7_BASE, TIM7_IRQn, { 0, 0, 0, 0 }, 2, { 2, 4 }, { 1, 1 } },
+#else
+    { 0 },
+#endif
+};
+
+/* 数据流中断号：DMA1 Stream0~7，DMA2 Stream0~7 */
+static const int32_t sim_dma_irq[2][8] = {
+    { DMA1_Stream0_IRQn, DMA1_Stream1_IRQn, DMA1_Stream2_IRQn, DMA1_Stream3_IRQn,
+      DMA1_Stream4_IRQn, DMA1_Stream5_IRQn, DMA1_Stream6_IRQn, DMA1_Stream7_IRQn },
+    { DMA2_Stream0_IRQn, DMA2_Stream1_IRQn, DMA2_Stream2_IRQn, DMA2_Stream3_IRQn,
+      DMA2_Stream4_IRQn, DMA2_Stream5_IRQn, DMA2_Stream6_IRQn, DMA2_Stream7_IRQn }
+};
+
+/* 数据流标志在LISR/HISR中的位置 */
+static const uint8_t sim_dma_shift[4] = { 0, 6, 16, 22 };
+
+/**
+  * @brief   DMA控制器状态
+  */
+typedef struct
+{
+    uint32_t isr[2];                                    /* LISR、HISR */
+    SimPeriph_DmaStream stream[8];             /* 数据流 */
+    void (*kick[8])(void *ctx);                      /* 数据流使能时补发请求的外设，NULL=无 */
+    void *kick_ctx[8];                                /* kick的参数 */
+} SimPeriph_DmaCtrl;
+
+/**
+  * @brief   SPI的固定连接
+  */
+typedef struct
+{
+    uint32_t base;                                     /* 基地址 */
+    uint8_t apb2;                                      /* 1=APB2，0=APB1 */
+    uint8_t dma;                                       /* TX请求所在的DMA控制器 */
+    uint8_t dma_num;                                /* TX请求数 */
+    uint8_t dma_stream[2];                        /* 请求所在的数据流 */
+    uint8_t dma_channel[2];                      /* 请求所在的通道 */
+} SimPeriph_SpiInfo;
+
+/* RM0090：SPIx_TX的DMA请求映射 */
+static const SimPeriph_SpiInfo sim_spi_info[SIMPERIPH_SPI_NUM] = {
+    { SPI1_BASE, 1, 2, 2, { 3, 5 }, { 3, 3 } },
+    { SPI2_BASE, 0, 1, 1, { 4, 0 }, { 0, 0 } },
+    { SPI3_BASE, 0, 1, 2, { 5, 7 }, { 0, 0 } },
+};
+
+uint32_t SystemCoreClock = SIMPERIPH_CORE_CLOCK;
+
+static SimPeriph_GpioPort sim_gpio[SIMPERIPH_GPIO_PORTS];
+static SimPeriph_GpioHook sim_gpio_hook;
+static void *sim_gpio_ctx;
+
+static uint32_t Gpio_ModelRead(void *ctx, uint32_t offset);
+static void Gpio_ModelWrite(void *ctx, uint32_t offset, uint32_t value);
+
+static SimPeriph_Tim sim_tim[SIM_TIM_NUM];
+static SimPeriph_TimHook sim_tim_hook[SIM_TIM_NUM];
+static void *sim_tim_ctx[SIM_TIM_NUM];
+static uint32_t sim_tim_ratio;                          /* APB1定时器每计一次的CPU周期数 */
+static RegSim_Model sim_tim_model[SIM_TIM_NUM];
+static SimPeriph_DmaCtrl sim_dma[2];
+static SimPeriph_SpiPort sim_spi[SIMPERIPH_SPI_NUM];
+static SimPeriph_SpiHook sim_spi_hook[SIMPERIPH_SPI_NUM];
+static void *sim_spi_ctx[SIMPERIPH_SPI_NUM];
+static RegSim_Model sim_spi_model[SIMPERIPH_SPI_NUM];
+static SimPeriph_Usart sim_usart;
+static SimPeriph_UsartHook sim_usart_hook;
+static void *sim_usart_ctx;
+
+static const RegSim_Model sim_gpio_model = {
+    "GPIO", GPIOA_BASE, SIMPERIPH_GPIO_PORTS * 0x400U, Gpio_ModelRead, Gpio_ModelWrite, sim_gpio
+};
+
+static uint32_t Tim_ModelRead(void *ctx, uint32_t offset);
+static void Tim_ModelWrite(void *ctx, uint32_t offset, uint32_t value);
+static uint32_t Dma_ModelRead(void *ctx, uint32_t offset);
+static void Dma_ModelWrite(void *ctx, uint32_t offset, uint32_t value);
+
+static const RegSim_Model sim_dma_model[2] = {
+    { "DMA1", DMA1_BASE, 0xD0, Dma_ModelRead, Dma_ModelWrite, &sim_dma[0] },
+    { "DMA2", DMA2_BASE, 0xD0, Dma_ModelRead, Dma_ModelWrite, &sim_dma[1] }
+};
+
+static uint32_t Usart_ModelRead(void *ctx, uint32_t offset);
+static void Usart_ModelWrite(void *ctx, uint32_t offset, uint32_t value);
+
+static const RegSim_Model sim_usart_model = {
+    "USART1", USART1_BASE, 0x1C, Usart_ModelRead, Usart_ModelWrite, &sim_usart
+};
+
+/**
+  * @brief           主机端时钟更新
+  * @param        None
+  * @retval          None
+  * @note           不读RCC，SystemCoreClock保持测试程序设定的值
+  */
+void SystemCoreClockUpdate(void)
+{
+}
+
+/* ---------------------------------- GPIO模型 ---------------------------------- */
+
+/**
+  * @brief           GPIO模型读钩子
+  * @param        ctx 端口状态数组
+  * @param        offset 相对GPIOA的偏移
+  * @retval          寄存器值
+  */
+static uint32_t Gpio_ModelRead(void *ctx, uint32_t offset)
+{
+    SimPeriph_GpioPort *g = &((SimPeriph_GpioPort *)ctx)[offset >> 10];
+
+    switch(offset & 0x3FFU) {
+    case 0x00: return g->moder;
+    case 0x04: return g->otyper;
+    case 0x08: return g->ospeedr;
+    case 0x0C: return g->pupdr;
+    case 0x10: return g->idr;
+    case 0x14: return g->odr;
+    case 0x20: return g->afr[0];
+    case 0x24: return g->afr[1];
+    default:   return 0;                                                 /* BSRR只写，LCKR不模拟 */
+    }
+}
+
+/**
+  * @brief           GPIO模型写钩子
+  * @param        ctx 端口状态数组
+  * @param        offset 相对GPIOA的偏移
+  * @param        value 写入值
+  * @retval          None
+  */
+static void Gpio_ModelWrite(void *ctx, uint32_t offset, uint32_t value)
+{
+    uint32_t port = offset >> 10;
+    SimPeriph_GpioPort *g = &((SimPeriph_GpioPort *)ctx)[port];
+    uint8_t notify = 1;
+
+    switch(offset & 0x3FFU) {
+    case 0x00: g->moder = value; break;
+    case 0x04: g->otyper = value; notify = 0; break;
+    case 0x08: g->ospeedr = value; notify = 0; break;
+    case 0x0C: g->pupdr = value; notify = 0; break;
+    case 0x14: g->odr = value & 0xFFFFU; break;
+    case 0x18: g->odr = (g->odr & ~(value >> 16)) | (value & 0xFFFFU); break;
+    case 0x20: g->afr[0] = value; notify = 0; break;
+    case 0x24: g->afr[1] = value; notify = 0; break;
+    default:   notify = 0; break;
+    }
+    if(notify && sim_gpio_hook != 0) sim_gpio_hook(port, g, sim_gpio_ctx);
+}
+
+/**
+  * @brief           挂接GPIO模型
+  * @param        hook 观察回调
+  * @param        ctx 回调参数
+  * @retval          0=成功，1=RegSim模型表已满
+  */
+uint8_t SimPeriph_GpioAttach(SimPeriph_GpioHook hook, void *ctx)
+{
+    uint32_t i;
+
+    for(i = 0; i < SIMPERIPH_GPIO_PORTS; i++) {
+        sim_gpio[i].moder = 0;
+        sim_gpio[i].otyper = 0;
+        sim_gpio[i].ospeedr = 0;
+        sim_gpio[i].pupdr = 0;
+        sim_gpio[i].idr = 0;
+        sim_gpio[i].odr = 0;
+        sim_gpio[i].afr[0] = 0;
+        sim_gpio[i].afr[1] = 0;
+    }
+    sim_gpio_hook = hook;
+    sim_gpio_ctx = ctx;
+    return RegSim_Attach(&sim_gpio_model);
+}
+
+/**
+  * @brief           取端口状态
+  * @param        port 端口序号
+  * @retval          端口状态
+  */
+SimPeriph_GpioPort *SimPeriph_Gpio(uint32_t port)
+{
+    return &sim_gpio[port % SIMPERIPH_GPIO_PORTS];
+}
+
+/**
+  * @brief           引脚的驱动状态
+  * @param        gpio 端口状态
+  * @param        pin 引脚号
+  * @retval          SIMPERIPH_PIN_xxx
+  */
+uint8_t SimPeriph_GpioDrive(const SimPeriph_GpioPort *gpio, uint32_t pin)
+{
+    if(((gpio->moder >> (2U * pin)) & 3U) != 1U) return SIMPERIPH_PIN_FLOAT;
+    if(((gpio->odr >> pin) & 1U) == 0) return SIMPERIPH_PIN_LOW;
+    /* 开漏输出的高电平不驱动 */
+    return ((gpio->otyper >> pin) & 1U) ? SIMPERIPH_PIN_FLOAT : SIMPERIPH_PIN_HIGH;
+}
+
+/* ---------------------------------- TIM模型 ---------------------------------- */
+
+/**
+  * @brief           定时器编号
+  */
+static uint32_t Tim_Index(const SimPeriph_Tim *t)
+{
+    return (uint32_t)(t - sim_tim) + SIMPERIPH_TIM_FIRST;
+}
+
+/**
+  * @brief           计数一次的CPU周期数
+  */
+static uint64_t Tim_Tick(const SimPeriph_Tim *t)
+{
+    return (uint64_t)sim_tim_ratio * (t->psc_act + 1U);
+}
+
+/**
+  * @brief           是否由内部时钟计数并正在运行
+  */
+static uint8_t Tim_Running(const SimPeriph_Tim *t)
+{
+    return (t->cr1 & TIM_CR1_CEN) && (t->smcr & TIM_SMCR_SMS) != TIM_SMCR_SMS;
+}
+
+/**
+  * @brief           当前计数值
+  */
+static uint32_t Tim_Count(const SimPeriph_Tim *t)
+{
+    uint64_t n;
+
+    if(!Tim_Running(t)) return t->cnt;
+    n = (RegSim_Now() - t->origin) / Tim_Tick(t);
+    return (n > t->arr_act) ? t->arr_act : (uint32_t)n;
+}
+
+static void Tim_Event(void *ctx);
+
+/**
+  * @brief           按当前起点安排下一次溢出
+  */
+static void Tim_Schedule(SimPeriph_Tim *t)
+{
+    uint64_t due;
+
+    if(!Tim_Running(t)) {
+        t->due = 0;
+        return;
+    }
+    due = t->origin + Tim_Tick(t) * ((uint64_t)t->arr_act + 1U);
+    if(due == t->due) return;                                               /* 已安排 */
+    /* ARR改到当前计数之下：实际计数器要计到满量程回绕，模型简化为立即溢出 */
+    if(due < RegSim_Now()) due = RegSim_Now();
+    t->due = due;
+    RegSim_Schedule(due - RegSim_Now(), Tim_Event, t);
+}
+
+static void Tim_Clock(uint32_t master);
+
+/**
+  * @brief           更新事件
+  * @param        t 定时器状态
+  * @param        overflow 1=计数溢出，0=软件UG
+  * @retval          None
+  */
+static void Tim_Update(SimPeriph_Tim *t, uint8_t overflow)
+{
+    const SimPeriph_TimInfo *info = &sim_tim_info[t - sim_tim];
+    uint32_t i;
+
+    if(t->cr1 & TIM_CR1_UDIS) return;
+
+    /* 预装载值装入影子寄存器 */
+    t->psc_act = t->psc;
+    t->arr_act = t->arr;
+    for(i = 0; i < 4U; i++) t->ccr_act[i] = t->ccr[i];
+    t->updates++;
+
+    if(overflow || !(t->cr1 & TIM_CR1_URS)) {
+        t->sr |= TIM_SR_UIF;
+        if(t->dier & TIM_DIER_UIE) RegSim_SetPending(info->irq);
+        if(t->dier & TIM_DIER_UDE) {
+            for(i = 0; i < info->dma_num; i++) {
+                if(SimPeriph_DmaRequest(1, info->dma_stream[i], info->dma_channel[i])) break;
+            }
+        }
+    }
+    if(sim_tim_hook[t - sim_tim] != 0) sim_tim_hook[t - sim_tim](Tim_Index(t), t, sim_tim_ctx[t - sim_tim]);
+
+    /* MMS = 010：更新事件作为TRGO */
+    if((t->cr2 & TIM_CR2_MMS) == TIM_CR2_MMS_1) Tim_Clock(Tim_Index(t));
+}
+
+/**
+  * @brief           主定时器的TRGO驱动外部时钟模式1的从定时器
+  * @param        master 主定时器编号
+  * @retval          None
+  */
+static void Tim_Clock(uint32_t master)
+{
+    SimPeriph_Tim *t;
+    uint32_t i;
+
+    for(i = 0; i < SIM_TIM_NUM; i++) {
+        t = &sim_tim[i];
+        if(sim_tim_model[i].base == 0 || !(t->cr1 & TIM_CR1_CEN)) continue;
+        if((t->smcr & TIM_SMCR_SMS) != TIM_SMCR_SMS) continue;
+        if((t->smcr & TIM_SMCR_TS) >= TIM_SMCR_TS_2) continue;                   /* 只模拟ITR0~ITR3 */
+        if(sim_tim_info[i].itr[(t->smcr & TIM_SMCR_TS) >> 4] != master) continue;
+        if(++t->cnt > t->arr_act) {
+            t->cnt = 0;
+            Tim_Update(t, 1);
+        }
+    }
+}
+
+/**
+  * @brief           溢出事件
+  * @param        ctx 定时器状态
+  * @retval          None
+  */
+static void Tim_Event(void *ctx)
+{
+    SimPeriph_Tim *t = (SimPeriph_Tim *)ctx;
+
+    if(t->due == 0 || RegSim_Now() != t->due || !Tim_Running(t)) return;
+    t->origin = t->due;
+    Tim_Update(t, 1);
+    Tim_Schedule(t);
+}
+
+/**
+  * @brief           定时器模型读钩子
+  * @param        ctx 定时器状态
+  * @param        offset 寄存器偏移
+  * @retval          寄存器值
+  */
+static uint32_t Tim_ModelRead(void *ctx, uint32_t offset)
+{
+    SimPeriph_Tim *t = (SimPeriph_Tim *)ctx;
+
+    switch(offset) {
+    case 0x00: return t->cr1;
+    case 0x04: return t->cr2;
+    case 0x08: return t->smcr;
+    case 0x0C: return t->dier;
+    case 0x10: return t->sr;
+    case 0x18: return t->ccmr[0];
+    case 0x1C: return t->ccmr[1];
+    case 0x20: return t->ccer;
+    case 0x24: return Tim_Count(t);
+    case 0x28: return t->psc;
+    case 0x2C: return t->arr;
+    case 0x34: case 0x38: case 0x3C: case 0x40:
+        return t->ccr[(offset - 0x34U) >> 2];
+    default:   return 0;
+    }
+}
+
+/**
+  * @brief           定时器模型写钩子
+  * @param        ctx 定时器状态
+  * @param        offset 寄存器偏移
+  * @param        value 写入值
+  * @retval          None
+  */
+static void Tim_ModelWrite(void *ctx, uint32_t offset, uint32_t value)
+{
+    SimPeriph_Tim *t = (SimPeriph_Tim *)ctx;
+    uint8_t was_running = Tim_Running(t);
+    uint32_t ch;
+
+    switch(offset) {
+    case 0x00:                                                                      /* CR1 */
+        if(was_running) t->cnt = Tim_Count(t);
+        t->cr1 = value & 0x3FFU;
+        if(!(t->cr1 & TIM_CR1_ARPE)) t->arr_act = t->arr;
+        break;
+    case 0x04: t->cr2 = value; return;
+    case 0x08:                                                                      /* SMCR */
+        if(was_running) t->cnt = Tim_Count(t);
+        t->smcr = value;
+        break;
+    case 0x0C: t->dier = value; return;
+    case 0x10: t->sr &= value; return;                                    /* rc_w0 */
+    case 0x14:                                                                      /* EGR */
+        if(value & TIM_EGR_UG) {
+            t->cnt = 0;
+            Tim_Update(t, 0);
+            t->origin = RegSim_Now();
+            Tim_Schedule(t);
+        }
+        return;
+    case 0x18: t->ccmr[0] = value; return;
+    case 0x1C: t->ccmr[1] = value; return;
+    case 0x20: t->ccer = value; return;
+    case 0x24:                                                                      /* CNT */
+        t->cnt = value;
+        break;
+    case 0x28: t->psc = value & 0xFFFFU; return;                    /* 更新事件时装入 */
+    case 0x2C:                                                                      /* ARR */
+        if(was_running) t->cnt = Tim_Count(t);
+        t->arr = value;
+        if(!(t->cr1 & TIM_CR1_ARPE)) t->arr_act = value;
+        break;
+    case 0x34: case 0x38: case 0x3C: case 0x40:                   /* CCRx */
+        ch = (offset - 0x34U) >> 2;
+        t->ccr[ch] = value;
+        if(!(t->ccmr[ch >> 1] & ((ch & 1U) ? TIM_CCMR1_OC2PE : TIM_CCMR1_OC1PE))) t->ccr_act[ch] = value;
+        return;
+    default:
+        return;
+    }
+
+    /* 开始计数或改写CNT时由计数值确定起点，其余情况保持起点（不丢失计数周期内的余数） */
+    if(Tim_Running(t) && (!was_running || offset == 0x24U)) {
+        t->origin = RegSim_Now() - (uint64_t)t->cnt * Tim_Tick(t);
+    }
+    Tim_Schedule(t);
+}
+
+/**
+  * @brief           挂接一个定时器模型
+  * @param        n 定时器编号
+  * @param        hook 观察回调
+  * @param        ctx 回调参数
+  * @retval          0=成功，1=编号非法或模型表已满
+  */
+uint8_t SimPeriph_TimAttach(uint32_t n, SimPeriph_TimHook hook, void *ctx)
+{
+    static const char *const name[SIM_TIM_NUM] = { "TIM2", "TIM3", "TIM4", "TIM5", "TIM6", "TIM7" };
+    uint32_t i = n - SIMPERIPH_TIM_FIRST;
+    uint32_t ppre;
+    SimPeriph_Tim *t;
+
+    if(n < SIMPERIPH_TIM_FIRST || n > SIMPERIPH_TIM_LAST || sim_tim_info[i].base == 0) return 1;
+
+    t = SIM_TIM(n);
+    t->cr1 = t->cr2 = t->smcr = t->dier = t->sr = 0;
+    t->ccmr[0] = t->ccmr[1] = t->ccer = 0;
+    t->cnt = t->psc = t->psc_act = 0;
+    t->arr = t->arr_act = 0xFFFFFFFFU;
+    for(i = 0; i < 4U; i++) t->ccr[i] = t->ccr_act[i] = 0;
+    t->origin = 0;
+    t->due = 0;
+    t->updates = 0;
+    i = n - SIMPERIPH_TIM_FIRST;
+    sim_tim_hook[i] = hook;
+    sim_tim_ctx[i] = ctx;
+
+    /* APB1分频为1时定时器时钟 = HCLK，否则为PCLK1 × 2 */
+    ppre = (RegSim_BusRead32((uint32_t)(uintptr_t)&RCC->CFGR) & RCC_CFGR_PPRE1) >> 10;
+    sim_tim_ratio = (ppre < 4U) ? 1U : (1U << (ppre - 3U)) / 2U;
+
+    sim_tim_model[i].name = name[i];
+    sim_tim_model[i].base = sim_tim_info[i].base;
+    sim_tim_model[i].size = 0x50;
+    sim_tim_model[i].read = Tim_ModelRead;
+    sim_tim_model[i].write = Tim_ModelWrite;
+    sim_tim_model[i].ctx = t;
+    return RegSim_Attach(&sim_tim_model[i]);
+}
+
+/**
+  * @brief           取定时器状态
+  * @param        n 定时器编号
+  * @retval          状态，编号非法返回NULL
+  */
+SimPeriph_Tim *SimPeriph_Timer(uint32_t n)
+{
+    if(n < SIMPERIPH_TIM_FIRST || n > SIMPERIPH_TIM_LAST) return 0;
+    return SIM_TIM(n);
+}
+
+/* ---------------------------------- DMA模型 ---------------------------------- */
+
+/**
+  * @brief           置数据流标志并按需挂起中断
+  * @param        dma 控制器下标（0、1）
+  * @param        n 数据流
+  * @param        flag 标志（TCIF/HTIF，按Stream0的位置）
+  * @param        ie 对应的中断使能位
+  * @retval          None
+  */
+static void Dma_Flag(uint32_t dma, uint32_t n, uint32_t flag, uint32_t ie)
+{
+    SimPeriph_DmaCtrl *d = &sim_dma[dma];
+
+    d->isr[n >> 2] |= flag << sim_dma_shift[n & 3U];
+    if(d->stream[n].cr & ie) RegSim_SetPending(sim_dma_irq[dma][n]);
+}
+
+/**
+  * @brief           按宽度读写主机内存
+  */
+static uint32_t Dma_MemRead(uint32_t addr, uint32_t size)
+{
+    if(size == 1U) return *(volatile uint8_t *)(uintptr_t)addr;
+    if(size == 2U) return *(volatile uint16_t *)(uintptr_t)addr;
+    return *(volatile uint32_t *)(uintptr_t)addr;
+}
+
+static void Dma_MemWrite(uint32_t addr, uint32_t size, uint32_t value)
+{
+    if(size == 1U) {
+        *(volatile uint8_t *)(uintptr_t)addr = (uint8_t)value;
+    } else if(size == 2U) {
+        *(volatile uint16_t *)(uintptr_t)addr = (uint16_t)value;
+    } else {
+        *(volatile uint32_t *)(uintptr_t)addr = value;
+    }
+}
+
+/**
+  * @brief           外设向DMA发出一次请求
+  * @param        dma 控制器（1或2）
+  * @param        stream 数据流
+  * @param        channel 请求所在的通道
+  * @retval          1=搬运了一项，0=未搬运
+  */
+uint8_t SimPeriph_DmaRequest(uint32_t dma, uint32_t stream, uint32_t channel)
+{
+    SimPeriph_DmaStream *st;
+    uint32_t psize;
+    uint32_t msize;
+    uint32_t value;
+
+    if(dma < 1U || dma > 2U || stream > 7U) return 0;
+    st = &sim_dma[dma - 1U].stream[stream];
+    if(!(st->cr & DMA_SxCR_EN) || ((st->cr & DMA_SxCR_CHSEL) >> 25) != channel || st->ndtr == 0) return 0;
+
+    /* 直接模式下MSIZE不起作用，存储器一侧也按PSIZE；FIFO模式下两侧宽度不同时的打包/拆包不模拟 */
+    psize = 1U << ((st->cr & DMA_SxCR_PSIZE) >> 11);
+    msize = (st->fcr & DMA_SxFCR_DMDIS) ? 1U << ((st->cr & DMA_SxCR_MSIZE) >> 13) : psize;
+    if((st->cr & DMA_SxCR_DIR) == DMA_SxCR_DIR_0) {                     /* 存储器→外设 */
+        value = Dma_MemRead(st->mptr, msize);
+        /* APB外设只有32位数据通路：字节写入复制到4个字节，半字写入复制到2个半字 */
+        if(psize == 1U) {
+            value = (value & 0xFFU) * 0x01010101U;
+        } else if(psize == 2U) {
+            value = (value & 0xFFFFU) * 0x00010001U;
+        }
+        RegSim_BusWrite32(st->pptr, value);
+    } else {                                                                            /* 外设→存储器 */
+        value = RegSim_BusRead32(st->pptr);
+        Dma_MemWrite(st->mptr, msize, value);
+    }
+    if(st->cr & DMA_SxCR_MINC) st->mptr += msize;
+    if(st->cr & DMA_SxCR_PINC) st->pptr += psize;
+    st->items++;
+
+    st->ndtr--;
+    if(st->ndtr == st->reload / 2U) Dma_Flag(dma - 1U, stream, DMA_LISR_HTIF0, DMA_SxCR_HTIE);
+    if(st->ndtr == 0) {
+        if(st->cr & DMA_SxCR_CIRC) {
+            st->ndtr = st->reload;
+            st->mptr = st->m0ar;
+            st->pptr = st->par;
+        } else {
+            st->cr &= ~DMA_SxCR_EN;
+        }
+        Dma_Flag(dma - 1U, stream, DMA_LISR_TCIF0, DMA_SxCR_TCIE);
+    }
+    return 1;
+}
+
+/**
+  * @brief           DMA模型读钩子
+  * @param        ctx 控制器状态
+  * @param        offset 寄存器偏移
+  * @retval          寄存器值
+  */
+static uint32_t Dma_ModelRead(void *ctx, uint32_t offset)
+{
+    SimPeriph_DmaCtrl *d = (SimPeriph_DmaCtrl *)ctx;
+    SimPeriph_DmaStream *st;
+
+    if(offset < 0x08U) return d->isr[offset >> 2];
+    if(offset < 0x10U) return 0;                                             /* LIFCR/HIFCR只写 */
+    st = &d->stream[(offset - 0x10U) / 0x18U];
+    switch((offset - 0x10U) % 0x18U) {
+    case 0x00: return st->cr;
+    case 0x04: return st->ndtr;
+    case 0x08: return st->par;
+    case 0x0C: return st->m0ar;
+    case 0x10: return st->m1ar;
+    default:   return st->fcr;
+    }
+}
+
+/**
+  * @brief           DMA模型写钩子
+  * @param        ctx 控制器状态
+  * @param        offset 寄存器偏移
+  * @param        value 写入值
+  * @retval          None
+  */
+static void Dma_ModelWrite(void *ctx, uint32_t offset, uint32_t value)
+{
+    SimPeriph_DmaCtrl *d = (SimPeriph_DmaCtrl *)ctx;
+    uint32_t n;
+    SimPeriph_DmaStream *st;
+
+    if(offset < 0x08U) return;                                               /* LISR/HISR只读 */
+    if(offset < 0x10U) {
+        d->isr[(offset - 0x08U) >> 2] &= ~value;                       /* 写1清除 */
+        return;
+    }
+    n = (offset - 0x10U) / 0x18U;
+    st = &d->stream[n];
+    switch((offset - 0x10U) % 0x18U) {
+    case 0x00:                                                                      /* CR */
+        if(!(st->cr & DMA_SxCR_EN) && (value & DMA_SxCR_EN)) {
+            st->reload = st->ndtr;
+            st->mptr = st->m0ar;
+            st->pptr = st->par;
+            st->cr = value;
+            if(d->kick[n] != 0) d->kick[n](d->kick_ctx[n]);
+            return;
+        } else if((st->cr & DMA_SxCR_EN) && !(value & DMA_SxCR_EN)) {
+            /* 软件关闭数据流：当前项结束后置TCIF */
+            st->cr = value;
+            Dma_Flag((uint32_t)(d - sim_dma), n, DMA_LISR_TCIF0, DMA_SxCR_TCIE);
+            return;
+        }
+        st->cr = value;
+        break;
+    case 0x04: if(!(st->cr & DMA_SxCR_EN)) st->ndtr = value & 0xFFFFU; break;
+    case 0x08: if(!(st->cr & DMA_SxCR_EN)) st->par = value; break;
+    case 0x0C: st->m0ar = value; break;
+    case 0x10: st->m1ar = value; break;
+    default:   st->fcr = value; break;
+    }
+}
+
+/**
+  * @brief           挂接DMA1和DMA2模型
+  * @param        None
+  * @retval          0=成功，1=模型表已满
+  */
+uint8_t SimPeriph_DmaAttach(void)
+{
+    uint32_t i;
+    uint32_t n;
+    SimPeriph_DmaStream *st;
+
+    for(i = 0; i < 2U; i++) {
+        sim_dma[i].isr[0] = 0;
+        sim_dma[i].isr[1] = 0;
+        for(n = 0; n < 8U; n++) {
+            st = &sim_dma[i].stream[n];
+            st->cr = st->ndtr = st->par = st->m0ar = st->m1ar = 0;
+            st->fcr = 0x21U;                                                       /* 复位值 */
+            st->reload = st->mptr = st->pptr = st->items = 0;
+            sim_dma[i].kick[n] = 0;
+            sim_dma[i].kick_ctx[n] = 0;
+        }
+    }
+    if(RegSim_Attach(&sim_dma_model[0]) != 0) return 1;
+    return RegSim_Attach(&sim_dma_model[1]);
+}
+
+/**
+  * @brief           取DMA数据流状态
+  * @param        dma 控制器（1或2）
+  * @param        stream 数据流
+  * @retval          状态
+  */
+SimPeriph_DmaStream *SimPeriph_Dma(uint32_t dma, uint32_t stream)
+{
+    return &sim_dma[(dma - 1U) & 1U].stream[stream & 7U];
+}
+
+/* ---------------------------------- SPI模型 ---------------------------------- */
+
+/**
+  * @brief           SPI编号
+  */
+static uint32_t Spi_Index(const SimPeriph_SpiPort *sp)
+{
+    return (uint32_t)(sp - sim_spi) + 1U;
+}
+
+/**
+  * @brief           移出一帧的CPU周期数
+  */
+static uint64_t Spi_FrameCycles(const SimPeriph_SpiPort *sp)
+{
+    uint32_t bits = (sp->cr1 & SPI_CR1_DFF) ? 16U : 8U;
+
+    return (uint64_t)bits * sp->ratio * (2U << ((sp->cr1 & SPI_CR1_BR) >> 3));
+}
+
+/**
+  * @brief           TXE为1且TXDMAEN置位时向DMA请求，直到发送缓冲再次为满或DMA不再响应
+  * @param        ctx SPI状态
+  * @retval          None
+  */
+static void Spi_Request(void *ctx)
+{
+    SimPeriph_SpiPort *sp = (SimPeriph_SpiPort *)ctx;
+    const SimPeriph_SpiInfo *info = &sim_spi_info[sp - sim_spi];
+    uint8_t moved;
+    uint32_t i;
+
+    if(sp->requesting) return;
+    sp->requesting = 1;
+    do {
+        moved = 0;
+        if(!(sp->sr & SPI_SR_TXE) || !(sp->cr2 & SPI_CR2_TXDMAEN)) break;
+        for(i = 0; i < info->dma_num && !moved; i++) {
+            moved = SimPeriph_DmaRequest(info->dma, info->dma_stream[i], info->dma_channel[i]);
+        }
+    } while(moved);
+    sp->requesting = 0;
+}
+
+static void Spi_Event(void *ctx);
+
+/**
+  * @brief           把数据装入移位寄存器并安排移出
+  */
+static void Spi_Start(SimPeriph_SpiPort *sp, uint16_t data)
+{
+    sp->shift = data;
+    sp->sr |= SPI_SR_BSY;
+    sp->due = RegSim_Now() + Spi_FrameCycles(sp);
+    RegSim_Schedule(Spi_FrameCycles(sp), Spi_Event, sp);
+}
+
+/**
+  * @brief           一帧移出完成
+  * @param        ctx SPI状态
+  * @retval          None
+  */
+static void Spi_Event(void *ctx)
+{
+    SimPeriph_SpiPort *sp = (SimPeriph_SpiPort *)ctx;
+    uint32_t i = (uint32_t)(sp - sim_spi);
+
+    if(sp->due == 0 || RegSim_Now() != sp->due) return;
+    sp->due = 0;
+    sp->frames++;
+    if(sim_spi_hook[i] != 0) sim_spi_hook[i](Spi_Index(sp), sp->shift, sim_spi_ctx[i]);
+
+    if(!(sp->sr & SPI_SR_TXE)) {
+        /* 发送缓冲中的数据紧接着移出 */
+        sp->sr |= SPI_SR_TXE;
+        Spi_Start(sp, sp->txbuf);
+        Spi_Request(sp);
+    } else {
+        sp->sr &= ~SPI_SR_BSY;
+    }
+}
+
+/**
+  * @brief           SPI模型读钩子
+  * @param        ctx SPI状态
+  * @param        offset 寄存器偏移
+  * @retval          寄存器值
+  */
+static uint32_t Spi_ModelRead(void *ctx, uint32_t offset)
+{
+    SimPeriph_SpiPort *sp = (SimPeriph_SpiPort *)ctx;
+
+    switch(offset) {
+    case 0x00: return sp->cr1;
+    case 0x04: return sp->cr2;
+    case 0x08: return sp->sr;
+    default:   return 0;                                                    /* DR：不模拟接收 */
+    }
+}
+
+/**
+  * @brief           SPI模型写钩子
+  * @param        ctx SPI状态
+  * @param        offset 寄存器偏移
+  * @param        value 写入值
+  * @retval          None
+  */
+static void Spi_ModelWrite(void *ctx, uint32_t offset, uint32_t value)
+{
+    SimPeriph_SpiPort *sp = (SimPeriph_SpiPort *)ctx;
+
+    switch(offset) {
+    case 0x00:                                                                      /* CR1 */
+        sp->cr1 = value & 0xFFFFU;
+        break;
+    case 0x04:                                                                      /* CR2 */
+        sp->cr2 = value & 0xFFU;
+        break;
+    case 0x0C:                                                                      /* DR */
+        if(!(sp->cr1 & SPI_CR1_SPE) || !(sp->sr & SPI_SR_TXE)) return;   /* 未使能或缓冲已满：丢弃 */
+        if(sp->sr & SPI_SR_BSY) {
+            sp->txbuf = (uint16_t)value;
+            sp->sr &= ~SPI_SR_TXE;
+            return;
+        }
+        Spi_Start(sp, (uint16_t)value);
+        break;
+    default:
+        return;
+    }
+    Spi_Request(sp);
+}
+
+/**
+  * @brief           挂接一个SPI模型
+  * @param        n SPI编号
+  * @param        hook 观察回调
+  * @param        ctx 回调参数
+  * @retval          0=成功，1=编号非法或模型表已满
+  */
+uint8_t SimPeriph_SpiAttach(uint32_t n, SimPeriph_SpiHook hook, void *ctx)
+{
+    static const char *const name[SIMPERIPH_SPI_NUM] = { "SPI1", "SPI2", "SPI3" };
+    const SimPeriph_SpiInfo *info;
+    SimPeriph_SpiPort *sp;
+    uint32_t ppre;
+    uint32_t i;
+
+    if(n < 1U || n > SIMPERIPH_SPI_NUM) return 1;
+    i = n - 1U;
+    info = &sim_spi_info[i];
+    sp = &sim_spi[i];
+    sp->cr1 = sp->cr2 = 0;
+    sp->sr = SPI_SR_TXE;
+    sp->shift = sp->txbuf = 0;
+    sp->due = 0;
+    sp->frames = 0;
+    sp->requesting = 0;
+    sim_spi_hook[i] = hook;
+    sim_spi_ctx[i] = ctx;
+
+    /* PCLK的分频：0xx=1，100=2，101=4，110=8，111=16 */
+    ppre = RegSim_BusRead32((uint32_t)(uintptr_t)&RCC->CFGR);
+    ppre = info->apb2 ? (ppre & RCC_CFGR_PPRE2) >> 13 : (ppre & RCC_CFGR_PPRE1) >> 10;
+    sp->ratio = (ppre < 4U) ? 1U : (1U << (ppre - 3U));
+
+    /* DMA数据流使能时补发TXE请求 */
+    for(n = 0; n < info->dma_num; n++) {
+        sim_dma[info->dma - 1U].kick[info->dma_stream[n]] = Spi_Request;
+        sim_dma[info->dma - 1U].kick_ctx[info->dma_stream[n]] = sp;
+    }
+
+    sim_spi_model[i].name = name[i];
+    sim_spi_model[i].base = info->base;
+    sim_spi_model[i].size = 0x24;
+    sim_spi_model[i].read = Spi_ModelRead;
+    sim_spi_model[i].write = Spi_ModelWrite;
+    sim_spi_model[i].ctx = sp;
+    return RegSim_Attach(&sim_spi_model[i]);
+}
+
+/**
+  * @brief           取SPI状态
+  * @param        n SPI编号
+  * @retval          状态，编号非法返回NULL
+  */
+SimPeriph_SpiPort *SimPeriph_Spi(uint32_t n)
+{
+    if(n < 1U || n > SIMPERIPH_SPI_NUM) return 0;
+    return &sim_spi[n - 1U];
+}
+
+/* ---------------------------------- USART模型 ---------------------------------- */
+
+#define SIM_USART_DMA                       2U               /* USART1的DMA请求：DMA2通道4 */
+#define SIM_USART_CHANNEL                 4U
+#define SIM_USART_RX_STREAM0            2U               /* USART1_RX：Stream2或Stream5 */
+#define SIM_USART_RX_STREAM1            5U
+#define SIM_USART_TX_STREAM              7U               /* USART1_TX：Stream7 */
+
+/**
+  * @brief           一帧（起始位 + 数据位 + 停止位）的CPU周期数
+  */
+static uint64_t Usart_FrameCycles(const SimPeriph_Usart *u)
+{
+    uint32_t bits = (u->cr1 & USART_CR1_M) ? 11U : 10U;
+
+    return (uint64_t)bits * (u->brr ? u->brr : 1U) * u->ratio;
+}
+
+/**
+  * @brief           按中断使能挂起USART1中断
+  */
+static void Usart_Irq(const SimPeriph_Usart *u)
+{
+    if(((u->sr & USART_SR_TXE) && (u->cr1 & USART_CR1_TXEIE)) ||
+       ((u->sr & USART_SR_TC) && (u->cr1 & USART_CR1_TCIE)) ||
+       ((u->sr & (USART_SR_RXNE | USART_SR_ORE)) && (u->cr1 & USART_CR1_RXNEIE)) ||
+       ((u->sr & USART_SR_IDLE) && (u->cr1 & USART_CR1_IDLEIE))) {
+        RegSim_SetPending(USART1_IRQn);
+    }
+}
+
+/**
+  * @brief           TXE/RXNE为1且对应的DMA使能置位时向DMA请求，直到标志清除或DMA不再响应
+  * @param        ctx USART状态
+  * @retval          None
+  */
+static void Usart_Request(void *ctx)
+{
+    SimPeriph_Usart *u = (SimPeriph_Usart *)ctx;
+    uint8_t moved;
+
+    if(u->requesting) return;
+    u->requesting = 1;
+    if((u->sr & USART_SR_RXNE) && (u->cr3 & USART_CR3_DMAR)) {
+        /* DMA读DR清除RXNE */
+        if(!SimPeriph_DmaRequest(SIM_USART_DMA, SIM_USART_RX_STREAM0, SIM_USART_CHANNEL)) {
+            (void)SimPeriph_DmaRequest(SIM_USART_DMA, SIM_USART_RX_STREAM1, SIM_USART_CHANNEL);
+        }
+    }
+    do {
+        moved = 0;
+        if(!(u->sr & USART_SR_TXE) || !(u->cr3 & USART_CR3_DMAT)) break;
+        moved = SimPeriph_DmaRequest(SIM_USART_DMA, SIM_USART_TX_STREAM, SIM_USART_CHANNEL);
+    } while(moved);
+    u->requesting = 0;
+}
+
+static void Usart_TxEvent(void *ctx);
+
+/**
+  * @brief           把数据装入发送移位寄存器并安排发送
+  */
+static void Usart_TxStart(SimPeriph_Usart *u, uint16_t data)
+{
+    u->shift = data;
+    u->sr &= ~USART_SR_TC;
+    u->tx_due = RegSim_Now() + Usart_FrameCycles(u);
+    RegSim_Schedule(Usart_FrameCycles(u), Usart_TxEvent, u);
+}
+
+/**
+  * @brief           一帧发送完成
+  * @param        ctx USART状态
+  * @retval          None
+  */
+static void Usart_TxEvent(void *ctx)
+{
+    SimPeriph_Usart *u = (SimPeriph_Usart *)ctx;
+
+    if(u->tx_due == 0 || RegSim_Now() != u->tx_due) return;
+    u->tx_due = 0;
+    u->tx_frames++;
+    if(sim_usart_hook != 0) sim_usart_hook(u->shift, RegSim_Now() - Usart_FrameCycles(u), sim_usart_ctx);
+
+    if(!(u->sr & USART_SR_TXE)) {
+        /* 发送缓冲中的数据紧接着发出 */
+        u->sr |= USART_SR_TXE;
+        Usart_TxStart(u, u->txbuf);
+        Usart_Request(u);
+    } else {
+        u->sr |= USART_SR_TC;
+    }
+    Usart_Irq(u);
+}
+
+/**
+  * @brief           线路空闲一帧
+  * @param        ctx USART状态
+  * @retval          None
+  */
+static void Usart_IdleEvent(void *ctx)
+{
+    SimPeriph_Usart *u = (SimPeriph_Usart *)ctx;
+
+    if(u->idle_due == 0 || RegSim_Now() != u->idle_due) return;
+    u->idle_due = 0;
+    if(!u->idle_armed) return;                                              /* IDLE之后没有收到数据：不再置位 */
+    u->idle_armed = 0;
+    u->sr |= USART_SR_IDLE;
+    u->idles++;
+    Usart_Irq(u);
+}
+
+/**
+  * @brief           一帧到达（停止位结束）
+  * @param        ctx USART状态
+  * @retval          None
+  */
+static void Usart_RxEvent(void *ctx)
+{
+    SimPeriph_Usart *u = (SimPeriph_Usart *)ctx;
+    uint64_t frame = Usart_FrameCycles(u);
+
+    if(u->rx_due == 0 || RegSim_Now() != u->rx_due) return;
+    if((u->cr1 & USART_CR1_UE) && (u->cr1 & USART_CR1_RE)) {
+        if(u->sr & USART_SR_RXNE) {
+            u->sr |= USART_SR_ORE;                                          /* 移位寄存器中的新帧丢失 */
+            u->overruns++;
+        } else {
+            u->rdr = u->rx_data[u->rx_pos];
+            u->sr |= USART_SR_RXNE;
+        }
+        u->idle_armed = 1;
+        u->rx_frames++;
+    }
+    u->rx_pos++;
+    u->rx_end = RegSim_Now();
+    if(u->rx_pos < u->rx_len) {
+        u->rx_due = RegSim_Now() + frame;
+        RegSim_Schedule(frame, Usart_RxEvent, u);
+    } else {
+        u->rx_due = 0;
+        u->idle_due = RegSim_Now() + frame;
+        RegSim_Schedule(frame, Usart_IdleEvent, u);
+    }
+    Usart_Request(u);
+    Usart_Irq(u);
+}
+
+/**
+  * @brief           USART模型读钩子
+  * @param        ctx USART状态
+  * @param        offset 寄存器偏移
+  * @retval          寄存器值
+  */
+static uint32_t Usart_ModelRead(void *ctx, uint32_t offset)
+{
+    SimPeriph_Usart *u = (SimPeriph_Usart *)ctx;
+    uint32_t v;
+
+    switch(offset) {
+    case 0x00:
+        u->sr_read = 1;
+        return u->sr;
+    case 0x04:                                                                      /* DR：清除RXNE，读SR之后再读清除IDLE/ORE */
+        v = u->rdr;
+        u->sr &= ~USART_SR_RXNE;
+        if(u->sr_read) u->sr &= ~(USART_SR_IDLE | USART_SR_ORE);
+        u->sr_read = 0;
+        return v;
+    case 0x08: v = u->brr; break;
+    case 0x0C: v = u->cr1; break;
+    case 0x10: v = u->cr2; break;
+    case 0x14: v = u->cr3; break;
+    default:   v = 0; break;
+    }
+    u->sr_read = 0;
+    return v;
+}
+
+/**
+  * @brief           USART模型写钩子
+  * @param        ctx USART状态
+  * @param        offset 寄存器偏移
+  * @param        value 写入值
+  * @retval          None
+  */
+static void Usart_ModelWrite(void *ctx, uint32_t offset, uint32_t value)
+{
+    SimPeriph_Usart *u = (SimPeriph_Usart *)ctx;
+
+    u->sr_read = 0;
+    switch(offset) {
+    case 0x00:                                                                      /* SR：RXNE、TC写0清除 */
+        u->sr &= value | ~(USART_SR_RXNE | USART_SR_TC);
+        return;
+    case 0x04:                                                                      /* DR */
+        if(!(u->cr1 & USART_CR1_UE) || !(u->cr1 & USART_CR1_TE) || !(u->sr & USART_SR_TXE)) return;
+        if(u->tx_due != 0) {
+            u->txbuf = (uint16_t)(value & 0x1FFU);
+            u->sr &= ~USART_SR_TXE;
+            return;
+        }
+        Usart_TxStart(u, (uint16_t)(value & 0x1FFU));
+        break;
+    case 0x08: u->brr = value & 0xFFFFU; return;
+    case 0x0C: u->cr1 = value & 0xFFFFU; break;
+    case 0x10: u->cr2 = value & 0x7FFFU; return;
+    case 0x14: u->cr3 = value & 0xFFFU; break;
+    default:   return;
+    }
+    Usart_Request(u);
+    Usart_Irq(u);
+}
+
+/**
+  * @brief           挂接USART1模型
+  * @param        hook 观察回调
+  * @param        ctx 回调参数
+  * @retval          0=成功，1=RegSim模型表已满
+  */
+uint8_t SimPeriph_UsartAttach(SimPeriph_UsartHook hook, void *ctx)
+{
+    SimPeriph_Usart *u = &sim_usart;
+    uint32_t ppre;
+
+    u->sr = USART_SR_TXE | USART_SR_TC;                                 /* 复位值 */
+    u->rdr = u->brr = u->cr1 = u->cr2 = u->cr3 = 0;
+    u->sr_read = u->requesting = 0;
+    u->shift = u->txbuf = 0;
+    u->tx_due = 0;
+    u->rx_data = 0;
+    u->rx_len = u->rx_pos = 0;
+    u->rx_due = u->rx_end = u->idle_due = 0;
+    u->idle_armed = 0;
+    u->tx_frames = u->rx_frames = u->overruns = u->idles = 0;
+    sim_usart_hook = hook;
+    sim_usart_ctx = ctx;
+
+    ppre = (RegSim_BusRead32((uint32_t)(uintptr_t)&RCC->CFGR) & RCC_CFGR_PPRE2) >> 13;
+    u->ratio = (ppre < 4U) ? 1U : (1U << (ppre - 3U));
+
+    /* DMA数据流使能时补发RXNE/TXE请求 */
+    sim_dma[SIM_USART_DMA - 1U].kick[SIM_USART_RX_STREAM0] = Usart_Request;
+    sim_dma[SIM_USART_DMA - 1U].kick_ctx[SIM_USART_RX_STREAM0] = u;
+    sim_dma[SIM_USART_DMA - 1U].kick[SIM_USART_RX_STREAM1] = Usart_Request;
+    sim_dma[SIM_USART_DMA - 1U].kick_ctx[SIM_USART_RX_STREAM1] = u;
+    sim_dma[SIM_USART_DMA - 1U].kick[SIM_USART_TX_STREAM] = Usart_Request;
+    sim_dma[SIM_USART_DMA - 1U].kick_ctx[SIM_USART_TX_STREAM] = u;
+    return RegSim_Attach(&sim_usart_model);
+}
+
+/**
+  * @brief           从RX线注入一段数据
+  * @param        data 数据
+  * @param        len 字节数
+  * @retval          0=已开始，1=上一段尚未全部到达
+  */
+uint8_t SimPeriph_UsartFeed(const uint8_t *data, uint32_t len)
+{
+    SimPeriph_Usart *u = &sim_usart;
+    uint64_t frame = Usart_FrameCycles(u);
+
+    if(u->rx_due != 0) return 1;
+    if(len == 0) return 0;
+    u->rx_data = data;
+    u->rx_len = len;
+    u->rx_pos = 0;
+    u->idle_due = 0;                                                           /* 起始位打断空闲检测 */
+    u->rx_due = RegSim_Now() + frame;
+    RegSim_Schedule(frame, Usart_RxEvent, u);
+    return 0;
+}
+
+/**
+  * @brief           取USART1状态
+  * @param        None
+  * @retval          状态
+  */
+SimPeriph_Usart *SimPeriph_Usart1(void)
+{
+    return &sim_usart;
+}
+
+#endif  /* REG_SIM */
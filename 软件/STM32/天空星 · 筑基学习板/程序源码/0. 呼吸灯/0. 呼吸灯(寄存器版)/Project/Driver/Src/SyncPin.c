@@ -0,0 +1,92 @@
+/**
+  ************************************************************************************
+  * @file              SyncPin.c
+  * @author         None
+  * @version       V1.0.0
+  * @date            2026-10-17
+  * @brief           多板同步脉冲引脚驱动源文件
+  *
+  * @details        本文件实现了PA1同步引脚的输出与EXTI1上升沿捕获
+  *
+  * @note            寄存器访问经过REG_xxx宏，可在主机仿真中运行
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *
+  ************************************************************************************
+  */
+
+#include "SyncPin.h"
+#include "Reg.h"
+
+#define SYNC_PIN                  1U              /* 同步引脚：PA1 */
+
+static SyncPin_Callback sync_cb;                   /* 上升沿回调 */
+
+/**
+  * @brief           初始化为主板
+  * @param        None
+  * @retval          None
+  */
+void SyncPin_InitLeader(void)
+{
+    REG_MODIFY(RCC->AHB1ENR, 0, RCC_AHB1ENR_GPIOAEN);
+
+    /* 先输出低电平，再切换为推挽输出，避免上电时产生毛刺 */
+    REG_WRITE(GPIOA->BSRR, GPIO_BSRR_RESET(SYNC_PIN));
+    REG_MODIFY(GPIOA->OTYPER, GPIO_1BIT_MASK(SYNC_PIN), GPIO_1BIT(SYNC_PIN, GPIO_OTYPE_PP));
+    REG_MODIFY(GPIOA->PUPDR, GPIO_2BIT_MASK(SYNC_PIN), GPIO_2BIT(SYNC_PIN, GPIO_PUPD_NONE));
+    REG_MODIFY(GPIOA->OSPEEDR, GPIO_2BIT_MASK(SYNC_PIN), GPIO_2BIT(SYNC_PIN, GPIO_SPEED_MEDIUM));
+    REG_MODIFY(GPIOA->MODER, GPIO_2BIT_MASK(SYNC_PIN), GPIO_2BIT(SYNC_PIN, GPIO_MODE_OUT));
+}
+
+/**
+  * @brief           设置同步引脚电平
+  * @param        level 1=高电平，0=低电平
+  * @retval          None
+  */
+void SyncPin_Set(uint8_t level)
+{
+    REG_WRITE(GPIOA->BSRR, level ? GPIO_BSRR_SET(SYNC_PIN) : GPIO_BSRR_RESET(SYNC_PIN));
+}
+
+/**
+  * @brief           初始化为从板
+  * @param        cb 上升沿回调
+  * @retval          None
+  */
+void SyncPin_InitFollower(SyncPin_Callback cb)
+{
+    sync_cb = cb;
+
+    /* 1. 使能GPIOA和SYSCFG时钟 */
+    REG_MODIFY(RCC->AHB1ENR, 0, RCC_AHB1ENR_GPIOAEN);
+    REG_MODIFY(RCC->APB2ENR, 0, RCC_APB2ENR_SYSCFGEN);
+
+    /* 2. PA1下拉输入，同步线断开时不会误触发 */
+    REG_MODIFY(GPIOA->MODER, GPIO_2BIT_MASK(SYNC_PIN), GPIO_2BIT(SYNC_PIN, GPIO_MODE_IN));
+    REG_MODIFY(GPIOA->PUPDR, GPIO_2BIT_MASK(SYNC_PIN), GPIO_2BIT(SYNC_PIN, GPIO_PUPD_DOWN));
+
+    /* 3. EXTI1连接到PA1，上升沿触发 */
+    REG_MODIFY(SYSCFG->EXTICR[0], SYSCFG_EXTICR1_EXTI1, SYSCFG_EXTICR1_EXTI1_PA);
+    REG_MODIFY(EXTI->FTSR, 1U << SYNC_PIN, 0);
+    REG_MODIFY(EXTI->RTSR, 0, 1U << SYNC_PIN);
+    REG_WRITE(EXTI->PR, 1U << SYNC_PIN);
+    REG_MODIFY(EXTI->IMR, 0, 1U << SYNC_PIN);
+
+    /* 4. 使能NVIC中断 */
+    REG_WRITE(NVIC->ISER[(uint32_t)EXTI1_IRQn >> 5], 1U << ((uint32_t)EXTI1_IRQn & 0x1FU));
+}
+
+/**
+  * @brief           EXTI1中断处理函数
+  * @param        None
+  * @retval          None
+  */
+void EXTI1_IRQHandler(void)
+{
+    if(REG_READ(EXTI->PR) & (1U << SYNC_PIN)) {
+        REG_WRITE(EXTI->PR, 1U << SYNC_PIN);           /* 写1清除挂起位 */
+        if(sync_cb) sync_cb();
+    }
+}
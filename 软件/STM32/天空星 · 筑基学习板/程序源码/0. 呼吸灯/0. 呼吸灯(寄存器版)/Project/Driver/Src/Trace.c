@@ -0,0 +1,305 @@
+/**
+  ************************************************************************************
+  * @file              Trace.c
+  * @author         None
+  * @version       V1.2.0
+  * @date            2026-10-17
+  * @brief           引脚边沿跟踪记录与比对模块源文件
+  *
+  * @details        本文件实现了边沿跟踪的记录、解码和比对：
+  *                        1. 记录端以DWT->CYCCNT为时间基准，增量+LEB128编码
+  *                        2. 缓冲区满时交给输出回调，实现流式输出
+  *                        3. 比对端逐条配对边沿，并统计各通道平均占空比和周期
+  *
+  * @note            记录格式见Trace.h
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 初始化时不再清零CYCCNT
+  *                         - 2026-10-17 V1.2.0 未初始化或已停止时不读CYCCNT（RegSim下不改变虚拟时间和访问统计）；
+  *                                                        Trace_Init(NULL, ...)停止记录
+  *
+  ************************************************************************************
+  */
+
+#include "Trace.h"
+#include "stm32f4xx.h"
+#include "Reg.h"
+
+#define TRACE_REC_MAX                       5U             /* 单条记录最大字节数（35位/7） */
+
+static uint8_t *trace_buf;                            /* 记录缓冲区 */
+static uint32_t trace_size;                           /* 缓冲区大小 */
+static uint32_t trace_len;                             /* 已写入字节数 */
+static uint32_t trace_dropped;                      /* 丢弃的边沿数 */
+static uint32_t trace_last;                            /* 上一个边沿的CYCCNT值 */
+static uint8_t trace_started;                        /* 是否已记录过边沿 */
+static Trace_Sink trace_sink;                        /* 输出回调 */
+
+/**
+  * @brief   单个通道的占空比/周期统计
+  */
+typedef struct
+{
+    uint64_t first_rise;                               /* 第一个上升沿时间 */
+    uint64_t last_rise;                                /* 最近一个上升沿时间 */
+    uint64_t high_acc;                                 /* 累计点亮时间 */
+    uint64_t high_done;                              /* 截至最近上升沿的完整周期点亮时间 */
+    uint32_t periods;                                  /* 完整周期数 */
+    uint8_t rising_seen;                             /* 是否已出现上升沿 */
+} Trace_ChStat;
+
+/**
+  * @brief           初始化跟踪记录
+  * @param        buf 记录缓冲区
+  * @param        size 缓冲区大小，单位：字节
+  * @param        sink 输出回调，可为NULL
+  * @retval          None
+  * @note           清空缓冲区并使能DWT周期计数器；buf为NULL时停止记录，不访问寄存器
+  */
+void Trace_Init(uint8_t *buf, uint32_t size, Trace_Sink sink)
+{
+    trace_buf = buf;
+    trace_size = size;
+    trace_len = 0;
+    trace_dropped = 0;
+    trace_started = 0;
+    trace_sink = sink;
+    if(buf == 0) return;
+
+    /* 使能DWT周期计数器（不清零，Delay模块以它为自由运行的时间基准） */
+    REG_MODIFY(CoreDebug->DEMCR, 0, CoreDebug_DEMCR_TRCENA_Msk);
+    REG_MODIFY(DWT->CTRL, 0, DWT_CTRL_CYCCNTENA_Msk);
+}
+
+/**
+  * @brief           记录一个边沿
+  * @param        ch 通道号（0-3）
+  * @param        level 1=点亮，0=熄灭
+  * @retval          None
+  * @note           缓冲区空间不足时先调用输出回调，无回调则丢弃
+  */
+void Trace_Edge(uint8_t ch, uint8_t level)
+{
+    uint32_t now;
+    uint64_t value;
+
+    if(trace_buf == 0) return;
+    now = REG_READ(DWT->CYCCNT);
+
+    /* 空间不足一条最长记录时先输出 */
+    if(trace_size - trace_len < TRACE_REC_MAX) {
+        if(trace_sink == 0) {
+            trace_dropped++;
+            return;
+        }
+        Trace_Flush();
+    }
+
+    if(!trace_started) {
+        trace_started = 1;
+        trace_last = now;
+    }
+
+    value = ((uint64_t)(now - trace_last) << 3) | ((uint32_t)(ch & 0x03U) << 1) | (level ? 1U : 0U);
+    trace_last = now;
+
+    /* LEB128：每字节7位，最高位为继续标志 */
+    while(value >= 0x80U) {
+        trace_buf[trace_len++] = (uint8_t)(value | 0x80U);
+        value >>= 7;
+    }
+    trace_buf[trace_len++] = (uint8_t)value;
+}
+
+/**
+  * @brief           输出缓冲区中的剩余记录
+  * @param        None
+  * @retval          None
+  * @note           无输出回调时直接清空
+  */
+void Trace_Flush(void)
+{
+    if(trace_sink != 0 && trace_len > 0) {
+        trace_sink(trace_buf, trace_len);
+    }
+    trace_len = 0;
+}
+
+/**
+  * @brief           获取缓冲区中尚未输出的数据
+  * @param        len 输出数据长度
+  * @retval          缓冲区首地址
+  */
+const uint8_t *Trace_Data(uint32_t *len)
+{
+    *len = trace_len;
+    return trace_buf;
+}
+
+/**
+  * @brief           获取丢弃的边沿数
+  * @param        None
+  * @retval          丢弃的边沿数
+  */
+uint32_t Trace_Dropped(void)
+{
+    return trace_dropped;
+}
+
+/**
+  * @brief           初始化读取器
+  * @param        r 读取器
+  * @param        data 跟踪数据
+  * @param        len 数据长度
+  * @retval          None
+  */
+void Trace_ReaderInit(Trace_Reader *r, const uint8_t *data, uint32_t len)
+{
+    r->pos = data;
+    r->end = data + len;
+    r->time = 0;
+}
+
+/**
+  * @brief           读取下一个边沿
+  * @param        r 读取器
+  * @param        e 输出的边沿记录
+  * @retval          1=读到一条记录，0=数据结束或损坏
+  * @note           时间为各增量的累加值
+  */
+uint8_t Trace_ReadEdge(Trace_Reader *r, Trace_EdgeRec *e)
+{
+    uint64_t value = 0;
+    uint8_t shift = 0;
+    uint8_t byte;
+
+    do {
+        if(r->pos >= r->end || shift >= 7U * TRACE_REC_MAX) return 0;
+        byte = *r->pos++;
+        value |= (uint64_t)(byte & 0x7FU) << shift;
+        shift += 7;
+    } while(byte & 0x80U);
+
+    r->time += value >> 3;
+    e->time = r->time;
+    e->channel = (uint8_t)((value >> 1) & 0x03U);
+    e->level = (uint8_t)(value & 0x01U);
+    return 1;
+}
+
+/**
+  * @brief           将一个边沿计入通道统计
+  * @param        s 通道统计
+  * @param        e 边沿记录
+  * @retval          None
+  */
+static void Trace_StatEdge(Trace_ChStat *s, const Trace_EdgeRec *e)
+{
+    if(e->level) {
+        if(!s->rising_seen) {
+            s->rising_seen = 1;
+            s->first_rise = e->time;
+        } else {
+            s->high_done = s->high_acc;
+            s->periods++;
+        }
+        s->last_rise = e->time;
+    } else if(s->rising_seen) {
+        s->high_acc += e->time - s->last_rise;
+    }
+}
+
+/**
+  * @brief           计算通道的平均周期与占空比
+  * @param        s 通道统计
+  * @param        period 输出平均周期，单位：周期
+  * @param        duty 输出平均占空比，单位：百万分之一
+  * @retval          None
+  */
+static void Trace_StatResult(const Trace_ChStat *s, uint32_t *period, uint32_t *duty)
+{
+    uint64_t span = s->last_rise - s->first_rise;
+
+    if(s->periods == 0 || span == 0) {
+        *period = 0;
+        *duty = 0;
+        return;
+    }
+    *period = (uint32_t)(span / s->periods);
+    *duty = (uint32_t)(s->high_done * 1000000U / span);
+}
+
+/**
+  * @brief           两个无符号数之差的绝对值
+  */
+static uint32_t Trace_AbsDiff(uint32_t a, uint32_t b)
+{
+    return a > b ? a - b : b - a;
+}
+
+/**
+  * @brief           将实际跟踪与黄金跟踪按容差比对
+  * @param        golden/golden_len 黄金跟踪
+  * @param        actual/actual_len 实际跟踪
+  * @param        tol 容差
+  * @param        diff 输出比对结果
+  * @retval          0=在容差内，1=超差
+  * @note           一侧边沿先结束也视为分歧
+  */
+uint8_t Trace_Compare(const uint8_t *golden, uint32_t golden_len,
+                      const uint8_t *actual, uint32_t actual_len,
+                      const Trace_Tolerance *tol, Trace_Diff *diff)
+{
+    Trace_Reader rg, ra;
+    Trace_EdgeRec eg, ea;
+    Trace_ChStat sg[TRACE_CHANNELS] = {0};
+    Trace_ChStat sa[TRACE_CHANNELS] = {0};
+    uint8_t has_g, has_a;
+    uint8_t fail = 0;
+    uint32_t i;
+
+    Trace_ReaderInit(&rg, golden, golden_len);
+    Trace_ReaderInit(&ra, actual, actual_len);
+    diff->edges = 0;
+    diff->first_diverge = -1;
+
+    /* 逐条配对比较，同时累计统计 */
+    for(;;) {
+        has_g = Trace_ReadEdge(&rg, &eg);
+        has_a = Trace_ReadEdge(&ra, &ea);
+        if(!has_g && !has_a) break;
+
+        if(has_g) Trace_StatEdge(&sg[eg.channel], &eg);
+        if(has_a) Trace_StatEdge(&sa[ea.channel], &ea);
+
+        if(diff->first_diverge >= 0) continue;
+
+        /* 边沿数不一致、通道或电平不同、时间超差 */
+        if(!has_g || !has_a
+           || eg.channel != ea.channel || eg.level != ea.level
+           || (eg.time > ea.time ? eg.time - ea.time : ea.time - eg.time) > tol->edge_cycles) {
+            diff->first_diverge = (int32_t)diff->edges;
+            diff->golden_edge = has_g ? eg : (Trace_EdgeRec){0};
+            diff->actual_edge = has_a ? ea : (Trace_EdgeRec){0};
+            fail = 1;
+            continue;
+        }
+        diff->edges++;
+    }
+
+    /* 各通道平均占空比与周期偏差 */
+    for(i = 0; i < TRACE_CHANNELS; i++) {
+        uint32_t pg, dg, pa, da;
+
+        Trace_StatResult(&sg[i], &pg, &dg);
+        Trace_StatResult(&sa[i], &pa, &da);
+        diff->duty_err_ppm[i] = Trace_AbsDiff(dg, da);
+        diff->period_err_cycles[i] = Trace_AbsDiff(pg, pa);
+        if(diff->duty_err_ppm[i] > tol->duty_ppm || diff->period_err_cycles[i] > tol->period_cycles) {
+            fail = 1;
+        }
+    }
+
+    return fail;
+}
@@ -0,0 +1,252 @@
+/**
+  ************************************************************************************
+  * @file              Uart.c
+  * @author         None
+  * @version       V1.1.0
+  * @date            2026-10-17
+  * @brief           USART1 DMA收发驱动源文件
+  *
+  * @details        本文件实现了串口的DMA收发：
+  *                        1. 接收：DMA2 Stream2循环模式，写指针 = UART_RX_SIZE - NDTR，
+  *                           读指针只在Uart_Poll()中推进，不需要DMA中断
+  *                        2. 空闲线中断只记录写指针位置、事件计数和CYCCNT时刻，不搬运数据
+  *                        3. 发送：DMA2 Stream7普通模式，传输结束后硬件清除EN位，
+  *                           Uart_TxBusy()读EN位判断是否发送完成，不需要DMA中断
+  *
+  * @note            USART1挂在APB2上，外设时钟取Device_Pclk2()（F407上84MHz，F401/F41x上等于主频）
+  *                        BRR = 外设时钟 ÷ 波特率（16倍过采样，四舍五入，低4位为小数部分）
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 APB2时钟改由Device层按实际分频计算
+  *
+  ************************************************************************************
+  */
+
+#include "Uart.h"
+#include "stm32f4xx.h"
+#include "Reg.h"
+#include "Device.h"
+
+#define UART_TX_PIN                9U              /* PA9：USART1_TX */
+#define UART_RX_PIN               10U             /* PA10：USART1_RX */
+#define UART_AF                       7U              /* AF7：USART1~3 */
+#define UART_DMA_CHANNEL     4U              /* DMA2 Stream2/Stream7通道4：USART1_RX/USART1_TX */
+
+/* DMA2 Stream2在LISR/LIFCR中、Stream7在HISR/HIFCR中的标志位 */
+#define UART_RX_DMA_FLAGS    (DMA_LIFCR_CFEIF2 | DMA_LIFCR_CDMEIF2 | DMA_LIFCR_CTEIF2 | \
+                              DMA_LIFCR_CHTIF2 | DMA_LIFCR_CTCIF2)
+#define UART_TX_DMA_FLAGS    (DMA_HIFCR_CFEIF7 | DMA_HIFCR_CDMEIF7 | DMA_HIFCR_CTEIF7 | \
+                              DMA_HIFCR_CHTIF7 | DMA_HIFCR_CTCIF7)
+
+static uint8_t uart_rx[UART_RX_SIZE];                  /* 接收环形缓冲区，由DMA写入 */
+static uint32_t uart_tail;                                      /* 读指针，只在Uart_Poll()中修改 */
+static volatile uint32_t uart_idle_pos;                 /* 最近一次空闲线时的写指针 */
+static volatile uint32_t uart_idle_at;                   /* 最近一次空闲线时的CYCCNT */
+static volatile uint32_t uart_idle_count;             /* 空闲线事件计数 */
+static uint32_t uart_idle_seen;                             /* 已交付的空闲线事件计数 */
+static uint8_t uart_tx_busy;                                 /* 已启动发送，尚未确认完成 */
+static Uart_Stats uart_stats;                                /* 收发统计 */
+
+/**
+  * @brief           当前DMA写指针
+  * @param        None
+  * @retval          写指针（0 ~ UART_RX_SIZE-1）
+  * @note           NDTR在循环模式下从UART_RX_SIZE递减到1后重装，不会停在0
+  */
+static uint32_t Uart_Head(void)
+{
+    return (UART_RX_SIZE - REG_READ(DMA2_Stream2->NDTR)) % UART_RX_SIZE;
+}
+
+/**
+  * @brief           交付 [uart_tail, to) 区间的数据
+  * @param        sink 接收回调
+  * @param        ctx 回调参数
+  * @param        to 区间终点
+  * @param        idle 最后一段的idle标志
+  * @retval          交付的字节数
+  * @note           区间跨过缓冲区末尾时分两段回调，第一段的idle恒为0
+  */
+static uint32_t Uart_Deliver(Uart_Sink sink, void *ctx, uint32_t to, uint8_t idle)
+{
+    uint32_t from = uart_tail;
+    uint32_t len;
+
+    if(to < from) {
+        sink(ctx, &uart_rx[from], UART_RX_SIZE - from, 0);
+        len = UART_RX_SIZE - from + to;
+        from = 0;
+    } else {
+        len = to - from;
+    }
+    if(to > from || idle) {
+        sink(ctx, &uart_rx[from], to - from, idle);
+    }
+    uart_tail = to;
+    return len;
+}
+
+/**
+  * @brief           初始化USART1及收发DMA
+  * @param        baud 波特率
+  * @retval          None
+  */
+void Uart_Init(uint32_t baud)
+{
+    uint32_t pclk = Device_Pclk2();
+
+    /* 1. 使能GPIOA、DMA2、USART1时钟 */
+    REG_MODIFY(RCC->AHB1ENR, 0, RCC_AHB1ENR_GPIOAEN | RCC_AHB1ENR_DMA2EN);
+    REG_MODIFY(RCC->APB2ENR, 0, RCC_APB2ENR_USART1EN);
+
+    /* 2. PA9/PA10：AF7复用，RX上拉保证断线时为空闲电平 */
+    REG_MODIFY(GPIOA->AFR[1], GPIO_AF_MASK(UART_TX_PIN) | GPIO_AF_MASK(UART_RX_PIN),
+               GPIO_AF(UART_TX_PIN, UART_AF) | GPIO_AF(UART_RX_PIN, UART_AF));
+    REG_MODIFY(GPIOA->OTYPER, GPIO_1BIT_MASK(UART_TX_PIN), GPIO_1BIT(UART_TX_PIN, GPIO_OTYPE_PP));
+    REG_MODIFY(GPIOA->PUPDR, GPIO_2BIT_MASK(UART_TX_PIN) | GPIO_2BIT_MASK(UART_RX_PIN),
+               GPIO_2BIT(UART_TX_PIN, GPIO_PUPD_UP) | GPIO_2BIT(UART_RX_PIN, GPIO_PUPD_UP));
+    REG_MODIFY(GPIOA->OSPEEDR, GPIO_2BIT_MASK(UART_TX_PIN), GPIO_2BIT(UART_TX_PIN, GPIO_SPEED_HIGH));
+    REG_MODIFY(GPIOA->MODER, GPIO_2BIT_MASK(UART_TX_PIN) | GPIO_2BIT_MASK(UART_RX_PIN),
+               GPIO_2BIT(UART_TX_PIN, GPIO_MODE_AF) | GPIO_2BIT(UART_RX_PIN, GPIO_MODE_AF));
+
+    /* 3. USART1：8N1，16倍过采样 */
+    REG_WRITE(USART1->CR1, 0);
+    REG_WRITE(USART1->CR2, 0);
+    REG_WRITE(USART1->BRR, (pclk + baud / 2U) / baud);
+    REG_WRITE(USART1->CR3, USART_CR3_DMAR | USART_CR3_DMAT);
+
+    /* 4. DMA2 Stream2：外设→存储器，字节，循环，不开中断 */
+    REG_MODIFY(DMA2_Stream2->CR, DMA_SxCR_EN, 0);
+    while(REG_READ(DMA2_Stream2->CR) & DMA_SxCR_EN);
+    REG_WRITE(DMA2->LIFCR, UART_RX_DMA_FLAGS);
+    REG_WRITE(DMA2_Stream2->PAR, (uint32_t)(uintptr_t)&USART1->DR);
+    REG_WRITE(DMA2_Stream2->M0AR, (uint32_t)(uintptr_t)uart_rx);
+    REG_WRITE(DMA2_Stream2->NDTR, UART_RX_SIZE);
+    REG_WRITE(DMA2_Stream2->CR, REG_FIELD(25, 3, UART_DMA_CHANNEL) | DMA_SxCR_MINC | DMA_SxCR_CIRC
+                              | DMA_SxCR_EN);
+
+    /* 5. DMA2 Stream7：存储器→外设，字节，普通模式，不开中断；地址和长度在Uart_Send()中设置 */
+    REG_MODIFY(DMA2_Stream7->CR, DMA_SxCR_EN, 0);
+    while(REG_READ(DMA2_Stream7->CR) & DMA_SxCR_EN);
+    REG_WRITE(DMA2_Stream7->PAR, (uint32_t)(uintptr_t)&USART1->DR);
+    REG_WRITE(DMA2_Stream7->CR, REG_FIELD(25, 3, UART_DMA_CHANNEL) | DMA_SxCR_MINC | DMA_SxCR_DIR_0);
+
+    /* 6. 使能USART1及空闲线中断 */
+    uart_tail = 0;
+    uart_idle_pos = 0;
+    uart_idle_count = 0;
+    uart_idle_seen = 0;
+    uart_tx_busy = 0;
+    REG_WRITE(USART1->CR1, USART_CR1_UE | USART_CR1_TE | USART_CR1_RE | USART_CR1_IDLEIE);
+    REG_WRITE(NVIC->ISER[(uint32_t)USART1_IRQn >> 5], 1U << ((uint32_t)USART1_IRQn & 0x1FU));
+
+    /* 7. 使能DWT周期计数器，用于统计交付延迟 */
+    REG_MODIFY(CoreDebug->DEMCR, 0, CoreDebug_DEMCR_TRCENA_Msk);
+    REG_MODIFY(DWT->CTRL, 0, DWT_CTRL_CYCCNTENA_Msk);
+}
+
+/**
+  * @brief           交付新收到的数据
+  * @param        sink 接收回调
+  * @param        ctx 回调参数
+  * @retval          本次交付的字节数
+  * @note           有新的空闲线事件时先交付到空闲位置（idle=1），再交付之后收到的部分（idle=0）；
+  *                        两次调用之间有多个空闲线事件时只保留最后一个的位置
+  */
+uint32_t Uart_Poll(Uart_Sink sink, void *ctx)
+{
+    uint32_t count;
+    uint32_t idle_pos;
+    uint32_t idle_at;
+    uint32_t head;
+    uint32_t len = 0;
+    uint32_t lat;
+
+    /* 最后读写指针，期间发生空闲线中断则重读：
+       取到的空闲位置不在写指针之后，之后的中断记录的位置也不会落在读指针之前 */
+    do {
+        count = uart_idle_count;
+        idle_pos = uart_idle_pos;
+        idle_at = uart_idle_at;
+        head = Uart_Head();
+    } while(count != uart_idle_count);
+
+    if(count != uart_idle_seen) {
+        uart_idle_seen = count;
+        len += Uart_Deliver(sink, ctx, idle_pos, 1);
+        lat = REG_READ(DWT->CYCCNT) - idle_at;
+        if(lat > uart_stats.latency_max) uart_stats.latency_max = lat;
+    }
+    if(head != uart_tail) {
+        len += Uart_Deliver(sink, ctx, head, 0);
+    }
+
+    uart_stats.rx_bytes += len;
+    if(len > uart_stats.rx_peak) uart_stats.rx_peak = len;
+    return len;
+}
+
+/**
+  * @brief           用DMA发送一段数据
+  * @param        data 数据（发送完成前须保持有效）
+  * @param        len 字节数（1 ~ 65535）
+  * @retval          0=已开始，1=上一段尚未发送完，2=参数非法
+  */
+uint8_t Uart_Send(const uint8_t *data, uint32_t len)
+{
+    if(len == 0 || len > 0xFFFFU) return 2;
+    if(Uart_TxBusy()) return 1;
+
+    REG_WRITE(DMA2->HIFCR, UART_TX_DMA_FLAGS);
+    REG_WRITE(DMA2_Stream7->M0AR, (uint32_t)(uintptr_t)data);
+    REG_WRITE(DMA2_Stream7->NDTR, len);
+    REG_MODIFY(DMA2_Stream7->CR, 0, DMA_SxCR_EN);
+    uart_tx_busy = 1;
+    uart_stats.tx_bytes += len;
+    return 0;
+}
+
+/**
+  * @brief           查询是否正在发送
+  * @param        None
+  * @retval          1=发送中，0=空闲
+  * @note           DMA写完最后一个字节即视为完成，此时移位寄存器中可能还有1~2个字节未送出，
+  *                        不影响下一次Uart_Send()
+  */
+uint8_t Uart_TxBusy(void)
+{
+    if(uart_tx_busy && !(REG_READ(DMA2_Stream7->CR) & DMA_SxCR_EN)) {
+        uart_tx_busy = 0;
+    }
+    return uart_tx_busy;
+}
+
+/**
+  * @brief           读取收发统计
+  * @param        stats 输出统计
+  * @retval          None
+  */
+void Uart_GetStats(Uart_Stats *stats)
+{
+    *stats = uart_stats;
+    stats->frames = uart_idle_count;
+}
+
+/**
+  * @brief           USART1中断处理函数
+  * @param        None
+  * @retval          None
+  * @note           先读SR再读DR清除IDLE标志；DR中的数据已由DMA取走，此处读出的值丢弃
+  */
+void USART1_IRQHandler(void)
+{
+    uint32_t sr = REG_READ(USART1->SR);
+
+    if(sr & USART_SR_IDLE) {
+        (void)REG_READ(USART1->DR);
+        uart_idle_pos = Uart_Head();
+        uart_idle_at = REG_READ(DWT->CYCCNT);
+        uart_idle_count++;
+    }
+}
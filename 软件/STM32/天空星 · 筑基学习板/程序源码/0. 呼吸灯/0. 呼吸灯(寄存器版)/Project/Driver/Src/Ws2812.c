@@ -0,0 +1,265 @@
+/**
+  ************************************************************************************
+  * @file              Ws2812.c
+  * @author         None
+  * @version       V1.2.0
+  * @date            2026-10-17
+  * @brief           WS2812/SK6812可寻址LED驱动源文件
+  *
+  * @details        本文件实现了灯带的编码和DMA发送：
+  *                        1. TIM2：计数时钟取Device_TimClk1()（F407上84MHz，ARR = 84MHz ÷ 800kHz - 1 = 104），CH1为PWM模式1，
+  *                           CCR1预装载，每次更新事件产生一次DMA请求写入下一位的比较值
+  *                        2. 缓冲区前后两半交替编码，数据和复位位全部送出后再经过两次中断
+  *                           （两半都已输出）停止定时器
+  *                        3. 编码按字节展开，每位一次查表选择t0/t1
+  *                        4. TIM2的CCR1为32位寄存器，缓冲区按字存放，DMA两侧都按字传输：
+  *                           APB上的半字写入会复制到高低两个半字，写入的比较值变为(v << 16) | v
+  *
+  * @note            TIM2挂在APB1上，定时器时钟按RCC实际分频计算；没有TIM2的型号（F410）不编译本驱动
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 定时器时钟改由Device层按实际分频计算，无TIM2的型号不编译
+  *                         - 2026-10-17 V1.2.0 缓冲区改为32位，DMA按字写入TIM2->CCR1（半字写入会复制到高半字）
+  *
+  ************************************************************************************
+  */
+
+#include "Ws2812.h"
+#include "stm32f4xx.h"
+#include "Reg.h"
+#include "Device.h"
+
+#if DEVICE_HAS_TIM(2)
+
+#define WS2812_PIN                5U              /* 数据线：PA5（TIM2_CH1） */
+#define WS2812_AF                  1U              /* AF1：TIM1/TIM2 */
+#define WS2812_DMA_CHANNEL   3U              /* DMA1 Stream1通道3：TIM2_UP */
+
+#define TIM_OCM_PWM1             0x6U           /* 输出比较模式：PWM模式1 */
+
+/* DMA1 Stream1在LISR/LIFCR中的标志位 */
+#define WS2812_DMA_FLAGS       (DMA_LIFCR_CFEIF1 | DMA_LIFCR_CDMEIF1 | DMA_LIFCR_CTEIF1 | \
+                                DMA_LIFCR_CHTIF1 | DMA_LIFCR_CTCIF1)
+
+static uint32_t ws_buf[2 * WS2812_HALF_SLOTS];  /* 乒乓缓冲区 */
+static Ws2812_Stream ws_stream;                        /* 编码状态 */
+static volatile uint8_t ws_busy;                       /* 发送中标志 */
+static uint8_t ws_drain;                                   /* 编码结束后的中断次数 */
+static uint32_t ws_start;                                  /* 本帧开始时的CYCCNT */
+static uint32_t ws_frame_cycles;                     /* 上一帧耗时 */
+static uint32_t ws_isr_cycles;                         /* 上一帧中断耗时 */
+
+/**
+  * @brief           开始编码一帧
+  * @param        s 编码状态
+  * @param        data 帧数据
+  * @param        len 数据字节数
+  * @param        t0 0码比较值
+  * @param        t1 1码比较值
+  * @param        reset_slots 复位位数
+  * @retval          None
+  */
+void Ws2812_Begin(Ws2812_Stream *s, const uint8_t *data, uint32_t len,
+                  uint16_t t0, uint16_t t1, uint32_t reset_slots)
+{
+    s->data = data;
+    s->bits = len * 8U;
+    s->pos = 0;
+    s->reset_left = reset_slots;
+    s->t0 = t0;
+    s->t1 = t1;
+}
+
+/**
+  * @brief           编码下一段比较值
+  * @param        s 编码状态
+  * @param        dst 输出比较值
+  * @param        slots 输出个数
+  * @retval          写入的有效位数
+  */
+uint32_t Ws2812_Fill(Ws2812_Stream *s, uint32_t *dst, uint32_t slots)
+{
+    uint32_t code[2];
+    uint32_t written = 0;
+    uint32_t n;
+    uint8_t b;
+
+    code[0] = s->t0;
+    code[1] = s->t1;
+
+    /* 数据位：字节对齐时一次编码8位 */
+    while(slots > 0 && s->pos < s->bits) {
+        if((s->pos & 7U) == 0 && slots >= 8U) {
+            b = s->data[s->pos >> 3];
+            dst[0] = code[(b >> 7) & 1U];
+            dst[1] = code[(b >> 6) & 1U];
+            dst[2] = code[(b >> 5) & 1U];
+            dst[3] = code[(b >> 4) & 1U];
+            dst[4] = code[(b >> 3) & 1U];
+            dst[5] = code[(b >> 2) & 1U];
+            dst[6] = code[(b >> 1) & 1U];
+            dst[7] = code[b & 1U];
+            n = 8U;
+        } else {
+            b = s->data[s->pos >> 3];
+            dst[0] = code[(b >> (7U - (s->pos & 7U))) & 1U];
+            n = 1U;
+        }
+        dst += n;
+        slots -= n;
+        written += n;
+        s->pos += n;
+    }
+
+    /* 复位位 */
+    n = (slots < s->reset_left) ? slots : s->reset_left;
+    s->reset_left -= n;
+    written += n;
+
+    /* 复位位和多余位置都输出0（低电平） */
+    while(slots--) {
+        *dst++ = 0;
+    }
+    return written;
+}
+
+/**
+  * @brief           初始化灯带驱动
+  * @param        None
+  * @retval          None
+  */
+void Ws2812_Init(void)
+{
+    /* 1. 使能GPIOA、DMA1、TIM2时钟 */
+    REG_MODIFY(RCC->AHB1ENR, 0, RCC_AHB1ENR_GPIOAEN | RCC_AHB1ENR_DMA1EN);
+    REG_MODIFY(RCC->APB1ENR, 0, RCC_APB1ENR_TIM2EN);
+
+    /* 2. TIM2：800kHz，CH1 PWM模式1，比较值为0时输出保持低电平 */
+    REG_WRITE(TIM2->CR1, 0);
+    REG_WRITE(TIM2->PSC, 0);
+    REG_WRITE(TIM2->ARR, Device_TimClk1() / WS2812_BIT_HZ - 1U);
+    REG_WRITE(TIM2->CCR1, 0);
+    REG_MODIFY(TIM2->CCMR1, TIM_CCMR1_OC1M | TIM_CCMR1_OC1PE | REG_MASK(0, 2),
+               REG_FIELD(4, 3, TIM_OCM_PWM1) | TIM_CCMR1_OC1PE);
+    REG_MODIFY(TIM2->CCER, TIM_CCER_CC1P | TIM_CCER_CC1E, TIM_CCER_CC1E);
+    REG_WRITE(TIM2->EGR, TIM_EGR_UG);
+
+    /* 3. PA5：TIM2_CH1复用推挽输出，下拉保证空闲时为低电平 */
+    REG_MODIFY(GPIOA->AFR[0], GPIO_AF_MASK(WS2812_PIN), GPIO_AF(WS2812_PIN, WS2812_AF));
+    REG_MODIFY(GPIOA->OTYPER, GPIO_1BIT_MASK(WS2812_PIN), GPIO_1BIT(WS2812_PIN, GPIO_OTYPE_PP));
+    REG_MODIFY(GPIOA->PUPDR, GPIO_2BIT_MASK(WS2812_PIN), GPIO_2BIT(WS2812_PIN, GPIO_PUPD_DOWN));
+    REG_MODIFY(GPIOA->OSPEEDR, GPIO_2BIT_MASK(WS2812_PIN), GPIO_2BIT(WS2812_PIN, GPIO_SPEED_HIGH));
+    REG_MODIFY(GPIOA->MODER, GPIO_2BIT_MASK(WS2812_PIN), GPIO_2BIT(WS2812_PIN, GPIO_MODE_AF));
+
+    /* 4. DMA1 Stream1：存储器→外设，字（CCR1为32位），循环，半传输/传输完成中断 */
+    REG_MODIFY(DMA1_Stream1->CR, DMA_SxCR_EN, 0);
+    while(REG_READ(DMA1_Stream1->CR) & DMA_SxCR_EN);
+    REG_WRITE(DMA1_Stream1->PAR, (uint32_t)(uintptr_t)&TIM2->CCR1);
+    REG_WRITE(DMA1_Stream1->M0AR, (uint32_t)(uintptr_t)ws_buf);
+    REG_WRITE(DMA1_Stream1->CR, REG_FIELD(25, 3, WS2812_DMA_CHANNEL) | DMA_SxCR_MSIZE_1 | DMA_SxCR_PSIZE_1
+                              | DMA_SxCR_MINC | DMA_SxCR_CIRC | DMA_SxCR_DIR_0
+                              | DMA_SxCR_HTIE | DMA_SxCR_TCIE);
+
+    /* 5. 使能NVIC中断 */
+    REG_WRITE(NVIC->ISER[(uint32_t)DMA1_Stream1_IRQn >> 5], 1U << ((uint32_t)DMA1_Stream1_IRQn & 0x1FU));
+
+    /* 6. 使能DWT周期计数器，用于统计帧耗时 */
+    REG_MODIFY(CoreDebug->DEMCR, 0, CoreDebug_DEMCR_TRCENA_Msk);
+    REG_MODIFY(DWT->CTRL, 0, DWT_CTRL_CYCCNTENA_Msk);
+}
+
+/**
+  * @brief           开始发送一帧
+  * @param        data 帧数据
+  * @param        len 数据字节数
+  * @retval          0=已开始，1=上一帧尚未发送完
+  */
+uint8_t Ws2812_Show(const uint8_t *data, uint32_t len)
+{
+    uint32_t ticks = Device_TimClk1() / 1000000U;              /* 每微秒的定时器计数 */
+    uint16_t t0 = (uint16_t)((uint64_t)WS2812_T0H_NS * ticks / 1000U);
+    uint16_t t1 = (uint16_t)((uint64_t)WS2812_T1H_NS * ticks / 1000U);
+
+    if(ws_busy) return 1;
+
+    ws_busy = 1;
+    ws_drain = 0;
+    ws_isr_cycles = 0;
+    ws_start = REG_READ(DWT->CYCCNT);
+
+    /* 预先编码两半缓冲区 */
+    Ws2812_Begin(&ws_stream, data, len, t0, t1, WS2812_RESET_US * WS2812_BIT_HZ / 1000000U);
+    Ws2812_Fill(&ws_stream, ws_buf, 2U * WS2812_HALF_SLOTS);
+
+    /* 启动DMA，再启动定时器：第一次更新事件写入第一位 */
+    REG_WRITE(DMA1->LIFCR, WS2812_DMA_FLAGS);
+    REG_WRITE(DMA1_Stream1->NDTR, 2U * WS2812_HALF_SLOTS);
+    REG_MODIFY(DMA1_Stream1->CR, 0, DMA_SxCR_EN);
+    REG_WRITE(TIM2->CNT, 0);
+    REG_MODIFY(TIM2->DIER, 0, TIM_DIER_UDE);
+    REG_WRITE(TIM2->CR1, TIM_CR1_ARPE | TIM_CR1_CEN);
+    return 0;
+}
+
+/**
+  * @brief           查询是否正在发送
+  * @param        None
+  * @retval          1=发送中，0=空闲
+  */
+uint8_t Ws2812_Busy(void)
+{
+    return ws_busy;
+}
+
+/**
+  * @brief           上一帧的发送耗时
+  * @param        None
+  * @retval          CPU周期数
+  */
+uint32_t Ws2812_FrameCycles(void)
+{
+    return ws_frame_cycles;
+}
+
+/**
+  * @brief           上一帧在中断中编码的耗时
+  * @param        None
+  * @retval          CPU周期数
+  */
+uint32_t Ws2812_IsrCycles(void)
+{
+    return ws_isr_cycles;
+}
+
+/**
+  * @brief           DMA1 Stream1中断处理函数
+  * @param        None
+  * @retval          None
+  * @note           半传输时前一半已送出，传输完成时后一半已送出，编码刚送出的那一半
+  */
+void DMA1_Stream1_IRQHandler(void)
+{
+    uint32_t t = REG_READ(DWT->CYCCNT);
+    uint32_t isr = REG_READ(DMA1->LISR);
+    uint32_t *half;
+
+    REG_WRITE(DMA1->LIFCR, WS2812_DMA_FLAGS);
+    if((isr & (DMA_LISR_HTIF1 | DMA_LISR_TCIF1)) == 0 || !ws_busy) return;
+
+    half = (isr & DMA_LISR_TCIF1) ? &ws_buf[WS2812_HALF_SLOTS] : ws_buf;
+    if(Ws2812_Fill(&ws_stream, half, WS2812_HALF_SLOTS) == 0) {
+        /* 连续两次无内容可编码：两半缓冲区中的数据都已送出 */
+        if(++ws_drain >= 2U) {
+            REG_WRITE(TIM2->CR1, 0);
+            REG_MODIFY(TIM2->DIER, TIM_DIER_UDE, 0);
+            REG_WRITE(TIM2->CCR1, 0);
+            REG_MODIFY(DMA1_Stream1->CR, DMA_SxCR_EN, 0);
+            ws_frame_cycles = REG_READ(DWT->CYCCNT) - ws_start;
+            ws_busy = 0;
+        }
+    }
+    ws_isr_cycles += REG_READ(DWT->CYCCNT) - t;
+}
+
+#endif  /* DEVICE_HAS_TIM(2) */
@@ -0,0 +1,284 @@
+/**
+  ************************************************************************************
+  * @file              Startup.c
+  * @author         None
+  * @version       V1.1.0
+  * @date            2026-10-17
+  * @brief           C语言启动代码源文件
+  *
+  * @details        本文件用C实现原汇编启动文件和__main分散加载的工作：
+  *                        1. 向量表为const数组，第0项为栈顶，其余为处理函数；
+  *                           未实现的处理函数弱定义为Startup_DefaultHandler（死循环）
+  *                        2. .data复制：每次迭代一个16字节结构体赋值（编译为LDM/STM各4个字），
+  *                           剩余部分按字、按字节复制
+  *                        3. .bss清零：每次迭代8次字写入（32字节），剩余部分按字、按字节清零；
+  *                           主栈和NOINIT区不清零（栈正被Reset_Handler使用）
+  *                        4. Startup_MarkMain()：在main()入口记录DWT->CYCCNT（SystemInit()中清零启动），
+  *                           汇编启动文件同样适用（STARTUP_C为0时本文件只提供这一部分）
+  *
+  * @note            链接符号：
+  *                        - Keil：Load$$RW_IRAMn$$RW$$Base、Image$$RW_IRAMn$$RW$$Base/Limit、
+  *                          Image$$RW_IRAMn$$ZI$$Base/Limit（n = 1、2，RW_IRAM2不存在时弱引用为0），
+  *                          链接选项需包含 --entry=Reset_Handler --keep=*(RESET) --datacompressor=off
+  *                        - GCC：链接脚本提供_sidata、_sdata、_edata、_sbss、_ebss、_estack，
+  *                          向量表放在.isr_vector，.noinit放在.bss之外（_snoinit、_enoinit）
+  *                        不调用C++静态构造函数（工程中没有C++源文件）
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 CYCCNT改在SystemInit()中启动、main()入口记录，汇编启动路径也能测量；
+  *                                                        增加STARTUP_C开关
+  *
+  ************************************************************************************
+  */
+
+#include "Startup.h"
+#include "stm32f4xx.h"
+#include "Reg.h"
+
+uint32_t Startup_Cycles;
+
+/**
+  * @brief           记录复位到main()的CPU周期数
+  * @param        None
+  * @retval          None
+  */
+void Startup_MarkMain(void)
+{
+    Startup_Cycles = REG_READ(DWT->CYCCNT);
+}
+
+#if STARTUP_C && defined(STARTUP_IRQ_LIST) && !defined(REG_SIM)
+
+#include "system_stm32f4xx.h"
+
+#if defined(__CC_ARM) || defined(__ARMCC_VERSION)
+
+#define STARTUP_VECTOR_SECTION           __attribute__((section("RESET"), used))
+#define STARTUP_STACK_TOP                    ((void *)&Startup_Stack[STARTUP_STACK_SIZE / 8U])
+#define STARTUP_NO_BUILTIN
+
+/* 主栈，与原汇编启动文件相同放在STACK节中 */
+static uint64_t Startup_Stack[STARTUP_STACK_SIZE / 8U] __attribute__((section("STACK"), zero_init));
+
+extern uint8_t Load$$RW_IRAM1$$RW$$Base[];
+extern uint8_t Image$$RW_IRAM1$$RW$$Base[];
+extern uint8_t Image$$RW_IRAM1$$RW$$Limit[];
+extern uint8_t Image$$RW_IRAM1$$ZI$$Base[];
+extern uint8_t Image$$RW_IRAM1$$ZI$$Limit[];
+extern uint8_t Load$$RW_IRAM2$$RW$$Base[] __attribute__((weak));
+extern uint8_t Image$$RW_IRAM2$$RW$$Base[] __attribute__((weak));
+extern uint8_t Image$$RW_IRAM2$$RW$$Limit[] __attribute__((weak));
+extern uint8_t Image$$RW_IRAM2$$ZI$$Base[] __attribute__((weak));
+extern uint8_t Image$$RW_IRAM2$$ZI$$Limit[] __attribute__((weak));
+extern uint8_t NOINIT$$Base[] __attribute__((weak));
+extern uint8_t NOINIT$$Limit[] __attribute__((weak));
+
+#else
+
+#define STARTUP_VECTOR_SECTION           __attribute__((section(".isr_vector"), used))
+#define STARTUP_STACK_TOP                    ((void *)_estack)
+#define STARTUP_NO_BUILTIN                   __attribute__((optimize("no-tree-loop-distribute-patterns")))
+
+extern uint8_t _sidata[];
+extern uint8_t _sdata[];
+extern uint8_t _edata[];
+extern uint8_t _sbss[];
+extern uint8_t _ebss[];
+extern uint8_t _estack[];
+extern uint8_t _snoinit[] __attribute__((weak));
+extern uint8_t _enoinit[] __attribute__((weak));
+
+#endif
+
+/**
+  * @brief   向量表项
+  */
+typedef union
+{
+    void (*handler)(void);                         /* 处理函数 */
+    void *sp;                                            /* 第0项：栈顶 */
+} Startup_Vector;
+
+/**
+  * @brief   .data复制单位（结构体赋值编译为LDM/STM）
+  */
+typedef struct
+{
+    uint32_t w[4];
+} Startup_Block;
+
+extern int main(void);
+
+void Startup_DefaultHandler(void);
+
+#define STARTUP_WEAK(name)                   void name(void) __attribute__((weak, alias("Startup_DefaultHandler")));
+#define STARTUP_ENTRY(name)                 { name },
+
+STARTUP_WEAK(NMI_Handler)
+STARTUP_WEAK(HardFault_Handler)
+STARTUP_WEAK(MemManage_Handler)
+STARTUP_WEAK(BusFault_Handler)
+STARTUP_WEAK(UsageFault_Handler)
+STARTUP_WEAK(SVC_Handler)
+STARTUP_WEAK(DebugMon_Handler)
+STARTUP_WEAK(PendSV_Handler)
+STARTUP_WEAK(SysTick_Handler)
+STARTUP_IRQ_LIST(STARTUP_WEAK)
+
+/**
+  * @brief   向量表
+  */
+const Startup_Vector Startup_Vectors[16U + STARTUP_IRQ_COUNT] STARTUP_VECTOR_SECTION =
+{
+    { .sp = STARTUP_STACK_TOP },
+    { Reset_Handler },
+    { NMI_Handler },
+    { HardFault_Handler },
+    { MemManage_Handler },
+    { BusFault_Handler },
+    { UsageFault_Handler },
+    { 0 },
+    { 0 },
+    { 0 },
+    { 0 },
+    { SVC_Handler },
+    { DebugMon_Handler },
+    { 0 },
+    { PendSV_Handler },
+    { SysTick_Handler },
+    STARTUP_IRQ_LIST(STARTUP_ENTRY)
+};
+
+/**
+  * @brief           复制初始化数据
+  * @param        src 源地址（Flash中的加载地址）
+  * @param        dst 目的起始地址
+  * @param        end 目的结束地址（不含）
+  * @retval          None
+  * @note           源和目的对4取余相同时按块和字复制，否则逐字节复制
+  */
+STARTUP_NO_BUILTIN static void Startup_Copy(const uint8_t *src, uint8_t *dst, uint8_t *end)
+{
+    if((((uint32_t)(uintptr_t)src ^ (uint32_t)(uintptr_t)dst) & 3U) == 0) {
+        while(((uint32_t)(uintptr_t)dst & 3U) && dst < end) *dst++ = *src++;
+        while(end - dst >= (int32_t)sizeof(Startup_Block)) {
+            *(Startup_Block *)dst = *(const Startup_Block *)src;
+            dst += sizeof(Startup_Block);
+            src += sizeof(Startup_Block);
+        }
+        while(end - dst >= 4) {
+            *(uint32_t *)dst = *(const uint32_t *)src;
+            dst += 4;
+            src += 4;
+        }
+    }
+    while(dst < end) *dst++ = *src++;
+}
+
+/**
+  * @brief           清零一段内存
+  * @param        p 起始地址
+  * @param        end 结束地址（不含）
+  * @retval          None
+  */
+STARTUP_NO_BUILTIN static void Startup_Zero(uint8_t *p, uint8_t *end)
+{
+    uint32_t *w;
+
+    while(((uint32_t)(uintptr_t)p & 3U) && p < end) *p++ = 0;
+    w = (uint32_t *)p;
+    while((uint8_t *)end - (uint8_t *)w >= 32) {
+        w[0] = 0;
+        w[1] = 0;
+        w[2] = 0;
+        w[3] = 0;
+        w[4] = 0;
+        w[5] = 0;
+        w[6] = 0;
+        w[7] = 0;
+        w += 8;
+    }
+    while((uint8_t *)end - (uint8_t *)w >= 4) *w++ = 0;
+    p = (uint8_t *)w;
+    while(p < end) *p++ = 0;
+}
+
+/**
+  * @brief           清零一段内存，跳过主栈和NOINIT区
+  * @param        p 起始地址
+  * @param        end 结束地址（不含）
+  * @retval          None
+  * @note           完全落在[p, end)内的区域才跳过；区域不存在时地址为0，不会落在范围内
+  */
+static void Startup_ZeroSkip(uint8_t *p, uint8_t *end)
+{
+    uint8_t *lo[2] = { 0, 0 };
+    uint8_t *hi[2] = { 0, 0 };
+    uint8_t *t;
+    uint32_t i;
+
+#if defined(__CC_ARM) || defined(__ARMCC_VERSION)
+    lo[0] = (uint8_t *)Startup_Stack;
+    hi[0] = (uint8_t *)Startup_Stack + sizeof(Startup_Stack);
+#if STARTUP_SKIP_NOINIT
+    lo[1] = NOINIT$$Base;
+    hi[1] = NOINIT$$Limit;
+#endif
+#endif
+
+    /* 按地址排序 */
+    if(lo[1] < lo[0]) {
+        t = lo[0]; lo[0] = lo[1]; lo[1] = t;
+        t = hi[0]; hi[0] = hi[1]; hi[1] = t;
+    }
+    for(i = 0; i < 2U; i++) {
+        if(lo[i] >= p && hi[i] <= end && hi[i] > lo[i]) {
+            Startup_Zero(p, lo[i]);
+            p = hi[i];
+        }
+    }
+    Startup_Zero(p, end);
+}
+
+/**
+  * @brief           默认处理函数
+  * @param        None
+  * @retval          None
+  * @note           未实现的异常和中断停在这里，可在调试器中查看IPSR确定中断号
+  */
+void Startup_DefaultHandler(void)
+{
+    while(1);
+}
+
+/**
+  * @brief           复位处理函数
+  * @param        None
+  * @retval          None
+  */
+void Reset_Handler(void)
+{
+    /* 1. 启动CYCCNT、FPU、时钟（只使用栈，不依赖已初始化的全局变量） */
+    SystemInit();
+
+    /* 2. 初始化数据、清零零初始化数据 */
+#if defined(__CC_ARM) || defined(__ARMCC_VERSION)
+    Startup_Copy(Load$$RW_IRAM1$$RW$$Base, Image$$RW_IRAM1$$RW$$Base, Image$$RW_IRAM1$$RW$$Limit);
+    Startup_ZeroSkip(Image$$RW_IRAM1$$ZI$$Base, Image$$RW_IRAM1$$ZI$$Limit);
+    Startup_Copy(Load$$RW_IRAM2$$RW$$Base, Image$$RW_IRAM2$$RW$$Base, Image$$RW_IRAM2$$RW$$Limit);
+    Startup_ZeroSkip(Image$$RW_IRAM2$$ZI$$Base, Image$$RW_IRAM2$$ZI$$Limit);
+#else
+    Startup_Copy(_sidata, _sdata, _edata);
+    Startup_ZeroSkip(_sbss, _ebss);
+#if !STARTUP_SKIP_NOINIT
+    Startup_Zero(_snoinit, _enoinit);
+#endif
+#endif
+
+    /* 3. 进入main()（启动耗时由main()入口的Startup_MarkMain()记录） */
+    main();
+    while(1);
+}
+
+#endif  /* STARTUP_C && STARTUP_IRQ_LIST && !REG_SIM */
@@ -0,0 +1,188 @@
+/**
+  ************************************************************************************
+  * @file              Startup.h
+  * @author         None
+  * @version       V1.1.0
+  * @date            2026-10-17
+  * @brief           C语言启动代码头文件
+  *
+  * @details        本文件提供C启动代码的配置和向量表定义：
+  *                        1. STARTUP_STACK_SIZE：主栈大小（与原汇编启动文件的Stack_Size相同）
+  *                        2. STARTUP_SKIP_NOINIT：为1时复位不清零STARTUP_NOINIT修饰的变量
+  *                        3. STARTUP_IRQ_LIST(X)：外部中断处理函数名列表，按中断号排列，
+  *                           Keil（ARMCC）和GCC共用同一份列表生成向量表和弱定义
+  *                        4. STARTUP_C：为1时使用本C启动代码，为0时只保留启动计时，工程改用汇编启动文件
+  *                        5. Startup_Cycles：复位到进入main()的CPU周期数，两种启动路径用同一方法测量：
+  *                           - 起点：SystemInit()第一条语句清零并启动DWT->CYCCNT
+  *                             （复位向量到SystemInit()之间的几条指令不计入，两条路径都只有一次调用）
+  *                           - 终点：main()第一条语句Startup_MarkMain()读取CYCCNT
+  *                           - 区间内：汇编路径为SystemInit() + __main（分散加载、MicroLIB初始化），
+  *                             C路径为SystemInit() + Startup_Copy()/Startup_ZeroSkip()
+  *                           - 读取：串口S命令应答的boot字段
+  *                           CYCCNT只在上电复位时清零，所以在SystemInit()中显式清零，软件复位后结果同样有效
+  *
+  * @note            向量表列表取自startup_stm32f40_41xxx.s（覆盖F405/407/415/417）；
+  *                        其他型号没有列表时本模块不生成向量表，仍使用对应的汇编启动文件
+  *
+  * @attention     注意事项：
+  *                         1. 工程中只能有一个启动实现：STARTUP_C为1时不能再加入startup_xxx.s；
+  *                            测量汇编路径时在Keil的C/C++宏定义中加入STARTUP_C=0，并把startup_stm32f40_41xxx.s
+  *                            加入Firmware组（Startup.c保留，链接选项不变）
+  *                         2. 不再经过__main，MicroLIB的malloc没有堆（__heap_base/__heap_limit未定义），
+  *                            动态内存改用固定块内存池
+  *
+  *                         修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *                         - 2026-10-17 V1.1.0 增加STARTUP_C和Startup_MarkMain()，汇编和C启动路径用同一方法测量启动周期
+  *
+  ************************************************************************************
+  */
+
+#ifndef __STARTUP_H
+#define __STARTUP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#ifndef STARTUP_C
+#define STARTUP_C                                1               /* 1=使用Startup.c的向量表和Reset_Handler，0=使用startup_xxx.s */
+#endif
+
+#define STARTUP_STACK_SIZE                 0x400U       /* 主栈大小，单位：字节（8的倍数） */
+
+#ifndef STARTUP_SKIP_NOINIT
+#define STARTUP_SKIP_NOINIT                1               /* 1=复位时保留NOINIT变量，0=与其他零初始化变量一起清零 */
+#endif
+
+/**
+  * @brief   不清零的变量（上电后为随机值，软件复位后保持原值）
+  * @note   Keil：节名为NOINIT，位于RW_IRAM1的ZI部分，启动代码按NOINIT$$Base/Limit跳过
+  *                GCC：节名为.noinit，链接脚本将其放在.bss之外
+  */
+#if defined(__CC_ARM) || defined(__ARMCC_VERSION)
+#define STARTUP_NOINIT                         __attribute__((section("NOINIT"), zero_init))
+#elif defined(__GNUC__) && !defined(REG_SIM)
+#define STARTUP_NOINIT                         __attribute__((section(".noinit")))
+#else
+#define STARTUP_NOINIT
+#endif
+
+/**
+  * @brief   外部中断处理函数名，第n项对应中断号n
+  */
+#if defined(STM32F40_41xxx)
+#define STARTUP_IRQ_COUNT                   82U
+#define STARTUP_IRQ_LIST(X)                 \
+    X(WWDG_IRQHandler)                              \
+    X(PVD_IRQHandler)                               \
+    X(TAMP_STAMP_IRQHandler)                        \
+    X(RTC_WKUP_IRQHandler)                          \
+    X(FLASH_IRQHandler)                             \
+    X(RCC_IRQHandler)                               \
+    X(EXTI0_IRQHandler)                             \
+    X(EXTI1_IRQHandler)                             \
+    X(EXTI2_IRQHandler)                             \
+    X(EXTI3_IRQHandler)                             \
+    X(EXTI4_IRQHandler)                             \
+    X(DMA1_Stream0_IRQHandler)                      \
+    X(DMA1_Stream1_IRQHandler)                      \
+    X(DMA1_Stream2_IRQHandler)                      \
+    X(DMA1_Stream3_IRQHandler)                      \
+    X(DMA1_Stream4_IRQHandler)                      \
+    X(DMA1_Stream5_IRQHandler)                      \
+    X(DMA1_Stream6_IRQHandler)                      \
+    X(ADC_IRQHandler)                               \
+    X(CAN1_TX_IRQHandler)                           \
+    X(CAN1_RX0_IRQHandler)                          \
+    X(CAN1_RX1_IRQHandler)                          \
+    X(CAN1_SCE_IRQHandler)                          \
+    X(EXTI9_5_IRQHandler)                           \
+    X(TIM1_BRK_TIM9_IRQHandler)                     \
+    X(TIM1_UP_TIM10_IRQHandler)                     \
+    X(TIM1_TRG_COM_TIM11_IRQHandler)                \
+    X(TIM1_CC_IRQHandler)                           \
+    X(TIM2_IRQHandler)                              \
+    X(TIM3_IRQHandler)                              \
+    X(TIM4_IRQHandler)                              \
+    X(I2C1_EV_IRQHandler)                           \
+    X(I2C1_ER_IRQHandler)                           \
+    X(I2C2_EV_IRQHandler)                           \
+    X(I2C2_ER_IRQHandler)                           \
+    X(SPI1_IRQHandler)                              \
+    X(SPI2_IRQHandler)                              \
+    X(USART1_IRQHandler)                            \
+    X(USART2_IRQHandler)                            \
+    X(USART3_IRQHandler)                            \
+    X(EXTI15_10_IRQHandler)                         \
+    X(RTC_Alarm_IRQHandler)                         \
+    X(OTG_FS_WKUP_IRQHandler)                       \
+    X(TIM8_BRK_TIM12_IRQHandler)                    \
+    X(TIM8_UP_TIM13_IRQHandler)                     \
+    X(TIM8_TRG_COM_TIM14_IRQHandler)                \
+    X(TIM8_CC_IRQHandler)                           \
+    X(DMA1_Stream7_IRQHandler)                      \
+    X(FSMC_IRQHandler)                              \
+    X(SDIO_IRQHandler)                              \
+    X(TIM5_IRQHandler)                              \
+    X(SPI3_IRQHandler)                              \
+    X(UART4_IRQHandler)                             \
+    X(UART5_IRQHandler)                             \
+    X(TIM6_DAC_IRQHandler)                          \
+    X(TIM7_IRQHandler)                              \
+    X(DMA2_Stream0_IRQHandler)                      \
+    X(DMA2_Stream1_IRQHandler)                      \
+    X(DMA2_Stream2_IRQHandler)                      \
+    X(DMA2_Stream3_IRQHandler)                      \
+    X(DMA2_Stream4_IRQHandler)                      \
+    X(ETH_IRQHandler)                               \
+    X(ETH_WKUP_IRQHandler)                          \
+    X(CAN2_TX_IRQHandler)                           \
+    X(CAN2_RX0_IRQHandler)                          \
+    X(CAN2_RX1_IRQHandler)                          \
+    X(CAN2_SCE_IRQHandler)                          \
+    X(OTG_FS_IRQHandler)                            \
+    X(DMA2_Stream5_IRQHandler)                      \
+    X(DMA2_Stream6_IRQHandler)                      \
+    X(DMA2_Stream7_IRQHandler)                      \
+    X(USART6_IRQHandler)                            \
+    X(I2C3_EV_IRQHandler)                           \
+    X(I2C3_ER_IRQHandler)                           \
+    X(OTG_HS_EP1_OUT_IRQHandler)                    \
+    X(OTG_HS_EP1_IN_IRQHandler)                     \
+    X(OTG_HS_WKUP_IRQHandler)                       \
+    X(OTG_HS_IRQHandler)                            \
+    X(DCMI_IRQHandler)                              \
+    X(CRYP_IRQHandler)                              \
+    X(HASH_RNG_IRQHandler)                          \
+    X(FPU_IRQHandler)
+#endif
+
+/**
+  * @brief   复位到进入main()的CPU周期数（DWT->CYCCNT），0表示main()未调用Startup_MarkMain()
+  */
+extern uint32_t Startup_Cycles;
+
+/**
+  * @brief           记录复位到main()的CPU周期数
+  * @param        None
+  * @retval          None
+  * @note           须为main()的第一条语句；汇编和C启动路径都在SystemInit()入口清零CYCCNT
+  */
+void Startup_MarkMain(void);
+
+/**
+  * @brief           复位处理函数
+  * @param        None
+  * @retval          None
+  * @note           SystemInit() → 复制.data → 清零.bss（跳过栈和NOINIT）→ main()
+  */
+void Reset_Handler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __STARTUP_H */
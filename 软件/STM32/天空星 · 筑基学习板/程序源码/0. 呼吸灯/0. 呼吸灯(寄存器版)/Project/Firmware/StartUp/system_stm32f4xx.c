@@ -475,6 +475,13 @@ static void SystemInit_ExtMemCtl(void);
   */
 void SystemInit(void)
 {
+  /* Boot timing start: zero and run DWT->CYCCNT. Both the assembly and the C
+     Reset_Handler call SystemInit() first; main() records the end point with
+     Startup_MarkMain() (see Startup.h) */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
   /* FPU settings ------------------------------------------------------------*/
   #if (__FPU_PRESENT == 1) && (__FPU_USED == 1)
     SCB->CPACR |= ((3UL << 10*2)|(3UL << 11*2));  /* set CP10 and CP11 Full Access */
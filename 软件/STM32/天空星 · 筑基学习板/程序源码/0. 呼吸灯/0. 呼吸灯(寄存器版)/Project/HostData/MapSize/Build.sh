@@ -0,0 +1,43 @@
+#!/bin/sh
+#
+# Build.sh  重新生成mapsize检查项的夹具
+#
+# 用主机gcc以32位、独立环境编译夹具源文件并按mapsize.ld链接：
+#   mapsize.elf、gcc_map.txt   当前版本（main.c、breath.c、arm_common_tables.c）
+#   gcc_old_map.txt            旧版本（定义MAPSIZE_OLD，不链接arm_common_tables.c，供diff比较）
+# keil_map.txt为按armlink格式手写的同一程序，不由本脚本生成；
+# .map文件以.txt结尾，避免被Clean.bat删除（mapsize按内容识别格式）
+#
+# 用法（在本目录下）：sh Build.sh
+# 需要gcc的-m32支持（不需要32位libc）；编译器版本不同时代码大小会变化，
+# 重新生成后按HostCheck.c中mapsize检查项的输出核对期望值
+#
+# 修改日志：
+#   - 2026-10-17 V1.0.0 初始版本
+
+CC=${CC:-gcc}
+CFLAGS="-m32 -ffreestanding -fno-pic -fno-asynchronous-unwind-tables -fno-stack-protector
+        -ffunction-sections -fdata-sections -Os"
+LDFLAGS="-m32 -nostdlib -static -no-pie -Wl,--build-id=none -T mapsize.ld"
+
+# $1 = 输出的ELF，$2 = 输出的.map，$3 = 额外的编译选项，其余为源文件名（不带.c）
+build()
+{
+    elf=$1
+    map=$2
+    opt=$3
+    shift 3
+    objs=""
+    for f in "$@"; do
+        $CC $CFLAGS $opt -c $f.c -o $f.o || return 1
+        objs="$objs $f.o"
+    done
+    $CC $LDFLAGS -Wl,-Map=$map $objs -o $elf
+    ret=$?
+    rm -f $objs
+    return $ret
+}
+
+build mapsize.elf gcc_map.txt "" main breath arm_common_tables || exit 1
+build mapsize_old.elf gcc_old_map.txt -DMAPSIZE_OLD main breath || exit 1
+rm -f mapsize_old.elf
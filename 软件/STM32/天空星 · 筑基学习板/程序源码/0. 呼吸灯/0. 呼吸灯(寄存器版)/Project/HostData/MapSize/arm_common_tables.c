@@ -0,0 +1,24 @@
+/**
+  ************************************************************************************
+  * @file              arm_common_tables.c
+  * @author         None
+  * @version       V1.0.0
+  * @date            2026-10-17
+  * @brief           mapsize检查项的夹具程序：模拟误链接进来的CMSIS-DSP表和函数
+  *
+  * @details        sinTable_f32与CMSIS-DSP中的表同名同大小（513项），供forbid和MapSize_Flag()匹配
+  *
+  * @note            只用于生成主机端夹具
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *
+  ************************************************************************************
+  */
+
+const float sinTable_f32[513] = { 0.0f, 0.0122715383f, 0.0245412285f };
+
+float arm_sin_f32(float x)
+{
+    return sinTable_f32[(unsigned int)x & 511U] * x;
+}
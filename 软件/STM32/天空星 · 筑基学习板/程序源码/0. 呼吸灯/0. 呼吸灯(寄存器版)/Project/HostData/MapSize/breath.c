@@ -0,0 +1,30 @@
+/**
+  ************************************************************************************
+  * @file              breath.c
+  * @author         None
+  * @version       V1.0.0
+  * @date            2026-10-17
+  * @brief           mapsize检查项的夹具程序：呼吸灯模块
+  *
+  * @details        cmd_reply为本地零初始化数据（ELF中按STT_FILE归入breath.c），led_state为全局已初始化数据
+  *
+  * @note            只用于生成主机端夹具
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *
+  ************************************************************************************
+  */
+
+#include <stdint.h>
+
+static uint8_t cmd_reply[160];
+
+uint32_t led_state = 1U;
+
+uint8_t Breath_Tick(uint32_t now)
+{
+    led_state ^= now;
+    cmd_reply[now % sizeof(cmd_reply)] = (uint8_t)led_state;
+    return cmd_reply[(now >> 8) % sizeof(cmd_reply)];
+}
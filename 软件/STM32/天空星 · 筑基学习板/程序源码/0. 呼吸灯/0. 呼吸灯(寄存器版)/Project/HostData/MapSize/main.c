@@ -0,0 +1,60 @@
+/**
+  ************************************************************************************
+  * @file              main.c
+  * @author         None
+  * @version       V1.0.0
+  * @date            2026-10-17
+  * @brief           mapsize检查项的夹具程序：主模块
+  *
+  * @details        与breath.c、arm_common_tables.c一起由Build.sh链接成mapsize.elf和gcc_map.txt；
+  *                        定义MAPSIZE_OLD时得到gcc_old_map.txt（接收缓冲区较小，未链接CMSIS-DSP表）
+  *
+  * @note            只用于生成主机端夹具，不加入Keil工程，也不在目标板上运行
+  *
+  * @attention     修改日志：
+  *                         - 2026-10-17 V1.0.0 初始版本
+  *
+  ************************************************************************************
+  */
+
+#include <stdint.h>
+
+#ifdef MAPSIZE_OLD
+#define UART_RX_SIZE                            512U
+#else
+#define UART_RX_SIZE                            1024U
+#endif
+
+uint8_t uart_rx[UART_RX_SIZE];
+
+static uint32_t tick = 5U;
+
+const uint16_t Key_Table[32] =
+{
+    0, 1, 3, 6, 10, 15, 21, 28, 36, 45, 55, 66, 78, 91, 105, 120,
+    136, 153, 171, 190, 210, 231, 253, 276, 300, 325, 351, 378, 406, 435, 465, 496,
+};
+
+uint8_t Breath_Tick(uint32_t now);
+#ifndef MAPSIZE_OLD
+float arm_sin_f32(float x);
+#endif
+
+int main(void)
+{
+    uint32_t i;
+
+    for(i = 0; i < UART_RX_SIZE; i++) {
+        tick += uart_rx[i] + Key_Table[i & 31U] + Breath_Tick(tick);
+    }
+#ifndef MAPSIZE_OLD
+    tick += (uint32_t)arm_sin_f32((float)tick);
+#endif
+    return (int)tick;
+}
+
+void Reset_Handler(void)
+{
+    main();
+    for(;;);
+}
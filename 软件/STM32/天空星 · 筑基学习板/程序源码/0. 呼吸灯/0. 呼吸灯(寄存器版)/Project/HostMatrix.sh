@@ -0,0 +1,72 @@
+#!/bin/sh
+#
+# HostMatrix.sh  主机端型号编译矩阵
+#
+# 对Device.h支持的每个型号宏：
+#   1. 以 -DREG_SIM -Wall -Werror 单独编译App/Src、Driver/Src下的全部源文件和Firmware/StartUp/Startup.c
+#   2. 链接hostcheck并运行全部检查项（-c 只编译，不运行）
+#
+# 用法（在Project目录下）：
+#   sh HostMatrix.sh [-c] [型号宏...]     不指定型号时依次检查全部型号
+# 任一型号编译失败或检查项失败时返回1；需要gcc（-no-pie、-pthread、-lm）
+#
+# 修改日志：
+#   - 2026-10-17 V1.0.0 初始版本
+#   - 2026-10-17 V1.1.0 hostcheck加入Trace，链接时定义TRACE_ENABLE
+#   - 2026-10-17 V1.2.0 hostcheck加入Flicker，链接libm
+#   - 2026-10-17 V1.3.0 hostcheck加入PwmStagger
+#   - 2026-10-17 V1.4.0 hostcheck加入Anim和示例动画AnimDemo
+#   - 2026-10-17 V1.5.0 hostcheck加入Pool
+#   - 2026-10-17 V1.6.0 hostcheck加入Arena，链接时定义ARENA_POISON=1
+#   - 2026-10-17 V1.7.0 hostcheck加入MapSize
+
+PARTS="STM32F40_41xxx STM32F427_437xx STM32F429_439xx STM32F401xx STM32F410xx
+       STM32F411xE STM32F412xG STM32F413_423xx STM32F446xx STM32F469_479xx"
+CC=${CC:-gcc}
+CFLAGS="-DREG_SIM -O2 -Wall -Werror -IApp/Inc -IDriver/Inc -IFirmware/StartUp"
+
+# hostcheck的源文件，与HostCheck.h中的编译命令一致
+CHECK_SRC="App/Src/HostCheck.c Driver/Src/RegSim.c Driver/Src/SimPeriph.c
+           Driver/Src/LED.c Driver/Src/Delay.c Driver/Src/Device.c Driver/Src/SyncPin.c
+           Driver/Src/Indicator.c Driver/Src/Ws2812.c Driver/Src/Matrix.c
+           Driver/Src/Charlie.c Driver/Src/Shift595.c Driver/Src/Uart.c App/Src/Cmd.c
+           App/Src/Fleet.c App/Src/Breath.c App/Src/PhaseLock.c Driver/Src/Trace.c
+           App/Src/Flicker.c App/Src/PwmStagger.c App/Src/Anim.c App/Src/AnimDemo.c
+           Driver/Src/Pool.c Driver/Src/Arena.c App/Src/MapSize.c"
+
+run=1
+if [ "$1" = "-c" ]; then
+    run=0
+    shift
+fi
+[ $# -gt 0 ] && PARTS="$*"
+
+out=$(mktemp -d) || exit 1
+trap 'rm -rf "$out"' EXIT
+fail=0
+
+for part in $PARTS; do
+    result="ok"
+    for src in App/Src/*.c Driver/Src/*.c Firmware/StartUp/Startup.c; do
+        if ! $CC $CFLAGS -D$part -c "$src" -o "$out/obj.o" 2>"$out/err.txt"; then
+            echo "$part: $src"
+            cat "$out/err.txt"
+            result="compile FAIL"
+        fi
+    done
+    if [ "$result" = "ok" ] && [ $run -eq 1 ]; then
+        if ! $CC $CFLAGS -D$part -DHOSTCHECK_MAIN -DTRACE_ENABLE -DARENA_POISON=1 -no-pie $CHECK_SRC -pthread -lm -o "$out/hostcheck" 2>"$out/err.txt"; then
+            cat "$out/err.txt"
+            result="link FAIL"
+        elif ! "$out/hostcheck" all >"$out/check.txt" 2>&1; then
+            grep "FAIL" "$out/check.txt"
+            result="check FAIL"
+        else
+            result="ok, hostcheck all PASS"
+        fi
+    fi
+    [ "${result#ok}" = "$result" ] && fail=1
+    printf "%-18s %s\n" "$part" "$result"
+done
+
+exit $fail